@@ -334,8 +334,9 @@ std::string normalizeBaseForm(const std::string& base_form, const std::vector<ch
 
 std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                           const std::vector<normalize::CharType>& char_types,
-                                                          const grammar::Inflection& inflection,
+                                                          const ChunkContext& chunk,
                                                           const dictionary::DictionaryManager* dict_manager) {
+  const grammar::Inflection& inflection = chunk.inflection();
   std::vector<UnknownCandidate> candidates;
 
   if (start_pos >= char_types.size() || char_types[start_pos] != normalize::CharType::Kanji) {
@@ -373,7 +374,7 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
   // Skip kanji + verb renyokei + すぎ pattern for MeCab compatibility
   // MeCab splits: 書きすぎる → 書き + すぎる, not as single adjective
   // Pattern: kanji + (き/ぎ/し/ち/に/び/み/り/い) + すぎ...
-  std::string hira_part = extractSubstring(codepoints, kanji_end, hiragana_end);
+  std::string_view hira_part = chunk.span(kanji_end, hiragana_end);
   // C++17 compatible: check if hiragana contains "すぎ" (6 bytes)
   if (hira_part.find("すぎ") != std::string::npos) {
     return candidates;  // Skip this candidate - force split path
@@ -404,7 +405,7 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
       }
     }
     if (!is_verb_context) {
-      std::string surface = extractSubstring(codepoints, start_pos, adj_end);
+      std::string surface(chunk.span(start_pos, adj_end));
       bool is_dict_noun = false;
       if (dict_manager != nullptr) {
         auto results = dict_manager->lookup(surface, 0);
@@ -440,7 +441,7 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
       is_adj_context = (next == U'て' || next == U'な' || next == U'も');
     }
     if (is_adj_context) {
-      std::string surface = extractSubstring(codepoints, start_pos, adj_end);
+      std::string surface(chunk.span(start_pos, adj_end));
       std::string lemma = extractSubstring(codepoints, start_pos, kanji_end) + "い";
       constexpr float kSingleKanjiKuCost = 0.52F;
       SUZUME_DEBUG_LOG_VERBOSE("[ADJ_SINGLE_KU] \"" << surface << "\" cost=" << kSingleKanjiKuCost << "\n");
@@ -451,8 +452,8 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
 
   // Try different ending lengths
   for (size_t end_pos = hiragana_end; end_pos > kanji_end; --end_pos) {
-    std::string surface = extractSubstring(codepoints, start_pos, end_pos);
-    std::string hiragana_part = extractSubstring(codepoints, kanji_end, end_pos);
+    std::string surface(chunk.span(start_pos, end_pos));
+    std::string hiragana_part(chunk.span(kanji_end, end_pos));
 
     // Skip patterns that are clearly not i-adjectives
     if (shouldSkipSimplePatterns(surface, hiragana_part, codepoints, start_pos, kanji_end, end_pos)) {
@@ -473,7 +474,7 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
     if (hiragana_part.size() >= core::kThreeJapaneseCharBytes &&
         hiragana_part.substr(0, core::kJapaneseCharBytes) == "し" &&
         hiragana_part.substr(core::kJapaneseCharBytes, core::kTwoJapaneseCharBytes) == "そう") {
-      std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+      std::string kanji_stem(chunk.span(start_pos, kanji_end));
 
       // Get adjective confidence for kanji + しい
       std::string adj_form = kanji_stem + "しい";
@@ -537,7 +538,7 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
         hiragana_part.substr(0, core::kJapaneseCharBytes) == "き" &&
         hiragana_part.substr(core::kJapaneseCharBytes, core::kTwoJapaneseCharBytes) == "そう") {
       // Construct potential verb form: kanji + く
-      std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+      std::string kanji_stem(chunk.span(start_pos, kanji_end));
       std::string verb_form = kanji_stem + "く";
       if (isVerbInDictionary(dict_manager, verb_form)) {
         continue;  // Verb exists, so this is verb renyoukei + そう, skip adjective
@@ -551,7 +552,7 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
     // 叩ければ → 叩く (verb exists) → skip adjective (叩い is not a real adjective)
     // 寒ければ → 寒い (adjective) - handled separately as hiragana_part starts with け
     if (kanji_end == start_pos + 1 && hiragana_part == "ければ") {
-      std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+      std::string kanji_stem(chunk.span(start_pos, kanji_end));
       std::string verb_form = kanji_stem + "く";
       if (isVerbInDictionary(dict_manager, verb_form)) {
         continue;  // Verb exists, this is verb potential-conditional (叩ける + ば)
@@ -754,10 +755,10 @@ std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char
         size_t hira_limit = (first_hira == U'し') ? kMaxHiraganaLen : 2;
         size_t max_end = std::min(hiragana_end, kanji_end + hira_limit);
         for (size_t end_pos = max_end; end_pos > kanji_end; --end_pos) {
-          std::string surface = extractSubstring(codepoints, start_pos, end_pos);
+          std::string surface(chunk.span(start_pos, end_pos));
           if (surface.empty())
             continue;
-          const auto& all_cands = inflection.analyze(surface);
+          const auto& all_cands = chunk.analyzeSpan(start_pos, end_pos);
           for (const auto& ic : all_cands) {
             if (ic.confidence >= 0.3F && ic.verb_type == grammar::VerbType::IAdjective) {
               constexpr float kCompoundAdjBaseCost = 0.5F;
@@ -1071,7 +1072,8 @@ std::vector<UnknownCandidate> generateNaAdjectiveCandidates(const std::vector<ch
 std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vector<char32_t>& codepoints,
                                                                   size_t start_pos,
                                                                   const std::vector<normalize::CharType>& char_types,
-                                                                  const grammar::Inflection& inflection) {
+                                                                  const ChunkContext& chunk) {
+  const grammar::Inflection& inflection = chunk.inflection();
   std::vector<UnknownCandidate> candidates;
 
   if (start_pos >= char_types.size() || char_types[start_pos] != normalize::CharType::Hiragana) {
@@ -1129,7 +1131,7 @@ std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vec
     // Use lower threshold (0.50) for particle-starting sequences to catch
     // words like かわいい (confidence=0.51)
     for (size_t end = max_hiragana_end; end > start_pos + 2; --end) {
-      std::string test_surface = extractSubstring(codepoints, start_pos, end);
+      std::string_view test_surface = chunk.span(start_pos, end);
 
       // Skip patterns ending with just く (adverbial form)
       // This prevents よろしく, わくわく from being validated as adjectives
@@ -1144,7 +1146,7 @@ std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vec
         continue;  // Skip - likely negative auxiliary, not adjective
       }
 
-      const auto& test_candidates = inflection.analyze(test_surface);
+      const auto& test_candidates = chunk.analyzeSpan(start_pos, end);
       for (const auto& cand : test_candidates) {
         if (cand.verb_type == grammar::VerbType::IAdjective && cand.confidence >= 0.50F) {
           // For particle-starting sequences, require stem length >= 2 characters
@@ -1196,7 +1198,7 @@ std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vec
 
   // Try different lengths, starting from longest
   for (size_t end_pos = hiragana_end; end_pos > start_pos + 2; --end_pos) {
-    std::string surface = extractSubstring(codepoints, start_pos, end_pos);
+    std::string surface(chunk.span(start_pos, end_pos));
 
     if (surface.empty()) {
       continue;
@@ -1535,7 +1537,7 @@ std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vec
   };
 
   // Start from maximum hiragana sequence
-  std::string full_surface = extractSubstring(codepoints, start_pos, max_hiragana_end);
+  std::string full_surface(chunk.span(start_pos, max_hiragana_end));
   for (const auto& aux_pattern : kHiraStemAuxPatterns) {
     if (full_surface.size() >=
             aux_pattern.size() + core::kTwoJapaneseCharBytes &&  // Need at least 2 chars before pattern
@@ -1619,7 +1621,7 @@ std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vec
 std::vector<UnknownCandidate> generateKatakanaAdjectiveCandidates(const std::vector<char32_t>& codepoints,
                                                                   size_t start_pos,
                                                                   const std::vector<normalize::CharType>& char_types,
-                                                                  const grammar::Inflection& inflection) {
+                                                                  const ChunkContext& chunk) {
   std::vector<UnknownCandidate> candidates;
 
   // Only process katakana-starting positions
@@ -1667,14 +1669,14 @@ std::vector<UnknownCandidate> generateKatakanaAdjectiveCandidates(const std::vec
 
   // Try different ending lengths, starting from longest
   for (size_t end_pos = hira_end; end_pos > kata_end; --end_pos) {
-    std::string surface = extractSubstring(codepoints, start_pos, end_pos);
+    std::string surface(chunk.span(start_pos, end_pos));
 
     if (surface.empty()) {
       continue;
     }
 
     // Check all candidates for IAdjective
-    const auto& all_candidates = inflection.analyze(surface);
+    const auto& all_candidates = chunk.analyzeSpan(start_pos, end_pos);
     for (const auto& cand : all_candidates) {
       // Require confidence >= 0.5 for i-adjectives
       if (cand.confidence >= 0.5F && cand.verb_type == grammar::VerbType::IAdjective) {
@@ -1836,10 +1838,11 @@ std::vector<UnknownCandidate> generateKatakanaAdjectiveCandidates(const std::vec
   return candidates;
 }
 
-std::vector<UnknownCandidate> generateAdjectiveStemCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
+std::vector<UnknownCandidate> generateAdjectiveStemCandidates(const std::vector<char32_t>& /*codepoints*/, size_t start_pos,
                                                               const std::vector<normalize::CharType>& char_types,
-                                                              const grammar::Inflection& inflection,
+                                                              const ChunkContext& chunk,
                                                               const dictionary::DictionaryManager* dict_manager) {
+  const grammar::Inflection& inflection = chunk.inflection();
   std::vector<UnknownCandidate> candidates;
 
   // Must start with kanji
@@ -1866,8 +1869,8 @@ std::vector<UnknownCandidate> generateAdjectiveStemCandidates(const std::vector<
     return candidates;
   }
 
-  std::string hiragana_part = extractSubstring(codepoints, kanji_end, hiragana_end);
-  std::string kanji_part = extractSubstring(codepoints, start_pos, kanji_end);
+  std::string hiragana_part(chunk.span(kanji_end, hiragana_end));
+  std::string kanji_part(chunk.span(start_pos, kanji_end));
   SUZUME_DEBUG_LOG_VERBOSE("[ADJ_STEM] pos=" << start_pos << " kanji=\"" << kanji_part << "\" hiragana=\""
                                              << hiragana_part << "\"\n");
 
@@ -1960,7 +1963,7 @@ std::vector<UnknownCandidate> generateAdjectiveStemCandidates(const std::vector<
 
       // Found potential i-adjective stem + garu-connection pattern
       // The stem is just the kanji portion (e.g., 高, 尊, 寒)
-      std::string stem = extractSubstring(codepoints, start_pos, kanji_end);
+      std::string stem(chunk.span(start_pos, kanji_end));
       std::string base_form = stem + "い";  // e.g., 高 → 高い
 
       // Validate that stem + い is a real i-adjective
@@ -2015,7 +2018,7 @@ std::vector<UnknownCandidate> generateAdjectiveStemCandidates(const std::vector<
 
       // Skip adjective stem when the full kanji+hiragana surface is a known verb
       // E.g., 下さい(=ください) is a verb, not adjective stem 下 + nominalization さ + い
-      std::string full_surface = extractSubstring(codepoints, start_pos, hiragana_end);
+      std::string_view full_surface = chunk.span(start_pos, hiragana_end);
       if (isVerbInDictionary(dict_manager, full_surface)) {
         SUZUME_DEBUG_LOG_VERBOSE("[ADJ_STEM]   skip: full surface \"" << full_surface << "\" is dict verb\n");
         continue;
@@ -2105,7 +2108,7 @@ std::vector<UnknownCandidate> generateAdjectiveStemCandidates(const std::vector<
       // The stem is: kanji + し
       size_t stem_end = kanji_end + 1;  // kanji + し (one hiragana)
 
-      std::string stem = extractSubstring(codepoints, start_pos, stem_end);
+      std::string stem(chunk.span(start_pos, stem_end));
       std::string base_form = stem + "い";  // e.g., 難し → 難しい
 
       // Validate that this looks like a real adjective
@@ -2130,7 +2133,7 @@ std::vector<UnknownCandidate> generateAdjectiveStemCandidates(const std::vector<
       // Also check that this is NOT a verb renyokei (話し from 話す)
       // by comparing adjective vs verb confidence
       // The verb form would be: kanji_stem + す (e.g., 話 + す = 話す)
-      std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+      std::string kanji_stem(chunk.span(start_pos, kanji_end));
       std::string verb_form = kanji_stem + "す";  // e.g., 話す (not 話しす)
       const auto& verb_results = inflection.analyze(verb_form);
       float verb_confidence = 0.0F;
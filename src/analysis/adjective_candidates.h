@@ -8,6 +8,7 @@
 
 #include <vector>
 
+#include "analysis/chunk_context.h"
 #include "core/types.h"
 #include "dictionary/dictionary.h"
 #include "grammar/inflection.h"
@@ -27,13 +28,13 @@ struct UnknownOptions;
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for conjugation detection
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @param dict_manager Dictionary manager for base form validation (optional)
  * @return Vector of candidates
  */
 std::vector<UnknownCandidate> generateAdjectiveCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                           const std::vector<normalize::CharType>& char_types,
-                                                          const grammar::Inflection& inflection,
+                                                          const ChunkContext& chunk,
                                                           const dictionary::DictionaryManager* dict_manager = nullptr);
 
 /**
@@ -61,13 +62,13 @@ std::vector<UnknownCandidate> generateNaAdjectiveCandidates(const std::vector<ch
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for conjugation detection
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @return Vector of candidates
  */
 std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vector<char32_t>& codepoints,
                                                                   size_t start_pos,
                                                                   const std::vector<normalize::CharType>& char_types,
-                                                                  const grammar::Inflection& inflection);
+                                                                  const ChunkContext& chunk);
 
 /**
  * @brief Generate katakana i-adjective candidates (e.g., エモい, キモい, ウザい)
@@ -79,13 +80,13 @@ std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(const std::vec
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for conjugation detection
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @return Vector of candidates
  */
 std::vector<UnknownCandidate> generateKatakanaAdjectiveCandidates(const std::vector<char32_t>& codepoints,
                                                                   size_t start_pos,
                                                                   const std::vector<normalize::CharType>& char_types,
-                                                                  const grammar::Inflection& inflection);
+                                                                  const ChunkContext& chunk);
 
 /**
  * @brief Generate i-adjective STEM candidates (e.g., 難し, 美し, 楽し)
@@ -102,13 +103,13 @@ std::vector<UnknownCandidate> generateKatakanaAdjectiveCandidates(const std::vec
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for stem validation
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @param dict_manager Dictionary manager for verb lookup (to filter verb renyokei)
  * @return Vector of candidates (adjective stems only)
  */
 std::vector<UnknownCandidate> generateAdjectiveStemCandidates(
     const std::vector<char32_t>& codepoints, size_t start_pos, const std::vector<normalize::CharType>& char_types,
-    const grammar::Inflection& inflection, const dictionary::DictionaryManager* dict_manager = nullptr);
+    const ChunkContext& chunk, const dictionary::DictionaryManager* dict_manager = nullptr);
 
 }  // namespace suzume::analysis
 
@@ -1,7 +1,10 @@
 #include "analysis/analyzer.h"
 
 #include <algorithm>
+#include <iterator>
+#include <type_traits>
 
+#include "analysis/sentence_boundary.h"
 #include "core/debug.h"
 #include "normalize/char_type.h"
 #include "normalize/utf8.h"
@@ -14,35 +17,6 @@ namespace {
 // Keeps Viterbi memory under ~3MB per chunk.
 constexpr size_t kMaxChunkBytes = 32768;
 
-// Check if byte position is a sentence boundary character.
-// Returns the number of bytes to include (0 if not a boundary).
-inline size_t sentenceBoundaryLen(std::string_view text, size_t pos) {
-  auto c = static_cast<unsigned char>(text[pos]);
-  // ASCII: \n, !, ?
-  if (c == '\n' || c == '!' || c == '?') {
-    return 1;
-  }
-  // 3-byte UTF-8 sequences
-  if (pos + 2 < text.size() && c == 0xE3) {
-    auto c1 = static_cast<unsigned char>(text[pos + 1]);
-    auto c2 = static_cast<unsigned char>(text[pos + 2]);
-    // 。(U+3002) = E3 80 82
-    if (c1 == 0x80 && c2 == 0x82)
-      return 3;
-  }
-  if (pos + 2 < text.size() && c == 0xEF) {
-    auto c1 = static_cast<unsigned char>(text[pos + 1]);
-    auto c2 = static_cast<unsigned char>(text[pos + 2]);
-    // ！(U+FF01) = EF BC 81
-    if (c1 == 0xBC && c2 == 0x81)
-      return 3;
-    // ？(U+FF1F) = EF BC 9F
-    if (c1 == 0xBC && c2 == 0x9F)
-      return 3;
-  }
-  return 0;
-}
-
 // Find the last UTF-8 character boundary at or before pos.
 inline size_t findUtf8Boundary(std::string_view text, size_t pos) {
   while (pos > 0 && (static_cast<unsigned char>(text[pos]) & 0xC0) == 0x80) {
@@ -51,6 +25,130 @@ inline size_t findUtf8Boundary(std::string_view text, size_t pos) {
   return pos;
 }
 
+// Shift morpheme character offsets by delta.
+inline void addCharOffset(std::vector<core::Morpheme>& morphemes, size_t delta) {
+  if (delta == 0) {
+    return;
+  }
+  for (auto& morpheme : morphemes) {
+    morpheme.start += delta;
+    morpheme.end += delta;
+    morpheme.start_pos += delta;
+    morpheme.end_pos += delta;
+  }
+}
+
+// FNV-1a over option values; see optionsFingerprint().
+class FingerprintBuilder {
+ public:
+  template <typename T>
+  void add(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "options are hashed by value bytes");
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+    for (size_t idx = 0; idx < sizeof(T); ++idx) {
+      value_ = (value_ ^ bytes[idx]) * 0x100000001b3ULL;
+    }
+  }
+
+  uint64_t value() const { return value_; }
+
+ private:
+  uint64_t value_{0xcbf29ce484222325ULL};
+};
+
+// Structs mixing member sizes have padding with unspecified contents, so
+// they are hashed member by member; structs of only floats (or only size_t)
+// have none and are hashed whole.
+uint64_t fingerprintOptions(const AnalyzerOptions& options) {
+  FingerprintBuilder builder;
+
+  const ScorerOptions& scorer = options.scorer_options;
+  for (float value : {scorer.noun_prior, scorer.verb_prior, scorer.adj_prior, scorer.adv_prior, scorer.particle_prior,
+                      scorer.aux_prior, scorer.pronoun_prior, scorer.single_kanji_penalty,
+                      scorer.single_hiragana_penalty, scorer.symbol_penalty, scorer.formal_noun_penalty,
+                      scorer.low_info_penalty, scorer.dictionary_bonus, scorer.user_dict_bonus,
+                      scorer.optimal_length_bonus}) {
+    builder.add(value);
+  }
+  builder.add(scorer.optimal_length);
+  builder.add(scorer.bigram);
+  builder.add(scorer.candidates.join);
+  builder.add(scorer.candidates.split);
+  builder.add(scorer.candidates.verb);
+  builder.add(scorer.inflection);
+
+  // inflection_cache_capacity only bounds memory
+  const UnknownOptions& unknown = options.unknown_options;
+  for (size_t value : {unknown.max_kanji_length, unknown.max_katakana_length, unknown.max_alphabet_length,
+                       unknown.max_alphanumeric_length, unknown.max_hiragana_length, unknown.max_unknown_length,
+                       unknown.max_character_speech_length}) {
+    builder.add(value);
+  }
+  builder.add(unknown.separate_suffix);
+  builder.add(unknown.suffix_separation_bonus);
+  builder.add(unknown.enable_character_speech);
+  builder.add(unknown.character_speech_cost);
+  builder.add(unknown.verb_candidate_options);
+
+  builder.add(options.normalize_options.preserve_vu);
+  builder.add(options.normalize_options.preserve_case);
+
+  builder.add(options.max_edges_per_position);
+  builder.add(options.max_edges_per_chunk);
+  builder.add(options.deadline.count());
+  return builder.value();
+}
+
+// Move morphemes to the end of dst.
+inline void appendMorphemes(std::vector<core::Morpheme>& dst, std::vector<core::Morpheme>& src) {
+  if (dst.empty()) {
+    dst = std::move(src);
+    return;
+  }
+  dst.insert(dst.end(), std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()));
+}
+
+// Extend each path with each alternative for the next piece of text, keeping
+// k combinations. Index 0 of both lists is the Viterbi best path, so best +
+// best stays first and the rest are the cheapest other combinations. An
+// empty tail list leaves paths unchanged.
+void extendNBest(std::vector<NBestPath>& paths, std::vector<NBestPath>& tails, size_t k) {
+  if (tails.empty()) {
+    return;
+  }
+  struct Combination {
+    float cost;
+    size_t head;
+    size_t tail;
+  };
+  std::vector<Combination> combinations;
+  combinations.reserve(paths.size() * tails.size());
+  for (size_t head = 0; head < paths.size(); ++head) {
+    for (size_t tail = 0; tail < tails.size(); ++tail) {
+      combinations.push_back({paths[head].cost + tails[tail].cost, head, tail});
+    }
+  }
+  size_t keep = std::min(k, combinations.size());
+  std::partial_sort(combinations.begin() + 1, combinations.begin() + static_cast<std::ptrdiff_t>(keep),
+                    combinations.end(), [](const Combination& lhs, const Combination& rhs) {
+                      if (lhs.cost != rhs.cost) {
+                        return lhs.cost < rhs.cost;
+                      }
+                      return lhs.head != rhs.head ? lhs.head < rhs.head : lhs.tail < rhs.tail;
+                    });
+
+  std::vector<NBestPath> extended(keep);
+  for (size_t idx = 0; idx < keep; ++idx) {
+    const Combination& combo = combinations[idx];
+    extended[idx].cost = combo.cost;
+    extended[idx].morphemes.reserve(paths[combo.head].morphemes.size() + tails[combo.tail].morphemes.size());
+    extended[idx].morphemes = paths[combo.head].morphemes;
+    extended[idx].morphemes.insert(extended[idx].morphemes.end(), tails[combo.tail].morphemes.begin(),
+                                   tails[combo.tail].morphemes.end());
+  }
+  paths = std::move(extended);
+}
+
 // Count UTF-8 characters in a byte range.
 inline size_t countChars(std::string_view text, size_t from, size_t to) {
   size_t count = 0;
@@ -70,8 +168,14 @@ Analyzer::Analyzer(const AnalyzerOptions& options)
       pretokenizer_(),
       scorer_(options.scorer_options),
       unknown_gen_(options.unknown_options, &dict_manager_),
-      tokenizer_(nullptr) {
+      tokenizer_(nullptr),
+      sentence_cache_(options.sentence_cache),
+      options_fingerprint_(fingerprintOptions(options)) {
   tokenizer_ = std::make_unique<Tokenizer>(dict_manager_, scorer_, unknown_gen_, options_.mode);
+  if (!sentence_cache_ && options_.sentence_cache_capacity > 0) {
+    sentence_cache_ =
+        std::make_shared<SentenceCache>(options_.sentence_cache_capacity, options_.sentence_cache_max_bytes);
+  }
 }
 
 Analyzer::~Analyzer() = default;
@@ -103,19 +207,65 @@ void Analyzer::setMode(core::AnalysisMode mode) {
   tokenizer_ = std::make_unique<Tokenizer>(dict_manager_, scorer_, unknown_gen_, options_.mode);
 }
 
+core::MemoryUsage Analyzer::memoryUsage() const {
+  core::MemoryUsage usage = dict_manager_.memoryUsage();
+  usage.inflection_cache = unknown_gen_.inflection().cacheMemoryUsage();
+  if (sentence_cache_) {
+    usage.sentence_cache = sentence_cache_->stats().memory_bytes;
+  }
+  usage.scratch = viterbi_.bufferBytes() + tokenizer_->entryWordCostBytes();
+  return usage;
+}
+
 std::vector<core::Morpheme> Analyzer::analyze(std::string_view text) const {
-  if (text.empty()) {
+  std::vector<core::Morpheme> result;
+  analyzeText(text, Output{&result, nullptr, nullptr, 0});
+  return result;
+}
+
+void Analyzer::analyzeInto(std::string_view text, std::vector<core::Morpheme>& out) const {
+  out.clear();
+  analyzeText(text, Output{&out, nullptr, nullptr, 0});
+}
+
+MultiGranularResult Analyzer::analyzeMultiGranular(std::string_view text) const {
+  MultiGranularResult result;
+  analyzeText(text, Output{&result.coarse, &result.fine, nullptr, 0});
+  return result;
+}
+
+std::vector<NBestPath> Analyzer::analyzeNBest(std::string_view text, size_t k) const {
+  if (k == 0) {
     return {};
   }
+  std::vector<NBestPath> paths(1);
+  analyzeText(text, Output{nullptr, nullptr, &paths, k});
+  if (paths.size() == 1 && paths[0].morphemes.empty()) {
+    paths.clear();
+  }
+  return paths;
+}
+
+void Analyzer::analyzeText(std::string_view text, const Output& call_out) const {
+  ++stats_.analyze_calls;
+  stats_.input_bytes += text.size();
+  if (text.empty()) {
+    return;
+  }
+
+  Output out = call_out;
+  if (options_.deadline.count() > 0) {
+    out.deadline = std::chrono::steady_clock::now() + options_.deadline;
+  }
 
   // Short text: process directly
   if (text.size() <= kMaxChunkBytes) {
-    return analyzeWithPretokenizer(text, 0);
+    analyzeWithPretokenizer(text, 0, out);
+    return;
   }
 
   // Long text: split at sentence boundaries before pretokenizer
   // This prevents pretokenizer from scanning 100MB+ in one pass.
-  std::vector<core::Morpheme> result;
   size_t pos = 0;
   size_t char_pos = 0;
 
@@ -145,33 +295,31 @@ std::vector<core::Morpheme> Analyzer::analyze(std::string_view text) const {
       }
     }
 
-    auto morphemes = analyzeWithPretokenizer(text.substr(pos, chunk_end - pos), char_pos);
-    for (auto& m : morphemes) {
-      result.push_back(std::move(m));
-    }
+    analyzeWithPretokenizer(text.substr(pos, chunk_end - pos), char_pos, out);
 
     char_pos += countChars(text, pos, chunk_end);
     pos = chunk_end;
   }
-
-  return result;
 }
 
-std::vector<core::Morpheme> Analyzer::analyzeWithPretokenizer(std::string_view text, size_t base_char_offset) const {
+void Analyzer::analyzeWithPretokenizer(std::string_view text, size_t base_char_offset, const Output& out) const {
   if (text.empty()) {
-    return {};
+    return;
   }
 
   // Run pretokenizer
-  auto pretoken_result = pretokenizer_.process(text);
+  auto pretoken_result = [&] {
+    core::ScopedStageTimer timer(&stats_.stage(core::AnalysisStage::Pretokenize));
+    return pretokenizer_.process(text);
+  }();
 
   // If no pretokens found, just analyze normally
   if (pretoken_result.tokens.empty()) {
-    return analyzeSpan(text, base_char_offset);
+    analyzeSpan(text, base_char_offset, out);
+    return;
   }
 
   // Merge pretokens and analyzed spans
-  std::vector<core::Morpheme> result;
 
   // Track current position for character offset calculation
   size_t current_byte = 0;
@@ -231,34 +379,32 @@ std::vector<core::Morpheme> Analyzer::analyzeWithPretokenizer(std::string_view t
       morpheme.end = base_char_offset + end_char;
       morpheme.is_from_dictionary = false;
       morpheme.is_unknown = false;
-      result.push_back(std::move(morpheme));
+      emitMorpheme(out, std::move(morpheme));
     } else {
       // Analyze span
       const auto& span = pretoken_result.spans[item.index];
       std::string_view span_text = text.substr(span.start, span.end - span.start);
-      auto span_morphemes = analyzeSpan(span_text, char_offset);
-
-      for (auto& morph : span_morphemes) {
-        result.push_back(std::move(morph));
-      }
+      analyzeSpan(span_text, char_offset, out);
     }
   }
-
-  return result;
 }
 
-std::vector<core::Morpheme> Analyzer::analyzeSpan(std::string_view text, size_t char_offset) const {
+void Analyzer::analyzeSpan(std::string_view text, size_t char_offset, const Output& out) const {
   if (text.empty()) {
-    return {};
+    return;
   }
 
   // Short text: analyze directly without chunking overhead
   if (text.size() <= kMaxChunkBytes) {
-    return analyzeChunk(text, char_offset);
+    analyzeChunk(text, char_offset, out);
+    return;
   }
 
+  analyzeChunked(text, char_offset, out);
+}
+
+void Analyzer::analyzeChunked(std::string_view text, size_t char_offset, const Output& out) const {
   // Long text: split at sentence boundaries to bound memory usage
-  std::vector<core::Morpheme> result;
   size_t pos = 0;
   size_t char_pos = 0;
 
@@ -293,44 +439,77 @@ std::vector<core::Morpheme> Analyzer::analyzeSpan(std::string_view text, size_t
     }
 
     // Analyze this chunk
-    auto morphemes = analyzeChunk(text.substr(pos, chunk_end - pos), char_offset + char_pos);
-    for (auto& m : morphemes) {
-      result.push_back(std::move(m));
-    }
+    analyzeChunk(text.substr(pos, chunk_end - pos), char_offset + char_pos, out);
 
     // Count characters in this chunk for offset tracking
     char_pos += countChars(text, pos, chunk_end);
     pos = chunk_end;
   }
-
-  return result;
 }
 
-std::vector<core::Morpheme> Analyzer::analyzeChunk(std::string_view text, size_t char_offset) const {
+void Analyzer::analyzeChunk(std::string_view text, size_t char_offset, const Output& out) const {
   if (text.empty()) {
-    return {};
+    return;
   }
 
   // Normalize text
-  auto norm_result = normalizer_.normalize(text);
+  auto norm_result = [&] {
+    core::ScopedStageTimer timer(&stats_.stage(core::AnalysisStage::Normalize));
+    return normalizer_.normalize(text);
+  }();
   if (!core::isSuccess(norm_result)) {
     SUZUME_DEBUG_BLOCK {
       auto& error = std::get<core::Error>(norm_result);
       SUZUME_DEBUG_STREAM << "[ANALYZER] Normalization failed: " << error.message
                           << " (code=" << static_cast<int>(error.code) << ")\n";
     }
-    return {};
+    return;
   }
   std::string normalized = std::get<std::string>(norm_result);
   if (normalized.empty()) {
-    return {};
+    return;
+  }
+
+  // Multi-granular analysis decodes one lattice twice: the primary (coarse)
+  // view hides fine-only fallback edges, the fine view hides join candidates
+  const bool multi = out.fine != nullptr;
+  core::AnalysisMode primary_mode = options_.mode;
+  if (multi && primary_mode == core::AnalysisMode::Split) {
+    primary_mode = core::AnalysisMode::Normal;
+  }
+
+  // Sentence cache: results are stored with chunk-relative offsets
+  SentenceCacheKey cache_key{normalized, primary_mode, dict_manager_.generation(), options_fingerprint_};
+  SentenceCacheKey fine_cache_key{normalized, core::AnalysisMode::Split, dict_manager_.generation(),
+                                  options_fingerprint_};
+  const bool use_cache = sentence_cache_ && out.nbest == nullptr;
+  if (use_cache) {
+    std::vector<core::Morpheme> cached;
+    std::vector<core::Morpheme> cached_fine;
+    auto lookup = [this](const SentenceCacheKey& key, std::vector<core::Morpheme>& found) {
+      ++stats_.cache_lookups;
+      if (!sentence_cache_->lookup(key, found)) {
+        return false;
+      }
+      ++stats_.cache_hits;
+      return true;
+    };
+    if (lookup(cache_key, cached) && (!multi || lookup(fine_cache_key, cached_fine))) {
+      addCharOffset(cached, char_offset);
+      appendMorphemes(*out.primary, cached);
+      if (multi) {
+        addCharOffset(cached_fine, char_offset);
+        appendMorphemes(*out.fine, cached_fine);
+      }
+      return;
+    }
   }
 
   // Decode to codepoints
   std::vector<char32_t> codepoints = normalize::utf8::decode(normalized);
   if (codepoints.empty()) {
     SUZUME_DEBUG_LOG("[ANALYZER] UTF-8 decode failed\n");
-    return {};
+    return;
   }
 
   // Get character types
@@ -341,7 +520,18 @@ std::vector<core::Morpheme> Analyzer::analyzeChunk(std::string_view text, size_t
   }
 
   // Build lattice
-  core::Lattice lattice = tokenizer_->buildLattice(normalized, codepoints, char_types);
+  ++stats_.chunks;
+  LatticeBudget budget;
+  budget.max_edges_per_position = options_.max_edges_per_position;
+  budget.max_edges_per_chunk = options_.max_edges_per_chunk;
+  budget.deadline = out.deadline;
+  bool degraded = false;
+  core::Lattice lattice = [&] {
+    core::ScopedStageTimer timer(&stats_.stage(core::AnalysisStage::LatticeBuild));
+    return tokenizer_->buildLattice(normalized, codepoints, char_types, &stats_, options_.time_generators, multi,
+                                    budget, &degraded);
+  }();
+  stats_.lattice_edges += lattice.edgeCount();
 
   // Check if lattice is valid
   if (!lattice.isValid()) {
@@ -352,53 +542,101 @@ std::vector<core::Morpheme> Analyzer::analyzeChunk(std::string_view text, size_t
     morpheme.end_pos = char_offset + codepoints.size();
     morpheme.start = char_offset;
     morpheme.end = char_offset + codepoints.size();
-    return {morpheme};
+    if (degraded) {
+      ++stats_.degraded_chunks;
+    }
+    emitMorpheme(out, std::move(morpheme));
+    return;
   }
 
-  // Run Viterbi
-  core::ViterbiResult vresult = viterbi_.solve(lattice, scorer_);
-
-  // Convert to morphemes with offset adjustment
-  std::vector<core::Morpheme> morphemes;
-  morphemes.reserve(vresult.path.size());
-
-  for (size_t edge_id : vresult.path) {
-    const core::LatticeEdge& edge = lattice.getEdge(edge_id);
+  core::ViterbiResult vresult;
+  core::ViterbiResult fine_vresult;
+  std::vector<core::ViterbiResult> nbest_results;
+  {
+    core::ScopedStageTimer timer(&stats_.stage(core::AnalysisStage::Viterbi));
 
-    core::Morpheme morpheme;
-    morpheme.surface = std::string(edge.surface);
-    morpheme.pos = edge.pos;
-    morpheme.extended_pos = edge.extended_pos;
-    morpheme.start = char_offset + edge.start;
-    morpheme.end = char_offset + edge.end;
-    morpheme.start_pos = char_offset + edge.start;
-    morpheme.end_pos = char_offset + edge.end;
+    // Drop duplicate/dominated edges emitted by overlapping generators
+    size_t pruned =
+        lattice.pruneDominatedEdges([this](const core::LatticeEdge& edge) { return scorer_.wordCost(edge); });
+    stats_.pruned_edges += pruned;
+    SUZUME_DEBUG_IF(pruned > 0) {
+      SUZUME_DEBUG_STREAM << "[ANALYZER] Pruned " << pruned << " dominated edges (" << lattice.edgeCount()
+                          << " remain)\n";
+    }
 
-    if (!edge.lemma.empty()) {
-      morpheme.lemma = std::string(edge.lemma);
+    if (out.nbest != nullptr) {
+      nbest_results = viterbi_.solveNBest(lattice, scorer_, out.nbest_k);
     } else {
-      morpheme.lemma = morpheme.surface;
+      // Run Viterbi
+      vresult = viterbi_.solve(lattice, scorer_, multi ? core::LatticeEdge::kFineOnly : 0, out.deadline);
+      degraded = degraded || vresult.degraded;
+    }
+    if (multi) {
+      fine_vresult = viterbi_.solve(lattice, scorer_, core::LatticeEdge::kCoarseOnly, out.deadline);
+      degraded = degraded || fine_vresult.degraded;
     }
+  }
+  if (degraded) {
+    ++stats_.degraded_chunks;
+  }
+  // A degraded result depends on timing and load; keep it out of the cache
+  const bool cache_result = use_cache && !degraded;
 
-    morpheme.features.is_dictionary = edge.fromDictionary();
-    morpheme.features.is_user_dict = edge.fromUserDict();
-    morpheme.features.is_formal_noun = edge.isFormalNoun();
-    morpheme.features.is_low_info = edge.isLowInfo();
-    morpheme.features.score = edge.cost;
-    morpheme.is_from_dictionary = edge.fromDictionary();
-    morpheme.is_unknown = edge.isUnknown();
-    morpheme.conj_type = edge.conj_type;
+  if (out.nbest != nullptr) {
+    std::vector<NBestPath> tails(nbest_results.size());
+    for (size_t idx = 0; idx < nbest_results.size(); ++idx) {
+      tails[idx].morphemes = pathToMorphemes(nbest_results[idx], lattice, normalized);
+      tails[idx].cost = nbest_results[idx].total_cost;
+      addCharOffset(tails[idx].morphemes, char_offset);
+    }
+    extendNBest(*out.nbest, tails, out.nbest_k);
+    return;
+  }
 
-    morphemes.push_back(std::move(morpheme));
+  // Convert to morphemes; without a cache copy to keep, stream the path straight into the output
+  if (!cache_result) {
+    appendPath(vresult, lattice, char_offset, *out.primary);
+  } else {
+    // Cached morphemes are chunk-relative, shifted to char_offset below
+    std::vector<core::Morpheme> morphemes = pathToMorphemes(vresult, lattice, normalized);
+    sentence_cache_->insert(cache_key, morphemes);
+    addCharOffset(morphemes, char_offset);
+    appendMorphemes(*out.primary, morphemes);
   }
 
-  return morphemes;
+  if (multi) {
+    std::vector<core::Morpheme> fine_morphemes = pathToMorphemes(fine_vresult, lattice, normalized);
+    if (cache_result) {
+      sentence_cache_->insert(fine_cache_key, fine_morphemes);
+    }
+    addCharOffset(fine_morphemes, char_offset);
+    appendMorphemes(*out.fine, fine_morphemes);
+  }
+}
+
+void Analyzer::emitMorpheme(const Output& out, core::Morpheme morpheme) {
+  if (out.nbest != nullptr) {
+    std::vector<NBestPath> tails(1);
+    tails[0].morphemes.push_back(std::move(morpheme));
+    extendNBest(*out.nbest, tails, out.nbest_k);
+    return;
+  }
+  if (out.fine != nullptr) {
+    out.fine->push_back(morpheme);
+  }
+  out.primary->push_back(std::move(morpheme));
 }
 
 std::vector<core::Morpheme> Analyzer::pathToMorphemes(const core::ViterbiResult& result, const core::Lattice& lattice,
                                                       std::string_view /*original_text*/) {
   std::vector<core::Morpheme> morphemes;
-  morphemes.reserve(result.path.size());
+  appendPath(result, lattice, 0, morphemes);
+  return morphemes;
+}
+
+void Analyzer::appendPath(const core::ViterbiResult& result, const core::Lattice& lattice, size_t char_offset,
+                          std::vector<core::Morpheme>& morphemes) {
+  morphemes.reserve(morphemes.size() + result.path.size());
 
   for (size_t edge_id : result.path) {
     const core::LatticeEdge& edge = lattice.getEdge(edge_id);
@@ -407,13 +645,14 @@ std::vector<core::Morpheme> Analyzer::pathToMorphemes(const core::ViterbiResult&
     morpheme.surface = std::string(edge.surface);
     morpheme.pos = edge.pos;
     morpheme.extended_pos = edge.extended_pos;
-    morpheme.start = edge.start;
-    morpheme.end = edge.end;
-    morpheme.start_pos = edge.start;
-    morpheme.end_pos = edge.end;
+    morpheme.start = edge.start + char_offset;
+    morpheme.end = edge.end + char_offset;
+    morpheme.start_pos = morpheme.start;
+    morpheme.end_pos = morpheme.end;
 
     if (!edge.lemma.empty()) {
       morpheme.lemma = std::string(edge.lemma);
+      morpheme.lemma_source = edge.fromDictionary() ? core::LemmaSource::Dictionary : core::LemmaSource::Candidate;
     } else {
       morpheme.lemma = morpheme.surface;
     }
@@ -429,8 +668,6 @@ std::vector<core::Morpheme> Analyzer::pathToMorphemes(const core::ViterbiResult&
 
     morphemes.push_back(std::move(morpheme));
   }
-
-  return morphemes;
 }
 
 std::vector<core::Morpheme> Analyzer::analyzeDebug(std::string_view text, core::Lattice* out_lattice) const {
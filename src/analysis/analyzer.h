@@ -1,14 +1,18 @@
 #ifndef SUZUME_ANALYSIS_ANALYZER_H_
 #define SUZUME_ANALYSIS_ANALYZER_H_
 
+#include <chrono>
 #include <memory>
 #include <string_view>
 #include <vector>
 
 #include "analysis/scorer.h"
+#include "analysis/sentence_cache.h"
 #include "analysis/tokenizer.h"
 #include "analysis/unknown.h"
+#include "core/memory_usage.h"
 #include "core/morpheme.h"
+#include "core/stats.h"
 #include "core/types.h"
 #include "core/viterbi.h"
 #include "dictionary/dictionary.h"
@@ -26,6 +30,46 @@ struct AnalyzerOptions {
   ScorerOptions scorer_options;
   UnknownOptions unknown_options;
   normalize::NormalizeOptions normalize_options;
+
+  // Sentence result cache (disabled when capacity is 0 and no cache is given).
+  // Results are cached per analysis chunk, so enabling the cache never
+  // changes segmentation. Pass a SharedSentenceCache to share it between
+  // analyzers running on different threads. sentence_cache_max_bytes also
+  // bounds the owned cache by approximate heap usage (0 = entries only).
+  size_t sentence_cache_capacity = 0;
+  size_t sentence_cache_max_bytes = 0;
+  std::shared_ptr<SentenceCache> sentence_cache;
+
+  // Time every candidate generator call (per position; off by default).
+  // Stage timers and edge counters are always collected.
+  bool time_generators = false;
+
+  // Work budgets for untrusted input (0 = unlimited; see LatticeBudget). The
+  // deadline is wall-clock time per analyze call; chunks reaching it are
+  // finished from dictionary candidates only. Such degraded chunks are
+  // counted in AnalysisStats::degraded_chunks and not cached.
+  size_t max_edges_per_position = 0;
+  size_t max_edges_per_chunk = 0;
+  std::chrono::microseconds deadline{0};
+};
+
+/**
+ * @brief Coarse and fine segmentation of the same text
+ *
+ * Both streams use the same character offsets, so tokens can be aligned by
+ * start/end position.
+ */
+struct MultiGranularResult {
+  std::vector<core::Morpheme> coarse;  // Normal/Search granularity
+  std::vector<core::Morpheme> fine;    // Split granularity
+};
+
+/**
+ * @brief One segmentation from N-best analysis
+ */
+struct NBestPath {
+  std::vector<core::Morpheme> morphemes;
+  float cost{0.0F};  // Total lattice path cost (lower is better)
 };
 
 /**
@@ -66,6 +110,40 @@ class Analyzer {
    */
   std::vector<core::Morpheme> analyze(std::string_view text) const;
 
+  /**
+   * @brief Analyze text into a caller-owned buffer
+   *
+   * Same result as analyze(); out is cleared first and its capacity is
+   * reused, so repeated calls with one buffer do not reallocate it.
+   */
+  void analyzeInto(std::string_view text, std::vector<core::Morpheme>& out) const;
+
+  /**
+   * @brief Analyze text at coarse and fine granularity in one pass
+   *
+   * Each chunk's lattice is built once with every candidate generator and
+   * decoded twice: with all edges for the coarse stream (as in Normal mode)
+   * and without join candidates for the fine stream (as in Split mode).
+   * When the analyzer is in Split mode the coarse stream uses Normal
+   * segmentation.
+   */
+  MultiGranularResult analyzeMultiGranular(std::string_view text) const;
+
+  /**
+   * @brief Enumerate the k cheapest segmentations of text
+   *
+   * Each chunk's lattice is decoded with Viterbi::solveNBest() and the
+   * per-chunk lists are combined into k whole-text paths. The first path is
+   * always the analyze() result; the rest are the cheapest alternatives.
+   * Pretokens (URLs, dates, ...) are fixed and add no cost. The sentence
+   * cache is bypassed since it only holds best paths.
+   *
+   * @param text UTF-8 text
+   * @param k Maximum number of paths
+   * @return Best path followed by up to k-1 alternatives in ascending cost order
+   */
+  std::vector<NBestPath> analyzeNBest(std::string_view text, size_t k) const;
+
   /**
    * @brief Debug analyze - returns lattice information for debugging
    * @param text UTF-8 text
@@ -93,6 +171,43 @@ class Analyzer {
 
   dictionary::DictionaryManager& dictionaryManager() { return dict_manager_; }
 
+  /**
+   * @brief Inflection analyzer used for candidate generation
+   *
+   * Shared with the lemmatizer so both use one analysis cache.
+   */
+  const grammar::Inflection& inflection() const { return unknown_gen_.inflection(); }
+
+  /**
+   * @brief Sentence result cache (nullptr if disabled)
+   */
+  const SentenceCache* sentenceCache() const { return sentence_cache_.get(); }
+
+  /**
+   * @brief Hash of the options that affect analysis results
+   *
+   * Covers scorer, unknown-word and normalization options and the work
+   * budgets (not the mode, which is keyed separately). Part of every
+   * sentence cache key, so analyzers sharing a cache only reuse entries
+   * produced with equal options.
+   */
+  uint64_t optionsFingerprint() const { return options_fingerprint_; }
+
+  /**
+   * @brief Cumulative stage timers and counters since construction or resetStats()
+   */
+  const core::AnalysisStats& stats() const { return stats_; }
+
+  /**
+   * @brief Reset all counters to zero
+   */
+  void resetStats() { stats_ = {}; }
+
+  /**
+   * @brief Approximate heap usage of dictionaries, caches and scratch buffers
+   */
+  core::MemoryUsage memoryUsage() const;
+
  private:
   AnalyzerOptions options_;
   normalize::Normalizer normalizer_;
@@ -102,11 +217,36 @@ class Analyzer {
   UnknownWordGenerator unknown_gen_;
   std::unique_ptr<Tokenizer> tokenizer_;
   core::Viterbi viterbi_;
+  std::shared_ptr<SentenceCache> sentence_cache_;
+  uint64_t options_fingerprint_{0};
+  mutable core::AnalysisStats stats_;
+
+  /**
+   * @brief Destination of the analysis helpers below
+   *
+   * Morphemes are appended to primary; fine is non-null only for
+   * multi-granular analysis and receives the Split-granularity stream.
+   * For N-best analysis primary is null and every piece of text extends
+   * the nbest_k cheapest paths in nbest instead. deadline is the end of
+   * the call's wall-clock budget (default-constructed if none).
+   */
+  struct Output {
+    std::vector<core::Morpheme>* primary;
+    std::vector<core::Morpheme>* fine;
+    std::vector<NBestPath>* nbest;
+    size_t nbest_k;
+    std::chrono::steady_clock::time_point deadline{};
+  };
+
+  /**
+   * @brief Split long text into pretokenizer-sized pieces and analyze them
+   */
+  void analyzeText(std::string_view text, const Output& out) const;
 
   /**
    * @brief Analyze a chunk with pretokenization (URL/date/etc. extraction)
    */
-  std::vector<core::Morpheme> analyzeWithPretokenizer(std::string_view text, size_t char_offset) const;
+  void analyzeWithPretokenizer(std::string_view text, size_t char_offset, const Output& out) const;
 
   /**
    * @brief Analyze a text span (without pretokenization)
@@ -114,18 +254,34 @@ class Analyzer {
    * For long text, automatically splits into sentence-level chunks
    * to keep memory usage bounded (Viterbi scales O(n) with text length).
    */
-  std::vector<core::Morpheme> analyzeSpan(std::string_view text, size_t char_offset) const;
+  void analyzeSpan(std::string_view text, size_t char_offset, const Output& out) const;
+
+  /**
+   * @brief Split a span into size-bounded chunks at sentence boundaries
+   */
+  void analyzeChunked(std::string_view text, size_t char_offset, const Output& out) const;
 
   /**
    * @brief Analyze a single chunk (no further splitting)
    */
-  std::vector<core::Morpheme> analyzeChunk(std::string_view text, size_t char_offset) const;
+  void analyzeChunk(std::string_view text, size_t char_offset, const Output& out) const;
+
+  /**
+   * @brief Append a fixed morpheme (pretoken or fallback) to the output
+   */
+  static void emitMorpheme(const Output& out, core::Morpheme morpheme);
 
   /**
    * @brief Convert Viterbi result to morphemes
    */
   static std::vector<core::Morpheme> pathToMorphemes(const core::ViterbiResult& result, const core::Lattice& lattice,
                                                      std::string_view original_text);
+
+  /**
+   * @brief Append the morphemes of a Viterbi path, shifted by char_offset, to out
+   */
+  static void appendPath(const core::ViterbiResult& result, const core::Lattice& lattice, size_t char_offset,
+                         std::vector<core::Morpheme>& out);
 };
 
 }  // namespace suzume::analysis
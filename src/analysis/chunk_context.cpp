@@ -0,0 +1,75 @@
+/**
+ * @file chunk_context.cpp
+ * @brief Per-chunk text accessor shared by candidate generators
+ */
+
+#include "analysis/chunk_context.h"
+
+#include "dictionary/dictionary.h"
+
+namespace suzume::analysis {
+
+namespace {
+
+inline uint32_t utf8ByteLength(char32_t code) {
+  if (code < 0x80) {
+    return 1;
+  }
+  if (code < 0x800) {
+    return 2;
+  }
+  if (code < 0x10000) {
+    return 3;
+  }
+  return 4;
+}
+
+}  // namespace
+
+ChunkContext::ChunkContext(std::string_view text, const std::vector<char32_t>& codepoints,
+                           const grammar::Inflection& inflection)
+    : text_(text), codepoints_(codepoints), inflection_(inflection), memo_generation_(inflection.cacheGeneration()) {
+  byte_offsets_.reserve(codepoints.size() + 1);
+  uint32_t offset = 0;
+  for (char32_t code : codepoints) {
+    byte_offsets_.push_back(offset);
+    offset += utf8ByteLength(code);
+  }
+  byte_offsets_.push_back(offset);
+}
+
+const std::vector<grammar::InflectionCandidate>& ChunkContext::analyzeSpan(size_t start, size_t end) const {
+  if (inflection_.cacheGeneration() != memo_generation_) {
+    inflection_memo_.clear();
+    memo_generation_ = inflection_.cacheGeneration();
+  }
+
+  uint64_t key = (static_cast<uint64_t>(start) << 32) | static_cast<uint64_t>(end);
+  auto iter = inflection_memo_.find(key);
+  if (iter != inflection_memo_.end()) {
+    return *iter->second;
+  }
+
+  if (deadline_ != std::chrono::steady_clock::time_point{} &&
+      (deadline_expired_ || std::chrono::steady_clock::now() >= deadline_)) {
+    static const std::vector<grammar::InflectionCandidate> kNoCandidates;
+    deadline_expired_ = true;
+    return kNoCandidates;
+  }
+
+  std::string_view surface = span(start, end);
+  if (conjugations_ != nullptr) {
+    const dictionary::ConjugatedSurface* indexed = conjugations_->findConjugated(surface);
+    if (indexed != nullptr && indexed->auxiliary_chain) {
+      static const std::vector<grammar::InflectionCandidate> kChainCandidates;
+      inflection_memo_.emplace(key, &kChainCandidates);
+      return kChainCandidates;
+    }
+  }
+
+  const auto& result = inflection_.analyze(surface);
+  inflection_memo_.emplace(key, &result);
+  return result;
+}
+
+}  // namespace suzume::analysis
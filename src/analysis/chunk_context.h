@@ -0,0 +1,127 @@
+/**
+ * @file chunk_context.h
+ * @brief Per-chunk text accessor shared by candidate generators
+ *
+ * Candidate generators work on character (codepoint) positions but most
+ * lookups (dictionary, inflection) take UTF-8 surfaces. Re-encoding a
+ * codepoint range for every probe allocates a short-lived std::string, and
+ * the same span is typically analyzed by several generators in turn.
+ *
+ * ChunkContext is built once per analyzed chunk and provides:
+ * - O(1) character → byte offset mapping
+ * - string_view spans into the normalized UTF-8 buffer (no allocation)
+ * - a memo of Inflection::analyze() results keyed by (start, end) span
+ */
+
+#ifndef SUZUME_ANALYSIS_CHUNK_CONTEXT_H_
+#define SUZUME_ANALYSIS_CHUNK_CONTEXT_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "grammar/inflection.h"
+
+namespace suzume::dictionary {
+class DictionaryManager;
+}  // namespace suzume::dictionary
+
+namespace suzume::analysis {
+
+/**
+ * @brief Read-only view of one chunk of normalized text
+ *
+ * The referenced text, codepoints and inflection analyzer must outlive
+ * this object. Not thread-safe (the inflection memo is mutable).
+ */
+class ChunkContext {
+ public:
+  /**
+   * @brief Build context for a chunk
+   * @param text Normalized UTF-8 text
+   * @param codepoints Codepoints decoded from text
+   * @param inflection Inflection analyzer used for span analysis
+   */
+  ChunkContext(std::string_view text, const std::vector<char32_t>& codepoints, const grammar::Inflection& inflection);
+
+  // Non-copyable, non-movable (generators hold references)
+  ChunkContext(const ChunkContext&) = delete;
+  ChunkContext& operator=(const ChunkContext&) = delete;
+  ChunkContext(ChunkContext&&) = delete;
+  ChunkContext& operator=(ChunkContext&&) = delete;
+
+  std::string_view text() const { return text_; }
+  const std::vector<char32_t>& codepoints() const { return codepoints_; }
+  const grammar::Inflection& inflection() const { return inflection_; }
+  size_t size() const { return codepoints_.size(); }
+
+  /**
+   * @brief Byte offset of a character position (clamped to text size)
+   */
+  size_t bytePos(size_t char_pos) const {
+    return char_pos < byte_offsets_.size() ? byte_offsets_[char_pos] : text_.size();
+  }
+
+  /**
+   * @brief UTF-8 view of characters [start, end)
+   * @return Empty view if the range is invalid
+   */
+  std::string_view span(size_t start, size_t end) const {
+    if (start >= end || end > codepoints_.size()) {
+      return {};
+    }
+    size_t byte_start = byte_offsets_[start];
+    return text_.substr(byte_start, byte_offsets_[end] - byte_start);
+  }
+
+  /**
+   * @brief Inflection analysis of characters [start, end), memoized per span
+   *
+   * Equivalent to inflection().analyze(span(start, end)), but repeated calls
+   * for the same span skip re-encoding and the cache key allocation.
+   * Once the deadline has passed, spans not analyzed yet get no candidates.
+   * Spans the conjugation index lists as a word plus auxiliaries get none
+   * either: the lattice always splits those chains, so rule-based readings
+   * of the whole span never reach the output.
+   */
+  const std::vector<grammar::InflectionCandidate>& analyzeSpan(size_t start, size_t end) const;
+
+  /**
+   * @brief Stop analyzing new spans after this point in time
+   */
+  void setDeadline(std::chrono::steady_clock::time_point deadline) { deadline_ = deadline; }
+
+  /**
+   * @brief Check if analyzeSpan() has skipped a span because of the deadline
+   */
+  bool deadlineExpired() const { return deadline_expired_; }
+
+  /**
+   * @brief Use a dictionary conjugation index to skip known auxiliary chains
+   * @param dictionary Dictionaries to consult (must outlive this object), or nullptr
+   */
+  void setConjugationIndex(const dictionary::DictionaryManager* dictionary) { conjugations_ = dictionary; }
+
+ private:
+  std::string_view text_;
+  const std::vector<char32_t>& codepoints_;
+  const grammar::Inflection& inflection_;
+  std::vector<uint32_t> byte_offsets_;  // byte_offsets_[i] = byte offset of char i (size n+1)
+
+  // Memoized pointers into the Inflection cache, tagged with its generation
+  // so a trimCache() while the context is alive drops stale entries.
+  mutable std::unordered_map<uint64_t, const std::vector<grammar::InflectionCandidate>*> inflection_memo_;
+  mutable uint32_t memo_generation_{0};
+
+  std::chrono::steady_clock::time_point deadline_{};  // Default-constructed = no deadline
+  mutable bool deadline_expired_{false};
+
+  const dictionary::DictionaryManager* conjugations_{nullptr};  // nullptr = analyze every span
+};
+
+}  // namespace suzume::analysis
+
+#endif  // SUZUME_ANALYSIS_CHUNK_CONTEXT_H_
@@ -0,0 +1,37 @@
+/**
+ * @file generator_prefilter.cpp
+ * @brief Per-chunk applicability checks for candidate generators
+ */
+
+#include "analysis/generator_prefilter.h"
+
+#include <algorithm>
+
+namespace suzume::analysis {
+
+GeneratorPrefilter::GeneratorPrefilter(const std::vector<char32_t>& codepoints,
+                                       const std::vector<GeneratorTrigger>& triggers)
+    : size_(codepoints.size()) {
+  const size_t block = size_ + 1;
+  next_hits_.resize(block * triggers.size());
+
+  for (size_t idx = 0; idx < triggers.size(); ++idx) {
+    const GeneratorTrigger& trigger = triggers[idx];
+    uint32_t* next_hit = next_hits_.data() + idx * block;
+
+    // Backward pass: next_hit[i] is the first trigger position >= i
+    next_hit[size_] = static_cast<uint32_t>(size_);
+    for (size_t pos = size_; pos-- > 0;) {
+      bool hit = std::binary_search(trigger.codepoints.begin(), trigger.codepoints.end(), codepoints[pos]) &&
+                 (trigger.next == 0 || (pos + 1 < size_ && codepoints[pos + 1] == trigger.next));
+      next_hit[pos] = hit ? static_cast<uint32_t>(pos) : next_hit[pos + 1];
+    }
+
+    Slot& slot = slots_[static_cast<size_t>(trigger.kind)];
+    slot.next_hit = next_hit;
+    slot.min_offset = trigger.min_offset;
+    slot.max_offset = trigger.max_offset;
+  }
+}
+
+}  // namespace suzume::analysis
@@ -0,0 +1,90 @@
+/**
+ * @file generator_prefilter.h
+ * @brief Per-chunk applicability checks for candidate generators
+ *
+ * Most join generators only produce edges when a specific codepoint (a
+ * productive prefix, 然 before と, て/で, a subsidiary verb's first
+ * character, ...) occurs within a few characters of the start position, yet
+ * the tokenizer would call them at every kanji or hiragana position. Each
+ * generator declares its trigger codepoints and the offset window they must
+ * appear in (GeneratorTrigger); GeneratorPrefilter resolves these once per
+ * chunk into next-occurrence tables, so the check before each call is a
+ * single table lookup.
+ */
+
+#ifndef SUZUME_ANALYSIS_GENERATOR_PREFILTER_H_
+#define SUZUME_ANALYSIS_GENERATOR_PREFILTER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "core/stats.h"
+
+namespace suzume::analysis {
+
+/**
+ * @brief Trigger set declared by a candidate generator
+ *
+ * The generator can only add edges at a start position p if one of
+ * `codepoints` occurs at some position in [p + min_offset, p + max_offset]
+ * and, when `next` is set, is directly followed by `next`. Declaring an
+ * empty codepoint set disables the generator.
+ */
+struct GeneratorTrigger {
+  static constexpr uint32_t kUnbounded = std::numeric_limits<uint32_t>::max();
+
+  core::GeneratorKind kind{core::GeneratorKind::Count_};
+  std::vector<char32_t> codepoints;  // Trigger codepoints
+  char32_t next{0};                  // Required following codepoint (0 = any)
+  uint32_t min_offset{0};            // Window start, relative to the start position
+  uint32_t max_offset{0};            // Window end (inclusive), or kUnbounded
+};
+
+/**
+ * @brief Trigger lookup for one chunk
+ */
+class GeneratorPrefilter {
+ public:
+  /**
+   * @brief Resolve triggers against a chunk
+   * @param codepoints Chunk codepoints (only read during construction)
+   * @param triggers Declared triggers (at most one per generator kind)
+   */
+  GeneratorPrefilter(const std::vector<char32_t>& codepoints, const std::vector<GeneratorTrigger>& triggers);
+
+  /**
+   * @brief Check whether a generator may produce edges at a position
+   *
+   * Always true for generators without a declared trigger.
+   */
+  bool mayApply(core::GeneratorKind kind, size_t pos) const {
+    const Slot& slot = slots_[static_cast<size_t>(kind)];
+    if (slot.next_hit == nullptr) {
+      return true;
+    }
+    size_t first = pos + slot.min_offset;
+    if (first >= size_) {
+      return false;
+    }
+    uint32_t hit = slot.next_hit[first];
+    return hit < size_ && (slot.max_offset == GeneratorTrigger::kUnbounded || hit <= pos + slot.max_offset);
+  }
+
+ private:
+  struct Slot {
+    const uint32_t* next_hit{nullptr};  // Next trigger position at or after i (size_ if none)
+    uint32_t min_offset{0};
+    uint32_t max_offset{0};
+  };
+
+  size_t size_{0};
+  std::vector<uint32_t> next_hits_;  // One (size_ + 1) block per declared trigger
+  std::array<Slot, core::kNumGeneratorKinds> slots_{};
+};
+
+}  // namespace suzume::analysis
+
+#endif  // SUZUME_ANALYSIS_GENERATOR_PREFILTER_H_
@@ -5,6 +5,8 @@
 
 #include "join_candidates.h"
 
+#include <algorithm>
+
 #include "bigram_table.h"
 #include "candidate_constants.h"
 #include "core/debug.h"
@@ -362,11 +364,13 @@ inline bool hasAuxiliarySuffix(std::string_view suffix) {
 
 }  // namespace
 
-void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                   const std::vector<char32_t>& codepoints, size_t start_pos,
+void addCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                    const std::vector<normalize::CharType>& char_types,
-                                   const dictionary::DictionaryManager& dict_manager, const Scorer& scorer,
-                                   const grammar::Inflection& inflection) {
+                                   const dictionary::DictionaryManager& dict_manager, const Scorer& scorer) {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
+  const grammar::Inflection& inflection = chunk.inflection();
   if (start_pos >= char_types.size()) {
     return;
   }
@@ -461,8 +465,8 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
   }
 
   // Get byte positions
-  size_t start_byte = charPosToBytePos(codepoints, start_pos);
-  size_t v2_start_byte = charPosToBytePos(codepoints, v2_start);
+  size_t start_byte = chunk.bytePos(start_pos);
+  size_t v2_start_byte = chunk.bytePos(v2_start);
 
   // Inflection analyzer for V2 detection (shared instance from Tokenizer)
 
@@ -570,7 +574,7 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
         // Case 1: Hiragana V2 inflected forms (e.g., きった from きる, かった from かう)
         // Try different lengths for V2 inflected form (shortest match first)
         for (size_t v2_end = v2_start + 2; v2_end <= v2_hiragana_end; ++v2_end) {
-          size_t v2_end_byte = charPosToBytePos(codepoints, v2_end);
+          size_t v2_end_byte = chunk.bytePos(v2_end);
           std::string v2_text(text.substr(v2_start_byte, v2_end_byte - v2_start_byte));
 
           // Use analyze() to get all candidates, not just the best one.
@@ -637,7 +641,7 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
 
                   // Try inflection on kanji+hiragana portion (shortest match first)
                   for (size_t v2_end = hira_start + 1; v2_end <= hira_end; ++v2_end) {
-                    size_t v2_end_byte = charPosToBytePos(codepoints, v2_end);
+                    size_t v2_end_byte = chunk.bytePos(v2_end);
                     std::string v2_text(text.substr(v2_start_byte, v2_end_byte - v2_start_byte));
 
                     // Use analyze() to search all candidates for matching base form
@@ -708,7 +712,7 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
 
     // Build the V1 base form for verification
     std::string v1_base;
-    size_t v1_end_byte = is_ichidan ? v2_start_byte : charPosToBytePos(codepoints, kanji_end);
+    size_t v1_end_byte = is_ichidan ? v2_start_byte : chunk.bytePos(kanji_end);
     v1_base = std::string(text.substr(start_byte, v1_end_byte - start_byte));
 
     if (is_sokuonbin) {
@@ -810,7 +814,7 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
       // Check if V1 renyokei is known as a non-verb (noun, adjective, etc.)
       // If so, don't form compound verb. E.g., 好き is ADJ, not verb renyokei of 好く.
       if (use_inflection_fallback) {
-        size_t v1_renyokei_end = is_ichidan ? v2_start_byte : charPosToBytePos(codepoints, kanji_end + 1);
+        size_t v1_renyokei_end = is_ichidan ? v2_start_byte : chunk.bytePos(kanji_end + 1);
         std::string v1_renyokei(text.substr(start_byte, v1_renyokei_end - start_byte));
         auto renyokei_results = dict_manager.lookup(v1_renyokei, 0);
         for (const auto& result : renyokei_results) {
@@ -825,7 +829,7 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
 
       if (use_inflection_fallback) {
         // Get V1 renyokei form for inflection analysis
-        size_t v1_renyokei_end = is_ichidan ? v2_start_byte : charPosToBytePos(codepoints, kanji_end + 1);
+        size_t v1_renyokei_end = is_ichidan ? v2_start_byte : chunk.bytePos(kanji_end + 1);
         std::string v1_renyokei(text.substr(start_byte, v1_renyokei_end - start_byte));
 
         auto infl_result = inflection.getBest(v1_renyokei);
@@ -882,7 +886,7 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
     // Build compound verb base form (V1 renyokei + V2 base form)
     // e.g., 走り + 出す = 走り出す, 走り + だす = 走り出す
     std::string compound_base;
-    size_t v1_renyokei_end = is_ichidan ? v2_start_byte : charPosToBytePos(codepoints, kanji_end + 1);
+    size_t v1_renyokei_end = is_ichidan ? v2_start_byte : chunk.bytePos(kanji_end + 1);
     compound_base = std::string(text.substr(start_byte, v1_renyokei_end - start_byte));
     // Use the pre-defined base_form for V2 (always in kanji form for consistency)
     compound_base += v2_verb.surface;
@@ -1167,11 +1171,13 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
   }
 }
 
-void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                           const std::vector<char32_t>& codepoints, size_t start_pos,
+void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                            const std::vector<normalize::CharType>& char_types,
-                                           const dictionary::DictionaryManager& dict_manager, const Scorer& scorer,
-                                           const grammar::Inflection& inflection) {
+                                           const dictionary::DictionaryManager& dict_manager, const Scorer& scorer) {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
+  const grammar::Inflection& inflection = chunk.inflection();
   if (start_pos >= char_types.size()) {
     return;
   }
@@ -1182,7 +1188,7 @@ void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_v
   }
 
   // Get byte position for start
-  size_t start_byte = charPosToBytePos(codepoints, start_pos);
+  size_t start_byte = chunk.bytePos(start_pos);
 
   // For each V2 subsidiary verb, check if it appears after a potential V1
   for (const auto& v2_verb : kSubsidiaryVerbs) {
@@ -1212,7 +1218,7 @@ void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_v
         continue;
       }
 
-      size_t v2_start_byte = charPosToBytePos(codepoints, v2_start);
+      size_t v2_start_byte = chunk.bytePos(v2_start);
 
       // Check if V2 reading (hiragana) or surface (kanji) matches at v2_start
       std::string_view v2_surface(v2_verb.surface);
@@ -1374,8 +1380,7 @@ void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_v
   }
 }
 
-void addAdjectiveSugiruJoinCandidates(core::Lattice& /*lattice*/, std::string_view /*text*/,
-                                      const std::vector<char32_t>& /*codepoints*/, size_t /*start_pos*/,
+void addAdjectiveSugiruJoinCandidates(core::Lattice& /*lattice*/, const ChunkContext& /*chunk*/, size_t /*start_pos*/,
                                       const std::vector<normalize::CharType>& /*char_types*/,
                                       const dictionary::DictionaryManager& /*dict_manager*/, const Scorer& /*scorer*/) {
   // MeCab compatibility: i-adjective + すぎる should be split as separate tokens
@@ -1394,9 +1399,11 @@ void addAdjectiveSugiruJoinCandidates(core::Lattice& /*lattice*/, std::string_vi
   return;
 }
 
-void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                     const std::vector<char32_t>& codepoints, size_t start_pos,
+void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                      const std::vector<normalize::CharType>& char_types, const Scorer& scorer) {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
   // DISABLED: MeCab splits KATAKANA + すぎる into separate tokens:
   //   シンプル 名詞,一般,*,*,*,*,*
   //   すぎる   動詞,非自立,*,*,一段,基本形,すぎる,スギル,スギル
@@ -1444,8 +1451,8 @@ void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view te
   }
 
   // Check if すぎ follows the katakana
-  size_t start_byte = charPosToBytePos(codepoints, start_pos);
-  size_t sugi_start_byte = charPosToBytePos(codepoints, katakana_end);
+  size_t start_byte = chunk.bytePos(start_pos);
+  size_t sugi_start_byte = chunk.bytePos(katakana_end);
 
   std::string_view after_katakana = text.substr(sugi_start_byte);
   constexpr std::string_view kSugi = "すぎ";
@@ -1469,7 +1476,7 @@ void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view te
   size_t renyokei_end_pos = katakana_end + sugi_renyokei_len;
 
   if (renyokei_end_pos <= codepoints.size()) {
-    size_t renyokei_end_byte = charPosToBytePos(codepoints, renyokei_end_pos);
+    size_t renyokei_end_byte = chunk.bytePos(renyokei_end_pos);
     std::string renyokei_surface(text.substr(start_byte, renyokei_end_byte - start_byte));
 
     lattice.addEdge(renyokei_surface, static_cast<uint32_t>(start_pos),
@@ -1485,7 +1492,7 @@ void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view te
     size_t sugiru_end_pos = katakana_end + sugiru_char_len;
 
     if (sugiru_end_pos <= codepoints.size()) {
-      size_t sugiru_end_byte = charPosToBytePos(codepoints, sugiru_end_pos);
+      size_t sugiru_end_byte = chunk.bytePos(sugiru_end_pos);
       std::string sugiru_surface(text.substr(start_byte, sugiru_end_byte - start_byte));
 
       lattice.addEdge(sugiru_surface, static_cast<uint32_t>(start_pos),
@@ -1496,9 +1503,12 @@ void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view te
 #endif  // Unreachable katakana+sugiru
 }
 
-void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                                 size_t start_pos, const std::vector<normalize::CharType>& char_types,
+void addPrefixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                 const std::vector<normalize::CharType>& char_types,
                                  const dictionary::DictionaryManager& dict_manager, const Scorer& scorer) {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
   if (start_pos >= codepoints.size()) {
     return;
   }
@@ -1544,7 +1554,7 @@ void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
   }
 
   // Check dictionary for compound nouns
-  size_t noun_start_byte = charPosToBytePos(codepoints, noun_start);
+  size_t noun_start_byte = chunk.bytePos(noun_start);
   auto noun_results = dict_manager.lookup(text, noun_start_byte);
   bool noun_in_dict = false;
   size_t dict_noun_end = noun_end;
@@ -1572,7 +1582,7 @@ void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
   }
 
   // Check if the combined form is already in dictionary
-  size_t start_byte = charPosToBytePos(codepoints, start_pos);
+  size_t start_byte = chunk.bytePos(start_pos);
   auto combined_results = dict_manager.lookup(text, start_byte);
 
   for (const auto& result : combined_results) {
@@ -1582,7 +1592,7 @@ void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
   }
 
   // Generate joined candidate
-  size_t end_byte = charPosToBytePos(codepoints, noun_end);
+  size_t end_byte = chunk.bytePos(noun_end);
   std::string surface(text.substr(start_byte, end_byte - start_byte));
 
   float base_cost = scorer.posPrior(core::PartOfSpeech::Noun);
@@ -1614,10 +1624,12 @@ void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
                   final_cost, flags, "");
 }
 
-void addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
-                                  const std::vector<char32_t>& codepoints, size_t start_pos,
-                                  const std::vector<normalize::CharType>& char_types, const Scorer& scorer,
-                                  const grammar::Inflection& inflection) {
+void addTeFormAuxiliaryCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                  const std::vector<normalize::CharType>& char_types, const Scorer& scorer) {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
+  const grammar::Inflection& inflection = chunk.inflection();
   if (start_pos >= codepoints.size()) {
     return;
   }
@@ -1661,8 +1673,8 @@ void addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
   }
 
   // Get byte positions
-  size_t te_byte = charPosToBytePos(codepoints, start_pos);
-  size_t aux_start_byte = charPosToBytePos(codepoints, aux_start);
+  size_t te_byte = chunk.bytePos(start_pos);
+  size_t aux_start_byte = chunk.bytePos(aux_start);
 
   // Find the extent of hiragana following て/で
   size_t hiragana_end = findCharRegionEnd(char_types, aux_start, 10, CharType::Hiragana);
@@ -1684,7 +1696,7 @@ void addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
 
     // Try different lengths after the stem
     for (size_t aux_end = aux_start + stem_char_len; aux_end <= hiragana_end && aux_end <= aux_start + 8; ++aux_end) {
-      size_t aux_end_byte = charPosToBytePos(codepoints, aux_end);
+      size_t aux_end_byte = chunk.bytePos(aux_end);
       std::string aux_surface(text.substr(aux_start_byte, aux_end_byte - aux_start_byte));
 
       auto best = inflection.getBest(aux_surface);
@@ -1717,11 +1729,13 @@ void addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
   }
 }
 
-void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                     const std::vector<char32_t>& codepoints, size_t start_pos,
+void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                      const std::vector<normalize::CharType>& char_types,
                                      [[maybe_unused]] const dictionary::DictionaryManager& dict_manager,
                                      const Scorer& scorer) {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
   if (start_pos >= codepoints.size()) {
     return;
   }
@@ -1747,8 +1761,8 @@ void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, std::string_view te
       return;
     }
     size_t end_pos = start_pos + 3;
-    size_t start_byte = charPosToBytePos(codepoints, start_pos);
-    size_t end_byte = charPosToBytePos(codepoints, end_pos);
+    size_t start_byte = chunk.bytePos(start_pos);
+    size_t end_byte = chunk.bytePos(end_pos);
     std::string surface(text.substr(start_byte, end_byte - start_byte));
     float base_cost = scorer.posPrior(core::PartOfSpeech::Noun);
     constexpr float kCompoundNounBonus = -1.0F;
@@ -1864,8 +1878,8 @@ void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, std::string_view te
 
   // Build the compound noun surface
   size_t end_pos = hiragana_end + 1;  // Include suffix
-  size_t start_byte = charPosToBytePos(codepoints, start_pos);
-  size_t end_byte = charPosToBytePos(codepoints, end_pos);
+  size_t start_byte = chunk.bytePos(start_pos);
+  size_t end_byte = chunk.bytePos(end_pos);
 
   std::string surface(text.substr(start_byte, end_byte - start_byte));
 
@@ -1880,9 +1894,11 @@ void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, std::string_view te
                   final_cost, flags, surface);  // lemma = surface for compound nouns
 }
 
-void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                    const std::vector<char32_t>& codepoints, size_t start_pos,
+void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                     const std::vector<normalize::CharType>& char_types, const Scorer& scorer) {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
   if (start_pos >= codepoints.size()) {
     return;
   }
@@ -1921,14 +1937,14 @@ void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, std::string_view tex
   }
 
   // Build the surface: X然と
-  size_t start_byte = charPosToBytePos(codepoints, start_pos);
+  size_t start_byte = chunk.bytePos(start_pos);
   size_t end_pos = kanji_end + 1;  // Include と
-  size_t end_byte = charPosToBytePos(codepoints, end_pos);
+  size_t end_byte = chunk.bytePos(end_pos);
 
   std::string surface(text.substr(start_byte, end_byte - start_byte));
 
   // X然 without と is the lemma
-  size_t zen_end_byte = charPosToBytePos(codepoints, kanji_end);
+  size_t zen_end_byte = chunk.bytePos(kanji_end);
   std::string lemma(text.substr(start_byte, zen_end_byte - start_byte));
 
   // Calculate cost with bonus for this pattern
@@ -1942,4 +1958,51 @@ void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, std::string_view tex
                   final_cost, flags, lemma);
 }
 
+const std::vector<GeneratorTrigger>& joinGeneratorTriggers() {
+  static const std::vector<GeneratorTrigger> triggers = [] {
+    auto firstChar = [](const char* str) {
+      size_t pos = 0;
+      return normalize::decodeUtf8(str, pos);
+    };
+
+    // V2 matches (surface, reading, renyokei, mizenkei, inflected) all start
+    // with the first character of the V2 surface or reading
+    std::vector<char32_t> v2_heads;
+    for (const auto& v2_verb : kSubsidiaryVerbs) {
+      v2_heads.push_back(firstChar(v2_verb.surface));
+      if (v2_verb.reading != nullptr) {
+        v2_heads.push_back(firstChar(v2_verb.reading));
+      }
+    }
+
+    std::vector<char32_t> prefixes;
+    for (const auto& prefix : kProductivePrefixes) {
+      prefixes.push_back(prefix.codepoint);
+    }
+
+    constexpr uint32_t kUnbounded = GeneratorTrigger::kUnbounded;
+    std::vector<GeneratorTrigger> result = {
+        // V2 starts 1-7 characters in: up to 4 kanji, then up to 3 stem kana
+        {core::GeneratorKind::CompoundVerbJoin, v2_heads, 0, 1, 7},
+        // Hiragana V1 is 2-4 characters
+        {core::GeneratorKind::HiraganaCompoundVerbJoin, v2_heads, 0, 2, 4},
+        {core::GeneratorKind::PrefixNounJoin, prefixes, 0, 0, 0},
+        // X然と: 然と closes the kanji run
+        {core::GeneratorKind::TaruAdjectiveJoin, {U'然'}, U'と', 1, kUnbounded},
+        // Suffix kanji after the kanji run and up to two kana
+        {core::GeneratorKind::VerbSuffixNounJoin, {U'物', U'方', U'所', U'目'}, 0, 1, kUnbounded},
+        {core::GeneratorKind::TeFormAuxiliary, {U'て', U'で'}, 0, 0, 0},
+        // Disabled for MeCab compatibility (see addKatakanaSugiruJoinCandidates)
+        {core::GeneratorKind::KatakanaSugiruJoin, {}, 0, 0, 0},
+    };
+    for (auto& trigger : result) {
+      std::sort(trigger.codepoints.begin(), trigger.codepoints.end());
+      trigger.codepoints.erase(std::unique(trigger.codepoints.begin(), trigger.codepoints.end()),
+                               trigger.codepoints.end());
+    }
+    return result;
+  }();
+  return triggers;
+}
+
 }  // namespace suzume::analysis
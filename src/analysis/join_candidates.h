@@ -14,6 +14,8 @@
 #include <string_view>
 #include <vector>
 
+#include "analysis/chunk_context.h"
+#include "analysis/generator_prefilter.h"
 #include "analysis/scorer.h"
 #include "core/lattice.h"
 #include "dictionary/dictionary.h"
@@ -35,18 +37,15 @@ namespace suzume::analysis {
  *   "書き出す" → compound verb (書く + 出す)
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param dict_manager Dictionary manager for lookups
  * @param scorer Scorer for POS priors
  */
-void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                   const std::vector<char32_t>& codepoints, size_t start_pos,
+void addCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                    const std::vector<normalize::CharType>& char_types,
-                                   const dictionary::DictionaryManager& dict_manager, const Scorer& scorer,
-                                   const grammar::Inflection& inflection);
+                                   const dictionary::DictionaryManager& dict_manager, const Scorer& scorer);
 
 /**
  * @brief Add hiragana compound verb join candidates
@@ -59,18 +58,15 @@ void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text
  *   "やりなおしたい" → やりなおし + たい
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param dict_manager Dictionary manager for lookups
  * @param scorer Scorer for POS priors
  */
-void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                           const std::vector<char32_t>& codepoints, size_t start_pos,
+void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                            const std::vector<normalize::CharType>& char_types,
-                                           const dictionary::DictionaryManager& dict_manager, const Scorer& scorer,
-                                           const grammar::Inflection& inflection);
+                                           const dictionary::DictionaryManager& dict_manager, const Scorer& scorer);
 
 /**
  * @brief Add adjective + すぎる compound verb candidates
@@ -83,15 +79,13 @@ void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_v
  *   "尊すぎて" → "尊すぎ" (verb, lemma="尊過ぎる") + "て" (auxiliary)
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param dict_manager Dictionary manager for lookups
  * @param scorer Scorer for POS priors
  */
-void addAdjectiveSugiruJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                      const std::vector<char32_t>& codepoints, size_t start_pos,
+void addAdjectiveSugiruJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                       const std::vector<normalize::CharType>& char_types,
                                       const dictionary::DictionaryManager& dict_manager, const Scorer& scorer);
 
@@ -107,14 +101,12 @@ void addAdjectiveSugiruJoinCandidates(core::Lattice& lattice, std::string_view t
  *   "シンプルすぎた" → "シンプルすぎ" (verb) + "た" (auxiliary)
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param scorer Scorer for POS priors
  */
-void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                     const std::vector<char32_t>& codepoints, size_t start_pos,
+void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                      const std::vector<normalize::CharType>& char_types, const Scorer& scorer);
 
 /**
@@ -130,15 +122,14 @@ void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view te
  *   "未経験" → merged as single noun (未 + 経験)
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param dict_manager Dictionary manager for lookups
  * @param scorer Scorer for POS priors
  */
-void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                                 size_t start_pos, const std::vector<normalize::CharType>& char_types,
+void addPrefixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                 const std::vector<normalize::CharType>& char_types,
                                  const dictionary::DictionaryManager& dict_manager, const Scorer& scorer);
 
 /**
@@ -153,16 +144,13 @@ void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
  *   "書いておく" → ["書いて" + "おく"]
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param scorer Scorer for POS priors
  */
-void addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
-                                  const std::vector<char32_t>& codepoints, size_t start_pos,
-                                  const std::vector<normalize::CharType>& char_types, const Scorer& scorer,
-                                  const grammar::Inflection& inflection);
+void addTeFormAuxiliaryCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                  const std::vector<normalize::CharType>& char_types, const Scorer& scorer);
 
 /**
  * @brief Add taru-adjective adverb join candidates
@@ -177,14 +165,12 @@ void addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
  *   "悠然と" → single adverb (not 悠然 + と)
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param scorer Scorer for POS priors
  */
-void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                    const std::vector<char32_t>& codepoints, size_t start_pos,
+void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                     const std::vector<normalize::CharType>& char_types, const Scorer& scorer);
 
 /**
@@ -199,18 +185,27 @@ void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, std::string_view tex
  *   "読み方" → compound noun (読む + 方)
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param dict_manager Dictionary manager for lookups
  * @param scorer Scorer for POS priors
  */
-void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                     const std::vector<char32_t>& codepoints, size_t start_pos,
+void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                      const std::vector<normalize::CharType>& char_types,
                                      const dictionary::DictionaryManager& dict_manager, const Scorer& scorer);
 
+/**
+ * @brief Trigger sets of the join generators
+ *
+ * Codepoints that must occur near a start position for the corresponding
+ * generator to add anything there; see GeneratorPrefilter. Derived from the
+ * same pattern tables the generators match against.
+ *
+ * @return One trigger per prefiltered join generator
+ */
+const std::vector<GeneratorTrigger>& joinGeneratorTriggers();
+
 }  // namespace suzume::analysis
 
 #endif  // SUZUME_ANALYSIS_JOIN_CANDIDATES_H_
@@ -11,11 +11,9 @@
 #include "core/types.h"
 #include "core/utf8_constants.h"
 #include "grammar/char_patterns.h"
+#include "normalize/char_type.h"
 #include "normalize/utf8.h"
 
-#ifdef SUZUME_DEBUG_INFO
-using suzume::core::CandidateOrigin;
-#endif
 namespace cost = suzume::analysis::bigram_cost;
 namespace sc = suzume::analysis::scorer;
 
@@ -24,6 +22,45 @@ namespace sc = suzume::analysis::scorer;
 
 namespace {
 
+using suzume::normalize::CharType;
+using suzume::normalize::charTypeBit;
+
+// Script checks on edge surfaces. The span's character classes answer most
+// calls with a bit test; a surface scan is only needed when the lattice
+// recorded no classes, or to confirm a kanji match: CharType::Kanji also
+// covers 々 and CJK compatibility/extension blocks, which the grammar
+// helpers do not treat as kanji.
+constexpr uint8_t kHiraganaBit = charTypeBit(CharType::Hiragana);
+constexpr uint8_t kKanjiBit = charTypeBit(CharType::Kanji);
+
+bool edgeIsPureHiragana(const suzume::core::LatticeEdge& edge) {
+  if (edge.char_classes == 0) {
+    return suzume::grammar::isPureHiragana(edge.surface);
+  }
+  return edge.char_classes == kHiraganaBit;
+}
+
+bool edgeContainsKanji(const suzume::core::LatticeEdge& edge) {
+  if (edge.char_classes != 0 && (edge.char_classes & kKanjiBit) == 0) {
+    return false;
+  }
+  return suzume::grammar::containsKanji(edge.surface);
+}
+
+bool edgeIsAllKanji(const suzume::core::LatticeEdge& edge) {
+  if (edge.char_classes != 0 && edge.char_classes != kKanjiBit) {
+    return false;
+  }
+  return suzume::grammar::isAllKanji(edge.surface);
+}
+
+bool edgeIsMixedHiraganaKanji(const suzume::core::LatticeEdge& edge) {
+  if (edge.char_classes != 0 && (edge.char_classes & (kHiraganaBit | kKanjiBit)) != (kHiraganaBit | kKanjiBit)) {
+    return false;
+  }
+  return suzume::grammar::isMixedHiraganaKanji(edge.surface);
+}
+
 // Convert POS to array index
 constexpr size_t posToIndex(suzume::core::PartOfSpeech pos) {
   switch (pos) {
@@ -152,6 +189,11 @@ float Scorer::bigramCost(core::PartOfSpeech prev, core::PartOfSpeech next) const
 }
 
 float Scorer::wordCost(const core::LatticeEdge& edge) const {
+  // Precomputed per dictionary entry by the tokenizer
+  if (edge.final_cost) {
+    return edge.cost;
+  }
+
   // v0.8: Base cost from ExtendedPOS category
   float category_cost = getCategoryCost(edge.extended_pos);
 
@@ -176,7 +218,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Exclude AdjStem (語幹) as it's not a complete i-adjective
   // Exclude conditional forms ending in ければ (should split: よければ → よけれ + ば)
   if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Adjective &&
-      edge.extended_pos != core::ExtendedPOS::AdjStem && grammar::isPureHiragana(edge.surface) &&
+      edge.extended_pos != core::ExtendedPOS::AdjStem && edgeIsPureHiragana(edge) &&
       !utf8::endsWith(edge.surface, "ければ") &&
       // Exclude ない/なく/なかっ - has auxiliary counterpart, context-dependent
       // Exclude そう - has auxiliary counterpart (様態), context-dependent
@@ -205,7 +247,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // VERB_連用→AUX_否定 connection bonus (-0.8).
   // Pattern: kanji-containing, 4+ chars, ending in い, from dictionary
   if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Adjective &&
-      edge.extended_pos != core::ExtendedPOS::AdjStem && grammar::containsKanji(edge.surface) &&
+      edge.extended_pos != core::ExtendedPOS::AdjStem && edgeContainsKanji(edge) &&
       edge.surface.size() >= 4 * core::kJapaneseCharBytes && utf8::endsWith(edge.surface, "い")) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     cost += lengthScaledBonus(-1.5F, char_len, 4, 0.3F);
@@ -217,7 +259,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Longer adverbs get stronger bonus to beat split paths
   // Short adverbs (2 chars) get weaker bonus to avoid false matches in patterns
   // like かもしれない (should not be か+もし+れない)
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Adverb && grammar::isPureHiragana(edge.surface)) {
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Adverb && edgeIsPureHiragana(edge)) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     // Short adverbs (2 chars) get weaker bonus
     // Longer adverbs get stronger bonus (0.5 per character beyond 2)
@@ -229,7 +271,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // These contain kanji so the pure-hiragana adverb bonus above doesn't apply.
   // They compete with verb renyokei + て split paths which get connection bonuses.
   // E.g., 初めて(ADV, cost=0.5) vs 初め(VERB_連用, -0.13) + て(PART, conn=-0.5)
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Adverb && !grammar::isPureHiragana(edge.surface)) {
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Adverb && !edgeIsPureHiragana(edge)) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     if (char_len >= 3) {
       cost += lengthScaledBonus(-1.5F, char_len, 3, 0.3F);
@@ -241,7 +283,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // E.g., 小さな(DET, cost=0.4) vs 小(ADJ_語幹, -0.68) + さ(SUFFIX, 0) + な(AUX)
   // Only apply to kanji-containing entries to avoid boosting pure hiragana determiners
   // like といった which should remain as particles
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Determiner && grammar::containsKanji(edge.surface)) {
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Determiner && edgeContainsKanji(edge)) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     if (char_len >= 3) {
       cost += lengthScaledBonus(-1.5F, char_len, 3, 0.3F);
@@ -252,7 +294,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // These compete with adverb+noun split paths that get adverb bonus + connection bonus.
   // E.g., ふともも(NOUN, 0.5) vs ふと(ADV, -0.5) + もも(NOUN, 0.5, conn=-0.5) = -0.5
   // Without bonus, the split path wins even though the longer dict match is better.
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Noun && grammar::isPureHiragana(edge.surface)) {
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Noun && edgeIsPureHiragana(edge)) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     if (char_len >= 4) {
       cost += -1.5F;
@@ -267,7 +309,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Note: applies to both Interjection (L1/L2) and Other (legacy)
   if (edge.fromDictionary() &&
       (edge.pos == core::PartOfSpeech::Interjection || edge.pos == core::PartOfSpeech::Other) &&
-      grammar::isPureHiragana(edge.surface)) {
+      edgeIsPureHiragana(edge)) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     // Stronger bonus for longer interjections (common greetings are 4-5 chars)
     float bonus = (char_len <= 2) ? -0.5F : (char_len <= 3) ? -1.5F : -2.0F - static_cast<float>(char_len - 3) * 0.5F;
@@ -277,7 +319,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Bonus for non-hiragana interjections from dictionary (お疲れ様, etc.)
   // Mixed script interjections also need bonus to beat split paths
   // E.g., お疲れ様 should not split as お+疲れ+様
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Interjection && !grammar::isPureHiragana(edge.surface)) {
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Interjection && !edgeIsPureHiragana(edge)) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     // Moderate bonus for mixed interjections
     cost += lengthScaledBonus(-0.5F, char_len, 3, 0.3F);
@@ -289,7 +331,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Needs to beat adverb bonus path, so use stronger bonus
   // Exclude でも - it has ambiguous interpretation (conjunction vs 副助詞)
   // and context-dependent splitting (彼女でもない → 彼女+で+も+ない)
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Conjunction && grammar::isPureHiragana(edge.surface) &&
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Conjunction && edgeIsPureHiragana(edge) &&
       edge.surface != "でも") {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     // Stronger bonus for conjunctions to beat adverb+particle splits
@@ -349,7 +391,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Requires 3+ chars with both hiragana and kanji
   if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Noun) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
-    if (char_len >= 3 && grammar::isMixedHiraganaKanji(edge.surface)) {
+    if (char_len >= 3 && edgeIsMixedHiraganaKanji(edge)) {
       if (char_len >= 4) {
         // Length-scaled bonus for long mixed nouns (お兄ちゃん, お父さん, なし崩し)
         cost += lengthScaledBonus(sc::kBonusLongMixedNounBase, char_len, 4, -sc::kBonusLongMixedNounPerChar);
@@ -363,7 +405,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Split path gets dict+dict connection bonus (-0.5) and split_candidates
   // both-in-dict bonus (-0.2), making it -0.7 cheaper than 1-token path.
   // Length-scaled bonus ensures registered compounds beat split paths.
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Noun && grammar::isAllKanji(edge.surface)) {
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Noun && edgeIsAllKanji(edge)) {
     size_t char_len = suzume::normalize::utf8Length(edge.surface);
     if (char_len >= 4) {
       cost += lengthScaledBonus(sc::kBonusLongKanjiNounBase, char_len, 4, -sc::kBonusLongKanjiNounPerChar);
@@ -373,7 +415,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Bonus for multi-char hiragana suffixes from dictionary (e.g., まみれ, だらけ, ごと)
   // These are L1 closed-class morphemes that should beat false verb candidates
   // E.g., 血まみれ should be 血+まみれ(SUFFIX), not 血まみ(VERB)+れ(AUX)
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Suffix && grammar::isPureHiragana(edge.surface) &&
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Suffix && edgeIsPureHiragana(edge) &&
       edge.surface.size() >= 9) {  // 3+ chars (9+ bytes)
     cost += sc::kBonusLongSuffix;
   }
@@ -381,7 +423,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Bonus for short hiragana verbs from dictionary (e.g., なる, ある, いる, する)
   // These compete with L1 function word entries (DET, AUX) which have lower category costs.
   // Dictionary registration indicates standalone verb usage should take precedence.
-  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(edge.surface) &&
+  if (edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(edge) &&
       edge.surface.length() <= 6) {  // ≤2 chars
     cost += sc::kBonusShortHiraganaVerb;
   }
@@ -413,7 +455,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Exception: short hiragana verbs (2-4 chars like もらっ, あげっ) get reduced penalty
   // as they are more likely to be legitimate verbs written in hiragana
   if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb &&
-      edge.extended_pos == core::ExtendedPOS::VerbOnbinkei && grammar::isPureHiragana(edge.surface) &&
+      edge.extended_pos == core::ExtendedPOS::VerbOnbinkei && edgeIsPureHiragana(edge) &&
       edge.surface.size() >= 6) {  // 2+ chars (avoid single-char like ん)
     // Reduced penalty for short forms (2-4 chars = 6-12 bytes)
     // to allow common hiragana verbs like もらっ, あげっ to compete
@@ -425,7 +467,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // E.g., "さんで" as te-form of "さむ" is likely さん+で misanalysis
   // Patterns: xさん, xさんで, さんで where x is short hiragana (likely name)
   // This complements the hatsuonbin penalty above for other verb forms
-  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(edge.surface) &&
+  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(edge) &&
       (utf8::contains(edge.surface, "さん"))) {
     size_t san_pos = edge.surface.find("さん");
     if (san_pos != std::string::npos) {
@@ -443,7 +485,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Should be に|つけ (particle + verb), not につけ (verb)
   // Valid verbs like "につける" don't exist; this is a mis-analysis
   if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb &&
-      edge.extended_pos == core::ExtendedPOS::VerbRenyokei && grammar::isPureHiragana(edge.surface) &&
+      edge.extended_pos == core::ExtendedPOS::VerbRenyokei && edgeIsPureHiragana(edge) &&
       utf8::startsWith(edge.surface, "に") && edge.surface.size() >= 6 && edge.surface.size() <= 12) {  // 2-4 chars
     cost += sc::kPenaltyNiPrefixVerb;
   }
@@ -452,7 +494,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // E.g., "ございませんでし" as verb renyokei is spurious
   // Should be ござい|ませ|ん|でし (aux chain), not ございませんでし (verb)
   // Valid long verbs typically have kanji stems
-  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(edge.surface) &&
+  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(edge) &&
       edge.surface.size() >= 18) {  // 6+ hiragana chars (6*3=18 bytes)
     cost += sc::kPenaltyVeryLongHiraganaVerb;
   }
@@ -461,7 +503,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // E.g., "つるつるし" as godan-sa renyokei — should be つるつる(ADV) + し(する)
   // Only renyokei: base forms like "づけられる" (from づける) are legitimate
   if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb &&
-      edge.extended_pos == core::ExtendedPOS::VerbRenyokei && grammar::isPureHiragana(edge.surface) &&
+      edge.extended_pos == core::ExtendedPOS::VerbRenyokei && edgeIsPureHiragana(edge) &&
       edge.surface.size() >= 15) {  // 5+ hiragana chars (5*3=15 bytes)
     cost += sc::kPenaltyVeryLongHiraganaVerb;
   }
@@ -473,7 +515,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // with the following し (suru renyokei)
   // Valid pattern: 漢字 + い (renyokei) vs invalid: 漢字 + いし (fake verb base 漢字いす)
   if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb &&
-      edge.extended_pos == core::ExtendedPOS::VerbRenyokei && grammar::containsKanji(edge.surface) &&
+      edge.extended_pos == core::ExtendedPOS::VerbRenyokei && edgeContainsKanji(edge) &&
       utf8::endsWith(edge.surface, "いし") && edge.surface.size() >= 9) {  // At least 1 kanji + いし (3 + 6 bytes)
     cost += sc::kPenaltyIshiVerbRenyokei;
   }
@@ -482,7 +524,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // E.g., "なさそう" should be な + さ + そう, not なさそう (verb)
   // The そう ending is typically from そう (様態 auxiliary), not a verb stem
   // Valid verbs ending in そう are rare and usually have kanji stems
-  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(edge.surface) &&
+  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(edge) &&
       utf8::endsWith(edge.surface, "そう") && edge.surface.size() >= 9) {  // 3+ chars (at least xそう)
     cost += cost::kRare;
   }
@@ -491,7 +533,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // E.g., "なってき" should be なっ + て + き (来る), not なってき (verb)
   // The てき ending is almost always て (particle) + き/こ (来る auxiliary)
   // Exception: できる is valid but is in dictionary
-  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(edge.surface) &&
+  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(edge) &&
       utf8::endsWith(edge.surface, "てき") && edge.surface.size() >= 9) {  // 3+ chars (at least xてき)
     cost += cost::kVeryRare;
   }
@@ -499,7 +541,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Penalty for pure-hiragana verb candidates ending with まし
   // E.g., "しまし" should be し + まし (masu renyokei), not しまし (verb)
   // The まし ending is almost always ます (polite aux) renyokei form
-  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(edge.surface) &&
+  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(edge) &&
       utf8::endsWith(edge.surface, "まし") && edge.surface.size() >= 9) {  // 3+ chars (at least xまし)
     cost += cost::kVeryRare;
   }
@@ -507,7 +549,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Penalty for pure-hiragana verb candidates ending with てい
   // E.g., "させてい" should be させ + て + い (progressive), not させてい (verb)
   // The てい ending is almost always て (particle) + い (いる renyokei)
-  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(edge.surface) &&
+  if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(edge) &&
       utf8::endsWith(edge.surface, "てい") && edge.surface.size() >= 9) {  // 3+ chars (at least xてい)
     cost += cost::kVeryRare;
   }
@@ -518,7 +560,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // MeCab splits pure-hiragana verb te-forms into verb + て particle
   // Exception: keep short forms (2 chars like して, きて) as they're common L1 entries
   if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb &&
-      edge.extended_pos == core::ExtendedPOS::VerbTeForm && grammar::isPureHiragana(edge.surface) &&
+      edge.extended_pos == core::ExtendedPOS::VerbTeForm && edgeIsPureHiragana(edge) &&
       edge.surface.size() >= 9) {  // 3+ chars (9 bytes) - allows して, きて
     cost += cost::kVeryRare;
   }
@@ -529,7 +571,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // This penalty encourages verb_stem + て particle split
   // Apply to both dict and non-dict candidates as some come from auto-generation
   if (edge.pos == core::PartOfSpeech::Verb && edge.extended_pos == core::ExtendedPOS::VerbTeForm &&
-      grammar::containsKanji(edge.surface) &&
+      edgeContainsKanji(edge) &&
       (utf8::endsWith(edge.surface, "て") || utf8::endsWith(edge.surface, "で")) &&
       edge.surface.size() <= 12) {  // Short te-forms (1-2 kanji + て/で)
     cost += cost::kSevere;          // Very strong penalty to overcome negative costs
@@ -540,7 +582,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Single kanji + いた/いだ pattern is most common (godan i-onbin + ta/da)
   // This penalty encourages verb_onbin + た/だ auxiliary split
   if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Verb &&
-      edge.extended_pos == core::ExtendedPOS::VerbTaForm && grammar::containsKanji(edge.surface) &&
+      edge.extended_pos == core::ExtendedPOS::VerbTaForm && edgeContainsKanji(edge) &&
       (utf8::endsWith(edge.surface, "いた") || utf8::endsWith(edge.surface, "いだ")) &&
       edge.surface.size() <= 12) {  // Short ta-forms (1-2 kanji + いた/いだ)
     cost += cost::kSevere;          // Strong penalty to prefer onbin + auxiliary split
@@ -554,7 +596,7 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
       edge.surface.length() >= 12) {  // ≥4 chars (kanji + ひらがな suffix)
     // Check if surface contains kanji — compound adjective from dictionary
     // Covers both base form (い) and inflected forms (く, かっ, けれ, etc.)
-    if (grammar::containsKanji(edge.surface)) {
+    if (edgeContainsKanji(edge)) {
       // Longer compounds need stronger bonus to beat noun+adj split paths
       // Must overcome NOUN→dict_ADJ surface bonus (-0.5) on the split path
       size_t char_len = suzume::normalize::utf8Length(edge.surface);
@@ -569,26 +611,17 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
   // Registered compounds like "世界中" will also split (accepted difference from MeCab)
   // This helps Suffix 中 candidates win over NOUN compounds
   if (!edge.fromDictionary() && edge.pos == core::PartOfSpeech::Noun && utf8::endsWith(edge.surface, "中") &&
-      grammar::isAllKanji(edge.surface) && edge.surface.size() >= 6) {  // 2+ kanji (at least N中)
+      edgeIsAllKanji(edge) && edge.surface.size() >= 6) {  // 2+ kanji (at least N中)
     cost += sc::kPenaltyKanjiChuuCompound;
   }
 
-  // Debug output - show which cost was used and candidate origin (verbose level)
+  // Debug output - show which cost was used (verbose level)
   SUZUME_DEBUG_VERBOSE_BLOCK {
     // Base source type
     const char* source = edge.fromDictionary() ? "dict" : edge.isUnknown() ? "unk" : "infl";
     const char* cost_from = (edge.cost != 0.0F) ? "edge" : "category";
 
     SUZUME_DEBUG_STREAM << "[WORD] \"" << edge.surface << "\" (" << source;
-#ifdef SUZUME_DEBUG_INFO
-    // Show detailed origin if available (e.g., "dict:adj_i", "unk:verb_kanji")
-    if (edge.origin != CandidateOrigin::Unknown) {
-      SUZUME_DEBUG_STREAM << ":" << core::originToString(edge.origin);
-    }
-    if (!edge.origin_detail.empty()) {
-      SUZUME_DEBUG_STREAM << "/" << edge.origin_detail;
-    }
-#endif
     SUZUME_DEBUG_STREAM << ") cost=" << cost << " (from " << cost_from << ")";
     SUZUME_DEBUG_STREAM << " [cat=" << category_cost;
     if (edge.cost != 0.0F) {
@@ -601,16 +634,8 @@ float Scorer::wordCost(const core::LatticeEdge& edge) const {
     if (edge.extended_pos == core::ExtendedPOS::Unknown) {
       SUZUME_DEBUG_STREAM << "(!UNKNOWN)";  // Warning: missing mapping
     } else if (edge.extended_pos != default_epos) {
-#ifdef SUZUME_DEBUG_INFO
-      // Show where the ExtendedPOS was set (e.g., "binary_dict", "l1_dict", "candidate_gen")
-      if (!edge.epos_source.empty()) {
-        SUZUME_DEBUG_STREAM << "(from:" << edge.epos_source << ")";
-      } else {
-        SUZUME_DEBUG_STREAM << "(explicit)";
-      }
-#else
-      SUZUME_DEBUG_STREAM << "(explicit)";  // Explicitly set, different from default
-#endif
+      // Where it was set is in the lattice's EdgeDebugInfo (printed by the Viterbi trace)
+      SUZUME_DEBUG_STREAM << "(explicit)";
     }
     SUZUME_DEBUG_STREAM << "]";
     // Highlight non-dictionary candidates (potential spurious entries)
@@ -642,7 +667,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Only when verb contains kanji to prevent false splits in hiragana sequences
   // (e.g., おこがましい → おこ+がましい would be wrong)
   if (prev.extended_pos == core::ExtendedPOS::VerbRenyokei && next.extended_pos == core::ExtendedPOS::AdjBasic &&
-      grammar::containsKanji(prev.surface)) {
+      edgeContainsKanji(prev)) {
     surface_bonus += cost::kExtraStrongBonus;
   }
 
@@ -650,7 +675,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // In modern Japanese, conjunction し follows shuushikei (行く+し), not renyoukei (行き+し).
   // VerbRenyokei + し is usually a false split of godan-sa renyoukei (尽く+し → 尽くし).
   if (prev.extended_pos == core::ExtendedPOS::VerbRenyokei && next.surface == "し" &&
-      next.extended_pos == core::ExtendedPOS::ParticleConj && grammar::containsKanji(prev.surface)) {
+      next.extended_pos == core::ExtendedPOS::ParticleConj && edgeContainsKanji(prev)) {
     surface_bonus += cost::kMinor;  // Penalty to discourage false split
   }
 
@@ -789,7 +814,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // from stealing た bonus over AUX_丁寧 path (参加してきました)
   if (prev.extended_pos == core::ExtendedPOS::VerbRenyokei && next.surface == "た" &&
       next.extended_pos == core::ExtendedPOS::AuxTenseTa &&
-      (grammar::containsKanji(prev.surface) || prev.fromDictionary())) {
+      (edgeContainsKanji(prev) || prev.fromDictionary())) {
     surface_bonus += cost::kVeryStrongBonus;
   }
 
@@ -799,7 +824,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Exclude pure hiragana onbin forms (ぴっ, ばっ) which are onomatopoeia, not verbs
   if ((prev.extended_pos == core::ExtendedPOS::VerbRenyokei || prev.extended_pos == core::ExtendedPOS::VerbOnbinkei) &&
       (next.surface == "たり" || next.surface == "だり") && next.extended_pos == core::ExtendedPOS::ParticleConj &&
-      grammar::containsKanji(prev.surface)) {
+      edgeContainsKanji(prev)) {
     surface_bonus += cost::kVeryStrongBonus;
   }
 
@@ -928,7 +953,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Exception: "い" (いる renyokei) has specific bonus rule below for PART_格→い pattern
   if (prev.extended_pos == core::ExtendedPOS::ParticleCase &&
       prev.surface.size() <= 3 &&  // Single hiragana char (3 bytes in UTF-8)
-      next.pos == core::PartOfSpeech::Verb && !next.fromDictionary() && grammar::isPureHiragana(next.surface) &&
+      next.pos == core::PartOfSpeech::Verb && !next.fromDictionary() && edgeIsPureHiragana(next) &&
       next.surface.size() <= 6 &&  // 2 chars or less (6 bytes in UTF-8)
       next.surface != "い") {      // Exclude い - has specific rule
     surface_bonus += cost::kAlmostNever;
@@ -941,7 +966,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Exception: い (renyokei of いる) - valid in ずにはいられない pattern
   // Exception: し (renyokei of する) - valid in emphatic negation ありはしない pattern
   if (prev.extended_pos == core::ExtendedPOS::ParticleTopic && prev.surface == "は" &&
-      next.pos == core::PartOfSpeech::Verb && grammar::isPureHiragana(next.surface) &&
+      next.pos == core::PartOfSpeech::Verb && edgeIsPureHiragana(next) &&
       next.surface.size() <= 3 &&  // 1 char only (3 bytes in UTF-8)
       next.surface != "い" &&      // い+られ is valid (いる potential)
       next.surface != "し") {      // し+ない is valid (emphatic negation)
@@ -952,7 +977,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // E.g., ふんど+し should be ふんどし (one word), not noun+する連用形
   // Pure hiragana unknown sequences split before し/き/etc. are usually wrong
   // Does not apply when prev is a known particle/aux (those have specific EPOS)
-  if (prev.pos == core::PartOfSpeech::Other && grammar::isPureHiragana(prev.surface) &&
+  if (prev.pos == core::PartOfSpeech::Other && edgeIsPureHiragana(prev) &&
       prev.surface.size() >= 6 &&                                                          // 2+ hiragana chars
       next.extended_pos == core::ExtendedPOS::VerbRenyokei && next.surface.size() <= 3) {  // Single char (し, き, etc.)
     surface_bonus += cost::kUncommon;
@@ -964,9 +989,9 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // okurigana (読み+残す), not a standalone unknown token
   // E.g., 先生+き(OTHER) should lose to 先+生きのこる
   // Needs a very high penalty to overcome prefix compound bonus advantages
-  if (prev.pos == core::PartOfSpeech::Noun && grammar::containsKanji(prev.surface) &&
+  if (prev.pos == core::PartOfSpeech::Noun && edgeContainsKanji(prev) &&
       next.pos == core::PartOfSpeech::Other && next.surface.size() == 3 &&  // Single char = 3 bytes UTF-8
-      grammar::isPureHiragana(next.surface)) {
+      edgeIsPureHiragana(next)) {
     surface_bonus += cost::kAlmostNever;
   }
 
@@ -975,7 +1000,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // causing splits like こんな+伸+びる instead of こんな+伸びる
   // Valid DET+NOUN patterns (こんな+事, あんな+人) use dict nouns or multi-char nouns
   if (prev.pos == core::PartOfSpeech::Determiner && next.pos == core::PartOfSpeech::Noun && !next.fromDictionary() &&
-      grammar::containsKanji(next.surface) && suzume::normalize::utf8Length(next.surface) == 1) {
+      edgeContainsKanji(next) && suzume::normalize::utf8Length(next.surface) == 1) {
     surface_bonus += cost::kStrong;
   }
 
@@ -986,7 +1011,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // (kanji + 1 trailing hiragana, e.g., 先生き, 出来事み) are rare after DET
   if (prev.pos == core::PartOfSpeech::Determiner && next.pos == core::PartOfSpeech::Noun && !next.fromDictionary()) {
     size_t char_len = suzume::normalize::utf8Length(next.surface);
-    if (char_len >= 3 && grammar::containsKanji(next.surface) && !grammar::isAllKanji(next.surface)) {
+    if (char_len >= 3 && edgeContainsKanji(next) && !edgeIsAllKanji(next)) {
       // Check if surface ends with exactly 1 hiragana (nominalized pattern)
       auto codepoints = normalize::toCodepoints(next.surface);
       if (!codepoints.empty() && kana::isHiraganaCodepoint(codepoints.back()) && codepoints.size() >= 2 &&
@@ -1008,7 +1033,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Valid お+verb patterns: お待ち, お願い (longer, often with kanji)
   // Note: 「い」 is in L1 dictionary as verb renyokei, so don't check fromDictionary
   if (prev.pos == core::PartOfSpeech::Prefix && next.pos == core::PartOfSpeech::Verb &&
-      grammar::isPureHiragana(next.surface) && next.surface.size() <= 6) {  // 2 chars or less
+      edgeIsPureHiragana(next) && next.surface.size() <= 6) {  // 2 chars or less
     surface_bonus += cost::kAlmostNever;
   }
 
@@ -1016,7 +1041,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // E.g., お+はよう in おはよう - はよう is not a real verb
   // Valid patterns like お+待ち have kanji, お+召し would be in dictionary
   if (prev.pos == core::PartOfSpeech::Prefix && next.pos == core::PartOfSpeech::Verb && !next.fromDictionary() &&
-      grammar::isPureHiragana(next.surface) && next.surface.size() == 9) {  // Exactly 3 chars (9 bytes)
+      edgeIsPureHiragana(next) && next.surface.size() == 9) {  // Exactly 3 chars (9 bytes)
     surface_bonus += cost::kAlmostNever;
   }
 
@@ -1027,7 +1052,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Exception: dictionary verbs like ね(寝る), み(見る), で(出る) are valid
   bool is_dict_verb_renyokei = core::hasFlag(next.flags, core::EdgeFlags::FromDictionary);
   if (prev.pos == core::PartOfSpeech::Adverb && next.extended_pos == core::ExtendedPOS::VerbRenyokei &&
-      grammar::isPureHiragana(next.surface) && next.surface.size() <= 3 &&  // 1 char only (し, み, etc.)
+      edgeIsPureHiragana(next) && next.surface.size() <= 3 &&  // 1 char only (し, み, etc.)
       !is_dict_verb_renyokei) {
     surface_bonus += cost::kVeryRare;
   }
@@ -1043,7 +1068,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // E.g., 東京（とうきょう） - the hiragana in parentheses is reading/furigana
   // Long hiragana sequences after symbols should stay as single tokens
   if (prev.pos == core::PartOfSpeech::Symbol && next.pos == core::PartOfSpeech::Other &&
-      grammar::isPureHiragana(next.surface) && next.surface.size() >= 12) {  // 4+ chars (12 bytes in UTF-8)
+      edgeIsPureHiragana(next) && next.surface.size() >= 12) {  // 4+ chars (12 bytes in UTF-8)
     surface_bonus += cost::kVeryStrongBonus;
   }
 
@@ -1091,7 +1116,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   //   (目的, 動的, 知的), 2+ char + 的 still splits via bigram bonus (論理+的)
   if (prev.pos == core::PartOfSpeech::Noun && next.pos == core::PartOfSpeech::Suffix &&
       prev.surface.size() == core::kJapaneseCharBytes && next.surface.size() == core::kJapaneseCharBytes &&
-      grammar::isAllKanji(prev.surface) && next.surface != "様" && next.surface != "氏") {
+      edgeIsAllKanji(prev) && next.surface != "様" && next.surface != "氏") {
     surface_bonus += cost::kRare;  // +1.0 to counteract -0.8 bonus
   }
 
@@ -1103,8 +1128,8 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // 政治学 were in dict) keep the bonus, since they represent intended compounds.
   if (prev.pos == core::PartOfSpeech::Noun && next.pos == core::PartOfSpeech::Suffix &&
       !prev.fromDictionary() && prev.surface.size() >= 3 * core::kJapaneseCharBytes &&
-      next.surface.size() == core::kJapaneseCharBytes && grammar::isAllKanji(prev.surface) &&
-      grammar::isAllKanji(next.surface)) {
+      next.surface.size() == core::kJapaneseCharBytes && edgeIsAllKanji(prev) &&
+      edgeIsAllKanji(next)) {
     surface_bonus += cost::kRare;  // +1.0 to neutralize -0.8 bigram bonus
   }
 
@@ -1179,7 +1204,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   if (prev.extended_pos == core::ExtendedPOS::VerbRenyokei &&
       (next.extended_pos == core::ExtendedPOS::AuxPassive || next.extended_pos == core::ExtendedPOS::AuxCausative) &&
       prev.surface.size() <= 3 &&                                       // Single hiragana (3 bytes)
-      grammar::isPureHiragana(prev.surface) && prev.surface != "い") {  // い+られ is valid (いる potential)
+      edgeIsPureHiragana(prev) && prev.surface != "い") {  // い+られ is valid (いる potential)
     surface_bonus += cost::kAlmostNever;                                // Strongly discourage
   }
 
@@ -1190,7 +1215,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Exception: み (みる auxiliary = "try") after て is valid (食べて+み+たい)
   if (prev.extended_pos == core::ExtendedPOS::ParticleConj && next.extended_pos == core::ExtendedPOS::VerbRenyokei &&
       next.surface.size() <= 3 &&  // Single hiragana (3 bytes)
-      grammar::isPureHiragana(next.surface) && prev.surface != "たり" && prev.surface != "だり" &&
+      edgeIsPureHiragana(next) && prev.surface != "たり" && prev.surface != "だり" &&
       next.surface != "み") {
     surface_bonus += cost::kAlmostNever;  // Strongly discourage
   }
@@ -1324,7 +1349,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // because ADJ_語幹→すぎ has a very strong surface bonus (-3.2)
   // Only apply to all-kanji surfaces (not katakana/verb renyokei)
   if (prev.pos == core::PartOfSpeech::Noun && prev.surface.size() >= 6 &&  // 2+ chars (6+ bytes)
-      grammar::isAllKanji(std::string(prev.surface)) && next.surface.size() >= 6 &&
+      edgeIsAllKanji(prev) && next.surface.size() >= 6 &&
       next.surface.compare(0, 6, "すぎ") == 0) {
     surface_bonus += cost::kVeryStrongBonus * 2;
   }
@@ -1343,7 +1368,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // The short hiragana verb ね (寝る renyokei) competes with final particle ね
   // This penalty ensures particle interpretation wins in よね, なね, etc. patterns
   if (prev.extended_pos == core::ExtendedPOS::ParticleFinal && next.extended_pos == core::ExtendedPOS::VerbRenyokei &&
-      grammar::isPureHiragana(next.surface) && next.surface.size() <= 3) {  // Single hiragana (3 bytes)
+      edgeIsPureHiragana(next) && next.surface.size() <= 3) {  // Single hiragana (3 bytes)
     surface_bonus += cost::kRare;
   }
 
@@ -1363,7 +1388,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Short hiragana verbs followed by ん are often mis-segmented names
   // Valid patterns like 押さ+ん (kanji verb) have non-hiragana stems
   // ん can be AUX_否定古 or PART_準体, both should be penalized
-  if (prev.extended_pos == core::ExtendedPOS::VerbMizenkei && grammar::isPureHiragana(prev.surface) &&
+  if (prev.extended_pos == core::ExtendedPOS::VerbMizenkei && edgeIsPureHiragana(prev) &&
       prev.surface.size() <= 6 &&  // 2 chars or less (6 bytes in UTF-8)
       next.surface == "ん") {
     surface_bonus += cost::kAlmostNever;
@@ -1375,7 +1400,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Long verbs (かかわら+ず) and kanji verbs (表さ+ず) are productive grammar
   // Lexicalized forms like 思わず have their own dict entries (ADV) that win anyway
   // Note: ん, ぬ, まい, ざる, ざれ excluded — common productive patterns
-  if (prev.pos == core::PartOfSpeech::Verb && prev.fromDictionary() && grammar::isPureHiragana(prev.surface) &&
+  if (prev.pos == core::PartOfSpeech::Verb && prev.fromDictionary() && edgeIsPureHiragana(prev) &&
       prev.surface.size() <= 9 &&  // ≤3 hiragana chars (9 bytes)
       next.extended_pos == core::ExtendedPOS::AuxNegativeNu && next.surface != "ん" && next.surface != "ぬ" &&
       next.surface != "まい" && next.surface != "ざる" && next.surface != "ざれ") {
@@ -1488,7 +1513,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Use small penalty (0.08) to tip balance: はなし gap=0.013, なんし gap=0.102
   if (prev.pos == core::PartOfSpeech::Noun && prev.fromDictionary() &&
       next.extended_pos == core::ExtendedPOS::VerbRenyokei && next.surface == "し" &&
-      grammar::isPureHiragana(prev.surface)) {
+      edgeIsPureHiragana(prev)) {
     surface_bonus += sc::kPenaltyHiraganaNounToSuruTip;
   }
 
@@ -1708,7 +1733,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // E.g., もも|もも is less likely than もも|も|もも (particle between)
   // This prevents すもももも... from being split as もも|もも|もの
   if (prev.pos == core::PartOfSpeech::Noun && next.pos == core::PartOfSpeech::Noun && prev.surface == next.surface &&
-      grammar::isPureHiragana(prev.surface)) {
+      edgeIsPureHiragana(prev)) {
     surface_bonus += cost::kVeryRare;
   }
 
@@ -1716,7 +1741,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // E.g., すもも|も|もも should beat すもも|もも (particle interpretation)
   // E.g., もも|の|うち should beat もの|うち (particle interpretation)
   // This helps famous test sentence: すもももももももものうち
-  if (prev.pos == core::PartOfSpeech::Noun && prev.fromDictionary() && grammar::isPureHiragana(prev.surface) &&
+  if (prev.pos == core::PartOfSpeech::Noun && prev.fromDictionary() && edgeIsPureHiragana(prev) &&
       next.pos == core::PartOfSpeech::Particle && (next.surface == "も" || next.surface == "の")) {
     surface_bonus += cost::kModerateBonus;
   }
@@ -1729,7 +1754,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Valid kanji+hiragana た-forms like 食べた are not affected (not pure hiragana)
   if ((prev.pos == core::PartOfSpeech::Noun || prev.pos == core::PartOfSpeech::Pronoun) &&
       next.extended_pos == core::ExtendedPOS::VerbTaForm && !next.fromDictionary() &&
-      grammar::isPureHiragana(next.surface) && next.surface.size() <= 12) {  // 4 chars or less (12 bytes in UTF-8)
+      edgeIsPureHiragana(next) && next.surface.size() <= 12) {  // 4 chars or less (12 bytes in UTF-8)
     surface_bonus += cost::kVeryRare;
   }
 
@@ -1745,8 +1770,8 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // E.g., 分+から should be 分から (single verb), not 分(NOUN) + から(VERB かる)
   // When a dictionary entry exists for combined form, penalize the split
   if (prev.pos == core::PartOfSpeech::Noun && prev.surface.size() == core::kJapaneseCharBytes &&  // Single kanji
-      grammar::isAllKanji(prev.surface) && next.extended_pos == core::ExtendedPOS::VerbMizenkei &&
-      !next.fromDictionary() && grammar::isPureHiragana(next.surface)) {
+      edgeIsAllKanji(prev) && next.extended_pos == core::ExtendedPOS::VerbMizenkei &&
+      !next.fromDictionary() && edgeIsPureHiragana(next)) {
     surface_bonus += cost::kVeryRare;  // Penalize split to favor combined dict verb
   }
 
@@ -1780,7 +1805,7 @@ float Scorer::connectionCost(const core::LatticeEdge& prev, const core::LatticeE
   // Exception: kanji verbs (見, 寝, 出) are unambiguous and valid after adverbs (初めて+見+た)
   if (prev.pos == core::PartOfSpeech::Adverb && next.extended_pos == core::ExtendedPOS::VerbRenyokei &&
       next.surface.size() <= 3 &&               // Single kana (3 bytes)
-      grammar::isPureHiragana(next.surface) &&  // Only hiragana (で, し), not kanji (見, 出)
+      edgeIsPureHiragana(next) &&  // Only hiragana (で, し), not kanji (見, 出)
       !core::hasFlag(next.flags, core::EdgeFlags::FromDictionary)) {
     surface_bonus += cost::kVeryRare;
   }
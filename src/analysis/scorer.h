@@ -107,7 +107,7 @@ class Scorer : public IScorer {
   /**
    * @brief Calculate word cost
    * @param edge Lattice edge
-   * @return Word cost
+   * @return Word cost (edge.cost unchanged if LatticeEdge::final_cost is set)
    */
   float wordCost(const core::LatticeEdge& edge) const override;
 
@@ -0,0 +1,66 @@
+/**
+ * @file sentence_boundary.h
+ * @brief Sentence boundary detection shared by chunking and incremental analysis
+ */
+
+#ifndef SUZUME_ANALYSIS_SENTENCE_BOUNDARY_H_
+#define SUZUME_ANALYSIS_SENTENCE_BOUNDARY_H_
+
+#include <cstddef>
+#include <string_view>
+
+namespace suzume::analysis {
+
+/**
+ * @brief Check if byte position is a sentence boundary character
+ *
+ * Boundaries are \n, !, ?, 。, ！ and ？. A sentence ends immediately
+ * after the boundary character.
+ *
+ * @return Number of bytes to include (0 if not a boundary)
+ */
+inline size_t sentenceBoundaryLen(std::string_view text, size_t pos) {
+  auto c = static_cast<unsigned char>(text[pos]);
+  // ASCII: \n, !, ?
+  if (c == '\n' || c == '!' || c == '?') {
+    return 1;
+  }
+  // 3-byte UTF-8 sequences
+  if (pos + 2 < text.size() && c == 0xE3) {
+    auto c1 = static_cast<unsigned char>(text[pos + 1]);
+    auto c2 = static_cast<unsigned char>(text[pos + 2]);
+    // 。(U+3002) = E3 80 82
+    if (c1 == 0x80 && c2 == 0x82)
+      return 3;
+  }
+  if (pos + 2 < text.size() && c == 0xEF) {
+    auto c1 = static_cast<unsigned char>(text[pos + 1]);
+    auto c2 = static_cast<unsigned char>(text[pos + 2]);
+    // ！(U+FF01) = EF BC 81
+    if (c1 == 0xBC && c2 == 0x81)
+      return 3;
+    // ？(U+FF1F) = EF BC 9F
+    if (c1 == 0xBC && c2 == 0x9F)
+      return 3;
+  }
+  return 0;
+}
+
+/**
+ * @brief Byte position just past the next sentence boundary at or after pos
+ * @return text.size() if no boundary follows
+ */
+inline size_t findSentenceEnd(std::string_view text, size_t pos) {
+  while (pos < text.size()) {
+    size_t blen = sentenceBoundaryLen(text, pos);
+    if (blen > 0) {
+      return pos + blen;
+    }
+    ++pos;
+  }
+  return text.size();
+}
+
+}  // namespace suzume::analysis
+
+#endif  // SUZUME_ANALYSIS_SENTENCE_BOUNDARY_H_
@@ -0,0 +1,138 @@
+/**
+ * @file sentence_cache.cpp
+ * @brief Bounded cache of per-sentence analysis results
+ */
+
+#include "analysis/sentence_cache.h"
+
+#include <functional>
+
+namespace suzume::analysis {
+
+uint64_t SentenceCacheKey::hash() const {
+  uint64_t value = std::hash<std::string_view>{}(text);
+  auto mix = [&value](uint64_t extra) { value ^= extra + 0x9e3779b97f4a7c15ULL + (value << 6) + (value >> 2); };
+  mix(static_cast<uint64_t>(mode));
+  mix(dict_generation);
+  mix(options_fingerprint);
+  return value;
+}
+
+SentenceCache::SentenceCache(size_t capacity, size_t max_memory_bytes)
+    : capacity_(capacity), max_memory_bytes_(max_memory_bytes) {}
+
+bool SentenceCache::lookup(const SentenceCacheKey& key, std::vector<core::Morpheme>& out) {
+  if (capacity_ == 0) {
+    return false;
+  }
+  ++stats_.lookups;
+
+  auto iter = index_.find(key.hash());
+  if (iter == index_.end()) {
+    return false;
+  }
+  const Entry& entry = *iter->second;
+  if (entry.text != key.text || entry.mode != key.mode || entry.dict_generation != key.dict_generation ||
+      entry.options_fingerprint != key.options_fingerprint) {
+    return false;
+  }
+
+  lru_.splice(lru_.begin(), lru_, iter->second);
+  out = entry.morphemes;
+  ++stats_.hits;
+  return true;
+}
+
+void SentenceCache::insert(const SentenceCacheKey& key, const std::vector<core::Morpheme>& morphemes) {
+  if (capacity_ == 0) {
+    return;
+  }
+
+  uint64_t hash = key.hash();
+  auto iter = index_.find(hash);
+  if (iter != index_.end()) {
+    // Same key re-analyzed, or a hash collision: replace in place
+    stats_.memory_bytes -= iter->second->memory_bytes;
+    lru_.erase(iter->second);
+    index_.erase(iter);
+  }
+
+  while (lru_.size() >= capacity_) {
+    evictLast();
+  }
+
+  Entry entry;
+  entry.hash = hash;
+  entry.text.assign(key.text);
+  entry.mode = key.mode;
+  entry.dict_generation = key.dict_generation;
+  entry.options_fingerprint = key.options_fingerprint;
+  entry.morphemes = morphemes;
+  entry.memory_bytes = entryMemory(entry);
+  if (max_memory_bytes_ != 0) {
+    if (entry.memory_bytes > max_memory_bytes_) {
+      return;  // Would not fit even in an empty cache
+    }
+    while (!lru_.empty() && stats_.memory_bytes + entry.memory_bytes > max_memory_bytes_) {
+      evictLast();
+    }
+  }
+
+  stats_.memory_bytes += entry.memory_bytes;
+  lru_.push_front(std::move(entry));
+  index_.emplace(hash, lru_.begin());
+  ++stats_.insertions;
+}
+
+void SentenceCache::evictLast() {
+  const Entry& victim = lru_.back();
+  stats_.memory_bytes -= victim.memory_bytes;
+  index_.erase(victim.hash);
+  lru_.pop_back();
+  ++stats_.evictions;
+}
+
+void SentenceCache::clear() {
+  lru_.clear();
+  index_.clear();
+  stats_.memory_bytes = 0;
+}
+
+SentenceCacheStats SentenceCache::stats() const {
+  SentenceCacheStats result = stats_;
+  result.entries = lru_.size();
+  return result;
+}
+
+size_t SentenceCache::entryMemory(const Entry& entry) {
+  // List node + index slot + owned strings/vectors
+  size_t bytes = sizeof(Entry) + 2 * sizeof(void*) + sizeof(std::pair<const uint64_t, std::list<Entry>::iterator>);
+  bytes += entry.text.capacity();
+  bytes += entry.morphemes.capacity() * sizeof(core::Morpheme);
+  for (const auto& morpheme : entry.morphemes) {
+    bytes += morpheme.surface.capacity() + morpheme.lemma.capacity();
+  }
+  return bytes;
+}
+
+bool SharedSentenceCache::lookup(const SentenceCacheKey& key, std::vector<core::Morpheme>& out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return SentenceCache::lookup(key, out);
+}
+
+void SharedSentenceCache::insert(const SentenceCacheKey& key, const std::vector<core::Morpheme>& morphemes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  SentenceCache::insert(key, morphemes);
+}
+
+void SharedSentenceCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  SentenceCache::clear();
+}
+
+SentenceCacheStats SharedSentenceCache::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return SentenceCache::stats();
+}
+
+}  // namespace suzume::analysis
@@ -0,0 +1,153 @@
+/**
+ * @file sentence_cache.h
+ * @brief Bounded cache of per-sentence analysis results
+ *
+ * Feeds with boilerplate, reposts and templated text analyze the same
+ * sentence over and over. The cache maps a normalized sentence (plus
+ * analysis mode, dictionary generation and analyzer options) to its
+ * morpheme sequence with sentence-relative offsets, so a hit skips lattice
+ * construction and Viterbi entirely.
+ */
+
+#ifndef SUZUME_ANALYSIS_SENTENCE_CACHE_H_
+#define SUZUME_ANALYSIS_SENTENCE_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "core/morpheme.h"
+#include "core/types.h"
+
+namespace suzume::analysis {
+
+/**
+ * @brief Cache lookup key
+ */
+struct SentenceCacheKey {
+  std::string_view text;  // Normalized sentence
+  core::AnalysisMode mode{core::AnalysisMode::Normal};
+  uint64_t dict_generation{0};      // DictionaryManager::generation()
+  uint64_t options_fingerprint{0};  // Analyzer::optionsFingerprint()
+
+  /**
+   * @brief 64-bit hash of all key fields
+   */
+  uint64_t hash() const;
+};
+
+/**
+ * @brief Sentence cache statistics
+ */
+struct SentenceCacheStats {
+  size_t lookups{0};
+  size_t hits{0};
+  size_t insertions{0};
+  size_t evictions{0};
+  size_t entries{0};       // Current number of cached sentences
+  size_t memory_bytes{0};  // Approximate heap usage of cached entries
+
+  double hitRate() const { return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups); }
+};
+
+/**
+ * @brief LRU cache of morpheme sequences keyed by normalized sentence
+ *
+ * Single-threaded; see SharedSentenceCache for concurrent use. Entries are
+ * verified against the full key on lookup, so a hash collision is a miss,
+ * never a wrong result.
+ *
+ * Analyzers with different options or dictionaries can share a cache:
+ * mode, dictionary generation and an options fingerprint are part of the
+ * key, so they only reuse each other's entries when all of them match.
+ */
+class SentenceCache {
+ public:
+  /**
+   * @param capacity Maximum number of cached sentences (0 disables caching)
+   * @param max_memory_bytes Evict least recently used entries while the
+   *        approximate heap usage exceeds this (0 = no byte limit)
+   */
+  explicit SentenceCache(size_t capacity, size_t max_memory_bytes = 0);
+  virtual ~SentenceCache() = default;
+
+  SentenceCache(const SentenceCache&) = delete;
+  SentenceCache& operator=(const SentenceCache&) = delete;
+  SentenceCache(SentenceCache&&) = delete;
+  SentenceCache& operator=(SentenceCache&&) = delete;
+
+  /**
+   * @brief Look up a sentence
+   * @param key Cache key
+   * @param out Receives a copy of the cached morphemes (sentence-relative offsets)
+   * @return true on hit
+   */
+  virtual bool lookup(const SentenceCacheKey& key, std::vector<core::Morpheme>& out);
+
+  /**
+   * @brief Insert or replace a sentence result (offsets must be sentence-relative)
+   */
+  virtual void insert(const SentenceCacheKey& key, const std::vector<core::Morpheme>& morphemes);
+
+  /**
+   * @brief Remove all entries (statistics counters are kept)
+   */
+  virtual void clear();
+
+  /**
+   * @brief Snapshot of statistics
+   */
+  virtual SentenceCacheStats stats() const;
+
+  size_t capacity() const { return capacity_; }
+  size_t maxMemoryBytes() const { return max_memory_bytes_; }
+
+ private:
+  struct Entry {
+    uint64_t hash{0};
+    std::string text;
+    core::AnalysisMode mode{core::AnalysisMode::Normal};
+    uint64_t dict_generation{0};
+    uint64_t options_fingerprint{0};
+    std::vector<core::Morpheme> morphemes;
+    size_t memory_bytes{0};
+  };
+
+  size_t capacity_;
+  size_t max_memory_bytes_;
+  std::list<Entry> lru_;  // Most recently used at front
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> index_;
+  SentenceCacheStats stats_;
+
+  static size_t entryMemory(const Entry& entry);
+  void evictLast();
+};
+
+/**
+ * @brief Thread-safe SentenceCache for sharing between analyzer instances
+ *
+ * Suzume instances are single-threaded; a worker pool typically creates one
+ * instance per thread and shares one SharedSentenceCache between them.
+ */
+class SharedSentenceCache : public SentenceCache {
+ public:
+  explicit SharedSentenceCache(size_t capacity, size_t max_memory_bytes = 0)
+      : SentenceCache(capacity, max_memory_bytes) {}
+
+  bool lookup(const SentenceCacheKey& key, std::vector<core::Morpheme>& out) override;
+  void insert(const SentenceCacheKey& key, const std::vector<core::Morpheme>& morphemes) override;
+  void clear() override;
+  SentenceCacheStats stats() const override;
+
+ private:
+  mutable std::mutex mutex_;
+};
+
+}  // namespace suzume::analysis
+
+#endif  // SUZUME_ANALYSIS_SENTENCE_CACHE_H_
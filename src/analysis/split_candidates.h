@@ -14,6 +14,7 @@
 #include <string_view>
 #include <vector>
 
+#include "analysis/chunk_context.h"
 #include "analysis/scorer.h"
 #include "core/lattice.h"
 #include "dictionary/dictionary.h"
@@ -34,15 +35,14 @@ namespace suzume::analysis {
  *   "3月" → merged as single noun with bonus
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param scorer Scorer for POS priors
  */
-void addMixedScriptCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                              size_t start_pos, const std::vector<normalize::CharType>& char_types,
-                              const Scorer& scorer, const dictionary::DictionaryManager& dict_manager);
+void addMixedScriptCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                              const std::vector<normalize::CharType>& char_types, const Scorer& scorer,
+                              const dictionary::DictionaryManager& dict_manager);
 
 /**
  * @brief Add compound noun split candidates
@@ -55,14 +55,13 @@ void addMixedScriptCandidates(core::Lattice& lattice, std::string_view text, con
  *   "人工知能研究所" → ["人工知能" + "研究所", ...]
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param dict_manager Dictionary manager for lookups
  */
-void addCompoundSplitCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                                size_t start_pos, const std::vector<normalize::CharType>& char_types,
+void addCompoundSplitCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                const std::vector<normalize::CharType>& char_types,
                                 const dictionary::DictionaryManager& dict_manager, const Scorer& scorer);
 
 /**
@@ -76,16 +75,14 @@ void addCompoundSplitCandidates(core::Lattice& lattice, std::string_view text, c
  *   "日本語話す" → ["日本語" + "話す"] (noun + verb)
  *
  * @param lattice Lattice to add candidates to
- * @param text Original text
- * @param codepoints Unicode codepoints
+ * @param chunk Chunk accessor (text, codepoints, byte offsets, inflection memo)
  * @param start_pos Starting position in codepoints
  * @param char_types Character types for each position
  * @param dict_manager Dictionary manager for lookups
  */
-void addNounVerbSplitCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                                size_t start_pos, const std::vector<normalize::CharType>& char_types,
-                                const dictionary::DictionaryManager& dict_manager, const Scorer& scorer,
-                                const grammar::Inflection& inflection);
+void addNounVerbSplitCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                const std::vector<normalize::CharType>& char_types,
+                                const dictionary::DictionaryManager& dict_manager, const Scorer& scorer);
 
 }  // namespace suzume::analysis
 
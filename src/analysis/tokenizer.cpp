@@ -11,7 +11,13 @@
 
 #include "analysis/tokenizer.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
 #include "analysis/category_cost.h"
+#include "analysis/generator_prefilter.h"
 #include "core/debug.h"
 #include "core/utf8_constants.h"
 #include "join_candidates.h"
@@ -33,38 +39,159 @@ Tokenizer::Tokenizer(const dictionary::DictionaryManager& dict_manager, const Sc
       mode_(mode) {}
 
 core::Lattice Tokenizer::buildLattice(std::string_view text, const std::vector<char32_t>& codepoints,
-                                      const std::vector<normalize::CharType>& char_types) const {
+                                      const std::vector<normalize::CharType>& char_types, core::AnalysisStats* stats,
+                                      bool time_generators, bool multi_granular, const LatticeBudget& budget,
+                                      bool* degraded) const {
   core::Lattice lattice(codepoints.size());
+  {
+    std::vector<uint8_t> char_classes(char_types.size());
+    for (size_t idx = 0; idx < char_types.size(); ++idx) {
+      char_classes[idx] = normalize::charTypeBit(char_types[idx]);
+    }
+    lattice.setCharClasses(std::move(char_classes));
+  }
+  if (entry_word_costs_generation_ != dict_manager_.generation()) {
+    entry_word_costs_.assign(dict_manager_.sharedEntryCount(), std::numeric_limits<float>::quiet_NaN());
+    entry_word_costs_generation_ = dict_manager_.generation();
+  }
+  // No inflection results are held between chunks, so the cache can be bounded here
+  inflection_.trimCache();
+  ChunkContext chunk(text, codepoints, inflection_);
+  if (dict_manager_.hasConjugationIndex()) {
+    chunk.setConjugationIndex(&dict_manager_);
+  }
+  if (budget.hasDeadline()) {
+    chunk.setDeadline(budget.deadline);
+  }
+  GeneratorPrefilter prefilter(codepoints, joinGeneratorTriggers());
+
+  // Work budget state: edges at the start of the current position, and
+  // whether the chunk budget or deadline restricted us to the dictionary
+  size_t position_first_edge = 0;
+  bool dictionary_only = false;
+  bool cut_short = false;
+  auto within_budget = [&](core::GeneratorKind kind) {
+    if (kind == core::GeneratorKind::Dictionary) {
+      return true;
+    }
+    if (dictionary_only || (budget.max_edges_per_position != 0 &&
+                            lattice.edgeCount() - position_first_edge >= budget.max_edges_per_position)) {
+      cut_short = true;
+      return false;
+    }
+    return true;
+  };
+
+  // Run one generator at `pos` unless the budget or its prefilter rules the
+  // position out, attributing its edges (and optionally time) to `kind`.
+  // Edges past the per-position budget are dropped again, so a generator
+  // that starts under it cannot overshoot.
+  auto run = [&lattice, &prefilter, &within_budget, &budget, &cut_short, stats, time_generators](
+                 core::GeneratorKind kind, size_t pos, auto&& generate) {
+    if (!within_budget(kind)) {
+      return;
+    }
+    if (!prefilter.mayApply(kind, pos)) {
+      if (stats != nullptr) {
+        ++stats->generator(kind).skipped;
+      }
+      return;
+    }
+    auto generate_capped = [&] {
+      generate();
+      if (budget.max_edges_per_position != 0 && lattice.capEdgesAt(pos, budget.max_edges_per_position) > 0) {
+        cut_short = true;
+      }
+    };
+    if (stats == nullptr) {
+      generate_capped();
+      return;
+    }
+    auto& gen_stats = stats->generator(kind);
+    size_t edges_before = lattice.edgeCount();
+    if (time_generators) {
+      core::StageStats timing;
+      {
+        core::ScopedStageTimer timer(&timing);
+        generate_capped();
+      }
+      gen_stats.nanoseconds += timing.nanoseconds;
+    } else {
+      generate_capped();
+    }
+    size_t added = lattice.edgeCount() - edges_before;
+    ++gen_stats.calls;
+    gen_stats.edges += added;
+    if (added > 0) {
+      ++gen_stats.productive;
+    }
+  };
+
+  // Join generators are skipped in Split mode; in a multi-granular lattice
+  // they always run and their edges are hidden from the fine decode
+  const bool run_joins = mode_ != core::AnalysisMode::Split || multi_granular;
+  auto run_join = [&lattice, &run, multi_granular](core::GeneratorKind kind, size_t pos, auto&& generate) {
+    size_t first_id = lattice.nextEdgeId();
+    run(kind, pos, generate);
+    if (multi_granular) {
+      lattice.addFlagsSince(first_id, core::LatticeEdge::kCoarseOnly);
+    }
+  };
 
   // Process each position
   for (size_t pos = 0; pos < codepoints.size(); ++pos) {
+    position_first_edge = lattice.edgeCount();
+    if (!dictionary_only &&
+        ((budget.max_edges_per_chunk != 0 && position_first_edge >= budget.max_edges_per_chunk) ||
+         chunk.deadlineExpired() ||
+         (budget.hasDeadline() && std::chrono::steady_clock::now() >= budget.deadline))) {
+      SUZUME_DEBUG_LOG("[LATTICE] budget exhausted at pos=" << pos << ", dictionary candidates only\n");
+      dictionary_only = true;
+      cut_short = true;
+    }
+
     // These run at every position
-    addDictionaryCandidates(lattice, text, codepoints, pos);
-    addUnknownCandidates(lattice, text, codepoints, pos, char_types);
-    if (mode_ != core::AnalysisMode::Split) {
-      addMixedScriptCandidates(lattice, text, codepoints, pos, char_types);
+    run(core::GeneratorKind::Dictionary, pos, [&] {
+      if (addDictionaryCandidates(lattice, chunk, pos, budget.max_edges_per_position, !dictionary_only)) {
+        cut_short = true;
+      }
+    });
+    run(core::GeneratorKind::Unknown, pos, [&] { addUnknownCandidates(lattice, chunk, pos, char_types); });
+    if (run_joins) {
+      run_join(core::GeneratorKind::MixedScript, pos,
+               [&] { addMixedScriptCandidates(lattice, chunk, pos, char_types); });
     }
 
     // CharType-based dispatch: skip generators that can't match at this position
     auto ct = char_types[pos];
     if (ct == normalize::CharType::Kanji) {
-      addCompoundSplitCandidates(lattice, text, codepoints, pos, char_types);
-      addNounVerbSplitCandidates(lattice, text, codepoints, pos, char_types);
-      if (mode_ != core::AnalysisMode::Split) {
-        addCompoundVerbJoinCandidates(lattice, text, codepoints, pos, char_types);
-        addPrefixNounJoinCandidates(lattice, text, codepoints, pos, char_types);
-        addTaruAdjectiveJoinCandidates(lattice, text, codepoints, pos, char_types);
-        addVerbSuffixNounJoinCandidates(lattice, text, codepoints, pos, char_types);
+      run(core::GeneratorKind::CompoundSplit, pos,
+          [&] { addCompoundSplitCandidates(lattice, chunk, pos, char_types); });
+      run(core::GeneratorKind::NounVerbSplit, pos,
+          [&] { addNounVerbSplitCandidates(lattice, chunk, pos, char_types); });
+      if (run_joins) {
+        run_join(core::GeneratorKind::CompoundVerbJoin, pos,
+                 [&] { addCompoundVerbJoinCandidates(lattice, chunk, pos, char_types); });
+        run_join(core::GeneratorKind::PrefixNounJoin, pos,
+                 [&] { addPrefixNounJoinCandidates(lattice, chunk, pos, char_types); });
+        run_join(core::GeneratorKind::TaruAdjectiveJoin, pos,
+                 [&] { addTaruAdjectiveJoinCandidates(lattice, chunk, pos, char_types); });
+        run_join(core::GeneratorKind::VerbSuffixNounJoin, pos,
+                 [&] { addVerbSuffixNounJoinCandidates(lattice, chunk, pos, char_types); });
       }
     } else if (ct == normalize::CharType::Hiragana) {
-      if (mode_ != core::AnalysisMode::Split) {
-        addHiraganaCompoundVerbJoinCandidates(lattice, text, codepoints, pos, char_types);
-        addVerbSuffixNounJoinCandidates(lattice, text, codepoints, pos, char_types);
+      if (run_joins) {
+        run_join(core::GeneratorKind::HiraganaCompoundVerbJoin, pos,
+                 [&] { addHiraganaCompoundVerbJoinCandidates(lattice, chunk, pos, char_types); });
+        run_join(core::GeneratorKind::VerbSuffixNounJoin, pos,
+                 [&] { addVerbSuffixNounJoinCandidates(lattice, chunk, pos, char_types); });
       }
-      addTeFormAuxiliaryCandidates(lattice, text, codepoints, pos, char_types);
+      run(core::GeneratorKind::TeFormAuxiliary, pos,
+          [&] { addTeFormAuxiliaryCandidates(lattice, chunk, pos, char_types); });
     } else if (ct == normalize::CharType::Katakana) {
-      if (mode_ != core::AnalysisMode::Split) {
-        addKatakanaSugiruJoinCandidates(lattice, text, codepoints, pos, char_types);
+      if (run_joins) {
+        run_join(core::GeneratorKind::KatakanaSugiruJoin, pos,
+                 [&] { addKatakanaSugiruJoinCandidates(lattice, chunk, pos, char_types); });
       }
     }
     // addAdjectiveSugiruJoinCandidates is a no-op — removed
@@ -75,39 +202,76 @@ core::Lattice Tokenizer::buildLattice(std::string_view text, const std::vector<c
   // Fallback: ensure every position has at least one edge
   // This prevents the lattice from becoming invalid when no candidates are generated
   // (e.g., positions starting with small kana like っ, ゃ, ゅ, ょ)
+  size_t edges_before_fallback = lattice.edgeCount();
   for (size_t pos = 0; pos < codepoints.size(); ++pos) {
-    if (lattice.edgesAt(pos).empty()) {
-      // Generate a single-character fallback candidate with high penalty
-      size_t byte_start = charPosToBytePos(codepoints, pos);
-      size_t byte_end = charPosToBytePos(codepoints, pos + 1);
-      std::string surface(text.substr(byte_start, byte_end - byte_start));
-
-      // Use OTHER POS with high cost - this should only be chosen as last resort
-      constexpr float kFallbackCost = 5.0F;
-      lattice.addEdge(surface, static_cast<uint32_t>(pos), static_cast<uint32_t>(pos + 1), core::PartOfSpeech::Other,
-                      kFallbackCost, core::LatticeEdge::kIsUnknown);
+    const auto& edges = lattice.edgesAt(pos);
+    uint8_t fallback_flags = core::LatticeEdge::kIsUnknown;
+    if (!edges.empty()) {
+      // Multi-granular: the fine view still needs a fallback if every edge
+      // here is a join candidate
+      bool fine_has_edge =
+          !multi_granular || std::any_of(edges.begin(), edges.end(),
+                                         [](const core::LatticeEdge& edge) { return !edge.isCoarseOnly(); });
+      if (fine_has_edge) {
+        continue;
+      }
+      fallback_flags |= core::LatticeEdge::kFineOnly;
     }
+
+    // Generate a single-character fallback candidate with high penalty
+    size_t byte_start = chunk.bytePos(pos);
+    size_t byte_end = chunk.bytePos(pos + 1);
+    std::string surface(text.substr(byte_start, byte_end - byte_start));
+
+    // Use OTHER POS with high cost - this should only be chosen as last resort
+    constexpr float kFallbackCost = 5.0F;
+    lattice.addEdge(surface, static_cast<uint32_t>(pos), static_cast<uint32_t>(pos + 1), core::PartOfSpeech::Other,
+                    kFallbackCost, fallback_flags);
+  }
+  if (stats != nullptr) {
+    stats->generator(core::GeneratorKind::Fallback).edges += lattice.edgeCount() - edges_before_fallback;
+  }
+  if (degraded != nullptr) {
+    *degraded = cut_short || chunk.deadlineExpired();
   }
 
   return lattice;
 }
 
-size_t Tokenizer::charPosToBytePos(const std::vector<char32_t>& codepoints, size_t char_pos) {
-  return analysis::charPosToBytePos(codepoints, char_pos);
-}
+bool Tokenizer::addDictionaryCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                        size_t max_edges, bool expand_emphatic) const {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
 
-void Tokenizer::addDictionaryCandidates(core::Lattice& lattice, std::string_view text,
-                                        const std::vector<char32_t>& codepoints, size_t start_pos) const {
   // Convert to byte position for dictionary lookup
-  size_t byte_pos = charPosToBytePos(codepoints, start_pos);
+  size_t byte_pos = chunk.bytePos(start_pos);
 
   // Lookup in dictionary
   auto results = dict_manager_.lookup(text, byte_pos);
+  // Conjugated matches only annotate the entries in results, so there is nothing to look up without them
+  std::vector<dictionary::ConjugatedLookupResult> conjugated;
+  if (!results.empty() && dict_manager_.hasConjugationIndex()) {
+    conjugated = dict_manager_.lookupConjugated(text, byte_pos);
+  }
+  auto find_conjugated = [&conjugated](size_t length) -> const dictionary::ConjugatedSurface* {
+    for (const auto& match : conjugated) {
+      if (match.length == length) {
+        return match.surface;
+      }
+    }
+    return nullptr;
+  };
+  const size_t edges_before = lattice.edgeCount();
+  auto at_limit = [&] { return max_edges != 0 && lattice.edgeCount() - edges_before >= max_edges; };
+  bool truncated = false;
 
   for (const auto& result : results) {
     if (result.entry == nullptr) {
       continue;
     }
+    if (at_limit()) {
+      return true;
+    }
 
     // Calculate end position in characters
     size_t end_pos = start_pos + result.length;
@@ -126,18 +290,42 @@ void Tokenizer::addDictionaryCandidates(core::Lattice& lattice, std::string_view
     // Cost is now derived from ExtendedPOS via getCategoryCost()
     float cost = analysis::getCategoryCost(result.entry->extended_pos);
 
-    lattice.addEdge(result.entry->surface, static_cast<uint32_t>(start_pos), static_cast<uint32_t>(end_pos),
-                    result.entry->pos, cost, flags, result.entry->lemma, dictionary::ConjugationType::None,
-                    core::CandidateOrigin::Dictionary, 1.0F, {}, result.entry->extended_pos, "dict");
+    // Conjugation type is not stored per entry; take it from the conjugation index when one is loaded
+    auto conj_type = dictionary::ConjugationType::None;
+    if (result.entry->pos == core::PartOfSpeech::Verb || result.entry->pos == core::PartOfSpeech::Adjective) {
+      const auto* indexed = find_conjugated(result.length);
+      if (indexed != nullptr && indexed->lemma == result.entry->lemma) {
+        conj_type = indexed->conj_type;
+      }
+    }
+
+    size_t edge_id = lattice.addEdge(result.entry->surface, static_cast<uint32_t>(start_pos),
+                                     static_cast<uint32_t>(end_pos), result.entry->pos, cost, flags,
+                                     result.entry->lemma, conj_type, core::CandidateOrigin::Dictionary, 1.0F, {},
+                                     result.entry->extended_pos, "dict");
+
+    // The edge depends only on the entry, so its word cost is computed once per entry
+    if (edge_id < lattice.nextEdgeId() && result.shared_id < entry_word_costs_.size()) {
+      float& word_cost = entry_word_costs_[result.shared_id];
+      if (std::isnan(word_cost)) {
+        word_cost = scorer_.wordCost(lattice.getEdge(edge_id));
+      }
+      lattice.setWordCost(edge_id, word_cost);
+    }
 
     // Emphatic suffix pattern: word + っ/ッ/ー/ぁぃぅぇぉ/ァィゥェォ (colloquial emphasis)
     // E.g., です→ですっ, ます→ますっ, 行く→行くっ, やばいーー, だぁー
     // Handles consecutive sokuon (っっ), chouon (ーー), and small vowels (ぁぃぅぇぉ)
     // Also handles vowel repetition: きた + ああああ → きたああああ
     // Only apply to verbs, auxiliaries, and adjectives (typical emphatic targets)
-    if (end_pos < codepoints.size() &&
+    // Skipped once the work budget is spent, since the suffix can run to the end of the chunk
+    const bool emphatic_target =
+        end_pos < codepoints.size() &&
         (result.entry->pos == core::PartOfSpeech::Verb || result.entry->pos == core::PartOfSpeech::Auxiliary ||
-         result.entry->pos == core::PartOfSpeech::Adjective)) {
+         result.entry->pos == core::PartOfSpeech::Adjective);
+    if (emphatic_target && (!expand_emphatic || at_limit())) {
+      truncated = true;
+    } else if (emphatic_target) {
       // Count consecutive emphatic characters (sokuon/chouon/small vowels)
       size_t emphatic_end = end_pos;
       std::string emphatic_suffix;
@@ -271,13 +459,16 @@ void Tokenizer::addDictionaryCandidates(core::Lattice& lattice, std::string_view
       }
     }
   }
+  return truncated;
 }
 
-void Tokenizer::addUnknownCandidates(core::Lattice& lattice, std::string_view text,
-                                     const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addUnknownCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                      const std::vector<normalize::CharType>& char_types) const {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
+
   // Check for dictionary entries at this position to penalize longer unknown words
-  size_t byte_pos = charPosToBytePos(codepoints, start_pos);
+  size_t byte_pos = chunk.bytePos(start_pos);
   auto dict_results = dict_manager_.lookup(text, byte_pos);
 
   size_t max_dict_length = 0;
@@ -288,7 +479,7 @@ void Tokenizer::addUnknownCandidates(core::Lattice& lattice, std::string_view te
   }
 
   // Generate unknown word candidates
-  auto candidates = unknown_gen_.generate(text, codepoints, start_pos, char_types);
+  auto candidates = unknown_gen_.generate(chunk, start_pos, char_types);
 
   for (const auto& candidate : candidates) {
     uint8_t flags = core::LatticeEdge::kIsUnknown;
@@ -502,7 +693,7 @@ void Tokenizer::addUnknownCandidates(core::Lattice& lattice, std::string_view te
           bool found_overlap = false;
           for (size_t back = 1; back <= kMaxLookback && back <= start_pos && !found_overlap; ++back) {
             size_t prev_pos = start_pos - back;
-            size_t prev_byte = charPosToBytePos(codepoints, prev_pos);
+            size_t prev_byte = chunk.bytePos(prev_pos);
             auto prev_results = dict_manager_.lookup(text, prev_byte);
             for (const auto& result : prev_results) {
               if (result.entry != nullptr && result.length >= 2 && result.length > back &&
@@ -611,8 +802,8 @@ void Tokenizer::addUnknownCandidates(core::Lattice& lattice, std::string_view te
       }
 
       if (hiragana_start < candidate.end) {
-        size_t suffix_byte_start = charPosToBytePos(codepoints, hiragana_start);
-        size_t suffix_byte_end = charPosToBytePos(codepoints, candidate.end);
+        size_t suffix_byte_start = chunk.bytePos(hiragana_start);
+        size_t suffix_byte_end = chunk.bytePos(candidate.end);
         std::string_view hiragana_suffix = text.substr(suffix_byte_start, suffix_byte_end - suffix_byte_start);
 
         // Don't penalize verb conjugation endings
@@ -624,7 +815,7 @@ void Tokenizer::addUnknownCandidates(core::Lattice& lattice, std::string_view te
         // - Known verb conjugation ending (te-form, renyoukei)
         // - Candidate has has_suffix flag (mizenkei for ぬ/れべき patterns)
         if (!is_verb_ending && !candidate.has_suffix) {
-          size_t suffix_byte_pos = charPosToBytePos(codepoints, hiragana_start);
+          size_t suffix_byte_pos = chunk.bytePos(hiragana_start);
           auto suffix_results = dict_manager_.lookup(text, suffix_byte_pos);
 
           for (const auto& result : suffix_results) {
@@ -662,73 +853,60 @@ void Tokenizer::addUnknownCandidates(core::Lattice& lattice, std::string_view te
   }
 }
 
-void Tokenizer::addMixedScriptCandidates(core::Lattice& lattice, std::string_view text,
-                                         const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addMixedScriptCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                          const std::vector<normalize::CharType>& char_types) const {
-  analysis::addMixedScriptCandidates(lattice, text, codepoints, start_pos, char_types, scorer_, dict_manager_);
+  analysis::addMixedScriptCandidates(lattice, chunk, start_pos, char_types, scorer_, dict_manager_);
 }
 
-void Tokenizer::addCompoundSplitCandidates(core::Lattice& lattice, std::string_view text,
-                                           const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addCompoundSplitCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                            const std::vector<normalize::CharType>& char_types) const {
-  analysis::addCompoundSplitCandidates(lattice, text, codepoints, start_pos, char_types, dict_manager_, scorer_);
+  analysis::addCompoundSplitCandidates(lattice, chunk, start_pos, char_types, dict_manager_, scorer_);
 }
 
-void Tokenizer::addNounVerbSplitCandidates(core::Lattice& lattice, std::string_view text,
-                                           const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addNounVerbSplitCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                            const std::vector<normalize::CharType>& char_types) const {
-  analysis::addNounVerbSplitCandidates(lattice, text, codepoints, start_pos, char_types, dict_manager_, scorer_,
-                                       inflection_);
+  analysis::addNounVerbSplitCandidates(lattice, chunk, start_pos, char_types, dict_manager_, scorer_);
 }
 
-void Tokenizer::addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                              const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                               const std::vector<normalize::CharType>& char_types) const {
-  analysis::addCompoundVerbJoinCandidates(lattice, text, codepoints, start_pos, char_types, dict_manager_, scorer_,
-                                          inflection_);
+  analysis::addCompoundVerbJoinCandidates(lattice, chunk, start_pos, char_types, dict_manager_, scorer_);
 }
 
-void Tokenizer::addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                                      const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk,
+                                                      size_t start_pos,
                                                       const std::vector<normalize::CharType>& char_types) const {
-  analysis::addHiraganaCompoundVerbJoinCandidates(lattice, text, codepoints, start_pos, char_types, dict_manager_,
-                                                  scorer_, inflection_);
+  analysis::addHiraganaCompoundVerbJoinCandidates(lattice, chunk, start_pos, char_types, dict_manager_, scorer_);
 }
 
-void Tokenizer::addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                            const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addPrefixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                             const std::vector<normalize::CharType>& char_types) const {
-  analysis::addPrefixNounJoinCandidates(lattice, text, codepoints, start_pos, char_types, dict_manager_, scorer_);
+  analysis::addPrefixNounJoinCandidates(lattice, chunk, start_pos, char_types, dict_manager_, scorer_);
 }
 
-void Tokenizer::addAdjectiveSugiruJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                                 const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addAdjectiveSugiruJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                                  const std::vector<normalize::CharType>& char_types) const {
-  analysis::addAdjectiveSugiruJoinCandidates(lattice, text, codepoints, start_pos, char_types, dict_manager_, scorer_);
+  analysis::addAdjectiveSugiruJoinCandidates(lattice, chunk, start_pos, char_types, dict_manager_, scorer_);
 }
 
-void Tokenizer::addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                                const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addKatakanaSugiruJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                                 const std::vector<normalize::CharType>& char_types) const {
-  analysis::addKatakanaSugiruJoinCandidates(lattice, text, codepoints, start_pos, char_types, scorer_);
+  analysis::addKatakanaSugiruJoinCandidates(lattice, chunk, start_pos, char_types, scorer_);
 }
 
-void Tokenizer::addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
-                                             const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addTeFormAuxiliaryCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                              const std::vector<normalize::CharType>& char_types) const {
-  analysis::addTeFormAuxiliaryCandidates(lattice, text, codepoints, start_pos, char_types, scorer_, inflection_);
+  analysis::addTeFormAuxiliaryCandidates(lattice, chunk, start_pos, char_types, scorer_);
 }
 
-void Tokenizer::addTaruAdjectiveJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                               const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addTaruAdjectiveJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                                const std::vector<normalize::CharType>& char_types) const {
-  analysis::addTaruAdjectiveJoinCandidates(lattice, text, codepoints, start_pos, char_types, scorer_);
+  analysis::addTaruAdjectiveJoinCandidates(lattice, chunk, start_pos, char_types, scorer_);
 }
 
-void Tokenizer::addVerbSuffixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                                const std::vector<char32_t>& codepoints, size_t start_pos,
+void Tokenizer::addVerbSuffixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                                 const std::vector<normalize::CharType>& char_types) const {
-  analysis::addVerbSuffixNounJoinCandidates(lattice, text, codepoints, start_pos, char_types, dict_manager_, scorer_);
+  analysis::addVerbSuffixNounJoinCandidates(lattice, chunk, start_pos, char_types, dict_manager_, scorer_);
 }
 
 }  // namespace suzume::analysis
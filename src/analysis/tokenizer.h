@@ -1,18 +1,44 @@
 #ifndef SUZUME_ANALYSIS_TOKENIZER_H_
 #define SUZUME_ANALYSIS_TOKENIZER_H_
 
+#include <chrono>
+#include <cstddef>
 #include <string_view>
 #include <vector>
 
+#include "analysis/chunk_context.h"
 #include "analysis/scorer.h"
 #include "analysis/unknown.h"
 #include "core/lattice.h"
+#include "core/stats.h"
 #include "dictionary/dictionary.h"
 #include "grammar/inflection.h"
 #include "normalize/char_type.h"
 
 namespace suzume::analysis {
 
+/**
+ * @brief Work limits for one lattice build (0 = unlimited)
+ *
+ * Guards against inputs that make candidate generation blow up: long
+ * unpunctuated kana runs, repeated emphatic characters, long kanji or
+ * katakana runs. At most max_edges_per_position edges start at a position:
+ * once they are there the remaining generators are skipped, and edges a
+ * generator added past the limit are dropped again. Once the chunk holds
+ * max_edges_per_chunk edges or the deadline has passed, the rest of the
+ * chunk gets plain dictionary candidates only, without emphatic variants.
+ * Inflection analysis returns nothing once the deadline has passed, and
+ * Viterbi falls back to extending only the cheapest state. The
+ * single-character fallback keeps the lattice connected either way.
+ */
+struct LatticeBudget {
+  size_t max_edges_per_position{0};
+  size_t max_edges_per_chunk{0};
+  std::chrono::steady_clock::time_point deadline{};  // Default-constructed = no deadline
+
+  bool hasDeadline() const { return deadline != std::chrono::steady_clock::time_point{}; }
+};
+
 /**
  * @brief Tokenizer that builds lattice from text
  */
@@ -26,10 +52,26 @@ class Tokenizer {
    * @param text Normalized text
    * @param codepoints Codepoints of text
    * @param char_types Character types
+   * @param stats Per-generator counters to update (optional)
+   * @param time_generators Also time each generator call (requires stats)
+   * @param multi_granular Run every generator regardless of mode and tag
+   *        edges so both granularities can be decoded from one lattice:
+   *        join candidates that Split mode never generates get
+   *        LatticeEdge::kCoarseOnly, and fallback edges needed only by the
+   *        fine view get LatticeEdge::kFineOnly
+   * @param budget Work limits
+   * @param degraded Set to true if a limit cut candidate generation short (optional)
    * @return Lattice with all candidates
    */
   core::Lattice buildLattice(std::string_view text, const std::vector<char32_t>& codepoints,
-                             const std::vector<normalize::CharType>& char_types) const;
+                             const std::vector<normalize::CharType>& char_types, core::AnalysisStats* stats = nullptr,
+                             bool time_generators = false, bool multi_granular = false,
+                             const LatticeBudget& budget = {}, bool* degraded = nullptr) const;
+
+  /**
+   * @brief Bytes held by the per-entry word cost table
+   */
+  size_t entryWordCostBytes() const { return entry_word_costs_.capacity() * sizeof(float); }
 
  private:
   const dictionary::DictionaryManager& dict_manager_;
@@ -38,17 +80,25 @@ class Tokenizer {
   const grammar::Inflection& inflection_;  // Shared from unknown_gen_
   core::AnalysisMode mode_;
 
+  // Word cost of each shared dictionary entry's edge (NaN = not seen yet),
+  // indexed by LookupResult::shared_id and reset when the dictionaries change
+  mutable std::vector<float> entry_word_costs_;
+  mutable uint64_t entry_word_costs_generation_{~uint64_t{0}};
+
   /**
    * @brief Add dictionary candidates at position
+   * @param max_edges Stop after this many edges (0 = unlimited)
+   * @param expand_emphatic Also add emphatic variants (e.g. きた + ああああ)
+   * @return true if candidates were left out because of the limits
    */
-  void addDictionaryCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                               size_t start_pos) const;
+  bool addDictionaryCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                               size_t max_edges = 0, bool expand_emphatic = true) const;
 
   /**
    * @brief Add unknown word candidates at position
    */
-  void addUnknownCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                            size_t start_pos, const std::vector<normalize::CharType>& char_types) const;
+  void addUnknownCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                            const std::vector<normalize::CharType>& char_types) const;
 
   /**
    * @brief Add mixed script joining candidates
@@ -61,8 +111,8 @@ class Tokenizer {
    *   "APIリクエスト" → merged as single noun with bonus
    *   "3月" → merged as single noun with bonus
    */
-  void addMixedScriptCandidates(core::Lattice& lattice, std::string_view text, const std::vector<char32_t>& codepoints,
-                                size_t start_pos, const std::vector<normalize::CharType>& char_types) const;
+  void addMixedScriptCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
+                                const std::vector<normalize::CharType>& char_types) const;
 
   /**
    * @brief Add compound noun split candidates
@@ -74,8 +124,7 @@ class Tokenizer {
    *   "人工知能" → ["人工知能", "人工" + "知能"]
    *   "人工知能研究所" → ["人工知能" + "研究所", ...]
    */
-  void addCompoundSplitCandidates(core::Lattice& lattice, std::string_view text,
-                                  const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addCompoundSplitCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                   const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -88,8 +137,7 @@ class Tokenizer {
    *   "本買った" → ["本" + "買った"] (noun + verb)
    *   "日本語話す" → ["日本語" + "話す"] (noun + verb)
    */
-  void addNounVerbSplitCandidates(core::Lattice& lattice, std::string_view text,
-                                  const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addNounVerbSplitCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                   const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -104,8 +152,7 @@ class Tokenizer {
    *   "読み込む" → compound verb (読む + 込む)
    *   "書き出す" → compound verb (書く + 出す)
    */
-  void addCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                     const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                      const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -117,8 +164,7 @@ class Tokenizer {
    *   "やりなおす" → compound verb (やる + なおす)
    *   "やりなおしたい" → やりなおし + たい
    */
-  void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                             const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addHiraganaCompoundVerbJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                              const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -130,8 +176,7 @@ class Tokenizer {
    *   "高すぎる" → compound verb with lemma "高過ぎる"
    *   "尊すぎて" → "尊すぎ" (verb) + "て" (auxiliary)
    */
-  void addAdjectiveSugiruJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                        const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addAdjectiveSugiruJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                         const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -143,8 +188,7 @@ class Tokenizer {
    *   "ワンパターンすぎる" → compound verb with lemma "ワンパターンすぎる"
    *   "シンプルすぎる" → compound verb with lemma "シンプルすぎる"
    */
-  void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                       const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addKatakanaSugiruJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                        const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -159,8 +203,7 @@ class Tokenizer {
    *   "不安" → merged as single noun (不 + 安)
    *   "未経験" → merged as single noun (未 + 経験)
    */
-  void addPrefixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                   const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addPrefixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                    const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -174,8 +217,7 @@ class Tokenizer {
    *   "食べてみる" → ["食べて" + "みる"]
    *   "書いておく" → ["書いて" + "おく"]
    */
-  void addTeFormAuxiliaryCandidates(core::Lattice& lattice, std::string_view text,
-                                    const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addTeFormAuxiliaryCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                     const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -187,8 +229,7 @@ class Tokenizer {
    *   "毅然と" → single adverb (not 毅然 + と)
    *   "平然と" → single adverb (not 平然 + と)
    */
-  void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                      const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addTaruAdjectiveJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                       const std::vector<normalize::CharType>& char_types) const;
 
   /**
@@ -198,14 +239,9 @@ class Tokenizer {
    *   "食べ物" → compound noun (食べ + 物)
    *   "読み方" → compound noun (読む + 方)
    */
-  void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, std::string_view text,
-                                       const std::vector<char32_t>& codepoints, size_t start_pos,
+  void addVerbSuffixNounJoinCandidates(core::Lattice& lattice, const ChunkContext& chunk, size_t start_pos,
                                        const std::vector<normalize::CharType>& char_types) const;
 
-  /**
-   * @brief Convert character position to byte position
-   */
-  static size_t charPosToBytePos(const std::vector<char32_t>& codepoints, size_t char_pos);
 };
 
 }  // namespace suzume::analysis
@@ -27,7 +27,7 @@ namespace suzume::analysis {
 
 UnknownWordGenerator::UnknownWordGenerator(const UnknownOptions& options,
                                            const dictionary::DictionaryManager* dict_manager)
-    : options_(options), dict_manager_(dict_manager) {}
+    : options_(options), dict_manager_(dict_manager), inflection_(options.inflection_cache_capacity) {}
 
 size_t UnknownWordGenerator::getMaxLength(normalize::CharType ctype) const {
   switch (ctype) {
@@ -132,6 +132,14 @@ float UnknownWordGenerator::getCostForType(normalize::CharType ctype, size_t len
 std::vector<UnknownCandidate> UnknownWordGenerator::generate(std::string_view text,
                                                              const std::vector<char32_t>& codepoints, size_t start_pos,
                                                              const std::vector<normalize::CharType>& char_types) const {
+  ChunkContext chunk(text, codepoints, inflection_);
+  return generate(chunk, start_pos, char_types);
+}
+
+std::vector<UnknownCandidate> UnknownWordGenerator::generate(const ChunkContext& chunk, size_t start_pos,
+                                                             const std::vector<normalize::CharType>& char_types) const {
+  std::string_view text = chunk.text();
+  const std::vector<char32_t>& codepoints = chunk.codepoints();
   std::vector<UnknownCandidate> candidates;
 
   if (start_pos >= char_types.size()) {
@@ -149,21 +157,21 @@ std::vector<UnknownCandidate> UnknownWordGenerator::generate(std::string_view te
 
   // Generate verb candidates (kanji + hiragana conjugation endings)
   if (char_types[start_pos] == normalize::CharType::Kanji) {
-    auto verbs = generateVerbCandidates(text, codepoints, start_pos, char_types);
+    auto verbs = generateVerbCandidates(chunk, codepoints, start_pos, char_types);
     candidates.insert(candidates.end(), verbs.begin(), verbs.end());
 
     // Generate compound verb candidates (kanji + hiragana + kanji + hiragana)
     // e.g., 恐れ入ります, 差し上げます, 申し上げます
-    auto compound_verbs = generateCompoundVerbCandidates(text, codepoints, start_pos, char_types);
+    auto compound_verbs = generateCompoundVerbCandidates(chunk, codepoints, start_pos, char_types);
     candidates.insert(candidates.end(), compound_verbs.begin(), compound_verbs.end());
 
     // Generate i-adjective candidates (kanji + hiragana conjugation endings)
-    auto adjs = generateAdjectiveCandidates(text, codepoints, start_pos, char_types);
+    auto adjs = generateAdjectiveCandidates(chunk, codepoints, start_pos, char_types);
     candidates.insert(candidates.end(), adjs.begin(), adjs.end());
 
     // Generate i-adjective STEM candidates (難し, 美し for 難しそう, 美しすぎる)
     // This enables MeCab-compatible split: 難しそう → 難し(ADJ) + そう(AUX)
-    auto adj_stems = generateAdjectiveStemCandidates(text, codepoints, start_pos, char_types);
+    auto adj_stems = generateAdjectiveStemCandidates(chunk, codepoints, start_pos, char_types);
     candidates.insert(candidates.end(), adj_stems.begin(), adj_stems.end());
 
     // Generate na-adjective candidates (〜的 patterns)
@@ -199,11 +207,11 @@ std::vector<UnknownCandidate> UnknownWordGenerator::generate(std::string_view te
 
   // Generate hiragana verb candidates (pure hiragana verbs like いく, くる)
   if (char_types[start_pos] == normalize::CharType::Hiragana) {
-    auto hiragana_verbs = generateHiraganaVerbCandidates(text, codepoints, start_pos, char_types);
+    auto hiragana_verbs = generateHiraganaVerbCandidates(chunk, codepoints, start_pos, char_types);
     candidates.insert(candidates.end(), hiragana_verbs.begin(), hiragana_verbs.end());
 
     // Generate hiragana i-adjective candidates (まずい, おいしい, etc.)
-    auto hiragana_adjs = generateHiraganaAdjectiveCandidates(text, codepoints, start_pos, char_types);
+    auto hiragana_adjs = generateHiraganaAdjectiveCandidates(chunk, codepoints, start_pos, char_types);
     candidates.insert(candidates.end(), hiragana_adjs.begin(), hiragana_adjs.end());
 
     // Generate productive suffix candidates (ありがち, 忘れっぽい, etc.)
@@ -213,11 +221,11 @@ std::vector<UnknownCandidate> UnknownWordGenerator::generate(std::string_view te
 
   // Generate katakana verb/adjective candidates (slang: バズる, エモい, etc.)
   if (char_types[start_pos] == normalize::CharType::Katakana) {
-    auto kata_verbs = generateKatakanaVerbCandidates(codepoints, start_pos, char_types, inflection_, dict_manager_,
+    auto kata_verbs = generateKatakanaVerbCandidates(codepoints, start_pos, char_types, chunk, dict_manager_,
                                                      options_.verb_candidate_options);
     candidates.insert(candidates.end(), kata_verbs.begin(), kata_verbs.end());
 
-    auto kata_adjs = generateKatakanaAdjectiveCandidates(codepoints, start_pos, char_types, inflection_);
+    auto kata_adjs = generateKatakanaAdjectiveCandidates(codepoints, start_pos, char_types, chunk);
     candidates.insert(candidates.end(), kata_adjs.begin(), kata_adjs.end());
   }
 
@@ -594,48 +602,48 @@ std::vector<UnknownCandidate> UnknownWordGenerator::generateWithSuffix(
 }
 
 std::vector<UnknownCandidate> UnknownWordGenerator::generateCompoundVerbCandidates(
-    std::string_view /*text*/, const std::vector<char32_t>& codepoints, size_t start_pos,
+    const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
     const std::vector<normalize::CharType>& char_types) const {
   // Delegate to the standalone function
-  return analysis::generateCompoundVerbCandidates(codepoints, start_pos, char_types, inflection_, dict_manager_,
+  return analysis::generateCompoundVerbCandidates(codepoints, start_pos, char_types, chunk, dict_manager_,
                                                   options_.verb_candidate_options);
 }
 
 std::vector<UnknownCandidate> UnknownWordGenerator::generateVerbCandidates(
-    std::string_view /*text*/, const std::vector<char32_t>& codepoints, size_t start_pos,
+    const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
     const std::vector<normalize::CharType>& char_types) const {
   // Delegate to the standalone function
-  return analysis::generateVerbCandidates(codepoints, start_pos, char_types, inflection_, dict_manager_,
+  return analysis::generateVerbCandidates(codepoints, start_pos, char_types, chunk, dict_manager_,
                                           options_.verb_candidate_options);
 }
 
 std::vector<UnknownCandidate> UnknownWordGenerator::generateHiraganaVerbCandidates(
-    std::string_view /*text*/, const std::vector<char32_t>& codepoints, size_t start_pos,
+    const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
     const std::vector<normalize::CharType>& char_types) const {
   // Delegate to the standalone function
-  return analysis::generateHiraganaVerbCandidates(codepoints, start_pos, char_types, inflection_, dict_manager_,
+  return analysis::generateHiraganaVerbCandidates(codepoints, start_pos, char_types, chunk, dict_manager_,
                                                   options_.verb_candidate_options);
 }
 
 std::vector<UnknownCandidate> UnknownWordGenerator::generateAdjectiveCandidates(
-    std::string_view /*text*/, const std::vector<char32_t>& codepoints, size_t start_pos,
+    const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
     const std::vector<normalize::CharType>& char_types) const {
   // Delegate to the standalone function
-  return analysis::generateAdjectiveCandidates(codepoints, start_pos, char_types, inflection_, dict_manager_);
+  return analysis::generateAdjectiveCandidates(codepoints, start_pos, char_types, chunk, dict_manager_);
 }
 
 std::vector<UnknownCandidate> UnknownWordGenerator::generateAdjectiveStemCandidates(
-    std::string_view /*text*/, const std::vector<char32_t>& codepoints, size_t start_pos,
+    const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
     const std::vector<normalize::CharType>& char_types) const {
   // Delegate to the standalone function
-  return analysis::generateAdjectiveStemCandidates(codepoints, start_pos, char_types, inflection_, dict_manager_);
+  return analysis::generateAdjectiveStemCandidates(codepoints, start_pos, char_types, chunk, dict_manager_);
 }
 
 std::vector<UnknownCandidate> UnknownWordGenerator::generateHiraganaAdjectiveCandidates(
-    std::string_view /*text*/, const std::vector<char32_t>& codepoints, size_t start_pos,
+    const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
     const std::vector<normalize::CharType>& char_types) const {
   // Delegate to the standalone function
-  return analysis::generateHiraganaAdjectiveCandidates(codepoints, start_pos, char_types, inflection_);
+  return analysis::generateHiraganaAdjectiveCandidates(codepoints, start_pos, char_types, chunk);
 }
 
 std::vector<UnknownCandidate> UnknownWordGenerator::generateNaAdjectiveCandidates(
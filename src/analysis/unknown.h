@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "analysis/candidate_options.h"
+#include "analysis/chunk_context.h"
 #include "core/types.h"
 #include "dictionary/dictionary.h"
 #include "grammar/inflection.h"
@@ -39,6 +40,9 @@ struct UnknownOptions {
 
   // Verb candidate generation options
   VerbCandidateOptions verb_candidate_options;
+
+  // Maximum number of cached inflection analyses (see grammar::Inflection)
+  size_t inflection_cache_capacity = grammar::Inflection::kDefaultCacheCapacity;
 };
 
 /**
@@ -222,6 +226,16 @@ class UnknownWordGenerator {
   std::vector<UnknownCandidate> generate(std::string_view text, const std::vector<char32_t>& codepoints,
                                          size_t start_pos, const std::vector<normalize::CharType>& char_types) const;
 
+  /**
+   * @brief Generate unknown word candidates using a shared chunk context
+   * @param chunk Chunk accessor (text spans, memoized inflection analysis)
+   * @param start_pos Start position (character index)
+   * @param char_types Character types
+   * @return Vector of candidates
+   */
+  std::vector<UnknownCandidate> generate(const ChunkContext& chunk, size_t start_pos,
+                                         const std::vector<normalize::CharType>& char_types) const;
+
   /**
    * @brief Access the shared inflection analyzer
    */
@@ -239,13 +253,13 @@ class UnknownWordGenerator {
    * if the base form exists in dictionary.
    */
   std::vector<UnknownCandidate> generateCompoundVerbCandidates(
-      std::string_view text, const std::vector<char32_t>& codepoints, size_t start_pos,
+      const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
       const std::vector<normalize::CharType>& char_types) const;
 
   /**
    * @brief Generate verb candidates (kanji + conjugation endings)
    */
-  std::vector<UnknownCandidate> generateVerbCandidates(std::string_view text, const std::vector<char32_t>& codepoints,
+  std::vector<UnknownCandidate> generateVerbCandidates(const ChunkContext& chunk, const std::vector<char32_t>& codepoints,
                                                        size_t start_pos,
                                                        const std::vector<normalize::CharType>& char_types) const;
 
@@ -253,13 +267,13 @@ class UnknownWordGenerator {
    * @brief Generate hiragana verb candidates (pure hiragana verbs like いく, くる)
    */
   std::vector<UnknownCandidate> generateHiraganaVerbCandidates(
-      std::string_view text, const std::vector<char32_t>& codepoints, size_t start_pos,
+      const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
       const std::vector<normalize::CharType>& char_types) const;
 
   /**
    * @brief Generate i-adjective candidates (kanji + conjugation endings)
    */
-  std::vector<UnknownCandidate> generateAdjectiveCandidates(std::string_view text,
+  std::vector<UnknownCandidate> generateAdjectiveCandidates(const ChunkContext& chunk,
                                                             const std::vector<char32_t>& codepoints, size_t start_pos,
                                                             const std::vector<normalize::CharType>& char_types) const;
 
@@ -267,14 +281,14 @@ class UnknownWordGenerator {
    * @brief Generate i-adjective STEM candidates (難し, 美し for MeCab-compatible split)
    */
   std::vector<UnknownCandidate> generateAdjectiveStemCandidates(
-      std::string_view text, const std::vector<char32_t>& codepoints, size_t start_pos,
+      const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
       const std::vector<normalize::CharType>& char_types) const;
 
   /**
    * @brief Generate hiragana i-adjective candidates (pure hiragana like まずい)
    */
   std::vector<UnknownCandidate> generateHiraganaAdjectiveCandidates(
-      std::string_view text, const std::vector<char32_t>& codepoints, size_t start_pos,
+      const ChunkContext& chunk, const std::vector<char32_t>& codepoints, size_t start_pos,
       const std::vector<normalize::CharType>& char_types) const;
 
   /**
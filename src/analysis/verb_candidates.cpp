@@ -27,7 +27,7 @@ namespace vh = verb_helpers;
 
 std::vector<UnknownCandidate> generateCompoundVerbCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                              const std::vector<normalize::CharType>& char_types,
-                                                             const grammar::Inflection& inflection,
+                                                             const ChunkContext& chunk,
                                                              const dictionary::DictionaryManager* dict_manager,
                                                              const VerbCandidateOptions& verb_opts) {
   std::vector<UnknownCandidate> candidates;
@@ -84,7 +84,7 @@ std::vector<UnknownCandidate> generateCompoundVerbCandidates(const std::vector<c
 
   // Try different ending lengths
   for (size_t end_pos = hira2_end; end_pos > kanji2_end; --end_pos) {
-    std::string surface = extractSubstring(codepoints, start_pos, end_pos);
+    std::string surface(chunk.span(start_pos, end_pos));
     if (surface.empty()) {
       continue;
     }
@@ -97,7 +97,7 @@ std::vector<UnknownCandidate> generateCompoundVerbCandidates(const std::vector<c
     }
 
     // Use inflection analyzer to get potential base forms
-    const auto& inflection_candidates = inflection.analyze(surface);
+    const auto& inflection_candidates = chunk.analyzeSpan(start_pos, end_pos);
 
     for (const auto& infl_cand : inflection_candidates) {
       if (infl_cand.confidence < verb_opts.confidence_low) {
@@ -153,9 +153,10 @@ std::vector<UnknownCandidate> generateCompoundVerbCandidates(const std::vector<c
 
 std::vector<UnknownCandidate> generateKatakanaVerbCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                              const std::vector<normalize::CharType>& char_types,
-                                                             const grammar::Inflection& inflection,
+                                                             const ChunkContext& chunk,
                                                              const dictionary::DictionaryManager* dict_manager,
                                                              const VerbCandidateOptions& verb_opts) {
+  const grammar::Inflection& inflection = chunk.inflection();
   std::vector<UnknownCandidate> candidates;
 
   // Only process katakana-starting positions
@@ -197,7 +198,7 @@ std::vector<UnknownCandidate> generateKatakanaVerbCandidates(const std::vector<c
   //   シンプル 名詞,一般,*,*,*,*,*
   //   すぎる   動詞,自立,*,*,一段,基本形,すぎる,スギル,スギル
   // So we skip verb candidates like シンプルすぎない to force split path
-  std::string hira_part = extractSubstring(codepoints, kata_end, hira_end);
+  std::string_view hira_part = chunk.span(kata_end, hira_end);
   // C++17 compatible: check if starts with "すぎ" (6 bytes)
   if (hira_part.size() >= 6 && hira_part.compare(0, 6, "すぎ") == 0) {
     return candidates;  // Skip this candidate - force split path
@@ -238,7 +239,7 @@ std::vector<UnknownCandidate> generateKatakanaVerbCandidates(const std::vector<c
 
   // Try different ending lengths, starting from longest
   for (size_t end_pos = hira_end; end_pos > kata_end; --end_pos) {
-    std::string surface = extractSubstring(codepoints, start_pos, end_pos);
+    std::string surface(chunk.span(start_pos, end_pos));
 
     if (surface.empty()) {
       continue;
@@ -252,7 +253,7 @@ std::vector<UnknownCandidate> generateKatakanaVerbCandidates(const std::vector<c
     // e.g., ハメた → inflection says Suru but た is not する conjugation → use ichidan instead
     if (best.verb_type == grammar::VerbType::Suru) {
       // Suru inflection was incorrectly matched; try next best candidate
-      const auto& all_results = inflection.analyze(surface);
+      const auto& all_results = chunk.analyzeSpan(start_pos, end_pos);
       best.confidence = 0.0F;
       for (const auto& cand : all_results) {
         if (cand.verb_type != grammar::VerbType::Suru && cand.verb_type != grammar::VerbType::IAdjective &&
@@ -286,8 +287,8 @@ std::vector<UnknownCandidate> generateKatakanaVerbCandidates(const std::vector<c
       if (second_char == "た" || second_char == "て" || second_char == "だ" || second_char == "で") {
         // Found katakana + っ + た/て pattern
         // Generate sokuonbin stem candidate: カタカナ + っ
-        std::string onbin_surface = extractSubstring(codepoints, start_pos, kata_end + 1);
-        std::string kata_part = extractSubstring(codepoints, start_pos, kata_end);
+        std::string onbin_surface(chunk.span(start_pos, kata_end + 1));
+        std::string kata_part(chunk.span(start_pos, kata_end));
         std::string base_form = kata_part + "る";  // Assume godan-ra (most common for slang)
 
         // Skip if katakana stem is already a dict noun (e.g., フェラ, ネタ)
@@ -335,8 +336,8 @@ std::vector<UnknownCandidate> generateKatakanaVerbCandidates(const std::vector<c
       if (is_negative || is_causative) {
         // Found katakana + ら + な/せ pattern
         // Generate mizenkei stem candidate: カタカナ + ら
-        std::string mizenkei_surface = extractSubstring(codepoints, start_pos, kata_end + 1);
-        std::string kata_part = extractSubstring(codepoints, start_pos, kata_end);
+        std::string mizenkei_surface(chunk.span(start_pos, kata_end + 1));
+        std::string kata_part(chunk.span(start_pos, kata_end));
         std::string base_form = kata_part + "る";  // Assume godan-ra (most common for slang)
 
         // Negative cost to beat unsplit forms (same as sokuonbin)
@@ -361,8 +362,8 @@ std::vector<UnknownCandidate> generateKatakanaVerbCandidates(const std::vector<c
         hira_part.compare(0, 6, "ろう") == 0) {
       // Found katakana + ろう pattern
       // Generate volitional stem candidate: カタカナ + ろ
-      std::string volitional_surface = extractSubstring(codepoints, start_pos, kata_end + 1);
-      std::string kata_part = extractSubstring(codepoints, start_pos, kata_end);
+      std::string volitional_surface(chunk.span(start_pos, kata_end + 1));
+      std::string kata_part(chunk.span(start_pos, kata_end));
       std::string base_form = kata_part + "る";  // Assume godan-ra
 
       // Negative cost to beat unsplit forms
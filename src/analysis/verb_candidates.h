@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "analysis/candidate_options.h"
+#include "analysis/chunk_context.h"
 #include "core/types.h"
 #include "dictionary/dictionary.h"
 #include "grammar/inflection.h"
@@ -27,13 +28,13 @@ struct UnknownCandidate;
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for conjugation detection
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @param dict_manager Dictionary manager for base form verification
  * @return Vector of candidates
  */
 std::vector<UnknownCandidate> generateCompoundVerbCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                              const std::vector<normalize::CharType>& char_types,
-                                                             const grammar::Inflection& inflection,
+                                                             const ChunkContext& chunk,
                                                              const dictionary::DictionaryManager* dict_manager,
                                                              const VerbCandidateOptions& verb_opts = {});
 
@@ -46,13 +47,13 @@ std::vector<UnknownCandidate> generateCompoundVerbCandidates(const std::vector<c
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for conjugation detection
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @param dict_manager Dictionary manager for suffix checking
  * @return Vector of candidates
  */
 std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                      const std::vector<normalize::CharType>& char_types,
-                                                     const grammar::Inflection& inflection,
+                                                     const ChunkContext& chunk,
                                                      const dictionary::DictionaryManager* dict_manager,
                                                      const VerbCandidateOptions& verb_opts = {});
 
@@ -65,13 +66,13 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for conjugation detection
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @param dict_manager Dictionary manager for base form verification
  * @return Vector of candidates
  */
 std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                              const std::vector<normalize::CharType>& char_types,
-                                                             const grammar::Inflection& inflection,
+                                                             const ChunkContext& chunk,
                                                              const dictionary::DictionaryManager* dict_manager,
                                                              const VerbCandidateOptions& verb_opts = {});
 
@@ -85,12 +86,12 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
  * @param codepoints Text as codepoints
  * @param start_pos Start position (character index)
  * @param char_types Character types for each position
- * @param inflection Inflection analyzer for conjugation detection
+ * @param chunk Chunk accessor (text spans, memoized inflection analysis)
  * @return Vector of candidates
  */
 std::vector<UnknownCandidate> generateKatakanaVerbCandidates(
     const std::vector<char32_t>& codepoints, size_t start_pos, const std::vector<normalize::CharType>& char_types,
-    const grammar::Inflection& inflection, const dictionary::DictionaryManager* dict_manager = nullptr,
+    const ChunkContext& chunk, const dictionary::DictionaryManager* dict_manager = nullptr,
     const VerbCandidateOptions& verb_opts = {});
 
 }  // namespace suzume::analysis
@@ -31,9 +31,10 @@ namespace vh = verb_helpers;
 
 std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                              const std::vector<normalize::CharType>& char_types,
-                                                             const grammar::Inflection& inflection,
+                                                             const ChunkContext& chunk,
                                                              const dictionary::DictionaryManager* dict_manager,
                                                              const VerbCandidateOptions& verb_opts) {
+  const grammar::Inflection& inflection = chunk.inflection();
   std::vector<UnknownCandidate> candidates;
 
   if (start_pos >= char_types.size() || char_types[start_pos] != normalize::CharType::Hiragana) {
@@ -239,7 +240,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
 
   // Try different lengths, starting from longest
   for (size_t end_pos = hiragana_end; end_pos > start_pos + 1; --end_pos) {
-    std::string surface = extractSubstring(codepoints, start_pos, end_pos);
+    std::string surface(chunk.span(start_pos, end_pos));
 
     if (surface.empty()) {
       continue;
@@ -247,7 +248,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
 
     // Check if this looks like a conjugated verb
     // First try the best match, but also check all candidates for dictionary verbs
-    const auto& all_candidates = inflection.analyze(surface);
+    const auto& all_candidates = chunk.analyzeSpan(start_pos, end_pos);
     grammar::InflectionCandidate best;
     bool is_dictionary_verb = false;
 
@@ -618,7 +619,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
             (first_char == U'で' || first_char == U'に' || first_char == U'が' || first_char == U'を' ||
              first_char == U'は' || first_char == U'の' || first_char == U'へ');
         // Check if 1-char stem + る is a known verb (e.g., でる, ねる)
-        std::string one_char_stem = extractSubstring(codepoints, start_pos, start_pos + 1);
+        std::string one_char_stem(chunk.span(start_pos, start_pos + 1));
         std::string potential_verb = one_char_stem + "る";
         bool has_1char_verb_in_dict = vh::isVerbInDictionary(dict_manager, potential_verb);
         if (has_1char_verb_in_dict) {
@@ -754,8 +755,8 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
 
     // Construct base form and mizenkei surface
     // E.g., for いわれる: mizenkei = いわ, stem = い, base_suffix = う → base_form = いう
-    std::string mizenkei_surface = extractSubstring(codepoints, start_pos, mizenkei_end);
-    std::string stem = extractSubstring(codepoints, start_pos, mizenkei_end - 1);
+    std::string_view mizenkei_surface = chunk.span(start_pos, mizenkei_end);
+    std::string stem(chunk.span(start_pos, mizenkei_end - 1));
     std::string base_form = stem + std::string(base_suffix);
 
     // Check if mizenkei surface exists in dictionary as a verb
@@ -792,7 +793,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
       char32_t stem_last = codepoints[mizenkei_end - 2];
       auto inner_suffix = grammar::godanBaseSuffixFromARow(stem_last);
       if (!inner_suffix.empty()) {
-        std::string inner_stem = extractSubstring(codepoints, start_pos, mizenkei_end - 2);
+        std::string inner_stem(chunk.span(start_pos, mizenkei_end - 2));
         std::string inner_base = inner_stem + std::string(inner_suffix);
         if (vh::isVerbInDictionary(dict_manager, inner_base)) {
           causative_passive_penalty = bigram_cost::kStrong;
@@ -836,7 +837,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     // MeCab splits: いわれません → いわ + れ + ませ + ん (4 tokens)
     // Previous strategy of splitting at passive renyokei (いわれ + ません) was incorrect
     size_t split_end = mizenkei_end;
-    std::string surface = extractSubstring(codepoints, start_pos, split_end);
+    std::string surface(chunk.span(start_pos, split_end));
     const char* pattern_name = "passive_mizenkei";
 
     float cost = candidate::verb_cost::kStandardBonus + causative_passive_penalty;
@@ -889,7 +890,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     if (stem_end <= start_pos)
       continue;
 
-    std::string stem = extractSubstring(codepoints, start_pos, stem_end);
+    std::string stem(chunk.span(start_pos, stem_end));
 
     // Skip stems containing て or で - these are te-form + subsidiary verb patterns
     // E.g., しておられた → stem=してお is actually して(te-form)+おる(subsidiary), not ichidan しておる
@@ -1015,8 +1016,8 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     }
 
     // Construct mizenkei surface and base form
-    std::string mizenkei_surface = extractSubstring(codepoints, start_pos, mizenkei_end);
-    std::string stem = extractSubstring(codepoints, start_pos, mizenkei_end - 1);
+    std::string mizenkei_surface(chunk.span(start_pos, mizenkei_end));
+    std::string stem(chunk.span(start_pos, mizenkei_end - 1));
     std::string base_form = stem + std::string(base_suffix);
 
     // Validate: check if base form exists in dictionary
@@ -1128,8 +1129,8 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     }
 
     // Construct mizenkei surface and base form
-    std::string mizenkei_surface = extractSubstring(codepoints, start_pos, mizenkei_end);
-    std::string stem = extractSubstring(codepoints, start_pos, mizenkei_end - 1);
+    std::string mizenkei_surface(chunk.span(start_pos, mizenkei_end));
+    std::string stem(chunk.span(start_pos, mizenkei_end - 1));
     std::string base_form = stem + std::string(base_suffix);
 
     // Validate: analyze the full form (including ない) to check if it's a valid verb
@@ -1203,7 +1204,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     // Get stem (part before ん) — need at least 1 char
     if (n_pos <= start_pos)
       continue;
-    std::string stem = extractSubstring(codepoints, start_pos, n_pos);
+    std::string stem(chunk.span(start_pos, n_pos));
 
     // Construct base form: stem + る (godan-ra)
     std::string base_form = stem + "る";
@@ -1300,7 +1301,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     }
 
     // Get the stem (part before onbin character)
-    std::string stem = extractSubstring(codepoints, start_pos, onbin_pos);
+    std::string stem(chunk.span(start_pos, onbin_pos));
     if (stem.empty()) {
       continue;
     }
@@ -1368,7 +1369,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
       }
 
       // Found a valid verb - generate onbin stem candidate
-      std::string onbin_surface = extractSubstring(codepoints, start_pos, onbin_pos + 1);
+      std::string onbin_surface(chunk.span(start_pos, onbin_pos + 1));
       // For tense patterns, use higher cost to avoid false positives for short stems
       // Contraction patterns (っとく, っちゃう) are more reliable, use lower cost
       float cost = is_contraction_pattern ? -0.5F : 0.2F;
@@ -1426,7 +1427,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
         }
         if (is_valid_follow) {
           // Construct base form (stem + る)
-          std::string stem_surface = extractSubstring(codepoints, start_pos, start_pos + 1);
+          std::string stem_surface(chunk.span(start_pos, start_pos + 1));
           std::string base_form = stem_surface + "る";
 
           // For e-row: require dict check to prevent false positives (め+て, け+て)
@@ -1500,7 +1501,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     }
 
     // Construct stem and base form
-    std::string stem_surface = extractSubstring(codepoints, start_pos, end_pos);
+    std::string stem_surface(chunk.span(start_pos, end_pos));
     std::string base_form = stem_surface + "る";
 
     // Skip stems starting with っ (sokuon) - no Japanese verb stem begins with っ
@@ -1510,7 +1511,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
     }
 
     // Use inflection analysis to validate - check if stem is recognized as ichidan
-    const auto& stem_analysis = inflection.analyze(stem_surface);
+    const auto& stem_analysis = chunk.analyzeSpan(start_pos, end_pos);
     bool found_ichidan = false;
     float ichidan_confidence = 0.0F;
     for (const auto& cand : stem_analysis) {
@@ -1619,8 +1620,8 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
       if (is_sokuonbin_te_ta) {
         // Generate candidate for stem + っ (without the た/て)
         size_t onbin_end = hira_extent_end - 1;  // Position after っ
-        std::string onbin_surface = extractSubstring(codepoints, start_pos, onbin_end);
-        std::string stem = extractSubstring(codepoints, start_pos, onbin_end - 1);
+        std::string onbin_surface(chunk.span(start_pos, onbin_end));
+        std::string stem(chunk.span(start_pos, onbin_end - 1));
 
         // Try different base form patterns for っ-onbin
         // GodanWa: しま + う → しまう, GodanRa: なくな + る → なくなる
@@ -1655,8 +1656,7 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
         // Phase 2: Inflection analysis fallback for short hiragana stems (e.g., やっ)
         // Only for stems of 1-2 characters (e.g., や, やる → やっ)
         if (!found_dict_match && stem.size() <= 6) {  // 2 chars * 3 bytes max
-          std::string full_surface = extractSubstring(codepoints, start_pos, hira_extent_end);
-          const auto& infl_results = inflection.analyze(full_surface);
+          const auto& infl_results = chunk.analyzeSpan(start_pos, hira_extent_end);
           for (const auto& result : infl_results) {
             if (result.confidence >= 0.5F) {
               for (const auto& [verb_type, base_suffix] : sokuonbin_types) {
@@ -1707,8 +1707,8 @@ std::vector<UnknownCandidate> generateHiraganaVerbCandidates(const std::vector<c
       if (is_hatsuonbin_de_da) {
         // Generate candidate for stem + ん (without the だ/で)
         size_t onbin_end = hira_extent_end - 1;  // Position after ん
-        std::string onbin_surface = extractSubstring(codepoints, start_pos, onbin_end);
-        std::string stem = extractSubstring(codepoints, start_pos, onbin_end - 1);
+        std::string onbin_surface(chunk.span(start_pos, onbin_end));
+        std::string stem(chunk.span(start_pos, onbin_end - 1));
 
         // Try different base form patterns for ん-onbin
         // Godan-ma: こ + む → こむ, よ + む → よむ
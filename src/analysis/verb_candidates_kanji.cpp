@@ -31,9 +31,10 @@ namespace vh = verb_helpers;
 
 std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>& codepoints, size_t start_pos,
                                                      const std::vector<normalize::CharType>& char_types,
-                                                     const grammar::Inflection& inflection,
+                                                     const ChunkContext& chunk,
                                                      const dictionary::DictionaryManager* dict_manager,
                                                      const VerbCandidateOptions& verb_opts) {
+  const grammar::Inflection& inflection = chunk.inflection();
   std::vector<UnknownCandidate> candidates;
 
   if (start_pos >= char_types.size() || char_types[start_pos] != normalize::CharType::Kanji) {
@@ -90,7 +91,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           }
           // が+な: verify kanji+ぐ exists as godan-ga verb in dictionary
           if (!is_verb_pattern && next_char == U'な' && dict_manager != nullptr) {
-            std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+            std::string kanji_stem(chunk.span(start_pos, kanji_end));
             std::string gu_form = kanji_stem + "ぐ";
             if (vh::isVerbInDictionary(dict_manager, gu_form)) {
               is_verb_pattern = true;
@@ -119,7 +120,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
   // Check for kanji verb + verb renyokei + すぎ pattern for MeCab compatibility
   // MeCab splits: 書きすぎる → 書き + すぎる, not 書きすぎる as single verb
   // Pattern: kanji + (き/ぎ/し/ち/に/び/み/り/い) + すぎ...
-  std::string hira_part = extractSubstring(codepoints, kanji_end, hiragana_end);
+  std::string_view hira_part = chunk.span(kanji_end, hiragana_end);
   // C++17 compatible: check if hiragana contains "すぎ" (6 bytes)
   bool is_sugi_pattern = (hira_part.find("すぎ") != std::string::npos);
 
@@ -143,7 +144,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           std::string_view base_suffix = grammar::godanBaseSuffixFromIRow(first_hira);
           if (!base_suffix.empty()) {
             // Construct base form: kanji + base_suffix (e.g., 書 + く = 書く)
-            std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+            std::string kanji_stem(chunk.span(start_pos, kanji_end));
             std::string base_form = kanji_stem + std::string(base_suffix);
 
             // Verify the base form is a valid verb
@@ -155,7 +156,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
 
             if (is_valid_verb) {
               size_t renyokei_end = kanji_end + 1;
-              std::string surface = extractSubstring(codepoints, start_pos, renyokei_end);
+              std::string surface(chunk.span(start_pos, renyokei_end));
               // Negative cost to beat compound NOUN path
               // Compound NOUNs like 書きすぎた get cost ~1.0, so we need much lower
               constexpr float kCost = candidate::verb_cost::kStrongBonus;
@@ -180,7 +181,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       if (kanji_end + 1 < codepoints.size() && codepoints[kanji_end + 1] == U'す' &&
           kanji_end + 2 < codepoints.size() && codepoints[kanji_end + 2] == U'ぎ') {
         // Construct base form: kanji + first_hira + る (e.g., 食 + べ + る = 食べる)
-        std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string kanji_stem(chunk.span(start_pos, kanji_end));
         std::string ichidan_stem = kanji_stem + normalize::encodeUtf8(first_hira);
         std::string base_form = ichidan_stem + "る";
 
@@ -193,7 +194,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
 
         if (is_valid_verb) {
           size_t renyokei_end = kanji_end + 1;
-          std::string surface = extractSubstring(codepoints, start_pos, renyokei_end);
+          std::string surface(chunk.span(start_pos, renyokei_end));
           // Negative cost to beat compound NOUN path
           constexpr float kCost = candidate::verb_cost::kStrongBonus;
           SUZUME_DEBUG_VERBOSE_BLOCK {
@@ -229,9 +230,9 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         grammar::VerbType verb_type = grammar::verbTypeFromARowCodepoint(a_row);
         std::string_view base_suffix = grammar::godanBaseSuffixFromARow(a_row);
         if (verb_type != grammar::VerbType::Unknown && !base_suffix.empty()) {
-          std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+          std::string kanji_stem(chunk.span(start_pos, kanji_end));
           std::string base_form = kanji_stem + std::string(base_suffix);
-          std::string surface = extractSubstring(codepoints, start_pos, kanji_end + 1);
+          std::string surface(chunk.span(start_pos, kanji_end + 1));
 
           // Verify via inflection analysis of base form
           const auto& results = inflection.analyze(base_form);
@@ -291,7 +292,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       char32_t after = codepoints[after_sha];
       // しゃ + れ (passive) or しゃ + せ (causative) or しゃ + し (emphatic)
       if (after == U'れ' || after == U'せ' || after == U'し') {
-        std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string kanji_stem(chunk.span(start_pos, kanji_end));
         std::string base_form = kanji_stem + "す";
         std::string surface = kanji_stem + "しゃ";
 
@@ -330,9 +331,9 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       if (verb_type != grammar::VerbType::Unknown) {
         std::string_view base_suffix = grammar::godanBaseSuffixFromARow(first_hira);
         if (!base_suffix.empty()) {
-          std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+          std::string kanji_stem(chunk.span(start_pos, kanji_end));
           std::string base_form = kanji_stem + std::string(base_suffix);
-          std::string surface = extractSubstring(codepoints, start_pos, kanji_end + 1);
+          std::string surface(chunk.span(start_pos, kanji_end + 1));
 
           // Verify via dictionary or inflection analysis of conjugated form
           bool is_valid = vh::isVerbInDictionary(dict_manager, base_form);
@@ -392,7 +393,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
   for (size_t stem_end = kanji_end; stem_end <= kanji_end + 1 && stem_end < hiragana_end; ++stem_end) {
     // Try different ending lengths, starting from longest
     for (size_t end_pos = hiragana_end; end_pos > stem_end; --end_pos) {
-      std::string surface = extractSubstring(codepoints, start_pos, end_pos);
+      std::string surface(chunk.span(start_pos, end_pos));
 
       if (surface.empty()) {
         continue;
@@ -400,7 +401,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
 
       // Check for particle/copula patterns that should NOT be treated as verbs
       // Kanji + particle or copula (で, に, を, が, は, も, へ, と, や, か, の, etc.)
-      std::string hiragana_part = extractSubstring(codepoints, kanji_end, end_pos);
+      std::string hiragana_part(chunk.span(kanji_end, end_pos));
       if (normalize::isParticleOrCopula(hiragana_part)) {
         continue;  // Skip particle/copula patterns
       }
@@ -483,7 +484,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
                                           core::kJapaneseCharBytes);
           if (last_char_view == "く" && end_pos < codepoints.size()) {
             // Check if followed by だ or ださ or ださい
-            std::string remaining = extractSubstring(codepoints, end_pos, std::min(end_pos + 3, codepoints.size()));
+            std::string_view remaining = chunk.span(end_pos, std::min(end_pos + 3, codepoints.size()));
             if (remaining.compare(0, 6, "ださ") == 0 || remaining.compare(0, 3, "だ") == 0) {
               continue;  // Skip - likely part of ください pattern
             }
@@ -515,7 +516,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       // This handles cases where the best candidate has wrong stem but a lower-ranked
       // candidate has the correct stem (e.g., 見なければ where 見なける wins over 見る)
       const auto& inflection_results = inflection.analyze(surface);
-      std::string expected_stem = extractSubstring(codepoints, start_pos, stem_end);
+      std::string_view expected_stem = chunk.span(start_pos, stem_end);
 
       // Find a candidate with matching stem and sufficient confidence
       // Prefer dictionary-verified candidates when multiple have similar confidence
@@ -660,7 +661,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           // Check if the base form (stem+す) is a registered GodanSa verb
           // For single-char hiragana_part "し": base = kanji + す
           // For multi-char like "とし": base = kanji + と + す = 証とす
-          std::string base_stem = extractSubstring(codepoints, start_pos, stem_end);
+          std::string base_stem(chunk.span(start_pos, stem_end));
           std::string base_form = base_stem + "す";
           if (!vh::isVerbInDictionary(dict_manager, base_form)) {
             // Not a registered verb - likely サ変 or compound particle pattern
@@ -1158,10 +1159,10 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       } else {
         // Surface is kanji + first e/i-row hiragana only (e.g., 食べ from 食べます, 感じ from 感じる)
         size_t renyokei_end = kanji_end + 1;
-        std::string surface = extractSubstring(codepoints, start_pos, renyokei_end);
+        std::string surface(chunk.span(start_pos, renyokei_end));
         // Get all inflection candidates, not just the best
         // This is important for ambiguous cases like 入れ (godan 入る imperative vs ichidan 入れる renyoukei)
-        const auto& all_cands = inflection.analyze(surface);
+        const auto& all_cands = chunk.analyzeSpan(start_pos, renyokei_end);
         // Find the best Ichidan, Suru, and Godan candidates
         grammar::InflectionCandidate ichidan_cand;
         grammar::InflectionCandidate suru_cand;
@@ -1212,7 +1213,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         bool suffix_is_dict_verb = false;
         if (dict_manager != nullptr && kanji_end > start_pos + 1) {
           for (size_t split = start_pos + 1; split < kanji_end; ++split) {
-            std::string remainder = extractSubstring(codepoints, split, renyokei_end);
+            std::string remainder(chunk.span(split, renyokei_end));
             std::string remainder_base = remainder + "る";
             if (vh::isVerbInDictionary(dict_manager, remainder_base)) {
               suffix_is_dict_verb = true;
@@ -1247,7 +1248,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
             bool is_in_dict = (dict_manager != nullptr && vh::isVerbInDictionary(dict_manager, ichidan_cand.base_form));
             if (is_single_kanji || is_in_dict) {
               size_t shuushi_end = renyokei_end + 1;
-              std::string shuushi_surface = extractSubstring(codepoints, start_pos, shuushi_end);
+              std::string shuushi_surface(chunk.span(start_pos, shuushi_end));
               float shuushi_cost = base_cost + 0.1F;  // Slightly higher than renyokei
               candidates.push_back(
                   makeVerbCandidate(shuushi_surface, start_pos, shuushi_end, shuushi_cost, ichidan_cand.base_form,
@@ -1277,8 +1278,8 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
                              first_hira == U'ぼ' || first_hira == U'ぽ');
       if (first_is_o_row && (grammar::isERowCodepoint(second_hira) || grammar::isIRowCodepoint(second_hira))) {
         size_t renyokei_end = kanji_end + 2;
-        std::string surface = extractSubstring(codepoints, start_pos, renyokei_end);
-        const auto& all_cands = inflection.analyze(surface);
+        std::string surface(chunk.span(start_pos, renyokei_end));
+        const auto& all_cands = chunk.analyzeSpan(start_pos, renyokei_end);
         grammar::InflectionCandidate ichidan_cand;
         grammar::InflectionCandidate suru_cand;
         grammar::InflectionCandidate godan_cand;
@@ -1342,8 +1343,8 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       if (codepoints[renyokei_end - 1] != U'し')
         continue;
 
-      std::string surface = extractSubstring(codepoints, start_pos, renyokei_end);
-      const auto& all_cands = inflection.analyze(surface);
+      std::string surface(chunk.span(start_pos, renyokei_end));
+      const auto& all_cands = chunk.analyzeSpan(start_pos, renyokei_end);
 
       // Find best godan-sa candidate
       grammar::InflectionCandidate best_sa;
@@ -1430,12 +1431,12 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           codepoints[renyokei_end + 1] == U'ば') {
         // E.g., 食べ + れ + ば → 食べれ is kateikei
         size_t kateikei_end = renyokei_end + 1;  // renyokei + れ
-        std::string surface = extractSubstring(codepoints, start_pos, kateikei_end);
-        std::string renyokei_surface = extractSubstring(codepoints, start_pos, renyokei_end);
+        std::string surface(chunk.span(start_pos, kateikei_end));
+        std::string renyokei_surface(chunk.span(start_pos, renyokei_end));
         std::string base_form = renyokei_surface + "る";  // 食べ + る = 食べる
 
         // Verify using inflection analysis on the kateikei form
-        const auto& all_candidates = inflection.analyze(surface);
+        const auto& all_candidates = chunk.analyzeSpan(start_pos, kateikei_end);
         float ichidan_confidence = vh::getIchidanConfidence(all_candidates, 0.3F);
 
         if (ichidan_confidence >= 0.3F) {
@@ -1479,8 +1480,8 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         if (!is_suru_pattern) {
           // E.g., 食べ + よ + う → 食べよ is volitional stem
           size_t volitional_end = renyokei_end + 1;  // renyokei + よ
-          std::string surface = extractSubstring(codepoints, start_pos, volitional_end);
-          std::string renyokei_surface = extractSubstring(codepoints, start_pos, renyokei_end);
+          std::string surface(chunk.span(start_pos, volitional_end));
+          std::string renyokei_surface(chunk.span(start_pos, renyokei_end));
           std::string base_form = renyokei_surface + "る";  // 食べ + る = 食べる
 
           // Check if renyokei looks like an adjective (kanji+い pattern)
@@ -1551,7 +1552,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       }
       if (followed_by_valid) {
         size_t renyokei_end = kanji_end + 2;  // kanji + ら + せ
-        std::string surface = extractSubstring(codepoints, start_pos, renyokei_end);
+        std::string surface(chunk.span(start_pos, renyokei_end));
 
         // The causative base form is surface + る (e.g., 知らせ → 知らせる)
         std::string causative_base = surface + "る";
@@ -1590,14 +1591,14 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       // e.g., 処理される should be 処理(noun) + される(aux), not godan passive
       // Also skip single kanji + さ + れ as these are typically not real verbs
       // e.g., 強される is not a verb (強い is adjective, 強 is noun)
-      std::string kanji_check = extractSubstring(codepoints, start_pos, kanji_end);
+      std::string_view kanji_check = chunk.span(start_pos, kanji_end);
       bool is_suru_passive_pattern = (first_hira == U'さ' && grammar::isAllKanji(kanji_check));
       if (is_suru_passive_pattern) {
         // Skip - this should be handled as noun + される auxiliary
         // Continue to next pattern
       } else {
         size_t renyokei_end = kanji_end + 2;  // kanji + a-row + れ
-        std::string surface = extractSubstring(codepoints, start_pos, renyokei_end);
+        std::string surface(chunk.span(start_pos, renyokei_end));
 
         // Check if this is a valid passive verb stem
         // The passive base form is surface + る (e.g., 言われ → 言われる)
@@ -1611,7 +1612,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         } else {
           // Compute the original base verb lemma by converting A-row to U-row
           // e.g., 言われる: 言 + わ + れる → 言 + う = 言う
-          std::string kanji_part = extractSubstring(codepoints, start_pos, kanji_end);
+          std::string kanji_part(chunk.span(start_pos, kanji_end));
           std::string_view u_row_suffix = grammar::godanBaseSuffixFromARow(first_hira);
           std::string base_lemma = kanji_part + std::string(u_row_suffix);
 
@@ -1701,7 +1702,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
     }
 
     if (has_rare_suffix && stem_end > start_pos) {
-      std::string surface = extractSubstring(codepoints, start_pos, stem_end);
+      std::string surface(chunk.span(start_pos, stem_end));
       // Construct base form: stem + る (e.g., 信じ → 信じる, 見 → 見る)
       std::string base_form = surface + "る";
 
@@ -1751,7 +1752,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       bool is_negative_aux = (h1 == kNa && (h2 == kI || h2 == kKu || h2 == kKa || h2 == kKe));
 
       if (is_polite_aux || is_negative_aux) {
-        std::string surface = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string surface(chunk.span(start_pos, kanji_end));
         std::string base_form = surface + "る";
         constexpr float kCost = candidate::verb_cost::kStandardBonus;  // Strong bonus to beat NOUN candidate
         SUZUME_DEBUG_VERBOSE_BLOCK {
@@ -1769,7 +1770,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       bool is_ta_aux = (h1 == kTa);
       bool is_te_particle = (h1 == kTe);
       if (is_ta_aux || is_te_particle) {
-        std::string surface = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string surface(chunk.span(start_pos, kanji_end));
         std::string base_form = surface + "る";
         constexpr float kCost = candidate::verb_cost::kStrongBonus;  // Strong bonus to beat unified dictionary entry
         SUZUME_DEBUG_VERBOSE_BLOCK {
@@ -1789,7 +1790,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       bool is_toku_aux = (h1 == kTo);
       bool is_chau_aux = (h1 == kChi);
       if (is_toku_aux || is_chau_aux) {
-        std::string surface = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string surface(chunk.span(start_pos, kanji_end));
         std::string base_form = surface + "る";
         constexpr float kCost = candidate::verb_cost::kStrongBonus;  // Strong bonus to beat unified contraction entry
         SUZUME_DEBUG_VERBOSE_BLOCK {
@@ -1807,7 +1808,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       // Note: For ichidan verbs, the passive/potential is られる (not れる)
       bool is_rareru_aux = (h1 == kRa && h2 == kRe);
       if (is_rareru_aux) {
-        std::string surface = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string surface(chunk.span(start_pos, kanji_end));
         std::string base_form = surface + "る";
         constexpr float kCost =
             candidate::verb_cost::kStrongBonus;  // Strong bonus to beat godan mizenkei interpretation
@@ -1826,7 +1827,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       bool is_volitional_aux = (h1 == kYo && h2 == kU);
       if (is_volitional_aux) {
         // Generate 漢字+よ as volitional stem
-        std::string surface = extractSubstring(codepoints, start_pos, kanji_end + 1);
+        std::string surface(chunk.span(start_pos, kanji_end + 1));
         std::string base_form = extractSubstring(codepoints, start_pos, kanji_end) + "る";
         constexpr float kCost = candidate::verb_cost::kStrongBonus;  // Strong bonus to beat compound interpretation
         SUZUME_DEBUG_VERBOSE_BLOCK {
@@ -1845,7 +1846,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       // MeCab splits these as: 見+させる (not 見さ+せる like godan-sa)
       bool is_saseru_aux = (h1 == kSa && h2 == kSe);
       if (is_saseru_aux) {
-        std::string surface = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string surface(chunk.span(start_pos, kanji_end));
         std::string base_form = surface + "る";
         constexpr float kCost = candidate::verb_cost::kStrongBonus;  // Strong bonus to beat NOUN candidate
         SUZUME_DEBUG_VERBOSE_BLOCK {
@@ -1969,7 +1970,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
             // E.g., 装飾さ should be 装飾 + される, not 装飾す mizenkei
             bool is_suru_verb_pattern = false;
             if (verb_type == grammar::VerbType::GodanSa) {
-              std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+              std::string_view kanji_stem = chunk.span(start_pos, kanji_end);
               if (grammar::isAllKanji(kanji_stem) && kanji_stem.size() >= 6) {
                 // This is likely a Suru verb pattern (2+ kanji followed by される)
                 // The connection rules will handle 装飾 + される instead
@@ -1991,7 +1992,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
               std::string_view base_suffix = grammar::godanBaseSuffixFromARow(first_hira);
               if (!base_suffix.empty()) {
                 // Construct base form: stem + base_suffix (e.g., 書 + く = 書く)
-                std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+                std::string kanji_stem(chunk.span(start_pos, kanji_end));
                 std::string base_form = kanji_stem + std::string(base_suffix);
 
                 // Verify the base form is a valid verb
@@ -2031,7 +2032,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
                 }
 
                 if (is_valid_verb) {
-                  std::string surface = extractSubstring(codepoints, start_pos, mizenkei_end);
+                  std::string surface(chunk.span(start_pos, mizenkei_end));
                   // Cost varies by pattern:
                   // - ぬ pattern: negative cost (-0.5F) to beat combined verb form
                   //   揃わぬ(VERB) gets ~-0.1 total, so split needs lower cost
@@ -2111,7 +2112,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           // E.g., 分から → 分かる (replace A-row ending with U-row)
           std::string_view base_suffix = grammar::godanBaseSuffixFromARow(cur_char);
           if (!base_suffix.empty()) {
-            std::string stem = extractSubstring(codepoints, start_pos, scan_pos);
+            std::string stem(chunk.span(start_pos, scan_pos));
             std::string base_form = stem + std::string(base_suffix);
             // Verify this is a valid verb
             bool is_valid_verb = vh::isVerbInDictionary(dict_manager, base_form);
@@ -2120,7 +2121,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
               is_valid_verb = infl_result.confidence > 0.5F && vh::isGodanVerbType(infl_result.verb_type);
             }
             if (is_valid_verb) {
-              std::string surface = extractSubstring(codepoints, start_pos, multi_miz_end);
+              std::string surface(chunk.span(start_pos, multi_miz_end));
               constexpr float kCost = candidate::verb_cost::kStandardBonus;  // Same as other negative patterns
               const char* pattern = is_nakatt_pattern ? "multi_mizenkei_nakatt"
                                     : is_n_pattern    ? "multi_mizenkei_n"
@@ -2168,7 +2169,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         std::string_view onbin_str = is_hatsuonbin ? "ん" : "い";
         auto candidates_to_try = vh::getGodanTypesByOnbin(onbin_str);
         // Get the kanji stem
-        std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string kanji_stem(chunk.span(start_pos, kanji_end));
         // First, check dictionary for ALL verb types before falling back to inflection
         // This ensures dictionary-verified verbs take precedence
         grammar::VerbType matched_verb_type = grammar::VerbType::Unknown;
@@ -2185,8 +2186,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         }
         // Phase 2: Inflection analysis fallback
         if (matched_verb_type == grammar::VerbType::Unknown && kanji_end > start_pos) {
-          std::string full_surface = extractSubstring(codepoints, start_pos, hiragana_end);
-          const auto& infl_results = inflection.analyze(full_surface);
+          const auto& infl_results = chunk.analyzeSpan(start_pos, hiragana_end);
           float best_conf = 0.0F;
           for (const auto& result : infl_results) {
             if (result.confidence >= 0.5F && result.confidence > best_conf) {
@@ -2207,7 +2207,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           // No valid verb found
         } else {
           // Found valid verb - generate onbin stem candidate
-          std::string onbin_surface = extractSubstring(codepoints, start_pos, kanji_end + 1);
+          std::string onbin_surface(chunk.span(start_pos, kanji_end + 1));
           constexpr float kOnbinCost = candidate::verb_cost::kStandardBonus;
           SUZUME_DEBUG_VERBOSE_BLOCK {
             SUZUME_DEBUG_STREAM << "[VERB_CAND] " << onbin_surface
@@ -2247,11 +2247,11 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
             {grammar::VerbType::GodanWa, "う"},
         };
         // Get the kanji stem
-        std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string kanji_stem(chunk.span(start_pos, kanji_end));
 
 #ifdef SUZUME_DEBUG
         // TRACE: Collect all candidates for logging (debug builds only)
-        std::string onbin_surface_for_log = extractSubstring(codepoints, start_pos, kanji_end + 1);
+        std::string_view onbin_surface_for_log = chunk.span(start_pos, kanji_end + 1);
         struct SokuonbinCandidate {
           grammar::VerbType type;
           std::string base_form;
@@ -2287,7 +2287,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         if (dict_manager != nullptr && kanji_end - start_pos >= 2) {
           // Check if any prefix of kanji_stem is a dictionary noun
           for (size_t prefix_len = 1; prefix_len < kanji_end - start_pos; ++prefix_len) {
-            std::string prefix = extractSubstring(codepoints, start_pos, start_pos + prefix_len);
+            std::string_view prefix = chunk.span(start_pos, start_pos + prefix_len);
             auto lookup_results = dict_manager->lookup(prefix, 0);
             for (const auto& result : lookup_results) {
               if (result.entry != nullptr && result.entry->surface == prefix &&
@@ -2306,7 +2306,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           // This handles patterns like 本買った, 服買った, 車買った
           if (!starts_with_dict_noun && kanji_end - start_pos == 2) {
             // Get the second kanji + verb ending
-            std::string remainder_stem = extractSubstring(codepoints, start_pos + 1, kanji_end);
+            std::string remainder_stem(chunk.span(start_pos + 1, kanji_end));
             for (const auto& [verb_type, base_suffix] : sokuonbin_types) {
               std::string remainder_base = remainder_stem + std::string(base_suffix);
               if (vh::isVerbInDictionary(dict_manager, remainder_base)) {
@@ -2325,8 +2325,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
             // Common verbs like 残る, 立つ, 打つ may not be in L2 dictionary.
             // Try surfaces of increasing length to get inflection result.
             for (size_t try_end = kanji_end + 2; try_end <= codepoints.size() && try_end <= kanji_end + 4; ++try_end) {
-              std::string try_surface = extractSubstring(codepoints, start_pos, try_end);
-              auto infl_result = inflection.analyze(try_surface);
+              const auto& infl_result = chunk.analyzeSpan(start_pos, try_end);
               if (!infl_result.empty()) {
                 const auto& best = infl_result[0];
                 if (best.confidence >= 0.6F) {
@@ -2376,7 +2375,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
           // Dict-matched verbs get bonus (-0.5) to beat unsplit forms
           // Inflection-only matches get neutral cost (0) to avoid false positives
           // like 像っ (from 像る which is not a real verb)
-          std::string onbin_surface = extractSubstring(codepoints, start_pos, kanji_end + 1);
+          std::string onbin_surface(chunk.span(start_pos, kanji_end + 1));
           // Dict-matched verbs get bonus (-0.5) to beat unsplit forms
           // Inflection-only matches (2-kanji stems only) get neutral cost
           const float sokuonbin_cost = matched_via_dict ? -0.5F : 0.0F;
@@ -2418,12 +2417,12 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       // We have kanji + 1-2 hiragana + っ + た/て
       // Generate candidate for kanji + hiragana + っ (without the た/て)
       size_t onbin_end = hiragana_end - 1;  // Position after っ
-      std::string onbin_surface = extractSubstring(codepoints, start_pos, onbin_end);
+      std::string onbin_surface(chunk.span(start_pos, onbin_end));
 
       // Skip if hiragana portion is なかっ (negative past pattern: なかっ+た)
       // This prevents false positives like 来なかった → 来なかっ+た (来なかる doesn't exist)
       // The correct split is 来 + なかっ + た (kuru + negative aux + past)
-      std::string hiragana_part = extractSubstring(codepoints, kanji_end, onbin_end);
+      std::string_view hiragana_part = chunk.span(kanji_end, onbin_end);
       if (hiragana_part == "なかっ") {
         // This is negative past, not extended sokuonbin - skip
       } else if (hiragana_part == "であっ") {
@@ -2458,7 +2457,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         } else {
           // Build potential base form and verify it exists in dictionary or inflection
           // This prevents false positives like 食べてしまる
-          std::string stem = extractSubstring(codepoints, start_pos, onbin_end - 1);
+          std::string stem(chunk.span(start_pos, onbin_end - 1));
           std::string potential_base = stem + "る";
 
           // Skip if hiragana before っ is だ (copula pattern)
@@ -2538,12 +2537,12 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         continue;
 
       size_t onbin_end = pos + 1;  // Position after っ
-      std::string onbin_surface = extractSubstring(codepoints, start_pos, onbin_end);
-      std::string stem = extractSubstring(codepoints, start_pos, pos);
+      std::string onbin_surface(chunk.span(start_pos, onbin_end));
+      std::string stem(chunk.span(start_pos, pos));
       std::string potential_base = stem + "る";
 
       // Check hiragana part for known false patterns
-      std::string hiragana_part = extractSubstring(codepoints, kanji_end, onbin_end);
+      std::string_view hiragana_part = chunk.span(kanji_end, onbin_end);
       if (hiragana_part == "なかっ" || hiragana_part == "であっ" || utf8::startsWith(hiragana_part, "といっ") ||
           hiragana_part == "くなっ") {
         continue;
@@ -2601,7 +2600,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
             {grammar::VerbType::GodanNa, "ぬ"},
         };
         // Get the kanji stem
-        std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+        std::string kanji_stem(chunk.span(start_pos, kanji_end));
 
         // First, check dictionary for ALL verb types
         grammar::VerbType matched_verb_type = grammar::VerbType::Unknown;
@@ -2617,8 +2616,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         }
         // Phase 2: Inflection analysis fallback
         if (matched_verb_type == grammar::VerbType::Unknown) {
-          std::string full_surface = extractSubstring(codepoints, start_pos, hiragana_end);
-          const auto& infl_results = inflection.analyze(full_surface);
+          const auto& infl_results = chunk.analyzeSpan(start_pos, hiragana_end);
           float best_conf = 0.0F;
           for (const auto& result : infl_results) {
             if (result.confidence >= 0.5F && result.confidence > best_conf) {
@@ -2637,7 +2635,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
 
         if (matched_verb_type != grammar::VerbType::Unknown) {
           // Found valid verb - generate hatsuonbin stem candidate
-          std::string onbin_surface = extractSubstring(codepoints, start_pos, kanji_end + 1);
+          std::string onbin_surface(chunk.span(start_pos, kanji_end + 1));
           constexpr float kHatsuonbinCost = candidate::verb_cost::kStandardBonus;
           SUZUME_DEBUG_VERBOSE_BLOCK {
             SUZUME_DEBUG_STREAM << "[VERB_CAND] " << onbin_surface << " kanji_hatsuonbin lemma=" << matched_base_form
@@ -2671,7 +2669,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
       if (!at_end && !followed_by_de_da)
         continue;
 
-      std::string kanji_stem = extractSubstring(codepoints, start_pos, kanji_end);
+      std::string kanji_stem(chunk.span(start_pos, kanji_end));
       std::string hira_stem = (n_pos > kanji_end) ? extractSubstring(codepoints, kanji_end, n_pos) : "";
 
       static const std::vector<std::pair<grammar::VerbType, std::string_view>> n_onbin_types = {
@@ -2684,7 +2682,7 @@ std::vector<UnknownCandidate> generateVerbCandidates(const std::vector<char32_t>
         std::string base_form = kanji_stem + hira_stem + std::string(base_suffix);
         if (vh::isVerbInDictionaryWithType(dict_manager, base_form, verb_type) ||
             vh::isVerbInDictionary(dict_manager, base_form)) {
-          std::string onbin_surface = extractSubstring(codepoints, start_pos, n_pos + 1);
+          std::string onbin_surface(chunk.span(start_pos, n_pos + 1));
           constexpr float kHatsuonbinCost = candidate::verb_cost::kStandardBonus;
           SUZUME_DEBUG_VERBOSE_BLOCK {
             SUZUME_DEBUG_STREAM << "[VERB_CAND] " << onbin_surface << " kanji_hatsuonbin_standalone lemma=" << base_form
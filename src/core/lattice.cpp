@@ -1,6 +1,8 @@
 #include "lattice.h"
 
 #include <queue>
+#include <unordered_map>
+#include <utility>
 
 namespace suzume::core {
 
@@ -14,28 +16,72 @@ bool isValidExtendedPos(ExtendedPOS extended_pos) {
   return static_cast<size_t>(extended_pos) < static_cast<size_t>(ExtendedPOS::Count_);
 }
 
+// Hash of the fields that make two edges interchangeable for scoring
+size_t edgeKeyHash(const LatticeEdge& edge) {
+  size_t hash = std::hash<std::string_view>{}(edge.surface);
+  auto mix = [&hash](size_t value) { hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+  mix(edge.end);
+  mix(static_cast<size_t>(edge.pos));
+  mix(static_cast<size_t>(edge.extended_pos));
+  mix(static_cast<size_t>(edge.flags));
+  mix(static_cast<size_t>(edge.conj_type));
+  mix(std::hash<std::string_view>{}(edge.lemma));
+  return hash;
+}
+
+bool sameEdgeKey(const LatticeEdge& lhs, const LatticeEdge& rhs) {
+  return lhs.end == rhs.end && lhs.pos == rhs.pos && lhs.extended_pos == rhs.extended_pos &&
+         lhs.flags == rhs.flags && lhs.conj_type == rhs.conj_type && lhs.surface == rhs.surface &&
+         lhs.lemma == rhs.lemma;
+}
+
 }  // namespace
 
 Lattice::Lattice(size_t text_length) : text_length_(text_length), edge_indices_by_start_(text_length + 1) {}
 
-void Lattice::addEdge(const LatticeEdge& edge) {
+void Lattice::addEdge(const LatticeEdge& edge, [[maybe_unused]] const EdgeDebugInfo& debug) {
   if (edge.start < edge.end && edge.end <= text_length_ && isValidPos(edge.pos) &&
       isValidExtendedPos(edge.extended_pos) && all_edges_.size() < kMaxEdges) {
     LatticeEdge new_edge = edge;
     new_edge.id = static_cast<uint32_t>(all_edges_.size());
+#ifdef SUZUME_DEBUG_INFO
+    std::string_view auto_epos_source;
+#endif
     // Set extended_pos if not already set - auto-detect for verbs/adjectives
     if (new_edge.extended_pos == ExtendedPOS::Unknown) {
       if (new_edge.pos == PartOfSpeech::Verb) {
         new_edge.extended_pos = detectVerbForm(new_edge.surface, {});
+#ifdef SUZUME_DEBUG_INFO
+        auto_epos_source = "lattice_auto_verb";
+#endif
       } else if (new_edge.pos == PartOfSpeech::Adjective) {
         // Check conj_type for na-adjective
         bool is_na = new_edge.conj_type == dictionary::ConjugationType::NaAdjective;
         new_edge.extended_pos = detectAdjForm(new_edge.surface, is_na);
+#ifdef SUZUME_DEBUG_INFO
+        auto_epos_source = "lattice_auto_adj";
+#endif
       } else {
         new_edge.extended_pos = posToExtendedPos(new_edge.pos);
+#ifdef SUZUME_DEBUG_INFO
+        auto_epos_source = "lattice_default";
+#endif
       }
     }
+    new_edge.char_classes = spanCharClasses(new_edge.start, new_edge.end);
     all_edges_.push_back(new_edge);
+#ifdef SUZUME_DEBUG_INFO
+    // Copy the detail strings, which may belong to another lattice
+    EdgeDebugInfo& info = debug_info_.emplace_back(debug);
+    if (!debug.origin_detail.empty()) {
+      info.origin_detail = origin_detail_storage_.emplace_back(debug.origin_detail);
+    }
+    if (!debug.epos_source.empty()) {
+      info.epos_source = epos_source_storage_.emplace_back(debug.epos_source);
+    } else {
+      info.epos_source = auto_epos_source;
+    }
+#endif
     edge_indices_by_start_[edge.start].push_back(new_edge.id);
     ++edge_count_;
   }
@@ -83,6 +129,7 @@ size_t Lattice::addEdge(std::string_view surface, uint32_t start, uint32_t end,
   edge.end = end;
   edge.surface = stored_surface;
   edge.pos = pos;
+  edge.char_classes = spanCharClasses(start, end);
   // Set extended_pos: use provided value if not Unknown, otherwise auto-detect
   // Track source for debug builds
 #ifdef SUZUME_DEBUG_INFO
@@ -112,17 +159,18 @@ size_t Lattice::addEdge(std::string_view surface, uint32_t start, uint32_t end,
   edge.flags = static_cast<EdgeFlags>(flags);
   edge.lemma = stored_lemma;
   edge.conj_type = conj_type;
+
+  all_edges_.push_back(edge);
 #ifdef SUZUME_DEBUG_INFO
-  edge.origin = origin;
-  edge.origin_confidence = origin_confidence;
-  edge.origin_detail = stored_origin_detail;
+  EdgeDebugInfo& info = debug_info_.emplace_back();
+  info.origin = origin;
+  info.origin_confidence = origin_confidence;
+  info.origin_detail = stored_origin_detail;
   // Use provided epos_source if available, otherwise use auto-detected source
-  edge.epos_source = !stored_epos_source.empty()
+  info.epos_source = !stored_epos_source.empty()
                          ? stored_epos_source
                          : (auto_epos_source ? std::string_view(auto_epos_source) : std::string_view{});
 #endif
-
-  all_edges_.push_back(edge);
   edge_indices_by_start_[start].push_back(edge.id);
   ++edge_count_;
 
@@ -142,6 +190,11 @@ std::vector<LatticeEdge> Lattice::edgesAt(size_t pos) const {
   return result;
 }
 
+const std::vector<uint32_t>& Lattice::edgeIdsAt(size_t pos) const {
+  static const std::vector<uint32_t> empty_ids;
+  return pos < edge_indices_by_start_.size() ? edge_indices_by_start_[pos] : empty_ids;
+}
+
 const LatticeEdge& Lattice::getEdge(size_t edge_id) const {
   static const LatticeEdge empty_edge{};
   if (edge_id < all_edges_.size()) {
@@ -150,6 +203,16 @@ const LatticeEdge& Lattice::getEdge(size_t edge_id) const {
   return empty_edge;
 }
 
+const EdgeDebugInfo& Lattice::debugInfo([[maybe_unused]] size_t edge_id) const {
+  static const EdgeDebugInfo empty_info{};
+#ifdef SUZUME_DEBUG_INFO
+  if (edge_id < debug_info_.size()) {
+    return debug_info_[edge_id];
+  }
+#endif
+  return empty_info;
+}
+
 bool Lattice::isValid() const {
   if (text_length_ == 0) {
     return true;
@@ -177,6 +240,108 @@ bool Lattice::isValid() const {
   return reachable[text_length_];
 }
 
+void Lattice::addFlagsSince(size_t first_id, uint8_t flags) {
+  for (size_t idx = first_id; idx < all_edges_.size(); ++idx) {
+    all_edges_[idx].flags = static_cast<EdgeFlags>(static_cast<uint8_t>(all_edges_[idx].flags) | flags);
+  }
+}
+
+void Lattice::setWordCost(size_t edge_id, float word_cost) {
+  if (edge_id < all_edges_.size()) {
+    all_edges_[edge_id].cost = word_cost;
+    all_edges_[edge_id].final_cost = true;
+  }
+}
+
+size_t Lattice::pruneDominatedEdges(const std::function<float(const LatticeEdge&)>& word_cost) {
+  size_t removed = 0;
+  // key hash -> index into `best` (collisions resolved by sameEdgeKey)
+  std::unordered_multimap<size_t, size_t> best_by_key;
+  std::vector<std::pair<uint32_t, float>> best;  // (edge index, word cost)
+  std::vector<bool> dropped;
+
+  for (auto& indices : edge_indices_by_start_) {
+    if (indices.size() < 2) {
+      continue;
+    }
+    best_by_key.clear();
+    best.clear();
+    dropped.assign(indices.size(), false);
+    size_t dropped_here = 0;
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+      const LatticeEdge& edge = all_edges_[indices[i]];
+      float cost = word_cost(edge);
+      size_t hash = edgeKeyHash(edge);
+
+      bool duplicate = false;
+      auto range = best_by_key.equal_range(hash);
+      for (auto iter = range.first; iter != range.second; ++iter) {
+        auto& [best_slot, best_cost] = best[iter->second];
+        if (!sameEdgeKey(all_edges_[indices[best_slot]], edge)) {
+          continue;
+        }
+        // Strictly cheaper later edge replaces the earlier one; on ties the
+        // earlier edge is kept (Viterbi relaxation is first-wins)
+        if (cost < best_cost) {
+          dropped[best_slot] = true;
+          best_slot = static_cast<uint32_t>(i);
+          best_cost = cost;
+        } else {
+          dropped[i] = true;
+        }
+        duplicate = true;
+        break;
+      }
+
+      if (duplicate) {
+        ++dropped_here;
+        continue;
+      }
+      best_by_key.emplace(hash, best.size());
+      best.emplace_back(static_cast<uint32_t>(i), cost);
+    }
+
+    if (dropped_here > 0) {
+      // Compact in place, preserving the relative order of survivors
+      size_t out = 0;
+      for (size_t i = 0; i < indices.size(); ++i) {
+        if (!dropped[i]) {
+          indices[out++] = indices[i];
+        }
+      }
+      indices.resize(out);
+      removed += dropped_here;
+    }
+  }
+
+  edge_count_ -= removed;
+  pruned_count_ += removed;
+  return removed;
+}
+
+size_t Lattice::capEdgesAt(size_t pos, size_t max_edges) {
+  if (pos >= edge_indices_by_start_.size() || edge_indices_by_start_[pos].size() <= max_edges) {
+    return 0;
+  }
+  auto& indices = edge_indices_by_start_[pos];
+  size_t removed = indices.size() - max_edges;
+  indices.resize(max_edges);
+  edge_count_ -= removed;
+  return removed;
+}
+
+uint8_t Lattice::spanCharClasses(uint32_t start, uint32_t end) const {
+  if (end > char_classes_.size()) {
+    return 0;
+  }
+  uint8_t mask = 0;
+  for (uint32_t idx = start; idx < end; ++idx) {
+    mask |= char_classes_[idx];
+  }
+  return mask;
+}
+
 void Lattice::clear() {
   for (auto& indices : edge_indices_by_start_) {
     indices.clear();
@@ -185,10 +350,12 @@ void Lattice::clear() {
   surface_storage_.clear();
   lemma_storage_.clear();
 #ifdef SUZUME_DEBUG_INFO
+  debug_info_.clear();
   origin_detail_storage_.clear();
   epos_source_storage_.clear();
 #endif
   edge_count_ = 0;
+  pruned_count_ = 0;
 }
 
 }  // namespace suzume::core
@@ -4,7 +4,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "dictionary/dictionary.h"
@@ -22,7 +24,9 @@ enum class EdgeFlags : uint8_t {
   IsFormalNoun = 1 << 2,
   IsLowInfo = 1 << 3,
   // Note: bit 4 is reserved for kIsUnknown legacy constant
-  HasSuffix = 1 << 5  // Has suffix following (e.g., verb stem + aux)
+  HasSuffix = 1 << 5,   // Has suffix following (e.g., verb stem + aux)
+  CoarseOnly = 1 << 6,  // Multi-granular lattice: hidden from the fine (Split) decode
+  FineOnly = 1 << 7     // Multi-granular lattice: hidden from the coarse decode
 };
 
 inline EdgeFlags operator|(EdgeFlags lhs, EdgeFlags rhs) {
@@ -35,26 +39,25 @@ inline bool hasFlag(EdgeFlags flags, EdgeFlags flag) {
 
 /**
  * @brief Lattice edge (morpheme candidate)
+ *
+ * Laid out hot-first: the span, cost and tag fields read by every Viterbi
+ * relaxation share the first 24 bytes, followed by the string views. Debug
+ * provenance lives in Lattice's EdgeDebugInfo side table so it does not
+ * widen the edges the decoder walks.
  */
 struct LatticeEdge {
   uint32_t id{0};                                                            // Edge ID
   uint32_t start{0};                                                         // Start position (character index)
   uint32_t end{0};                                                           // End position (character index)
-  std::string_view surface;                                                  // Surface string (StringPool reference)
+  float cost{0.0F};                                                          // Cost
   PartOfSpeech pos{PartOfSpeech::Unknown};                                   // Part of speech
   ExtendedPOS extended_pos{ExtendedPOS::Unknown};                            // Extended POS for fine-grained bigram
-  float cost{0.0F};                                                          // Cost
   EdgeFlags flags{EdgeFlags::None};                                          // Flags
-  std::string_view lemma;                                                    // Lemma (optional)
   dictionary::ConjugationType conj_type{dictionary::ConjugationType::None};  // Conjugation type
-
-#ifdef SUZUME_DEBUG_INFO
-  // Debug: candidate origin tracking (excluded from release/WASM builds)
-  CandidateOrigin origin{CandidateOrigin::Unknown};
-  float origin_confidence{0.0F};   // Inflection confidence (for debug)
-  std::string_view origin_detail;  // Pattern detail (e.g., "ichidan_te_form")
-  std::string_view epos_source;    // Where ExtendedPOS was set (e.g., "binary_dict", "l1_dict")
-#endif
+  uint8_t char_classes{0};                                                   // CharType bits of the span (0 = unset)
+  bool final_cost{false};                                                    // cost is the word cost (setWordCost)
+  std::string_view surface;                                                  // Surface string (StringPool reference)
+  std::string_view lemma;                                                    // Lemma (optional)
 
   // Flag constants for compatibility
   static constexpr uint8_t kFromDictionary = static_cast<uint8_t>(EdgeFlags::FromDictionary);
@@ -62,6 +65,8 @@ struct LatticeEdge {
   static constexpr uint8_t kIsFormalNoun = static_cast<uint8_t>(EdgeFlags::IsFormalNoun);
   static constexpr uint8_t kIsLowInfo = static_cast<uint8_t>(EdgeFlags::IsLowInfo);
   static constexpr uint8_t kIsUnknown = 1 << 4;
+  static constexpr uint8_t kCoarseOnly = static_cast<uint8_t>(EdgeFlags::CoarseOnly);
+  static constexpr uint8_t kFineOnly = static_cast<uint8_t>(EdgeFlags::FineOnly);
 
   // Flag accessors
   bool fromDictionary() const { return hasFlag(flags, EdgeFlags::FromDictionary); }
@@ -70,6 +75,20 @@ struct LatticeEdge {
   bool isLowInfo() const { return hasFlag(flags, EdgeFlags::IsLowInfo); }
   bool hasSuffix() const { return hasFlag(flags, EdgeFlags::HasSuffix); }
   bool isUnknown() const { return (static_cast<uint8_t>(flags) & kIsUnknown) != 0; }
+  bool isCoarseOnly() const { return hasFlag(flags, EdgeFlags::CoarseOnly); }
+  bool isFineOnly() const { return hasFlag(flags, EdgeFlags::FineOnly); }
+};
+
+/**
+ * @brief Candidate provenance of an edge, for debug output
+ *
+ * Only recorded in SUZUME_DEBUG_INFO builds; see Lattice::debugInfo().
+ */
+struct EdgeDebugInfo {
+  CandidateOrigin origin{CandidateOrigin::Unknown};
+  float origin_confidence{0.0F};   // Inflection confidence
+  std::string_view origin_detail;  // Pattern detail (e.g., "ichidan_te_form")
+  std::string_view epos_source;    // Where ExtendedPOS was set (e.g., "binary_dict", "l1_dict")
 };
 
 /**
@@ -94,8 +113,10 @@ class Lattice {
 
   /**
    * @brief Add an edge to the lattice
+   * @param edge Edge to copy (its id is reassigned; surface and lemma must outlive the lattice)
+   * @param debug Provenance recorded in SUZUME_DEBUG_INFO builds, e.g. debugInfo() of the edge's source lattice
    */
-  void addEdge(const LatticeEdge& edge);
+  void addEdge(const LatticeEdge& edge, const EdgeDebugInfo& debug = {});
 
   /**
    * @brief Add an edge with parameters
@@ -128,6 +149,11 @@ class Lattice {
    */
   std::vector<LatticeEdge> edgesAt(size_t pos) const;
 
+  /**
+   * @brief IDs of the (unpruned) edges starting at a position, without copying
+   */
+  const std::vector<uint32_t>& edgeIdsAt(size_t pos) const;
+
   /**
    * @brief Get edge by ID
    * @param edge_id Edge ID
@@ -135,6 +161,46 @@ class Lattice {
    */
   const LatticeEdge& getEdge(size_t edge_id) const;
 
+  /**
+   * @brief Get the debug provenance of an edge
+   *
+   * Returns an empty record for unknown IDs and in builds without
+   * SUZUME_DEBUG_INFO.
+   */
+  const EdgeDebugInfo& debugInfo(size_t edge_id) const;
+
+  /**
+   * @brief ID the next added edge will get
+   */
+  size_t nextEdgeId() const { return all_edges_.size(); }
+
+  /**
+   * @brief OR flags into every edge added since first_id
+   *
+   * Used to tag the output of a whole candidate generator (e.g. as
+   * EdgeFlags::CoarseOnly) without threading the flag through it.
+   */
+  void addFlagsSince(size_t first_id, uint8_t flags);
+
+  /**
+   * @brief Replace an edge's cost with its precomputed word cost
+   *
+   * Scorer::wordCost returns the cost of such edges unchanged. Used for
+   * dictionary edges, whose word cost only depends on the entry.
+   */
+  void setWordCost(size_t edge_id, float word_cost);
+
+  /**
+   * @brief Set per-character script-class bits for the text
+   *
+   * masks[i] has the bit for the normalize::CharType of character i. Edges
+   * added afterwards get the OR of the bits over their span in
+   * LatticeEdge::char_classes, so script checks on edges become bit tests.
+   *
+   * @param masks One mask per character (text length entries)
+   */
+  void setCharClasses(std::vector<uint8_t> masks) { char_classes_ = std::move(masks); }
+
   /**
    * @brief Check if lattice is valid (path exists from start to end)
    */
@@ -150,19 +216,55 @@ class Lattice {
    */
   size_t edgeCount() const { return edge_count_; }
 
+  /**
+   * @brief Remove duplicate and dominated edges before Viterbi
+   *
+   * Edges that agree on everything the scorer reads except cost (span,
+   * surface, POS, extended POS, flags, lemma, conjugation type) are
+   * interchangeable as Viterbi predecessors and successors, so only the one
+   * with the lowest word cost can be on the best path. The others are
+   * unlinked from the per-position index. Edge IDs stay stable (getEdge()
+   * still resolves removed edges); ties keep the earliest edge, matching
+   * Viterbi's first-wins relaxation.
+   *
+   * @param word_cost Word cost function (normally Scorer::wordCost)
+   * @return Number of edges removed by this call
+   */
+  size_t pruneDominatedEdges(const std::function<float(const LatticeEdge&)>& word_cost);
+
+  /**
+   * @brief Keep only the first max_edges edges starting at a position
+   *
+   * Later edges are unlinked from the per-position index like pruned ones
+   * (their IDs stay valid). Used to enforce per-position work budgets.
+   *
+   * @return Number of edges removed
+   */
+  size_t capEdgesAt(size_t pos, size_t max_edges);
+
+  /**
+   * @brief Total number of edges removed by pruneDominatedEdges()
+   */
+  size_t prunedEdgeCount() const { return pruned_count_; }
+
   /**
    * @brief Clear the lattice
    */
   void clear();
 
  private:
+  uint8_t spanCharClasses(uint32_t start, uint32_t end) const;
+
   size_t text_length_{0};
   size_t edge_count_{0};
+  size_t pruned_count_{0};
   std::vector<std::vector<uint32_t>> edge_indices_by_start_;  // Edge indices per position
   std::vector<LatticeEdge> all_edges_;                        // All edges (primary storage)
+  std::vector<uint8_t> char_classes_;                         // Script-class bits per character
   std::deque<std::string> surface_storage_;                   // Storage for surface strings (deque for stable pointers)
   std::deque<std::string> lemma_storage_;                     // Storage for lemma strings (deque for stable pointers)
 #ifdef SUZUME_DEBUG_INFO
+  std::vector<EdgeDebugInfo> debug_info_;          // Provenance per edge ID (cold side table)
   std::deque<std::string> origin_detail_storage_;  // Storage for origin detail strings (deque for stable pointers)
   std::deque<std::string> epos_source_storage_;    // Storage for epos_source strings (deque for stable pointers)
 #endif
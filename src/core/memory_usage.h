@@ -0,0 +1,46 @@
+/**
+ * @file memory_usage.h
+ * @brief Per-component heap usage breakdown
+ *
+ * Figures are approximate: containers are counted by capacity and node
+ * overheads are estimated, but nothing that grows with input or dictionary
+ * size is left out. Dictionaries and caches shared between instances are
+ * counted in full by each instance that holds them.
+ */
+
+#ifndef SUZUME_CORE_MEMORY_USAGE_H_
+#define SUZUME_CORE_MEMORY_USAGE_H_
+
+#include <cstddef>
+
+namespace suzume::core {
+
+/**
+ * @brief Approximate heap bytes held, by component
+ */
+struct MemoryUsage {
+  size_t dictionary_entries{0};  // Parsed dictionary entries and their strings
+  size_t tries{0};               // Double-array and user dictionary tries
+  size_t string_pools{0};        // Dictionary images kept after loading
+  size_t inflection_cache{0};    // grammar::Inflection analysis cache
+  size_t sentence_cache{0};      // Sentence result cache
+  size_t scratch{0};             // Buffers kept between analyze calls
+
+  size_t total() const {
+    return dictionary_entries + tries + string_pools + inflection_cache + sentence_cache + scratch;
+  }
+
+  MemoryUsage& operator+=(const MemoryUsage& other) {
+    dictionary_entries += other.dictionary_entries;
+    tries += other.tries;
+    string_pools += other.string_pools;
+    inflection_cache += other.inflection_cache;
+    sentence_cache += other.sentence_cache;
+    scratch += other.scratch;
+    return *this;
+  }
+};
+
+}  // namespace suzume::core
+
+#endif  // SUZUME_CORE_MEMORY_USAGE_H_
@@ -11,6 +11,15 @@
 
 namespace suzume::core {
 
+/**
+ * @brief Where a morpheme's lemma came from
+ */
+enum class LemmaSource : uint8_t {
+  Unknown,     // Defaulted to the surface; the lemmatizer derives it
+  Dictionary,  // Taken from a dictionary entry
+  Candidate,   // Verified during candidate generation (inflection analysis)
+};
+
 /**
  * @brief Morpheme information
  *
@@ -25,6 +34,7 @@ struct Morpheme {
   std::string lemma;                                                         // Lemma (for verbs/adjectives)
   dictionary::ConjugationType conj_type{dictionary::ConjugationType::None};  // Conjugation type
   grammar::ConjForm conj_form{grammar::ConjForm::Base};                      // Conjugation form
+  LemmaSource lemma_source{LemmaSource::Unknown};                            // Lemma provenance
 
   // Aliases for compatibility
   size_t start_pos = 0;             // Alias for start
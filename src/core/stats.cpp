@@ -0,0 +1,79 @@
+#include "stats.h"
+
+namespace suzume::core {
+
+const char* analysisStageName(AnalysisStage stage) {
+  switch (stage) {
+    case AnalysisStage::Normalize:
+      return "normalize";
+    case AnalysisStage::Pretokenize:
+      return "pretokenize";
+    case AnalysisStage::LatticeBuild:
+      return "lattice_build";
+    case AnalysisStage::Viterbi:
+      return "viterbi";
+    case AnalysisStage::Postprocess:
+      return "postprocess";
+    case AnalysisStage::Count_:
+      break;
+  }
+  return "unknown";
+}
+
+const char* generatorKindName(GeneratorKind kind) {
+  switch (kind) {
+    case GeneratorKind::Dictionary:
+      return "dictionary";
+    case GeneratorKind::Unknown:
+      return "unknown";
+    case GeneratorKind::MixedScript:
+      return "mixed_script";
+    case GeneratorKind::CompoundSplit:
+      return "compound_split";
+    case GeneratorKind::NounVerbSplit:
+      return "noun_verb_split";
+    case GeneratorKind::CompoundVerbJoin:
+      return "compound_verb_join";
+    case GeneratorKind::PrefixNounJoin:
+      return "prefix_noun_join";
+    case GeneratorKind::TaruAdjectiveJoin:
+      return "taru_adjective_join";
+    case GeneratorKind::VerbSuffixNounJoin:
+      return "verb_suffix_noun_join";
+    case GeneratorKind::HiraganaCompoundVerbJoin:
+      return "hiragana_compound_verb_join";
+    case GeneratorKind::TeFormAuxiliary:
+      return "te_form_auxiliary";
+    case GeneratorKind::KatakanaSugiruJoin:
+      return "katakana_sugiru_join";
+    case GeneratorKind::Fallback:
+      return "fallback";
+    case GeneratorKind::Count_:
+      break;
+  }
+  return "unknown";
+}
+
+void AnalysisStats::merge(const AnalysisStats& other) {
+  analyze_calls += other.analyze_calls;
+  input_bytes += other.input_bytes;
+  chunks += other.chunks;
+  lattice_edges += other.lattice_edges;
+  pruned_edges += other.pruned_edges;
+  cache_lookups += other.cache_lookups;
+  cache_hits += other.cache_hits;
+  degraded_chunks += other.degraded_chunks;
+  for (size_t i = 0; i < kNumAnalysisStages; ++i) {
+    stages[i].calls += other.stages[i].calls;
+    stages[i].nanoseconds += other.stages[i].nanoseconds;
+  }
+  for (size_t i = 0; i < kNumGeneratorKinds; ++i) {
+    generators[i].calls += other.generators[i].calls;
+    generators[i].edges += other.generators[i].edges;
+    generators[i].nanoseconds += other.generators[i].nanoseconds;
+    generators[i].skipped += other.generators[i].skipped;
+    generators[i].productive += other.generators[i].productive;
+  }
+}
+
+}  // namespace suzume::core
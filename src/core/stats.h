@@ -0,0 +1,141 @@
+/**
+ * @file stats.h
+ * @brief Analysis stage timers and counters
+ *
+ * Always compiled in (unlike SUZUME_DEBUG logging). Stage timers take two
+ * steady_clock reads per chunk and stage; per-generator counters are plain
+ * integer adds. Per-generator timing runs once per position per generator,
+ * so it is opt-in (AnalyzerOptions::time_generators).
+ */
+
+#ifndef SUZUME_CORE_STATS_H_
+#define SUZUME_CORE_STATS_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace suzume::core {
+
+/**
+ * @brief Timed pipeline stages
+ */
+enum class AnalysisStage : uint8_t {
+  Normalize = 0,
+  Pretokenize,
+  LatticeBuild,  // Includes all candidate generators
+  Viterbi,       // Includes dominated-edge pruning
+  Postprocess,
+  Count_
+};
+
+/**
+ * @brief Lattice candidate generators (Tokenizer::buildLattice dispatch order)
+ */
+enum class GeneratorKind : uint8_t {
+  Dictionary = 0,
+  Unknown,
+  MixedScript,
+  CompoundSplit,
+  NounVerbSplit,
+  CompoundVerbJoin,
+  PrefixNounJoin,
+  TaruAdjectiveJoin,
+  VerbSuffixNounJoin,
+  HiraganaCompoundVerbJoin,
+  TeFormAuxiliary,
+  KatakanaSugiruJoin,
+  Fallback,  // Single-character fallback edges
+  Count_
+};
+
+inline constexpr size_t kNumAnalysisStages = static_cast<size_t>(AnalysisStage::Count_);
+inline constexpr size_t kNumGeneratorKinds = static_cast<size_t>(GeneratorKind::Count_);
+
+/**
+ * @brief Stage name for reports (e.g., "lattice_build")
+ */
+const char* analysisStageName(AnalysisStage stage);
+
+/**
+ * @brief Generator name for reports (e.g., "compound_verb_join")
+ */
+const char* generatorKindName(GeneratorKind kind);
+
+struct StageStats {
+  uint64_t calls{0};
+  uint64_t nanoseconds{0};
+};
+
+struct GeneratorStats {
+  uint64_t calls{0};        // Calls made (prefilter passed, if the generator has one)
+  uint64_t edges{0};        // Edges added to the lattice
+  uint64_t nanoseconds{0};  // Only collected with generator timing enabled
+  uint64_t skipped{0};      // Positions rejected by the generator's prefilter
+  uint64_t productive{0};   // Calls that added at least one edge
+};
+
+/**
+ * @brief Cumulative analysis counters (snapshot-able, resettable)
+ */
+struct AnalysisStats {
+  uint64_t analyze_calls{0};
+  uint64_t input_bytes{0};
+  uint64_t chunks{0};           // Chunks run through lattice + Viterbi
+  uint64_t lattice_edges{0};    // Edges generated (before pruning)
+  uint64_t pruned_edges{0};     // Edges removed by dominated-edge pruning
+  uint64_t cache_lookups{0};    // Sentence cache lookups
+  uint64_t cache_hits{0};       // Sentence cache hits
+  uint64_t degraded_chunks{0};  // Chunks whose lattice was cut short by a work budget
+
+  std::array<StageStats, kNumAnalysisStages> stages{};
+  std::array<GeneratorStats, kNumGeneratorKinds> generators{};
+
+  StageStats& stage(AnalysisStage id) { return stages[static_cast<size_t>(id)]; }
+  const StageStats& stage(AnalysisStage id) const { return stages[static_cast<size_t>(id)]; }
+  GeneratorStats& generator(GeneratorKind id) { return generators[static_cast<size_t>(id)]; }
+  const GeneratorStats& generator(GeneratorKind id) const { return generators[static_cast<size_t>(id)]; }
+
+  double cacheHitRate() const {
+    return cache_lookups == 0 ? 0.0 : static_cast<double>(cache_hits) / static_cast<double>(cache_lookups);
+  }
+
+  /**
+   * @brief Add another snapshot's counters into this one
+   */
+  void merge(const AnalysisStats& other);
+};
+
+/**
+ * @brief RAII timer adding elapsed time to a StageStats (no-op if null)
+ */
+class ScopedStageTimer {
+ public:
+  explicit ScopedStageTimer(StageStats* stage) : stage_(stage) {
+    if (stage_ != nullptr) {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~ScopedStageTimer() {
+    if (stage_ != nullptr) {
+      auto elapsed = std::chrono::steady_clock::now() - start_;
+      stage_->nanoseconds += static_cast<uint64_t>(std::chrono::nanoseconds(elapsed).count());
+      ++stage_->calls;
+    }
+  }
+
+  ScopedStageTimer(const ScopedStageTimer&) = delete;
+  ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+  ScopedStageTimer(ScopedStageTimer&&) = delete;
+  ScopedStageTimer& operator=(ScopedStageTimer&&) = delete;
+
+ private:
+  StageStats* stage_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace suzume::core
+
+#endif  // SUZUME_CORE_STATS_H_
@@ -1,11 +1,131 @@
 #include "viterbi.h"
 
-// Note: The template-based solve() method in viterbi.h is the primary implementation.
-// This file only contains the namespace definition.
+#include <algorithm>
+#include <array>
 
 namespace suzume::core {
 
-// All Viterbi algorithm implementation is in the header template.
-// This file exists to ensure the namespace is properly defined.
+void ViterbiBuffer::prepare(const Lattice& lattice, uint8_t skip_flags) {
+  const size_t text_len = lattice.textLength();
+
+  // Assign slots in processing order
+  edge_ids.clear();
+  pos_tags.clear();
+  start_offsets.assign(text_len + 2, 0);
+  end_offsets.assign(text_len + 2, 0);
+  for (size_t pos = 0; pos < text_len; ++pos) {
+    start_offsets[pos] = static_cast<uint32_t>(edge_ids.size());
+    for (uint32_t edge_id : lattice.edgeIdsAt(pos)) {
+      const LatticeEdge& edge = lattice.getEdge(edge_id);
+      if ((static_cast<uint8_t>(edge.flags) & skip_flags) != 0 || edge.end > text_len) {
+        continue;
+      }
+      edge_ids.push_back(edge_id);
+      pos_tags.push_back(static_cast<uint8_t>(edge.pos));
+      ++end_offsets[edge.end + 1];
+    }
+  }
+  start_offsets[text_len] = static_cast<uint32_t>(edge_ids.size());
+  start_offsets[text_len + 1] = start_offsets[text_len];
+
+  const size_t slot_count = edge_ids.size();
+  cost.assign(slot_count, std::numeric_limits<float>::max());
+  back.assign(slot_count, kUnreached);
+
+  // Counting sort by end position (stable, so each group stays in slot order)
+  for (size_t pos = 1; pos < end_offsets.size(); ++pos) {
+    end_offsets[pos] += end_offsets[pos - 1];
+  }
+  slots_by_end.resize(slot_count);
+  for (uint32_t slot = 0; slot < slot_count; ++slot) {
+    uint32_t end = lattice.getEdge(edge_ids[slot]).end;
+    slots_by_end[end_offsets[end]++] = slot;
+  }
+  // end_offsets[end] now points past its group; shift back by one position
+  for (size_t pos = end_offsets.size() - 1; pos > 0; --pos) {
+    end_offsets[pos] = end_offsets[pos - 1];
+  }
+  end_offsets[0] = 0;
+}
+
+void ViterbiBuffer::collectWinners(size_t pos) {
+  winners.clear();
+  if (pos == 0) {
+    winners.push_back(kBos);
+    return;
+  }
+
+  std::array<int32_t, kNumPosTypes> best_by_tag;
+  best_by_tag.fill(kUnreached);
+  bool any = false;
+  for (uint32_t idx = end_offsets[pos]; idx < end_offsets[pos + 1]; ++idx) {
+    uint32_t slot = slots_by_end[idx];
+    if (back[slot] == kUnreached) {
+      continue;
+    }
+    int32_t& best = best_by_tag[pos_tags[slot]];
+    if (best == kUnreached || cost[slot] < cost[static_cast<size_t>(best)]) {
+      best = static_cast<int32_t>(slot);
+    }
+    any = true;
+  }
+  if (!any) {
+    return;
+  }
+  for (int32_t slot : best_by_tag) {
+    if (slot != kUnreached) {
+      winners.push_back(slot);
+    }
+  }
+}
+
+size_t ViterbiBuffer::memoryBytes() const {
+  return edge_ids.capacity() * sizeof(uint32_t) + pos_tags.capacity() * sizeof(uint8_t) +
+         cost.capacity() * sizeof(float) + back.capacity() * sizeof(int32_t) +
+         start_offsets.capacity() * sizeof(uint32_t) + end_offsets.capacity() * sizeof(uint32_t) +
+         slots_by_end.capacity() * sizeof(uint32_t) + winners.capacity() * sizeof(int32_t);
+}
+
+float bosConnectionCost(const LatticeEdge& edge) {
+  float conn_cost = 0.0F;
+  // Suffix should not appear at sentence start
+  if (edge.pos == PartOfSpeech::Suffix) {
+    conn_cost = 3.0F;  // High penalty for suffix at BOS
+  }
+  // Conjunction at sentence start is natural (e.g., でも, しかし)
+  if (edge.pos == PartOfSpeech::Conjunction) {
+    conn_cost = -0.5F;  // Bonus for conjunction at BOS
+  }
+  // AuxAppearanceSou (様態そう) should not appear at sentence start
+  // At BOS, そう should be demonstrative na-adjective, not appearance aux
+  // E.g., "そうかもしれません" - そう is demonstrative
+  if (edge.extended_pos == ExtendedPOS::AuxAppearanceSou) {
+    conn_cost += 0.5F;  // Penalty for appearance aux at BOS
+  }
+  // AuxAspectIku (いく aspect) should not appear at sentence start
+  // At BOS, いく should be verb (行く) or part of pronoun (いくつ)
+  // AuxAspectIku is only valid after て-form (食べていく, 走っていく)
+  if (edge.extended_pos == ExtendedPOS::AuxAspectIku) {
+    conn_cost += 1.0F;  // Penalty for aspect aux at BOS
+  }
+  // AuxTenseTa (た/だ past) requires preceding verb/adj stem
+  if (edge.extended_pos == ExtendedPOS::AuxTenseTa) {
+    conn_cost += 2.0F;
+  }
+  // Sentence-ending particles cannot appear at sentence start
+  if (edge.extended_pos == ExtendedPOS::ParticleFinal) {
+    conn_cost += 2.0F;
+  }
+  return conn_cost;
+}
+
+void Viterbi::backtrack(int32_t slot, std::vector<size_t>& path) const {
+  size_t first = path.size();
+  while (slot >= 0) {
+    path.push_back(buffer_.edge_ids[static_cast<size_t>(slot)]);
+    slot = buffer_.back[static_cast<size_t>(slot)];
+  }
+  std::reverse(path.begin() + static_cast<std::ptrdiff_t>(first), path.end());
+}
 
 }  // namespace suzume::core
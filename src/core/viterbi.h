@@ -1,11 +1,12 @@
 #ifndef SUZUME_CORE_VITERBI_H_
 #define SUZUME_CORE_VITERBI_H_
 
-#include <algorithm>
-#include <array>
-#include <iostream>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <limits>
-#include <utility>
+#include <queue>
 #include <vector>
 
 #include "debug.h"
@@ -27,10 +28,66 @@ inline constexpr size_t kNumPosTypes = static_cast<size_t>(PartOfSpeech::Count_)
 struct ViterbiResult {
   std::vector<size_t> path;  // Edge IDs in order
   float total_cost{0.0F};    // Total path cost
+  bool degraded{false};      // Deadline passed mid-decode; the path may not be the cheapest
 };
 
+/**
+ * @brief Reusable edge-level DP state for Viterbi (structure of arrays)
+ *
+ * Every edge that takes part in decoding gets a slot. Slots are numbered in
+ * processing order (start position, then lattice order), so the edges
+ * starting at a position form the contiguous range
+ * [start_offsets[pos], start_offsets[pos + 1]).
+ */
+struct ViterbiBuffer {
+  static constexpr int32_t kBos = -1;        // Back-pointer to beginning of sentence
+  static constexpr int32_t kUnreached = -2;  // Edge whose start is unreachable
+
+  // Per slot
+  std::vector<uint32_t> edge_ids;  // Lattice edge ID
+  std::vector<uint8_t> pos_tags;   // PartOfSpeech of the edge
+  std::vector<float> cost;         // Best path cost up to the end of the edge
+  std::vector<int32_t> back;       // Previous slot, kBos or kUnreached
+
+  // Per position (text_len + 2 entries)
+  std::vector<uint32_t> start_offsets;  // First slot starting at a position
+  std::vector<uint32_t> end_offsets;    // Range in slots_by_end for a position
+
+  std::vector<uint32_t> slots_by_end;  // Slots grouped by end position, in slot order
+  std::vector<int32_t> winners;        // Scratch: surviving slots at the current position
+
+  /**
+   * @brief Assign slots for the lattice, skipping edges with any of skip_flags
+   */
+  void prepare(const Lattice& lattice, uint8_t skip_flags);
+
+  /**
+   * @brief Collect the cheapest reached slot per POS ending at pos into winners
+   *
+   * Winners are ordered by POS index; ties keep the lowest slot. This is the
+   * per-(position, POS) state merging the decoder has always used.
+   */
+  void collectWinners(size_t pos);
+
+  /**
+   * @brief Approximate bytes held by the buffers
+   */
+  size_t memoryBytes() const;
+};
+
+/**
+ * @brief Connection cost from the beginning of sentence to an edge
+ */
+float bosConnectionCost(const LatticeEdge& edge);
+
 /**
  * @brief Viterbi algorithm for finding optimal path
+ *
+ * DP state is kept per edge rather than per (character, POS) cell, so memory
+ * is proportional to the number of edges. At each position only the cheapest
+ * edge per POS ending there is extended (ties go to the edge reached first).
+ * Buffers are reused across calls, so one instance must not decode on
+ * several threads at once.
  */
 class Viterbi {
  public:
@@ -47,10 +104,16 @@ class Viterbi {
    * @brief Solve with custom scorer (returns edge IDs)
    * @param lattice Lattice graph
    * @param scorer Custom scorer
+   * @param skip_flags Ignore edges with any of these flags set (e.g.
+   *        LatticeEdge::kCoarseOnly to decode the fine view of a
+   *        multi-granular lattice)
+   * @param deadline Once passed, only the cheapest state at each remaining
+   *        position is extended (default-constructed = no deadline)
    * @return ViterbiResult with path and cost
    */
   template <typename Scorer>
-  ViterbiResult solve(const Lattice& lattice, const Scorer& scorer) const {
+  ViterbiResult solve(const Lattice& lattice, const Scorer& scorer, uint8_t skip_flags = 0,
+                      std::chrono::steady_clock::time_point deadline = {}) const {
     ViterbiResult result;
     result.total_cost = 0.0F;
 
@@ -59,168 +122,107 @@ class Viterbi {
       return result;
     }
 
-    // State info for (position, POS) pair tracking
-    // Using 2D array: states_by_pos[position][pos_tag_index]
-    // This eliminates hash overhead and O(n) position scanning
-    struct StateInfo {
-      float cost{std::numeric_limits<float>::max()};
-      int prev_edge{-1};
-      size_t prev_pos{0};
-      PartOfSpeech prev_pos_tag{PartOfSpeech::Unknown};
-      bool valid{false};  // Track if this state has been set
-    };
+    ViterbiBuffer& buf = buffer_;
+    buf.prepare(lattice, skip_flags);
 
-    // Pre-allocate for all positions + 1 (for final position)
-    std::vector<std::array<StateInfo, kNumPosTypes>> states_by_pos(text_len + 1);
+    // Small per-transition cost to prefer fewer morphemes (longer tokens)
+    // This breaks ties when paths have equal cost
+    constexpr float kTransitionCost = 0.001F;
 
-    // Initialize BOS state at position 0, POS=Unknown
-    auto& bos_state = states_by_pos[0][static_cast<size_t>(PartOfSpeech::Unknown)];
-    bos_state.cost = 0.0F;
-    bos_state.prev_edge = -1;
-    bos_state.valid = true;
-
-    // Forward pass - process positions in order
+    // Forward pass - extend the surviving edges ending at each position
+    const bool has_deadline = deadline != std::chrono::steady_clock::time_point{};
     for (size_t pos = 0; pos < text_len; ++pos) {
-      const auto& states_at_pos = states_by_pos[pos];
-
-      // Check if any valid state exists at this position
-      bool has_valid_state = false;
-      for (size_t i = 0; i < kNumPosTypes; ++i) {
-        if (states_at_pos[i].valid) {
-          has_valid_state = true;
-          break;
-        }
-      }
-      if (!has_valid_state) {
+      buf.collectWinners(pos);
+      if (buf.winners.empty()) {
         continue;
       }
+      if (has_deadline && !result.degraded && std::chrono::steady_clock::now() >= deadline) {
+        SUZUME_DEBUG_LOG("[VITERBI] deadline passed at pos=" << pos << ", extending the cheapest state only\n");
+        result.degraded = true;
+      }
+      if (result.degraded && buf.winners.size() > 1) {
+        int32_t cheapest = buf.winners[0];
+        for (int32_t slot : buf.winners) {
+          if (buf.cost[static_cast<size_t>(slot)] < buf.cost[static_cast<size_t>(cheapest)]) {
+            cheapest = slot;
+          }
+        }
+        buf.winners.assign(1, cheapest);
+      }
 
-      const auto& edges = lattice.edgesAt(pos);
-      for (size_t idx = 0; idx < edges.size(); ++idx) {
-        const auto& edge = edges[idx];
+      for (uint32_t slot = buf.start_offsets[pos]; slot < buf.start_offsets[pos + 1]; ++slot) {
+        const LatticeEdge& edge = lattice.getEdge(buf.edge_ids[slot]);
         float word_cost = scorer.wordCost(edge);
 
-        // Try all valid states at this position
-        for (size_t pos_idx = 0; pos_idx < kNumPosTypes; ++pos_idx) {
-          const auto& state_info = states_at_pos[pos_idx];
-          if (!state_info.valid) {
-            continue;
-          }
-
+        float best_cost = 0.0F;
+        int32_t best_back = ViterbiBuffer::kUnreached;
+        for (int32_t prev_slot : buf.winners) {
+          float prev_cost = 0.0F;
           float conn_cost = 0.0F;
-          if (state_info.prev_edge >= 0) {
-            const auto& prev_edges = lattice.edgesAt(state_info.prev_pos);
-            const auto& prev = prev_edges[static_cast<size_t>(state_info.prev_edge)];
-            conn_cost = scorer.connectionCost(prev, edge);
+          if (prev_slot == ViterbiBuffer::kBos) {
+            conn_cost = bosConnectionCost(edge);
           } else {
-            // BOS (beginning of sentence) connection cost
-            // Suffix should not appear at sentence start
-            if (edge.pos == PartOfSpeech::Suffix) {
-              conn_cost = 3.0F;  // High penalty for suffix at BOS
-            }
-            // Conjunction at sentence start is natural (e.g., でも, しかし)
-            if (edge.pos == PartOfSpeech::Conjunction) {
-              conn_cost = -0.5F;  // Bonus for conjunction at BOS
-            }
-            // AuxAppearanceSou (様態そう) should not appear at sentence start
-            // At BOS, そう should be demonstrative na-adjective, not appearance aux
-            // E.g., "そうかもしれません" - そう is demonstrative
-            if (edge.extended_pos == ExtendedPOS::AuxAppearanceSou) {
-              conn_cost += 0.5F;  // Penalty for appearance aux at BOS
-            }
-            // AuxAspectIku (いく aspect) should not appear at sentence start
-            // At BOS, いく should be verb (行く) or part of pronoun (いくつ)
-            // AuxAspectIku is only valid after て-form (食べていく, 走っていく)
-            if (edge.extended_pos == ExtendedPOS::AuxAspectIku) {
-              conn_cost += 1.0F;  // Penalty for aspect aux at BOS
-            }
-            // AuxTenseTa (た/だ past) requires preceding verb/adj stem
-            if (edge.extended_pos == ExtendedPOS::AuxTenseTa) {
-              conn_cost += 2.0F;
-            }
-            // Sentence-ending particles cannot appear at sentence start
-            if (edge.extended_pos == ExtendedPOS::ParticleFinal) {
-              conn_cost += 2.0F;
-            }
+            prev_cost = buf.cost[static_cast<size_t>(prev_slot)];
+            conn_cost = scorer.connectionCost(lattice.getEdge(buf.edge_ids[static_cast<size_t>(prev_slot)]), edge);
           }
-
-          // Small per-transition cost to prefer fewer morphemes (longer tokens)
-          // This breaks ties when paths have equal cost
-          constexpr float kTransitionCost = 0.001F;
-          float total = state_info.cost + word_cost + conn_cost + kTransitionCost;
-          size_t next_pos_idx = static_cast<size_t>(edge.pos);
+          float total = prev_cost + word_cost + conn_cost + kTransitionCost;
 
           SUZUME_DEBUG_VERBOSE_BLOCK {
+            PartOfSpeech prev_tag = prev_slot == ViterbiBuffer::kBos
+                                        ? PartOfSpeech::Unknown
+                                        : static_cast<PartOfSpeech>(buf.pos_tags[static_cast<size_t>(prev_slot)]);
             SUZUME_DEBUG_STREAM << "[VITERBI] pos=" << pos << " \"" << edge.surface << "\" (" << posToString(edge.pos)
                                 << "/" << extendedPosToString(edge.extended_pos) << ")";
 #ifdef SUZUME_DEBUG_INFO
-            if (edge.origin != CandidateOrigin::Unknown) {
-              SUZUME_DEBUG_STREAM << " [src:" << originToString(edge.origin);
-              if (!edge.origin_detail.empty()) {
-                SUZUME_DEBUG_STREAM << "/" << edge.origin_detail;
+            const EdgeDebugInfo& info = lattice.debugInfo(edge.id);
+            if (info.origin != CandidateOrigin::Unknown) {
+              SUZUME_DEBUG_STREAM << " [src:" << originToString(info.origin);
+              if (!info.origin_detail.empty()) {
+                SUZUME_DEBUG_STREAM << "/" << info.origin_detail;
               }
               SUZUME_DEBUG_STREAM << "]";
             }
+            if (!info.epos_source.empty()) {
+              SUZUME_DEBUG_STREAM << " [epos:" << info.epos_source << "]";
+            }
 #endif
-            SUZUME_DEBUG_STREAM << " from " << posToString(static_cast<PartOfSpeech>(pos_idx)) << " word=" << word_cost
-                                << " conn=" << conn_cost << " total=" << total << "\n";
+            SUZUME_DEBUG_STREAM << " from " << posToString(prev_tag) << " word=" << word_cost << " conn=" << conn_cost
+                                << " total=" << total << "\n";
           }
 
-          // Bounds check - skip edges that go beyond text length
-          if (edge.end > text_len) {
-            continue;
-          }
-          auto& next_state = states_by_pos[edge.end][next_pos_idx];
-          if (!next_state.valid || total < next_state.cost) {
-            next_state.cost = total;
-            next_state.prev_edge = static_cast<int>(idx);
-            next_state.prev_pos = pos;
-            next_state.prev_pos_tag = static_cast<PartOfSpeech>(pos_idx);
-            next_state.valid = true;
+          if (best_back == ViterbiBuffer::kUnreached || total < best_cost) {
+            best_cost = total;
+            best_back = prev_slot;
           }
         }
+        buf.cost[slot] = best_cost;
+        buf.back[slot] = best_back;
       }
     }
 
     // Find best and second-best states at final position
-    size_t best_final_pos_idx = 0;
-    size_t second_final_pos_idx = 0;
+    buf.collectWinners(text_len);
+    int32_t best_slot = ViterbiBuffer::kUnreached;
+    int32_t second_slot = ViterbiBuffer::kUnreached;
     float best_cost = std::numeric_limits<float>::max();
     float second_cost = std::numeric_limits<float>::max();
-
-    const auto& final_states = states_by_pos[text_len];
-    for (size_t i = 0; i < kNumPosTypes; ++i) {
-      if (final_states[i].valid) {
-        if (final_states[i].cost < best_cost) {
-          second_cost = best_cost;
-          second_final_pos_idx = best_final_pos_idx;
-          best_cost = final_states[i].cost;
-          best_final_pos_idx = i;
-        } else if (final_states[i].cost < second_cost) {
-          second_cost = final_states[i].cost;
-          second_final_pos_idx = i;
-        }
+    for (int32_t slot : buf.winners) {
+      float cost = buf.cost[static_cast<size_t>(slot)];
+      if (cost < best_cost) {
+        second_cost = best_cost;
+        second_slot = best_slot;
+        best_cost = cost;
+        best_slot = slot;
+      } else if (cost < second_cost) {
+        second_cost = cost;
+        second_slot = slot;
       }
     }
 
     // Backtrack
-    if (best_cost < std::numeric_limits<float>::max()) {
+    if (best_slot >= 0) {
       result.total_cost = best_cost;
-      size_t current_pos = text_len;
-      size_t current_pos_idx = best_final_pos_idx;
-
-      while (current_pos > 0) {
-        const auto& state = states_by_pos[current_pos][current_pos_idx];
-        if (!state.valid || state.prev_edge < 0) {
-          break;
-        }
-
-        const auto& prev_edges = lattice.edgesAt(state.prev_pos);
-        result.path.push_back(prev_edges[static_cast<size_t>(state.prev_edge)].id);
-        current_pos = state.prev_pos;
-        current_pos_idx = static_cast<size_t>(state.prev_pos_tag);
-      }
-      std::reverse(result.path.begin(), result.path.end());
+      backtrack(best_slot, result.path);
     }
 
     // Debug: print final path and runner-up comparison
@@ -234,45 +236,172 @@ class Viterbi {
                             << extendedPosToString(edge.extended_pos) << ")";
       }
       // Show margin over second-best if available
-      if (second_cost < std::numeric_limits<float>::max() && second_cost != best_cost) {
+      if (second_slot >= 0 && second_cost != best_cost) {
         SUZUME_DEBUG_STREAM << " [margin=" << (second_cost - best_cost) << "]";
       }
       SUZUME_DEBUG_STREAM << "\n";
 
       // Show runner-up path at verbose level
       SUZUME_DEBUG_VERBOSE_BLOCK {
-        if (second_cost < std::numeric_limits<float>::max() && second_cost != best_cost) {
-          // Backtrack runner-up path
+        if (second_slot >= 0 && second_cost != best_cost) {
           std::vector<size_t> runner_up_path;
-          size_t ru_pos = text_len;
-          size_t ru_pos_idx = second_final_pos_idx;
-          while (ru_pos > 0) {
-            const auto& state = states_by_pos[ru_pos][ru_pos_idx];
-            if (!state.valid || state.prev_edge < 0)
-              break;
-            const auto& prev_edges = lattice.edgesAt(state.prev_pos);
-            runner_up_path.push_back(prev_edges[static_cast<size_t>(state.prev_edge)].id);
-            ru_pos = state.prev_pos;
-            ru_pos_idx = static_cast<size_t>(state.prev_pos_tag);
+          backtrack(second_slot, runner_up_path);
+          SUZUME_DEBUG_STREAM << "[VITERBI] Runner-up (cost=" << second_cost << "): ";
+          for (size_t i = 0; i < runner_up_path.size(); ++i) {
+            const auto& edge = lattice.getEdge(runner_up_path[i]);
+            if (i > 0)
+              SUZUME_DEBUG_STREAM << " → ";
+            SUZUME_DEBUG_STREAM << "\"" << edge.surface << "\"(" << posToString(edge.pos) << ")";
           }
-          std::reverse(runner_up_path.begin(), runner_up_path.end());
-
-          if (!runner_up_path.empty()) {
-            SUZUME_DEBUG_STREAM << "[VITERBI] Runner-up (cost=" << second_cost << "): ";
-            for (size_t i = 0; i < runner_up_path.size(); ++i) {
-              const auto& edge = lattice.getEdge(runner_up_path[i]);
-              if (i > 0)
-                SUZUME_DEBUG_STREAM << " → ";
-              SUZUME_DEBUG_STREAM << "\"" << edge.surface << "\"(" << posToString(edge.pos) << ")";
+          SUZUME_DEBUG_STREAM << "\n";
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Enumerate the best path and the k-1 cheapest alternatives
+   *
+   * The first result is always solve()'s path. Alternatives come from an
+   * exact edge-level forward pass (every predecessor is considered, without
+   * solve()'s per-POS state merging) followed by a backward A* search whose
+   * heuristic is the exact forward cost, so complete paths come off the
+   * queue in cost order. Path costs use the same terms as solve(); since
+   * solve() merges states, an alternative can occasionally cost less than
+   * the first result.
+   *
+   * The search stops after about k x (edge count) expansions, so
+   * pathological lattices return fewer than k paths rather than running
+   * unbounded.
+   *
+   * @param lattice Lattice graph
+   * @param scorer Custom scorer
+   * @param k Maximum number of paths
+   * @param skip_flags Ignore edges with any of these flags set
+   * @return solve()'s path followed by up to k-1 alternatives in ascending cost order
+   */
+  template <typename Scorer>
+  std::vector<ViterbiResult> solveNBest(const Lattice& lattice, const Scorer& scorer, size_t k,
+                                        uint8_t skip_flags = 0) const {
+    std::vector<ViterbiResult> results;
+    const size_t text_len = lattice.textLength();
+    if (text_len == 0 || k == 0) {
+      return results;
+    }
+    results.push_back(solve(lattice, scorer, skip_flags));
+    if (results[0].path.empty() || k == 1) {
+      return results;
+    }
+
+    ViterbiBuffer& buf = buffer_;
+    buf.prepare(lattice, skip_flags);
+    constexpr float kTransitionCost = 0.001F;
+
+    // Forward: exact best prefix cost per edge (back is only used as a
+    // reached marker here)
+    for (size_t pos = 0; pos < text_len; ++pos) {
+      for (uint32_t slot = buf.start_offsets[pos]; slot < buf.start_offsets[pos + 1]; ++slot) {
+        const LatticeEdge& edge = lattice.getEdge(buf.edge_ids[slot]);
+        float best_prefix = 0.0F;
+        bool reached = false;
+        if (pos == 0) {
+          best_prefix = bosConnectionCost(edge);
+          reached = true;
+        } else {
+          for (uint32_t idx = buf.end_offsets[pos]; idx < buf.end_offsets[pos + 1]; ++idx) {
+            uint32_t prev_slot = buf.slots_by_end[idx];
+            if (buf.back[prev_slot] == ViterbiBuffer::kUnreached) {
+              continue;
+            }
+            float prefix = buf.cost[prev_slot] + scorer.connectionCost(lattice.getEdge(buf.edge_ids[prev_slot]), edge);
+            if (!reached || prefix < best_prefix) {
+              best_prefix = prefix;
+              reached = true;
             }
-            SUZUME_DEBUG_STREAM << "\n";
           }
         }
+        if (reached) {
+          buf.cost[slot] = best_prefix + scorer.wordCost(edge) + kTransitionCost;
+          buf.back[slot] = ViterbiBuffer::kBos;
+        }
       }
     }
 
-    return result;
+    // Backward A*: a node is a path suffix starting with `slot`; g is the
+    // cost of everything after that edge
+    struct Node {
+      uint32_t slot;
+      int32_t next;  // Following node, -1 at end of text
+      float g;
+    };
+    struct QueueEntry {
+      float priority;
+      uint32_t node;
+      bool operator>(const QueueEntry& other) const {
+        return priority > other.priority || (priority == other.priority && node > other.node);
+      }
+    };
+    std::vector<Node> nodes;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+    auto push = [&](uint32_t slot, int32_t next, float g) {
+      nodes.push_back(Node{slot, next, g});
+      queue.push(QueueEntry{buf.cost[slot] + g, static_cast<uint32_t>(nodes.size() - 1)});
+    };
+
+    for (uint32_t idx = buf.end_offsets[text_len]; idx < buf.end_offsets[text_len + 1]; ++idx) {
+      uint32_t slot = buf.slots_by_end[idx];
+      if (buf.back[slot] != ViterbiBuffer::kUnreached) {
+        push(slot, -1, 0.0F);
+      }
+    }
+
+    const size_t max_expansions = k * (buf.edge_ids.size() + 1);
+    size_t expansions = 0;
+    while (!queue.empty() && results.size() < k && expansions++ < max_expansions) {
+      QueueEntry top = queue.top();
+      queue.pop();
+      const Node node = nodes[top.node];
+      const LatticeEdge& edge = lattice.getEdge(buf.edge_ids[node.slot]);
+
+      if (edge.start == 0) {
+        ViterbiResult path;
+        path.total_cost = top.priority;
+        for (int32_t cur = static_cast<int32_t>(top.node); cur >= 0; cur = nodes[static_cast<size_t>(cur)].next) {
+          path.path.push_back(buf.edge_ids[nodes[static_cast<size_t>(cur)].slot]);
+        }
+        if (path.path != results[0].path) {
+          results.push_back(std::move(path));
+        }
+        continue;
+      }
+
+      float suffix = node.g + scorer.wordCost(edge) + kTransitionCost;
+      for (uint32_t idx = buf.end_offsets[edge.start]; idx < buf.end_offsets[edge.start + 1]; ++idx) {
+        uint32_t prev_slot = buf.slots_by_end[idx];
+        if (buf.back[prev_slot] == ViterbiBuffer::kUnreached) {
+          continue;
+        }
+        float conn_cost = scorer.connectionCost(lattice.getEdge(buf.edge_ids[prev_slot]), edge);
+        push(prev_slot, static_cast<int32_t>(top.node), suffix + conn_cost);
+      }
+    }
+    return results;
   }
+
+  /**
+   * @brief Bytes currently held by the reusable decode buffers
+   */
+  size_t bufferBytes() const { return buffer_.memoryBytes(); }
+
+ private:
+  mutable ViterbiBuffer buffer_;
+
+  /**
+   * @brief Follow back-pointers from a slot to BOS, appending edge IDs in order
+   */
+  void backtrack(int32_t slot, std::vector<size_t>& path) const;
 };
 
 }  // namespace suzume::core
@@ -1,6 +1,7 @@
 #include "dictionary/binary_dict.h"
 
 #include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <limits>
@@ -71,6 +72,14 @@ bool isValidExtendedPos(uint8_t val) {
   return val < static_cast<uint8_t>(core::ExtendedPOS::Count_);
 }
 
+bool isValidConjugationType(uint8_t val) {
+  return val <= static_cast<uint8_t>(ConjugationType::ProperGiven);
+}
+
+size_t alignTo4(size_t size) {
+  return (size + 3) & ~static_cast<size_t>(3);
+}
+
 struct BinaryDictEntryV0 {
   uint32_t surface_offset;
   uint32_t lemma_offset;
@@ -81,7 +90,7 @@ struct BinaryDictEntryV0 {
 };
 
 template <typename T>
-T readPod(const std::vector<uint8_t>& data, size_t offset) {
+T readPod(const DictionaryImage& data, size_t offset) {
   T value{};
   std::memcpy(&value, data.data() + offset, sizeof(T));
   return value;
@@ -94,54 +103,58 @@ T readPod(const std::vector<uint8_t>& data, size_t offset) {
 BinaryDictionary::BinaryDictionary() = default;
 BinaryDictionary::~BinaryDictionary() = default;
 
-core::Expected<size_t, core::Error> BinaryDictionary::loadFromFile(const std::string& path) {
-  std::ifstream file(path, std::ios::binary | std::ios::ate);
-  if (!file) {
-    return core::makeUnexpected(core::Error(core::ErrorCode::FileNotFound, "Failed to open dictionary file: " + path));
-  }
-
-  size_t file_size = static_cast<size_t>(file.tellg());
-  file.seekg(0);
-
-  std::vector<uint8_t> loaded_data(file_size);
-  if (!file.read(reinterpret_cast<char*>(loaded_data.data()), file_size)) {
-    return core::makeUnexpected(core::Error(core::ErrorCode::InternalError, "Failed to read dictionary file: " + path));
+BinaryDictEntry BinaryDictionary::readEntryRecord(const DictionaryImage& data, const EntryLayout& layout,
+                                                  size_t idx) {
+  if (!layout.legacy) {
+    return readPod<BinaryDictEntry>(data, layout.offset + idx * sizeof(BinaryDictEntry));
   }
+  const auto legacy = readPod<BinaryDictEntryV0>(data, layout.offset + idx * sizeof(BinaryDictEntryV0));
+  BinaryDictEntry rec{};
+  rec.surface_offset = legacy.surface_offset;
+  rec.lemma_offset = legacy.lemma_offset;
+  rec.surface_length = legacy.surface_length;
+  rec.lemma_length = legacy.lemma_length;
+  rec.pos = legacy.pos;
+  rec.flags = legacy.flags;
+  rec.extended_pos = static_cast<uint8_t>(core::ExtendedPOS::Unknown);
+  return rec;
+}
 
-  DoubleArray loaded_trie;
-  std::vector<DictionaryEntry> loaded_entries;
-  auto result = parseData(loaded_data, loaded_trie, loaded_entries);
-  if (!result.hasValue()) {
-    return result;
+core::Expected<size_t, core::Error> BinaryDictionary::loadFromFile(const std::string& path) {
+  auto image = DictionaryImage::fromFile(path);
+  if (!image.hasValue()) {
+    return core::makeUnexpected(image.error());
   }
-
-  data_ = std::move(loaded_data);
-  trie_ = std::move(loaded_trie);
-  entries_ = std::move(loaded_entries);
-  return result;
+  return loadImage(std::move(image).value());
 }
 
 core::Expected<size_t, core::Error> BinaryDictionary::loadFromMemory(const uint8_t* data, size_t size) {
   if (data == nullptr || size == 0) {
     return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Empty dictionary data"));
   }
+  return loadImage(DictionaryImage::fromMemory(data, size));
+}
 
-  std::vector<uint8_t> loaded_data(data, data + size);
+core::Expected<size_t, core::Error> BinaryDictionary::loadImage(DictionaryImage image) {
+  // The tries read their units in place from the image, which keeps its address when moved into image_
   DoubleArray loaded_trie;
-  std::vector<DictionaryEntry> loaded_entries;
-  auto result = parseData(loaded_data, loaded_trie, loaded_entries);
+  EntryLayout loaded_layout;
+  ConjugationIndex loaded_conjugations;
+  auto result = parseData(image, loaded_trie, loaded_layout, loaded_conjugations);
   if (!result.hasValue()) {
     return result;
   }
 
-  data_ = std::move(loaded_data);
+  image_ = std::move(image);
   trie_ = std::move(loaded_trie);
-  entries_ = std::move(loaded_entries);
+  layout_ = loaded_layout;
+  entries_.reset(loaded_layout.count);
+  conjugations_ = std::move(loaded_conjugations);
   return result;
 }
 
-core::Expected<size_t, core::Error> BinaryDictionary::parseData(const std::vector<uint8_t>& data, DoubleArray& trie,
-                                                                std::vector<DictionaryEntry>& entries) {
+core::Expected<size_t, core::Error> BinaryDictionary::parseData(const DictionaryImage& data, DoubleArray& trie,
+                                                                EntryLayout& layout, ConjugationIndex& conjugations) {
   if (data.size() < sizeof(BinaryDictHeader)) {
     return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Dictionary file too small"));
   }
@@ -189,31 +202,19 @@ core::Expected<size_t, core::Error> BinaryDictionary::parseData(const std::vecto
   size_t string_pool_size = data.size() - header.string_offset;
 
   // Load trie
-  if (!trie.deserialize(data.data() + header.trie_offset, header.trie_size)) {
+  if (!trie.deserializeView(data.data() + header.trie_offset, header.trie_size)) {
     return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Failed to load dictionary trie"));
   }
 
-  // Load entries
-  const char* string_pool = reinterpret_cast<const char*>(data.data() + header.string_offset);
-
-  entries.clear();
-  entries.reserve(entry_count);
+  // Validate entry records; they are decoded into DictionaryEntry on first access
+  layout.count = entry_count;
+  layout.offset = header.entry_offset;
+  layout.string_offset = header.string_offset;
+  layout.legacy = header.version_minor < 1;
+  layout.version_minor = header.version_minor;
 
   for (uint32_t idx = 0; idx < header.entry_count; ++idx) {
-    BinaryDictEntry rec{};
-    size_t entry_pos = header.entry_offset + idx * entry_record_size;
-    if (header.version_minor >= 1) {
-      rec = readPod<BinaryDictEntry>(data, entry_pos);
-    } else {
-      const auto legacy = readPod<BinaryDictEntryV0>(data, entry_pos);
-      rec.surface_offset = legacy.surface_offset;
-      rec.lemma_offset = legacy.lemma_offset;
-      rec.surface_length = legacy.surface_length;
-      rec.lemma_length = legacy.lemma_length;
-      rec.pos = legacy.pos;
-      rec.flags = legacy.flags;
-      rec.extended_pos = static_cast<uint8_t>(core::ExtendedPOS::Unknown);
-    }
+    const BinaryDictEntry rec = readEntryRecord(data, layout, idx);
 
     if (rec.surface_offset > string_pool_size || rec.surface_length > string_pool_size - rec.surface_offset) {
       return core::makeUnexpected(
@@ -236,169 +237,225 @@ core::Expected<size_t, core::Error> BinaryDictionary::parseData(const std::vecto
         (rec.lemma_offset > string_pool_size || rec.lemma_length > string_pool_size - rec.lemma_offset)) {
       return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Invalid dictionary lemma string range"));
     }
+  }
 
-    DictionaryEntry entry;
-    entry.surface = std::string(string_pool + rec.surface_offset, rec.surface_length);
-    entry.pos = uint8ToPos(rec.pos);
+  // Load conjugation index (between the entry table and the string pool)
+  conjugations.trie.clear();
+  conjugations.surfaces.reset(0);
+  if ((header.flags & BinaryDictHeader::kFlagConjugationIndex) != 0) {
+    if (header.version_minor < BinaryDictHeader::kVersionMinorConjugationIndex) {
+      return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Invalid conjugation index"));
+    }
+    size_t section_offset = header.entry_offset + entry_table_size;
+    size_t section_size = header.string_offset - section_offset;
+    if (section_size < 2 * sizeof(uint32_t)) {
+      return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Invalid conjugation index"));
+    }
+    auto record_count = readPod<uint32_t>(data, section_offset);
+    auto index_trie_size = readPod<uint32_t>(data, section_offset + sizeof(uint32_t));
+    size_t trie_start = section_offset + 2 * sizeof(uint32_t);
+    size_t available = section_size - 2 * sizeof(uint32_t);
+    if (index_trie_size > available ||
+        record_count > (available - alignTo4(index_trie_size)) / sizeof(BinaryConjugationRecord)) {
+      return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Invalid conjugation index"));
+    }
+    if (!conjugations.trie.deserializeView(data.data() + trie_start, index_trie_size)) {
+      return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Failed to load conjugation index trie"));
+    }
 
-    if (rec.lemma_length > 0) {
-      entry.lemma = std::string(string_pool + rec.lemma_offset, rec.lemma_length);
-    } else {
-      entry.lemma = entry.surface;
+    size_t record_start = trie_start + alignTo4(index_trie_size);
+    for (size_t idx = 0; idx < record_count; ++idx) {
+      const auto rec = readPod<BinaryConjugationRecord>(data, record_start + idx * sizeof(BinaryConjugationRecord));
+      if (rec.lemma_length == 0 || rec.lemma_offset > string_pool_size ||
+          rec.lemma_length > string_pool_size - rec.lemma_offset || !isValidPos(rec.pos) ||
+          !isValidExtendedPos(rec.extended_pos) || !isValidConjugationType(rec.conj_type) ||
+          (rec.flags & ~BinaryConjugationRecord::kFlagAuxiliaryChain) != 0) {
+        return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Invalid conjugation index record"));
+      }
     }
+    conjugations.record_offset = record_start;
+    conjugations.surfaces.reset(record_count);
+  }
 
-    entry.extended_pos = uint8ToExtendedPos(rec.extended_pos);
-
-    if (entry.extended_pos != core::ExtendedPOS::Unknown) {
-      // Use the serialized fine-grained category when present.
-    } else if ((rec.flags & kFlagFormalNoun) != 0) {
-      entry.extended_pos = core::ExtendedPOS::NounFormal;
-    } else if ((rec.flags & kFlagInterjection) != 0) {
-      entry.extended_pos = core::ExtendedPOS::Interjection;
-    } else if ((rec.flags & kFlagProperFamily) != 0) {
-      entry.extended_pos = core::ExtendedPOS::NounProperFamily;
-    } else if ((rec.flags & kFlagProperGiven) != 0) {
-      entry.extended_pos = core::ExtendedPOS::NounProperGiven;
-    } else {
-      // Derive default extended_pos from POS for proper cost calculation
-      switch (entry.pos) {
-        case core::PartOfSpeech::Adjective: {
-          // Distinguish I-adjective forms from NA-adjective based on ending
-          // I-adjective forms: い, く, くて, かった, かっ, ければ, そう, etc.
-          // NA-adjectives: don't end in these patterns
-          // Exceptions: きれい, きらい are na-adjectives ending in い
-          using namespace std::string_view_literals;
-          if (utf8::endsWithAny(entry.surface, {"きれい"sv, "きらい"sv, "嫌い"sv, "綺麗"sv})) {
-            entry.extended_pos = core::ExtendedPOS::AdjNaAdj;
-          } else if (utf8::endsWith(entry.surface, "い")) {
-            entry.extended_pos = core::ExtendedPOS::AdjBasic;
-          } else if (utf8::endsWithAny(entry.surface, {"く"sv, "くて"sv})) {
-            // く-form (adverbial/te-form): 美しく, 美しくて
-            entry.extended_pos = core::ExtendedPOS::AdjRenyokei;
-          } else if (utf8::endsWithAny(entry.surface, {"かっ"sv})) {
-            // かっ-form (past stem): 美しかっ
-            entry.extended_pos = core::ExtendedPOS::AdjKatt;
-          } else if (utf8::endsWithAny(entry.surface, {"ければ"sv, "かったら"sv})) {
-            // Conditional forms: 美しければ, 美しかったら
-            entry.extended_pos = core::ExtendedPOS::AdjKeForm;
-          } else if (utf8::endsWithAny(entry.surface, {"そう"sv})) {
-            // Stem+そう: 美しそう
-            entry.extended_pos = core::ExtendedPOS::AdjStem;
-          } else {
-            // Doesn't match I-adjective patterns → NA-adjective
-            entry.extended_pos = core::ExtendedPOS::AdjNaAdj;
-          }
-          break;
+  return entry_count;
+}
+
+DictionaryEntry BinaryDictionary::decodeEntry(size_t idx) const {
+  const BinaryDictEntry rec = readEntryRecord(image_, layout_, idx);
+  const char* string_pool = reinterpret_cast<const char*>(image_.data() + layout_.string_offset);
+
+  DictionaryEntry entry;
+  entry.surface = std::string(string_pool + rec.surface_offset, rec.surface_length);
+  entry.pos = uint8ToPos(rec.pos);
+
+  if (rec.lemma_length > 0) {
+    entry.lemma = std::string(string_pool + rec.lemma_offset, rec.lemma_length);
+  } else {
+    entry.lemma = entry.surface;
+  }
+
+  entry.extended_pos = uint8ToExtendedPos(rec.extended_pos);
+
+  if (entry.extended_pos != core::ExtendedPOS::Unknown) {
+    // Use the serialized fine-grained category when present.
+  } else if ((rec.flags & kFlagFormalNoun) != 0) {
+    entry.extended_pos = core::ExtendedPOS::NounFormal;
+  } else if ((rec.flags & kFlagInterjection) != 0) {
+    entry.extended_pos = core::ExtendedPOS::Interjection;
+  } else if ((rec.flags & kFlagProperFamily) != 0) {
+    entry.extended_pos = core::ExtendedPOS::NounProperFamily;
+  } else if ((rec.flags & kFlagProperGiven) != 0) {
+    entry.extended_pos = core::ExtendedPOS::NounProperGiven;
+  } else {
+    // Derive default extended_pos from POS for proper cost calculation
+    switch (entry.pos) {
+      case core::PartOfSpeech::Adjective: {
+        // Distinguish I-adjective forms from NA-adjective based on ending
+        // I-adjective forms: い, く, くて, かった, かっ, ければ, そう, etc.
+        // NA-adjectives: don't end in these patterns
+        // Exceptions: きれい, きらい are na-adjectives ending in い
+        using namespace std::string_view_literals;
+        if (utf8::endsWithAny(entry.surface, {"きれい"sv, "きらい"sv, "嫌い"sv, "綺麗"sv})) {
+          entry.extended_pos = core::ExtendedPOS::AdjNaAdj;
+        } else if (utf8::endsWith(entry.surface, "い")) {
+          entry.extended_pos = core::ExtendedPOS::AdjBasic;
+        } else if (utf8::endsWithAny(entry.surface, {"く"sv, "くて"sv})) {
+          // く-form (adverbial/te-form): 美しく, 美しくて
+          entry.extended_pos = core::ExtendedPOS::AdjRenyokei;
+        } else if (utf8::endsWithAny(entry.surface, {"かっ"sv})) {
+          // かっ-form (past stem): 美しかっ
+          entry.extended_pos = core::ExtendedPOS::AdjKatt;
+        } else if (utf8::endsWithAny(entry.surface, {"ければ"sv, "かったら"sv})) {
+          // Conditional forms: 美しければ, 美しかったら
+          entry.extended_pos = core::ExtendedPOS::AdjKeForm;
+        } else if (utf8::endsWithAny(entry.surface, {"そう"sv})) {
+          // Stem+そう: 美しそう
+          entry.extended_pos = core::ExtendedPOS::AdjStem;
+        } else {
+          // Doesn't match I-adjective patterns → NA-adjective
+          entry.extended_pos = core::ExtendedPOS::AdjNaAdj;
         }
-        case core::PartOfSpeech::Verb: {
-          // Distinguish verb forms based on ending
-          // 音便形: ends with っ/ん (onbin for ta/te form)
-          using namespace std::string_view_literals;
-          if (utf8::endsWithAny(entry.surface, {"っ"sv, "ん"sv})) {
-            // Sokuonbin (っ) or hatsuonbin (ん): あっ, 飲ん, etc.
-            entry.extended_pos = core::ExtendedPOS::VerbOnbinkei;
-          } else if (utf8::endsWith(entry.surface, "い") && entry.surface.size() > core::kTwoJapaneseCharBytes) {
-            // Godan-ka/ga i-onbin (い音便) for 3+ char compound verbs
-            // e.g., たどり着い from たどり着く, 引っかい from 引っかく
-            // Short forms (1-2 chars) are handled by the short-verb rules below
-            entry.extended_pos = core::ExtendedPOS::VerbOnbinkei;
-          } else if (utf8::endsWithAny(entry.surface, {"れば"sv, "けば"sv, "せば"sv, "てば"sv, "ねば"sv, "べば"sv,
-                                                       "めば"sv, "えば"sv})) {
-            // Conditional form
-            entry.extended_pos = core::ExtendedPOS::VerbKateikei;
-          } else if (entry.surface.size() == core::kJapaneseCharBytes) {
-            // Single hiragana character verb forms are renyokei (連用形)
-            // e.g., い from いる expansion, not shuushikei
-            // This prevents incorrect VERB_終止→AUX_意志 connections like と→い→う
-            entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
-          } else if (!utf8::endsWith(entry.surface, "る") && entry.surface.size() <= core::kTwoJapaneseCharBytes) {
-            // Short verb forms (1-2 chars) not ending in る
-            if (grammar::endsWithARow(entry.surface) && grammar::containsKanji(entry.surface)) {
-              // Kanji + A-row ending = godan mizenkei (読ま, 書か, 行か)
-              entry.extended_pos = core::ExtendedPOS::VerbMizenkei;
-            } else {
-              // Other short forms likely renyoukei (すぎ from すぎる)
-              entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
-            }
-          } else if (utf8::endsWithAny(entry.surface,
-                                       {"き"sv, "ぎ"sv, "し"sv, "ち"sv, "に"sv, "び"sv, "み"sv, "り"sv})) {
-            // Godan verb renyokei endings (I-row hiragana except い)
-            // e.g., いただき from いただく → いただき + ます should work
-            // Note: い excluded because godan-wa renyokei (思い) would need
-            // disambiguation from noun/adj uses. Short forms are handled above.
-            entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
-          } else if (utf8::endsWithAny(entry.surface,
-                                       {"え"sv, "け"sv, "げ"sv, "せ"sv, "ぜ"sv, "ね"sv, "べ"sv, "め"sv, "れ"sv}) &&
-                     entry.surface.size() > core::kTwoJapaneseCharBytes) {
-            // Ichidan verb renyokei endings (E-row hiragana)
-            // e.g., いただけ from いただける, 成し遂げ from 成し遂げる
-            // Only for 3+ char forms to avoid te-form fragments (食べ+て, 捨て)
-            // Short E-row forms are handled by the 1-2 char rule above
-            // Note: て/で excluded — conflicts with te-form (捨て, 出で)
-            entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
-          } else if (grammar::endsWithARow(entry.surface) && entry.surface.size() > core::kTwoJapaneseCharBytes) {
-            // Godan verb mizenkei endings (A-row hiragana)
-            // e.g., サボら from サボる → サボら + れる (passive) should work
-            // Only for 3+ char forms to avoid conflicts with short words
+        break;
+      }
+      case core::PartOfSpeech::Verb: {
+        // Distinguish verb forms based on ending
+        // 音便形: ends with っ/ん (onbin for ta/te form)
+        using namespace std::string_view_literals;
+        if (utf8::endsWithAny(entry.surface, {"っ"sv, "ん"sv})) {
+          // Sokuonbin (っ) or hatsuonbin (ん): あっ, 飲ん, etc.
+          entry.extended_pos = core::ExtendedPOS::VerbOnbinkei;
+        } else if (utf8::endsWith(entry.surface, "い") && entry.surface.size() > core::kTwoJapaneseCharBytes) {
+          // Godan-ka/ga i-onbin (い音便) for 3+ char compound verbs
+          // e.g., たどり着い from たどり着く, 引っかい from 引っかく
+          // Short forms (1-2 chars) are handled by the short-verb rules below
+          entry.extended_pos = core::ExtendedPOS::VerbOnbinkei;
+        } else if (utf8::endsWithAny(entry.surface, {"れば"sv, "けば"sv, "せば"sv, "てば"sv, "ねば"sv, "べば"sv,
+                                                     "めば"sv, "えば"sv})) {
+          // Conditional form
+          entry.extended_pos = core::ExtendedPOS::VerbKateikei;
+        } else if (entry.surface.size() == core::kJapaneseCharBytes) {
+          // Single hiragana character verb forms are renyokei (連用形)
+          // e.g., い from いる expansion, not shuushikei
+          // This prevents incorrect VERB_終止→AUX_意志 connections like と→い→う
+          entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
+        } else if (!utf8::endsWith(entry.surface, "る") && entry.surface.size() <= core::kTwoJapaneseCharBytes) {
+          // Short verb forms (1-2 chars) not ending in る
+          if (grammar::endsWithARow(entry.surface) && grammar::containsKanji(entry.surface)) {
+            // Kanji + A-row ending = godan mizenkei (読ま, 書か, 行か)
             entry.extended_pos = core::ExtendedPOS::VerbMizenkei;
           } else {
-            // Default: shuushikei (dictionary form or other forms)
-            entry.extended_pos = core::ExtendedPOS::VerbShuushikei;
+            // Other short forms likely renyoukei (すぎ from すぎる)
+            entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
           }
-          break;
+        } else if (utf8::endsWithAny(entry.surface,
+                                     {"き"sv, "ぎ"sv, "し"sv, "ち"sv, "に"sv, "び"sv, "み"sv, "り"sv})) {
+          // Godan verb renyokei endings (I-row hiragana except い)
+          // e.g., いただき from いただく → いただき + ます should work
+          // Note: い excluded because godan-wa renyokei (思い) would need
+          // disambiguation from noun/adj uses. Short forms are handled above.
+          entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
+        } else if (utf8::endsWithAny(entry.surface,
+                                     {"え"sv, "け"sv, "げ"sv, "せ"sv, "ぜ"sv, "ね"sv, "べ"sv, "め"sv, "れ"sv}) &&
+                   entry.surface.size() > core::kTwoJapaneseCharBytes) {
+          // Ichidan verb renyokei endings (E-row hiragana)
+          // e.g., いただけ from いただける, 成し遂げ from 成し遂げる
+          // Only for 3+ char forms to avoid te-form fragments (食べ+て, 捨て)
+          // Short E-row forms are handled by the 1-2 char rule above
+          // Note: て/で excluded — conflicts with te-form (捨て, 出で)
+          entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
+        } else if (grammar::endsWithARow(entry.surface) && entry.surface.size() > core::kTwoJapaneseCharBytes) {
+          // Godan verb mizenkei endings (A-row hiragana)
+          // e.g., サボら from サボる → サボら + れる (passive) should work
+          // Only for 3+ char forms to avoid conflicts with short words
+          entry.extended_pos = core::ExtendedPOS::VerbMizenkei;
+        } else {
+          // Default: shuushikei (dictionary form or other forms)
+          entry.extended_pos = core::ExtendedPOS::VerbShuushikei;
         }
-        case core::PartOfSpeech::Noun:
-          entry.extended_pos = core::ExtendedPOS::Noun;
-          break;
-        case core::PartOfSpeech::Adverb:
-          entry.extended_pos = core::ExtendedPOS::Adverb;
-          break;
-        case core::PartOfSpeech::Particle:
-          entry.extended_pos = core::ExtendedPOS::ParticleCase;
-          break;
-        case core::PartOfSpeech::Auxiliary:
-          entry.extended_pos = core::ExtendedPOS::AuxTenseTa;  // Default aux
-          break;
-        case core::PartOfSpeech::Suffix:
-          entry.extended_pos = core::ExtendedPOS::Suffix;
-          break;
-        case core::PartOfSpeech::Prefix:
-          entry.extended_pos = core::ExtendedPOS::Prefix;
-          break;
-        case core::PartOfSpeech::Conjunction:
-          entry.extended_pos = core::ExtendedPOS::Conjunction;
-          break;
-        case core::PartOfSpeech::Determiner:
-          entry.extended_pos = core::ExtendedPOS::Determiner;
-          break;
-        case core::PartOfSpeech::Pronoun:
-          entry.extended_pos = core::ExtendedPOS::Pronoun;
-          break;
-        case core::PartOfSpeech::Symbol:
-          entry.extended_pos = core::ExtendedPOS::Symbol;
-          break;
-        case core::PartOfSpeech::Other:
-          entry.extended_pos = core::ExtendedPOS::Other;
-          break;
-        default:
-          entry.extended_pos = core::ExtendedPOS::Unknown;
-          break;
+        break;
       }
+      case core::PartOfSpeech::Noun:
+        entry.extended_pos = core::ExtendedPOS::Noun;
+        break;
+      case core::PartOfSpeech::Adverb:
+        entry.extended_pos = core::ExtendedPOS::Adverb;
+        break;
+      case core::PartOfSpeech::Particle:
+        entry.extended_pos = core::ExtendedPOS::ParticleCase;
+        break;
+      case core::PartOfSpeech::Auxiliary:
+        entry.extended_pos = core::ExtendedPOS::AuxTenseTa;  // Default aux
+        break;
+      case core::PartOfSpeech::Suffix:
+        entry.extended_pos = core::ExtendedPOS::Suffix;
+        break;
+      case core::PartOfSpeech::Prefix:
+        entry.extended_pos = core::ExtendedPOS::Prefix;
+        break;
+      case core::PartOfSpeech::Conjunction:
+        entry.extended_pos = core::ExtendedPOS::Conjunction;
+        break;
+      case core::PartOfSpeech::Determiner:
+        entry.extended_pos = core::ExtendedPOS::Determiner;
+        break;
+      case core::PartOfSpeech::Pronoun:
+        entry.extended_pos = core::ExtendedPOS::Pronoun;
+        break;
+      case core::PartOfSpeech::Symbol:
+        entry.extended_pos = core::ExtendedPOS::Symbol;
+        break;
+      case core::PartOfSpeech::Other:
+        entry.extended_pos = core::ExtendedPOS::Other;
+        break;
+      default:
+        entry.extended_pos = core::ExtendedPOS::Unknown;
+        break;
     }
-    // is_low_info, is_prefix, conj_type are no longer stored
-
-    // Debug: log entries with Unknown extended_pos (indicates missing category mapping)
-    // These entries get high cost (2.0) which may cause unexpected tokenization
-    // At trace level (SUZUME_DEBUG=3) to avoid flooding output at lower levels
-    if (entry.extended_pos == core::ExtendedPOS::Unknown) {
-      SUZUME_DEBUG_LOG_TRACE("[DICT_LOAD] WARNING: \"" << entry.surface << "\" pos=" << core::posToString(entry.pos)
-                                                       << " has epos=UNKNOWN (cost=2.0)\n");
-    }
-
-    entries.push_back(std::move(entry));
+  }
+  // is_low_info, is_prefix, conj_type are no longer stored
+
+  // Debug: log entries with Unknown extended_pos (indicates missing category mapping)
+  // These entries get high cost (2.0) which may cause unexpected tokenization
+  // At trace level (SUZUME_DEBUG=3) to avoid flooding output at lower levels
+  if (entry.extended_pos == core::ExtendedPOS::Unknown) {
+    SUZUME_DEBUG_LOG_TRACE("[DICT_LOAD] WARNING: \"" << entry.surface << "\" pos=" << core::posToString(entry.pos)
+                                                     << " has epos=UNKNOWN (cost=2.0)\n");
   }
 
-  return entries.size();
+  return entry;
+}
+
+ConjugatedSurface BinaryDictionary::decodeConjugated(size_t idx) const {
+  const auto rec =
+      readPod<BinaryConjugationRecord>(image_, conjugations_.record_offset + idx * sizeof(BinaryConjugationRecord));
+  const char* string_pool = reinterpret_cast<const char*>(image_.data() + layout_.string_offset);
+  ConjugatedSurface surface;
+  surface.lemma.assign(string_pool + rec.lemma_offset, rec.lemma_length);
+  surface.pos = uint8ToPos(rec.pos);
+  surface.extended_pos = uint8ToExtendedPos(rec.extended_pos);
+  surface.conj_type = static_cast<ConjugationType>(rec.conj_type);
+  surface.auxiliary_chain = (rec.flags & BinaryConjugationRecord::kFlagAuxiliaryChain) != 0;
+  return surface;
 }
 
 std::vector<LookupResult> BinaryDictionary::lookup(std::string_view text, size_t start_pos) const {
@@ -416,7 +473,7 @@ std::vector<LookupResult> BinaryDictionary::lookup(std::string_view text, size_t
       result.entry_id = static_cast<uint32_t>(tres.value);
       // Convert byte length from trie to character count
       result.length = countUtf8Chars(text, start_pos, tres.length);
-      result.entry = &entries_[tres.value];
+      result.entry = entryAt(static_cast<size_t>(tres.value));
       results.push_back(result);
     }
   }
@@ -426,11 +483,47 @@ std::vector<LookupResult> BinaryDictionary::lookup(std::string_view text, size_t
 
 const DictionaryEntry* BinaryDictionary::getEntry(uint32_t idx) const {
   if (idx < entries_.size()) {
-    return &entries_[idx];
+    return entryAt(idx);
   }
   return nullptr;
 }
 
+const ConjugatedSurface* BinaryDictionary::findConjugated(std::string_view surface) const {
+  if (conjugations_.surfaces.size() == 0 || surface.empty()) {
+    return nullptr;
+  }
+  int32_t idx = conjugations_.trie.exactMatch(surface);
+  if (idx < 0 || static_cast<size_t>(idx) >= conjugations_.surfaces.size()) {
+    return nullptr;
+  }
+  return conjugations_.surfaces.get(static_cast<size_t>(idx),
+                                   [this](size_t record) { return decodeConjugated(record); });
+}
+
+std::vector<ConjugatedLookupResult> BinaryDictionary::lookupConjugated(std::string_view text,
+                                                                       size_t start_pos) const {
+  std::vector<ConjugatedLookupResult> results;
+  if (conjugations_.surfaces.size() == 0 || start_pos >= text.size()) {
+    return results;
+  }
+  for (const auto& tres : conjugations_.trie.commonPrefixSearch(text, start_pos)) {
+    if (tres.value >= 0 && static_cast<size_t>(tres.value) < conjugations_.surfaces.size()) {
+      const auto* surface = conjugations_.surfaces.get(static_cast<size_t>(tres.value),
+                                                       [this](size_t record) { return decodeConjugated(record); });
+      results.push_back({countUtf8Chars(text, start_pos, tres.length), surface});
+    }
+  }
+  return results;
+}
+
+core::MemoryUsage BinaryDictionary::memoryUsage() const {
+  core::MemoryUsage usage;
+  usage.dictionary_entries = entries_.memoryUsage() + conjugations_.surfaces.memoryUsage();
+  usage.tries = trie_.memoryUsage() + conjugations_.trie.memoryUsage();
+  usage.string_pools = image_.size();
+  return usage;
+}
+
 // BinaryDictWriter implementation
 
 BinaryDictWriter::BinaryDictWriter() = default;
@@ -448,6 +541,10 @@ void BinaryDictWriter::replaceEntry(const DictionaryEntry& entry) {
   }
 }
 
+void BinaryDictWriter::addConjugatedSurface(const std::string& surface, const ConjugatedSurface& info) {
+  conjugations_.emplace(surface, info);
+}
+
 core::Expected<std::vector<uint8_t>, core::Error> BinaryDictWriter::build() {
   if (entries_.empty()) {
     return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "No entries to write"));
@@ -545,19 +642,60 @@ core::Expected<std::vector<uint8_t>, core::Error> BinaryDictWriter::build() {
   }
 
   DoubleArray trie;
-  if (!trie.build(keys, values)) {
+  if (!trie.build(keys, values, DoubleArray::Labels::Codepoints)) {
     return core::makeUnexpected(core::Error(core::ErrorCode::InternalError, "Failed to build dictionary trie"));
   }
 
   auto trie_data = trie.serialize();
 
+  // Build conjugation index: [count][trie size][trie, padded][records]
+  std::vector<uint8_t> index_data;
+  if (!conjugations_.empty()) {
+    std::vector<std::string> index_keys;
+    std::vector<int32_t> index_values;
+    std::vector<BinaryConjugationRecord> index_records;
+    index_keys.reserve(conjugations_.size());
+    index_values.reserve(conjugations_.size());
+    index_records.reserve(conjugations_.size());
+    for (const auto& [surface, info] : conjugations_) {
+      if (surface.empty() || info.lemma.empty() || info.lemma.size() > std::numeric_limits<uint8_t>::max()) {
+        return core::makeUnexpected(
+            core::Error(core::ErrorCode::InvalidInput, "Invalid conjugation index surface: " + surface));
+      }
+      BinaryConjugationRecord rec{};
+      rec.lemma_offset = addString(info.lemma);
+      rec.lemma_length = static_cast<uint8_t>(info.lemma.size());
+      rec.pos = posToUint8(info.pos);
+      rec.extended_pos = extendedPosToUint8(info.extended_pos);
+      rec.conj_type = static_cast<uint8_t>(info.conj_type);
+      rec.flags = info.auxiliary_chain ? BinaryConjugationRecord::kFlagAuxiliaryChain : 0;
+      index_values.push_back(static_cast<int32_t>(index_records.size()));
+      index_keys.push_back(surface);
+      index_records.push_back(rec);
+    }
+
+    DoubleArray index_trie;
+    if (!index_trie.build(index_keys, index_values, DoubleArray::Labels::Codepoints)) {
+      return core::makeUnexpected(core::Error(core::ErrorCode::InternalError, "Failed to build conjugation index"));
+    }
+    auto index_trie_data = index_trie.serialize();
+
+    uint32_t counts[2] = {static_cast<uint32_t>(index_records.size()), static_cast<uint32_t>(index_trie_data.size())};
+    size_t records_size = index_records.size() * sizeof(BinaryConjugationRecord);
+    index_data.resize(sizeof(counts) + alignTo4(index_trie_data.size()) + records_size);
+    std::memcpy(index_data.data(), counts, sizeof(counts));
+    std::memcpy(index_data.data() + sizeof(counts), index_trie_data.data(), index_trie_data.size());
+    std::memcpy(index_data.data() + sizeof(counts) + alignTo4(index_trie_data.size()), index_records.data(),
+                records_size);
+  }
+
   // Calculate offsets
   size_t header_size = sizeof(BinaryDictHeader);
   size_t trie_offset = header_size;
   size_t trie_size = trie_data.size();
   size_t entry_offset = trie_offset + trie_size;
   size_t entry_size = binary_entries.size() * sizeof(BinaryDictEntry);
-  size_t string_offset = entry_offset + entry_size;
+  size_t string_offset = entry_offset + entry_size + index_data.size();
   size_t total_size = string_offset + string_pool.size();
 
   // Build output
@@ -568,13 +706,15 @@ core::Expected<std::vector<uint8_t>, core::Error> BinaryDictWriter::build() {
   BinaryDictHeader header{};
   header.magic = BinaryDictHeader::kMagic;
   header.version_major = BinaryDictHeader::kVersionMajor;
-  header.version_minor = BinaryDictHeader::kVersionMinor;
+  // Without the index the layout is unchanged, so older readers can still load the file
+  header.version_minor = index_data.empty() ? BinaryDictHeader::kVersionMinorConjugationIndex - 1
+                                            : BinaryDictHeader::kVersionMinorConjugationIndex;
   header.entry_count = static_cast<uint32_t>(entries_.size());
   header.trie_offset = static_cast<uint32_t>(trie_offset);
   header.trie_size = static_cast<uint32_t>(trie_size);
   header.entry_offset = static_cast<uint32_t>(entry_offset);
   header.string_offset = static_cast<uint32_t>(string_offset);
-  header.flags = 0;
+  header.flags = index_data.empty() ? 0 : BinaryDictHeader::kFlagConjugationIndex;
   header.checksum = 0;
 
   std::memcpy(ptr, &header, sizeof(header));
@@ -588,6 +728,12 @@ core::Expected<std::vector<uint8_t>, core::Error> BinaryDictWriter::build() {
   std::memcpy(ptr, binary_entries.data(), entry_size);
   ptr += entry_size;
 
+  // Write conjugation index
+  if (!index_data.empty()) {
+    std::memcpy(ptr, index_data.data(), index_data.size());
+    ptr += index_data.size();
+  }
+
   // Write string pool
   std::memcpy(ptr, string_pool.data(), string_pool.size());
 
@@ -600,15 +746,29 @@ core::Expected<size_t, core::Error> BinaryDictWriter::writeToFile(const std::str
     return core::makeUnexpected(result.error());
   }
 
-  std::ofstream file(path, std::ios::binary);
-  if (!file) {
-    return core::makeUnexpected(
-        core::Error(core::ErrorCode::InternalError, "Failed to create dictionary file: " + path));
+  // Write a temporary file and rename it over path, so processes that have
+  // the old file mapped keep reading it unchanged
+  std::string temp_path = path + ".tmp";
+  const auto& data = result.value();
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return core::makeUnexpected(
+          core::Error(core::ErrorCode::InternalError, "Failed to create dictionary file: " + temp_path));
+    }
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    file.close();
+    if (!file) {
+      std::remove(temp_path.c_str());
+      return core::makeUnexpected(
+          core::Error(core::ErrorCode::InternalError, "Failed to write dictionary file: " + temp_path));
+    }
   }
 
-  const auto& data = result.value();
-  file.write(reinterpret_cast<const char*>(data.data()), data.size());
-  if (!file) {
+  // std::rename does not replace an existing file on every platform
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0 &&
+      (std::remove(path.c_str()) != 0 || std::rename(temp_path.c_str(), path.c_str()) != 0)) {
+    std::remove(temp_path.c_str());
     return core::makeUnexpected(
         core::Error(core::ErrorCode::InternalError, "Failed to write dictionary file: " + path));
   }
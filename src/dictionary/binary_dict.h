@@ -2,6 +2,7 @@
 #define SUZUME_DICTIONARY_BINARY_DICT_H_
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -10,7 +11,9 @@
 #include "core/error.h"
 #include "core/types.h"
 #include "dictionary/dictionary.h"
+#include "dictionary/dictionary_image.h"
 #include "dictionary/double_array.h"
+#include "dictionary/lazy_table.h"
 
 namespace suzume::dictionary {
 
@@ -22,18 +25,22 @@ namespace suzume::dictionary {
 struct BinaryDictHeader {
   uint32_t magic;          // "SZMD" (0x444D5A53)
   uint16_t version_major;  // Major version (2 = compact format)
-  uint16_t version_minor;  // Minor version
+  uint16_t version_minor;  // Minor version (1 = extended POS, 2 = codepoint trie, 3 = conjugation index)
   uint32_t entry_count;    // Number of entries
   uint32_t trie_offset;    // Offset to trie data
   uint32_t trie_size;      // Size of trie data
   uint32_t entry_offset;   // Offset to entry array
   uint32_t string_offset;  // Offset to string pool
-  uint32_t flags;          // Reserved flags
+  uint32_t flags;          // Section flags (kFlagConjugationIndex)
   uint32_t checksum;       // CRC32 checksum (reserved)
 
   static constexpr uint32_t kMagic = 0x444D5A53;  // "SZMD"
   static constexpr uint16_t kVersionMajor = 2;
-  static constexpr uint16_t kVersionMinor = 1;
+  static constexpr uint16_t kVersionMinor = 3;                  // Newest minor version this reader accepts
+  static constexpr uint16_t kVersionMinorConjugationIndex = 3;  // Written only when the index is present
+
+  // A conjugation index fills the space between the entry array and the string pool
+  static constexpr uint32_t kFlagConjugationIndex = 0x01;
 };
 
 /**
@@ -52,13 +59,36 @@ struct BinaryDictEntry {
   uint8_t reserved[3];      // Reserved, must be zero
 };
 
+/**
+ * @brief Conjugation index record (8 bytes)
+ *
+ * The index section is [uint32 record count][uint32 trie size][trie, padded
+ * to 4 bytes][records]; the trie maps each surface to its record.
+ */
+struct BinaryConjugationRecord {
+  uint32_t lemma_offset;  // Lemma offset in string pool
+  uint8_t lemma_length;   // Lemma byte length
+  uint8_t pos;            // Part of speech (Verb or Adjective)
+  uint8_t extended_pos;   // Extended POS of the leading word
+  uint8_t conj_type;      // ConjugationType of the lemma
+  uint8_t flags;          // kFlagAuxiliaryChain
+  uint8_t reserved[3];    // Reserved (0)
+
+  static constexpr uint8_t kFlagAuxiliaryChain = 0x01;
+};
+
 /**
  * @brief Binary dictionary (read-only, memory-mapped friendly)
  *
+ * Loading validates the image and keeps it; the tries are read in place
+ * and each entry is decoded into a DictionaryEntry the first time a lookup
+ * reaches it, so startup cost does not grow with the entry count.
+ *
  * File format:
  *   [Header]
  *   [Double-Array Trie]
  *   [Entry Array]
+ *   [Conjugation Index] (optional, v2.3+)
  *   [String Pool]
  */
 class BinaryDictionary : public IDictionary {
@@ -70,6 +100,10 @@ class BinaryDictionary : public IDictionary {
    * @brief Load dictionary from file
    * @param path File path
    * @return Number of entries on success, error on failure
+   *
+   * The file is memory-mapped where supported (see DictionaryImage); replace
+   * it by renaming a new file over it, as BinaryDictWriter::writeToFile does,
+   * rather than rewriting it in place while it is loaded.
    */
   core::Expected<size_t, core::Error> loadFromFile(const std::string& path);
 
@@ -99,15 +133,76 @@ class BinaryDictionary : public IDictionary {
   /**
    * @brief Check if dictionary is loaded
    */
-  bool isLoaded() const { return !entries_.empty(); }
+  bool isLoaded() const { return entries_.size() > 0; }
+
+  /**
+   * @brief Find a surface in the conjugation index
+   * @return Conjugation info, or nullptr if not indexed
+   */
+  const ConjugatedSurface* findConjugated(std::string_view surface) const;
+
+  /**
+   * @brief Find conjugated surfaces starting at a position
+   * @param text Text to search
+   * @param start_pos Start position in bytes
+   */
+  std::vector<ConjugatedLookupResult> lookupConjugated(std::string_view text, size_t start_pos) const;
+
+  /**
+   * @brief Check if the dictionary carries a conjugation index
+   */
+  bool hasConjugationIndex() const { return conjugations_.surfaces.size() > 0; }
+
+  /**
+   * @brief Number of surfaces in the conjugation index
+   */
+  size_t conjugationCount() const { return conjugations_.surfaces.size(); }
+
+  /**
+   * @brief Format minor version of the loaded file
+   */
+  uint16_t versionMinor() const { return layout_.version_minor; }
+
+  /**
+   * @brief Approximate heap usage (entries, trie and the retained file image)
+   */
+  core::MemoryUsage memoryUsage() const;
 
  private:
+  // Location of the entry records in image_
+  struct EntryLayout {
+    size_t count{0};
+    size_t offset{0};         // First entry record
+    size_t string_offset{0};  // String pool
+    bool legacy{false};       // v2.0 records (no extended POS)
+    uint16_t version_minor{0};
+  };
+
+  struct ConjugationIndex {
+    DoubleArray trie;
+    LazyTable<ConjugatedSurface> surfaces;
+    size_t record_offset{0};  // First BinaryConjugationRecord in image_
+  };
+
+  DictionaryImage image_;  // Mapped or copied file (the tries read their units from it)
   DoubleArray trie_;
-  std::vector<DictionaryEntry> entries_;
-  std::vector<uint8_t> data_;  // Owned copy of binary data
+  EntryLayout layout_;
+  LazyTable<DictionaryEntry> entries_;
+  ConjugationIndex conjugations_;
+
+  core::Expected<size_t, core::Error> loadImage(DictionaryImage image);
+
+  core::Expected<size_t, core::Error> parseData(const DictionaryImage& data, DoubleArray& trie, EntryLayout& layout,
+                                                ConjugationIndex& conjugations);
+
+  static BinaryDictEntry readEntryRecord(const DictionaryImage& data, const EntryLayout& layout, size_t idx);
 
-  core::Expected<size_t, core::Error> parseData(const std::vector<uint8_t>& data, DoubleArray& trie,
-                                                std::vector<DictionaryEntry>& entries);
+  DictionaryEntry decodeEntry(size_t idx) const;
+  ConjugatedSurface decodeConjugated(size_t idx) const;
+
+  const DictionaryEntry* entryAt(size_t idx) const {
+    return entries_.get(idx, [this](size_t record) { return decodeEntry(record); });
+  }
 };
 
 /**
@@ -128,6 +223,11 @@ class BinaryDictWriter {
    */
   void replaceEntry(const DictionaryEntry& entry);
 
+  /**
+   * @brief Add a surface to the conjugation index (the first one added for a surface is kept)
+   */
+  void addConjugatedSurface(const std::string& surface, const ConjugatedSurface& info);
+
   /**
    * @brief Build and write to file
    * @param path Output file path
@@ -148,6 +248,7 @@ class BinaryDictWriter {
 
  private:
   std::vector<DictionaryEntry> entries_;
+  std::map<std::string, ConjugatedSurface> conjugations_;  // Sorted for the index trie
 };
 
 }  // namespace suzume::dictionary
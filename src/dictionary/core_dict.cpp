@@ -17,6 +17,9 @@
 #include "dictionary/entries/interjections.h"
 #include "dictionary/entries/particles.h"
 #include "dictionary/entries/pronouns.h"
+#ifdef SUZUME_PREBUILT_TABLES
+#include "tables/builtin_tables.h"
+#endif
 
 namespace suzume::dictionary {
 
@@ -37,6 +40,38 @@ CoreDictionary::CoreDictionary() {
 }
 
 void CoreDictionary::initializeEntries() {
+#ifdef SUZUME_PREBUILT_TABLES
+  entry_count_ = tables::kCoreEntryCount;
+  prebuilt_entries_.reset(entry_count_);
+  trie_.deserializeView(tables::kCoreTrie, tables::kCoreTrieSize);
+#else
+  entries_ = collectEntries();
+  entry_count_ = entries_.size();
+  buildTrie(entries_, trie_);
+#endif
+}
+
+std::string_view CoreDictionary::surfaceAt(size_t idx) const {
+#ifdef SUZUME_PREBUILT_TABLES
+  return tables::kCoreEntries[idx].surface;
+#else
+  return entries_[idx].surface;
+#endif
+}
+
+const DictionaryEntry* CoreDictionary::entryAt(size_t idx) const {
+#ifdef SUZUME_PREBUILT_TABLES
+  return prebuilt_entries_.get(idx, [](size_t record_idx) {
+    const auto& record = tables::kCoreEntries[record_idx];
+    return DictionaryEntry{record.surface, static_cast<core::PartOfSpeech>(record.pos),
+                           static_cast<core::ExtendedPOS>(record.extended_pos), record.lemma};
+  });
+#else
+  return &entries_[idx];
+#endif
+}
+
+std::vector<DictionaryEntry> CoreDictionary::collectEntries() {
   // ==========================================================================
   // v0.8: Layer 1 only - Closed class entries (function words)
   // ==========================================================================
@@ -55,14 +90,14 @@ void CoreDictionary::initializeEntries() {
   auto formal_nouns = entries::getFormalNounEntries();
   auto interjections = entries::getInterjectionEntries();
 
-  // Reserve space
-  entries_.reserve(particles.size() + compound_particles.size() + auxiliaries.size() + conjunctions.size() +
-                   determiners.size() + pronouns.size() + formal_nouns.size() + interjections.size());
+  std::vector<DictionaryEntry> entries;
+  entries.reserve(particles.size() + compound_particles.size() + auxiliaries.size() + conjunctions.size() +
+                  determiners.size() + pronouns.size() + formal_nouns.size() + interjections.size());
 
   // Collect entries (trie built after sorting)
-  auto addEntries = [this](const std::vector<DictionaryEntry>& source) {
+  auto addEntries = [&entries](const std::vector<DictionaryEntry>& source) {
     for (const auto& entry : source) {
-      entries_.push_back(entry);
+      entries.push_back(entry);
     }
   };
 
@@ -77,15 +112,13 @@ void CoreDictionary::initializeEntries() {
 
   // Sort entries by surface for Double-Array compatibility
   // Use stable_sort to preserve relative order of entries with same surface
-  std::stable_sort(entries_.begin(), entries_.end(),
+  std::stable_sort(entries.begin(), entries.end(),
                    [](const DictionaryEntry& lhs, const DictionaryEntry& rhs) { return lhs.surface < rhs.surface; });
-
-  // Build Double-Array trie
-  buildTrie();
+  return entries;
 }
 
-void CoreDictionary::buildTrie() {
-  if (entries_.empty()) {
+void CoreDictionary::buildTrie(const std::vector<DictionaryEntry>& entries, DoubleArray& trie) {
+  if (entries.empty()) {
     return;
   }
 
@@ -99,8 +132,8 @@ void CoreDictionary::buildTrie() {
   std::string prev_surface;
   size_t first_idx = 0;
 
-  for (size_t idx = 0; idx < entries_.size(); ++idx) {
-    const auto& entry = entries_[idx];
+  for (size_t idx = 0; idx < entries.size(); ++idx) {
+    const auto& entry = entries[idx];
     if (entry.surface != prev_surface) {
       // New surface - save previous first if exists
       if (!prev_surface.empty()) {
@@ -119,8 +152,8 @@ void CoreDictionary::buildTrie() {
     values.push_back(static_cast<int32_t>(first_idx));
   }
 
-  // Build the Double-Array trie
-  trie_.build(keys, values);
+  // Build the Double-Array trie (one transition per common Japanese character)
+  trie.build(keys, values, DoubleArray::Labels::Codepoints);
 }
 
 namespace {
@@ -148,7 +181,7 @@ size_t countUtf8Chars(std::string_view text, size_t start_byte, size_t byte_leng
 std::vector<LookupResult> CoreDictionary::lookup(std::string_view text, size_t start_pos) const {
   std::vector<LookupResult> results;
 
-  if (entries_.empty() || start_pos >= text.size()) {
+  if (entry_count_ == 0 || start_pos >= text.size()) {
     return results;
   }
 
@@ -156,16 +189,16 @@ std::vector<LookupResult> CoreDictionary::lookup(std::string_view text, size_t s
   auto trie_results = trie_.commonPrefixSearch(text, start_pos);
 
   for (const auto& tres : trie_results) {
-    if (tres.value < 0 || static_cast<size_t>(tres.value) >= entries_.size()) {
+    if (tres.value < 0 || static_cast<size_t>(tres.value) >= entry_count_) {
       continue;
     }
 
     size_t first_idx = static_cast<size_t>(tres.value);
-    const std::string& matched_surface = entries_[first_idx].surface;
+    std::string_view matched_surface = surfaceAt(first_idx);
 
     // Collect all entries with the same surface (consecutive in sorted array)
-    for (size_t idx = first_idx; idx < entries_.size(); ++idx) {
-      if (entries_[idx].surface != matched_surface) {
+    for (size_t idx = first_idx; idx < entry_count_; ++idx) {
+      if (surfaceAt(idx) != matched_surface) {
         break;
       }
 
@@ -173,7 +206,7 @@ std::vector<LookupResult> CoreDictionary::lookup(std::string_view text, size_t s
       result.entry_id = static_cast<uint32_t>(idx);
       // Convert byte length to character count
       result.length = countUtf8Chars(text, start_pos, tres.length);
-      result.entry = &entries_[idx];
+      result.entry = entryAt(idx);
       results.push_back(result);
     }
   }
@@ -182,10 +215,17 @@ std::vector<LookupResult> CoreDictionary::lookup(std::string_view text, size_t s
 }
 
 const DictionaryEntry* CoreDictionary::getEntry(uint32_t idx) const {
-  if (idx < entries_.size()) {
-    return &entries_[idx];
+  if (idx < entry_count_) {
+    return entryAt(idx);
   }
   return nullptr;
 }
 
+core::MemoryUsage CoreDictionary::memoryUsage() const {
+  core::MemoryUsage usage;
+  usage.dictionary_entries = entriesMemoryUsage(entries_) + prebuilt_entries_.memoryUsage();
+  usage.tries = trie_.memoryUsage();
+  return usage;
+}
+
 }  // namespace suzume::dictionary
@@ -2,10 +2,12 @@
 #define SUZUME_DICTIONARY_CORE_DICT_H_
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 #include "dictionary/dictionary.h"
 #include "dictionary/double_array.h"
+#include "dictionary/lazy_table.h"
 
 namespace suzume::dictionary {
 
@@ -19,6 +21,10 @@ namespace suzume::dictionary {
  * Uses Double-Array Trie for efficient O(m) lookup where m is key length.
  * This improves WASM startup time and memory efficiency compared to
  * the traditional hash-based Trie.
+ *
+ * With prebuilt tables the trie is read in place from the binary and each
+ * entry is decoded from its build-time record on first lookup, so
+ * construction copies nothing.
  */
 class CoreDictionary : public IDictionary {
  public:
@@ -43,25 +49,53 @@ class CoreDictionary : public IDictionary {
   /**
    * @brief Get number of entries
    */
-  size_t size() const override { return entries_.size(); }
+  size_t size() const override { return entry_count_; }
+
+  /**
+   * @brief Approximate heap usage (entries and trie)
+   */
+  core::MemoryUsage memoryUsage() const;
+
+  /**
+   * @brief Run the builtin entry generators and sort entries by surface
+   *
+   * Used at build time by suzume-gen-tables, and at startup when prebuilt
+   * tables are disabled.
+   */
+  static std::vector<DictionaryEntry> collectEntries();
+
+  /**
+   * @brief Build Double-Array trie (surface -> first entry index) from sorted entries
+   */
+  static void buildTrie(const std::vector<DictionaryEntry>& entries, DoubleArray& trie);
 
  private:
-  // Entries sorted by surface for Double-Array compatibility
+  size_t entry_count_{0};
+
+  // Entries sorted by surface for Double-Array compatibility (runtime generators only)
   std::vector<DictionaryEntry> entries_;
 
+  // Prebuilt entries (tables::kCoreEntries, same order), decoded on first access
+  LazyTable<DictionaryEntry> prebuilt_entries_;
+
   // Double-Array Trie storing (surface -> first_entry_index)
   // Multiple entries with same surface are stored consecutively
   DoubleArray trie_;
 
   /**
-   * @brief Initialize entries from hardcoded data and build trie
+   * @brief Initialize entries and trie (from prebuilt tables when available)
    */
   void initializeEntries();
 
   /**
-   * @brief Build Double-Array trie from sorted entries
+   * @brief Surface of an entry without decoding it
+   */
+  std::string_view surfaceAt(size_t idx) const;
+
+  /**
+   * @brief Entry by index (idx < entry_count_)
    */
-  void buildTrie();
+  const DictionaryEntry* entryAt(size_t idx) const;
 };
 
 }  // namespace suzume::dictionary
@@ -7,13 +7,14 @@
 
 #include "dictionary/binary_dict.h"
 #include "dictionary/core_dict.h"
+#include "dictionary/dictionary_registry.h"
 #include "dictionary/user_dict.h"
 
 namespace suzume::dictionary {
 
-#ifndef __EMSCRIPTEN__
 namespace {
 
+#ifndef __EMSCRIPTEN__
 /**
  * @brief Get home directory path
  */
@@ -23,11 +24,55 @@ std::string getHomeDir() {
   }
   return "";
 }
+#endif  // __EMSCRIPTEN__
+
+/**
+ * @brief Builtin dictionary shared by all managers
+ */
+std::shared_ptr<const CoreDictionary> sharedCoreDictionary() {
+  static const std::shared_ptr<const CoreDictionary> kCoreDict = std::make_shared<const CoreDictionary>();
+  return kCoreDict;
+}
+
+/**
+ * @brief Generation for a set of dictionary identities
+ *
+ * Identities are never reused, so equal sets always denote the same
+ * dictionaries; a 64-bit hash of the ordered set tells other sets apart
+ * without keeping a table of every set seen.
+ */
+uint64_t hashGeneration(const std::vector<uint64_t>& identities) {
+  // splitmix64 finalizer applied after each identity
+  auto mix = [](uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  };
+  uint64_t value = mix(identities.size());
+  for (uint64_t identity : identities) {
+    value = mix(value + 0x9e3779b97f4a7c15ULL + identity);
+  }
+  return value;
+}
+
+/**
+ * @brief Load a file through the process-wide registry
+ *
+ * On failure the currently loaded dictionary (if any) is kept.
+ */
+core::Expected<size_t, core::Error> acquireInto(const std::string& path,
+                                                std::shared_ptr<const BinaryDictionary>& target) {
+  auto acquired = DictionaryRegistry::instance().acquire(path);
+  if (!acquired.hasValue()) {
+    return acquired.error();
+  }
+  target = std::move(acquired).value();
+  return target->size();
+}
 
 }  // namespace
-#endif  // __EMSCRIPTEN__
 
-DictionaryManager::DictionaryManager() : core_dict_(std::make_unique<CoreDictionary>()) {}
+DictionaryManager::DictionaryManager() : core_dict_(sharedCoreDictionary()) { refreshGeneration(); }
 
 DictionaryManager::~DictionaryManager() = default;
 
@@ -37,26 +82,38 @@ DictionaryManager& DictionaryManager::operator=(DictionaryManager&&) noexcept =
 void DictionaryManager::addUserDictionary(std::shared_ptr<UserDictionary> dict) {
   if (dict) {
     user_dicts_.push_back(std::move(dict));
+    refreshGeneration();
   }
 }
 
 std::vector<LookupResult> DictionaryManager::lookup(std::string_view text, size_t start_pos) const {
   std::vector<LookupResult> results;
 
+  // Shared IDs number layers 1-3 consecutively
+  auto appendShared = [&results](std::vector<LookupResult>& layer_results, size_t base) {
+    for (auto& r : layer_results) {
+      r.shared_id = static_cast<uint32_t>(base + r.entry_id);
+    }
+    results.insert(results.end(), layer_results.begin(), layer_results.end());
+  };
+  size_t base = 0;
+
   // Lookup in core dictionary (Layer 1: hardcoded)
   auto core_results = core_dict_->lookup(text, start_pos);
-  results.insert(results.end(), core_results.begin(), core_results.end());
+  appendShared(core_results, base);
+  base += core_dict_->size();
 
   // Lookup in core binary dictionary (Layer 2: core.dic)
   if (core_binary_dict_ && core_binary_dict_->isLoaded()) {
     auto binary_results = core_binary_dict_->lookup(text, start_pos);
-    results.insert(results.end(), binary_results.begin(), binary_results.end());
+    appendShared(binary_results, base);
+    base += core_binary_dict_->size();
   }
 
   // Lookup in user binary dictionary (Layer 3: user.dic)
   if (user_binary_dict_ && user_binary_dict_->isLoaded()) {
     auto user_binary_results = user_binary_dict_->lookup(text, start_pos);
-    results.insert(results.end(), user_binary_results.begin(), user_binary_results.end());
+    appendShared(user_binary_results, base);
   }
 
   // Lookup in custom user dictionaries (Layer 4: CSV/TSV files)
@@ -71,6 +128,28 @@ std::vector<LookupResult> DictionaryManager::lookup(std::string_view text, size_
   return results;
 }
 
+size_t DictionaryManager::sharedEntryCount() const {
+  size_t count = core_dict_->size();
+  if (core_binary_dict_ && core_binary_dict_->isLoaded()) {
+    count += core_binary_dict_->size();
+  }
+  if (user_binary_dict_ && user_binary_dict_->isLoaded()) {
+    count += user_binary_dict_->size();
+  }
+  return count;
+}
+
+void DictionaryManager::refreshGeneration() {
+  // The builtin dictionary is the same for every manager
+  std::vector<uint64_t> identities;
+  identities.push_back(core_binary_dict_ ? core_binary_dict_->identity() : 0);
+  identities.push_back(user_binary_dict_ ? user_binary_dict_->identity() : 0);
+  for (const auto& user_dict : user_dicts_) {
+    identities.push_back(user_dict->identity());
+  }
+  generation_ = hashGeneration(identities);
+}
+
 const CoreDictionary& DictionaryManager::coreDictionary() const {
   return *core_dict_;
 }
@@ -80,11 +159,9 @@ bool DictionaryManager::loadCoreDictionary(const std::string& path) {
 }
 
 core::Expected<size_t, core::Error> DictionaryManager::loadCoreDictionaryResult(const std::string& path) {
-  if (!core_binary_dict_) {
-    core_binary_dict_ = std::make_unique<BinaryDictionary>();
-  }
-
-  return core_binary_dict_->loadFromFile(path);
+  auto result = acquireInto(path, core_binary_dict_);
+  refreshGeneration();
+  return result;
 }
 
 bool DictionaryManager::hasCoreBinaryDictionary() const {
@@ -96,11 +173,9 @@ bool DictionaryManager::loadUserBinaryDictionary(const std::string& path) {
 }
 
 core::Expected<size_t, core::Error> DictionaryManager::loadUserBinaryDictionaryResult(const std::string& path) {
-  if (!user_binary_dict_) {
-    user_binary_dict_ = std::make_unique<BinaryDictionary>();
-  }
-
-  return user_binary_dict_->loadFromFile(path);
+  auto result = acquireInto(path, user_binary_dict_);
+  refreshGeneration();
+  return result;
 }
 
 bool DictionaryManager::loadUserBinaryDictionaryFromMemory(const uint8_t* data, size_t size) {
@@ -109,17 +184,67 @@ bool DictionaryManager::loadUserBinaryDictionaryFromMemory(const uint8_t* data,
 
 core::Expected<size_t, core::Error> DictionaryManager::loadUserBinaryDictionaryFromMemoryResult(const uint8_t* data,
                                                                                                 size_t size) {
-  if (!user_binary_dict_) {
-    user_binary_dict_ = std::make_unique<BinaryDictionary>();
+  // In-memory data has no file identity, so it is never shared
+  auto dict = std::make_shared<BinaryDictionary>();
+  auto result = dict->loadFromMemory(data, size);
+  if (result.hasValue()) {
+    user_binary_dict_ = std::move(dict);
+    refreshGeneration();
   }
-
-  return user_binary_dict_->loadFromMemory(data, size);
+  return result;
 }
 
 bool DictionaryManager::hasUserBinaryDictionary() const {
   return user_binary_dict_ && user_binary_dict_->isLoaded();
 }
 
+const ConjugatedSurface* DictionaryManager::findConjugated(std::string_view surface) const {
+  if (user_binary_dict_) {
+    if (const auto* found = user_binary_dict_->findConjugated(surface)) {
+      return found;
+    }
+  }
+  if (core_binary_dict_) {
+    return core_binary_dict_->findConjugated(surface);
+  }
+  return nullptr;
+}
+
+std::vector<ConjugatedLookupResult> DictionaryManager::lookupConjugated(std::string_view text,
+                                                                        size_t start_pos) const {
+  std::vector<ConjugatedLookupResult> results;
+  if (user_binary_dict_) {
+    results = user_binary_dict_->lookupConjugated(text, start_pos);
+  }
+  if (core_binary_dict_) {
+    auto core_results = core_binary_dict_->lookupConjugated(text, start_pos);
+    results.insert(results.end(), core_results.begin(), core_results.end());
+  }
+  return results;
+}
+
+bool DictionaryManager::hasConjugationIndex() const {
+  return (user_binary_dict_ && user_binary_dict_->hasConjugationIndex()) ||
+         (core_binary_dict_ && core_binary_dict_->hasConjugationIndex());
+}
+
+core::MemoryUsage DictionaryManager::memoryUsage() const {
+  core::MemoryUsage usage;
+  if (core_dict_) {
+    usage += core_dict_->memoryUsage();
+  }
+  if (core_binary_dict_) {
+    usage += core_binary_dict_->memoryUsage();
+  }
+  if (user_binary_dict_) {
+    usage += user_binary_dict_->memoryUsage();
+  }
+  for (const auto& dict : user_dicts_) {
+    usage += dict->memoryUsage();
+  }
+  return usage;
+}
+
 bool DictionaryManager::tryAutoLoadCoreDictionary() {
   // Already loaded
   if (hasCoreBinaryDictionary()) {
@@ -1,6 +1,7 @@
 #ifndef SUZUME_DICTIONARY_DICTIONARY_H_
 #define SUZUME_DICTIONARY_DICTIONARY_H_
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -8,6 +9,7 @@
 #include <vector>
 
 #include "core/error.h"
+#include "core/memory_usage.h"
 #include "core/types.h"
 
 namespace suzume::dictionary {
@@ -54,14 +56,51 @@ struct DictionaryEntry {
   std::string lemma;                                           // Lemma (optional)
 };
 
+/**
+ * @brief Approximate heap bytes of an entry array, strings included
+ */
+inline size_t entriesMemoryUsage(const std::vector<DictionaryEntry>& entries) {
+  size_t bytes = entries.capacity() * sizeof(DictionaryEntry);
+  for (const auto& entry : entries) {
+    bytes += entry.surface.capacity() + entry.lemma.capacity();
+  }
+  return bytes;
+}
+
+/**
+ * @brief Conjugated surface of a dictionary verb or adjective
+ *
+ * Pre-expanded by `dict compile --conjugation-index` (stems and common
+ * auxiliary chains such as 食べました), so known words resolve without
+ * inflection analysis.
+ */
+struct ConjugatedSurface {
+  std::string lemma;                                           // Dictionary form
+  core::PartOfSpeech pos{core::PartOfSpeech::Verb};            // Verb or Adjective
+  core::ExtendedPOS extended_pos{core::ExtendedPOS::Unknown};  // Form of the leading word
+  ConjugationType conj_type{ConjugationType::None};            // Conjugation type of the lemma
+  bool auxiliary_chain{false};  // Leading word plus auxiliaries (食べました), analyzed as several tokens
+};
+
+/**
+ * @brief Conjugation index match at a text position
+ */
+struct ConjugatedLookupResult {
+  size_t length;  // Match length in characters
+  const ConjugatedSurface* surface;
+};
+
 /**
  * @brief Lookup result
  */
 struct LookupResult {
+  static constexpr uint32_t kNoSharedId = UINT32_MAX;
+
   uint32_t entry_id;
   size_t length;  // Match length in characters
   const DictionaryEntry* entry;
-  bool from_user_dict = false;  // True if from user dictionary (Layer 4)
+  bool from_user_dict = false;         // True if from user dictionary (Layer 4)
+  uint32_t shared_id = kNoSharedId;  // ID across the immutable layers 1-3 (see DictionaryManager::sharedEntryCount)
 };
 
 /**
@@ -77,8 +116,13 @@ class IDictionary {
   IDictionary(IDictionary&&) = delete;
   IDictionary& operator=(IDictionary&&) = delete;
 
+  /**
+   * @brief Process-unique identity of this instance (never reused)
+   */
+  uint64_t identity() const { return identity_; }
+
  protected:
-  IDictionary() = default;
+  IDictionary() : identity_(nextIdentity()) {}
 
   /**
    * @brief Lookup entries at position
@@ -99,6 +143,14 @@ class IDictionary {
    * @brief Get number of entries
    */
   virtual size_t size() const = 0;
+
+ private:
+  static uint64_t nextIdentity() {
+    static std::atomic<uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t identity_;
 };
 
 // Forward declarations
@@ -134,6 +186,26 @@ class DictionaryManager {
    */
   std::vector<LookupResult> lookup(std::string_view text, size_t start_pos) const;
 
+  /**
+   * @brief Find a conjugated surface in the binary dictionaries' conjugation indexes
+   * @param surface Exact surface to look up
+   * @return Conjugation info (user dictionary first), or nullptr if not indexed
+   */
+  const ConjugatedSurface* findConjugated(std::string_view surface) const;
+
+  /**
+   * @brief Find conjugated surfaces starting at a position
+   * @param text Text to search
+   * @param start_pos Start position in bytes
+   * @return Matches from the user dictionary, then the core dictionary
+   */
+  std::vector<ConjugatedLookupResult> lookupConjugated(std::string_view text, size_t start_pos) const;
+
+  /**
+   * @brief Check if any loaded binary dictionary carries a conjugation index
+   */
+  bool hasConjugationIndex() const;
+
   /**
    * @brief Get the core dictionary
    */
@@ -156,6 +228,12 @@ class DictionaryManager {
    */
   bool hasCoreBinaryDictionary() const;
 
+  /**
+   * @brief Get the core binary dictionary (shared through DictionaryRegistry)
+   * @return nullptr if none is loaded
+   */
+  const BinaryDictionary* coreBinaryDictionary() const { return core_binary_dict_.get(); }
+
   /**
    * @brief Load user binary dictionary from file
    * @param path File path
@@ -199,11 +277,41 @@ class DictionaryManager {
    */
   bool tryAutoLoadCoreDictionary();
 
+  /**
+   * @brief Number of entries in the immutable layers (core, core.dic, user.dic)
+   *
+   * LookupResult::shared_id is below this for entries from those layers, so
+   * per-entry data can live in a flat array. IDs are stable until generation()
+   * changes.
+   */
+  size_t sharedEntryCount() const;
+
+  /**
+   * @brief Dictionary set generation
+   *
+   * Identifies the set of loaded dictionaries across the whole process:
+   * managers holding the same dictionary instances report the same value,
+   * and any other set gets a different one (a 64-bit hash of the
+   * dictionary identities). Result caches shared between analyzers include
+   * it in their key.
+   */
+  uint64_t generation() const { return generation_; }
+
+  /**
+   * @brief Approximate heap usage of all loaded dictionaries
+   */
+  core::MemoryUsage memoryUsage() const;
+
  private:
-  std::unique_ptr<CoreDictionary> core_dict_;
-  std::unique_ptr<BinaryDictionary> core_binary_dict_;
-  std::unique_ptr<BinaryDictionary> user_binary_dict_;
+  // Immutable dictionaries, shared with other managers in the process
+  std::shared_ptr<const CoreDictionary> core_dict_;
+  std::shared_ptr<const BinaryDictionary> core_binary_dict_;
+  std::shared_ptr<const BinaryDictionary> user_binary_dict_;
   std::vector<std::shared_ptr<UserDictionary>> user_dicts_;
+  uint64_t generation_{0};
+
+  // Recompute generation_ after the dictionary set changed
+  void refreshGeneration();
 };
 
 }  // namespace suzume::dictionary
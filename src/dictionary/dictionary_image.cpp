@@ -0,0 +1,105 @@
+#include "dictionary/dictionary_image.h"
+
+#include <fstream>
+#include <utility>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#define SUZUME_DICTIONARY_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace suzume::dictionary {
+
+DictionaryImage::~DictionaryImage() { release(); }
+
+DictionaryImage::DictionaryImage(DictionaryImage&& other) noexcept
+    : owned_(std::move(other.owned_)), data_(other.data_), size_(other.size_), mapped_(other.mapped_) {
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.mapped_ = false;
+}
+
+DictionaryImage& DictionaryImage::operator=(DictionaryImage&& other) noexcept {
+  if (this != &other) {
+    release();
+    owned_ = std::move(other.owned_);
+    data_ = other.data_;
+    size_ = other.size_;
+    mapped_ = other.mapped_;
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.mapped_ = false;
+  }
+  return *this;
+}
+
+void DictionaryImage::release() {
+#ifdef SUZUME_DICTIONARY_MMAP
+  if (mapped_) {
+    munmap(const_cast<uint8_t*>(data_), size_);
+  }
+#endif
+  owned_.clear();
+  data_ = nullptr;
+  size_ = 0;
+  mapped_ = false;
+}
+
+core::Expected<DictionaryImage, core::Error> DictionaryImage::fromFile(const std::string& path) {
+#ifdef SUZUME_DICTIONARY_MMAP
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return core::makeUnexpected(core::Error(core::ErrorCode::FileNotFound, "Failed to open dictionary file: " + path));
+  }
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+    ::close(fd);
+    return core::makeUnexpected(core::Error(core::ErrorCode::InternalError, "Failed to read dictionary file: " + path));
+  }
+  auto file_size = static_cast<size_t>(file_stat.st_size);
+  if (file_size == 0) {
+    ::close(fd);
+    return DictionaryImage();
+  }
+  void* mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    return core::makeUnexpected(core::Error(core::ErrorCode::InternalError, "Failed to map dictionary file: " + path));
+  }
+  DictionaryImage image;
+  image.data_ = static_cast<const uint8_t*>(mapping);
+  image.size_ = file_size;
+  image.mapped_ = true;
+  return image;
+#else
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return core::makeUnexpected(core::Error(core::ErrorCode::FileNotFound, "Failed to open dictionary file: " + path));
+  }
+
+  size_t file_size = static_cast<size_t>(file.tellg());
+  file.seekg(0);
+
+  DictionaryImage image;
+  image.owned_.resize(file_size);
+  if (!file.read(reinterpret_cast<char*>(image.owned_.data()), static_cast<std::streamsize>(file_size))) {
+    return core::makeUnexpected(core::Error(core::ErrorCode::InternalError, "Failed to read dictionary file: " + path));
+  }
+  image.data_ = image.owned_.data();
+  image.size_ = file_size;
+  return image;
+#endif
+}
+
+DictionaryImage DictionaryImage::fromMemory(const uint8_t* data, size_t size) {
+  DictionaryImage image;
+  image.owned_.assign(data, data + size);
+  image.data_ = image.owned_.data();
+  image.size_ = size;
+  return image;
+}
+
+}  // namespace suzume::dictionary
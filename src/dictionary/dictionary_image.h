@@ -0,0 +1,60 @@
+#ifndef SUZUME_DICTIONARY_DICTIONARY_IMAGE_H_
+#define SUZUME_DICTIONARY_DICTIONARY_IMAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/error.h"
+
+namespace suzume::dictionary {
+
+/**
+ * @brief Read-only bytes of a compiled dictionary
+ *
+ * Files are memory-mapped where the platform supports it, so loading does
+ * not copy the image and only the pages a lookup reaches are read in.
+ * Otherwise (Windows, WASM) the file is read into an owned buffer. The
+ * bytes keep their address when the image is moved.
+ */
+class DictionaryImage {
+ public:
+  DictionaryImage() = default;
+  ~DictionaryImage();
+
+  DictionaryImage(const DictionaryImage&) = delete;
+  DictionaryImage& operator=(const DictionaryImage&) = delete;
+  DictionaryImage(DictionaryImage&& other) noexcept;
+  DictionaryImage& operator=(DictionaryImage&& other) noexcept;
+
+  /**
+   * @brief Map (or read) a file
+   */
+  static core::Expected<DictionaryImage, core::Error> fromFile(const std::string& path);
+
+  /**
+   * @brief Copy bytes into an owned image
+   */
+  static DictionaryImage fromMemory(const uint8_t* data, size_t size);
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  /**
+   * @brief Check if the bytes are a file mapping rather than a heap buffer
+   */
+  bool isMapped() const { return mapped_; }
+
+ private:
+  void release();
+
+  std::vector<uint8_t> owned_;  // Heap copy when not mapped
+  const uint8_t* data_{nullptr};
+  size_t size_{0};
+  bool mapped_{false};
+};
+
+}  // namespace suzume::dictionary
+
+#endif  // SUZUME_DICTIONARY_DICTIONARY_IMAGE_H_
@@ -0,0 +1,98 @@
+#include "dictionary/dictionary_registry.h"
+
+#include <tuple>
+#ifndef __EMSCRIPTEN__
+#include <filesystem>
+#include <system_error>
+#endif
+
+namespace suzume::dictionary {
+
+bool DictionaryRegistry::FileKey::operator<(const FileKey& other) const {
+  return std::tie(path, size, mtime) < std::tie(other.path, other.size, other.mtime);
+}
+
+DictionaryRegistry& DictionaryRegistry::instance() {
+  static DictionaryRegistry registry;
+  return registry;
+}
+
+core::Expected<std::shared_ptr<const BinaryDictionary>, core::Error> DictionaryRegistry::acquire(
+    const std::string& path) {
+  auto load = [&path]() -> core::Expected<std::shared_ptr<const BinaryDictionary>, core::Error> {
+    auto dict = std::make_shared<BinaryDictionary>();
+    auto result = dict->loadFromFile(path);
+    if (!result.hasValue()) {
+      return result.error();
+    }
+    return std::shared_ptr<const BinaryDictionary>(std::move(dict));
+  };
+
+#ifdef __EMSCRIPTEN__
+  // No stable file identity on the virtual filesystem: load a private copy
+  return load();
+#else
+  namespace fs = std::filesystem;
+
+  std::error_code err;
+  FileKey key;
+  key.path = fs::canonical(path, err).string();
+  if (!err) {
+    key.size = fs::file_size(key.path, err);
+  }
+  if (!err) {
+    key.mtime = static_cast<int64_t>(fs::last_write_time(key.path, err).time_since_epoch().count());
+  }
+  if (err) {
+    return load();  // Let the loader report the error
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = entries_.find(key);
+    if (found != entries_.end()) {
+      if (auto shared = found->second.lock()) {
+        return shared;
+      }
+    }
+  }
+
+  // Load without holding the lock; if another thread won the race, use its copy
+  auto loaded = load();
+  if (!loaded.hasValue()) {
+    return loaded;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  pruneLocked();
+  auto& slot = entries_[key];
+  if (auto shared = slot.lock()) {
+    return shared;
+  }
+  slot = loaded.value();
+  return loaded;
+#endif
+}
+
+size_t DictionaryRegistry::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t alive = 0;
+  for (const auto& [key, dict] : entries_) {
+    if (!dict.expired()) {
+      ++alive;
+    }
+  }
+  return alive;
+}
+
+void DictionaryRegistry::pruneLocked() {
+  for (auto iter = entries_.begin(); iter != entries_.end();) {
+    if (iter->second.expired()) {
+      iter = entries_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+}  // namespace suzume::dictionary
@@ -0,0 +1,60 @@
+#ifndef SUZUME_DICTIONARY_DICTIONARY_REGISTRY_H_
+#define SUZUME_DICTIONARY_DICTIONARY_REGISTRY_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "core/error.h"
+#include "dictionary/binary_dict.h"
+
+namespace suzume::dictionary {
+
+/**
+ * @brief Process-wide cache of loaded binary dictionaries
+ *
+ * Analyzers that load the same .dic file share one immutable instance.
+ * Files are identified by canonical path, size and modification time, so a
+ * rewritten file is loaded afresh while analyzers holding the old instance
+ * keep using it. The registry only holds weak references: a dictionary is
+ * freed as soon as the last analyzer using it is destroyed.
+ */
+class DictionaryRegistry {
+ public:
+  /**
+   * @brief Get the process-wide registry
+   */
+  static DictionaryRegistry& instance();
+
+  /**
+   * @brief Get a shared dictionary for a file, loading it if needed
+   * @param path File path
+   * @return Shared dictionary on success, error on failure
+   */
+  core::Expected<std::shared_ptr<const BinaryDictionary>, core::Error> acquire(const std::string& path);
+
+  /**
+   * @brief Number of dictionaries currently alive in the registry
+   */
+  size_t size() const;
+
+ private:
+  struct FileKey {
+    std::string path;
+    uintmax_t size{0};
+    int64_t mtime{0};
+
+    bool operator<(const FileKey& other) const;
+  };
+
+  mutable std::mutex mutex_;
+  std::map<FileKey, std::weak_ptr<const BinaryDictionary>> entries_;
+
+  void pruneLocked();
+};
+
+}  // namespace suzume::dictionary
+
+#endif  // SUZUME_DICTIONARY_DICTIONARY_REGISTRY_H_
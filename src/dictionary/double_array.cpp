@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <numeric>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace suzume::dictionary {
 
@@ -12,10 +14,54 @@ namespace {
 constexpr size_t kInitialSize = 8192;
 constexpr size_t kBlockSize = 256;
 
+// Codepoint labels follow the 256 byte labels (0 doubles as the terminator)
+constexpr uint32_t kFirstCodepointLabel = 256;
+constexpr size_t kMaxCodepointLabels = std::numeric_limits<uint16_t>::max() + 1 - kFirstCodepointLabel;
+// A codepoint gets a label only if this many keys contain it
+constexpr size_t kMinLabelKeys = 2;
+constexpr size_t kLabelPageCount = 0x110000 >> 8;
+
 inline uint8_t toByte(char chr) {
   return static_cast<uint8_t>(chr);
 }
 
+/**
+ * @brief Decode a well-formed multi-byte UTF-8 sequence
+ * @return Sequence length, or 0 for ASCII and malformed, overlong or
+ *         truncated sequences (these keep byte labels)
+ */
+inline size_t decodeSequence(std::string_view text, size_t pos, char32_t& codepoint) {
+  uint8_t lead = toByte(text[pos]);
+  size_t len = 0;
+  char32_t min_value = 0;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    len = 2;
+    codepoint = lead & 0x1F;
+    min_value = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    len = 3;
+    codepoint = lead & 0x0F;
+    min_value = 0x800;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    len = 4;
+    codepoint = lead & 0x07;
+    min_value = 0x10000;
+  } else {
+    return 0;
+  }
+  if (text.size() - pos < len) {
+    return 0;
+  }
+  for (size_t idx = 1; idx < len; ++idx) {
+    uint8_t byte = toByte(text[pos + idx]);
+    if ((byte & 0xC0) != 0x80) {
+      return 0;
+    }
+    codepoint = (codepoint << 6) | (byte & 0x3F);
+  }
+  return codepoint >= min_value && codepoint < 0x110000 ? len : 0;
+}
+
 }  // namespace
 
 // BuildState implementation
@@ -30,7 +76,7 @@ void DoubleArray::BuildState::resize(size_t new_size) {
   }
 }
 
-size_t DoubleArray::BuildState::findBase(const std::vector<uint8_t>& children) {
+size_t DoubleArray::BuildState::findBase(const std::vector<uint32_t>& children) {
   if (children.empty()) {
     return 0;
   }
@@ -41,7 +87,7 @@ size_t DoubleArray::BuildState::findBase(const std::vector<uint8_t>& children) {
   for (size_t base_cand = std::max(next_check_pos, first_child); base_cand < units.size() + kBlockSize; ++base_cand) {
     // Check if all children positions are available
     bool all_empty = true;
-    for (uint8_t child : children) {
+    for (uint32_t child : children) {
       size_t pos = base_cand ^ child;
       if (pos < units.size() && used[pos]) {
         all_empty = false;
@@ -60,7 +106,7 @@ size_t DoubleArray::BuildState::findBase(const std::vector<uint8_t>& children) {
 // DoubleArray implementation
 DoubleArray::DoubleArray() = default;
 
-bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<int32_t>& values) {
+bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<int32_t>& values, Labels labels) {
   if (keys.size() != values.size()) {
     return false;
   }
@@ -82,6 +128,36 @@ bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<
     }
   }
 
+  clear();
+  labels_ = labels;
+  if (labels == Labels::Codepoints) {
+    assignCodepointLabels(keys);
+  }
+
+  // Encode keys as label strings. Byte labels keep the key order; codepoint
+  // labels need a re-sort (the encoding is injective, so keys stay unique).
+  std::vector<LabelString> label_keys(keys.size());
+  for (size_t idx = 0; idx < keys.size(); ++idx) {
+    const std::string& key = keys[idx];
+    for (size_t pos = 0; pos < key.size();) {
+      uint32_t label = 0;
+      pos += nextLabel(key, pos, label);
+      label_keys[idx].push_back(label);
+    }
+  }
+  std::vector<int32_t> label_values = values;
+  if (!label_codepoints_.empty()) {
+    std::vector<size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return label_keys[lhs] < label_keys[rhs]; });
+    std::vector<LabelString> sorted_keys(keys.size());
+    for (size_t idx = 0; idx < order.size(); ++idx) {
+      sorted_keys[idx] = std::move(label_keys[order[idx]]);
+      label_values[idx] = values[order[idx]];
+    }
+    label_keys = std::move(sorted_keys);
+  }
+
   // Initialize build state
   BuildState state;
   state.resize(kInitialSize);
@@ -89,7 +165,7 @@ bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<
 
   // Build recursively starting from root
   try {
-    buildRecursive(state, keys, values, 0, keys.size(), 0, 0);
+    buildRecursive(state, label_keys, label_values, 0, label_keys.size(), 0, 0);
   } catch (const std::exception&) {
     clear();
     return false;
@@ -97,6 +173,8 @@ bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<
 
   // Transfer result
   units_ = std::move(state.units);
+  unit_data_ = units_.data();
+  unit_count_ = units_.size();
 
   // Shrink to fit
   size_t last_used = 0;
@@ -108,12 +186,14 @@ bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<
   }
   if (last_used > 0) {
     units_.resize(last_used);
+    unit_count_ = last_used;
   }
 
+  buildRootChildren();
   return true;
 }
 
-bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<uint32_t>& values) {
+bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<uint32_t>& values, Labels labels) {
   std::vector<int32_t> signed_values(values.size());
   for (size_t idx = 0; idx < values.size(); ++idx) {
     if (values[idx] > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())) {
@@ -121,10 +201,104 @@ bool DoubleArray::build(const std::vector<std::string>& keys, const std::vector<
     }
     signed_values[idx] = static_cast<int32_t>(values[idx]);
   }
-  return build(keys, signed_values);
+  return build(keys, signed_values, labels);
 }
 
-void DoubleArray::buildRecursive(BuildState& state, const std::vector<std::string>& keys,
+void DoubleArray::assignCodepointLabels(const std::vector<std::string>& keys) {
+  // Count the keys containing each non-ASCII codepoint
+  std::unordered_map<char32_t, size_t> key_counts;
+  std::vector<char32_t> seen;
+  for (const std::string& key : keys) {
+    seen.clear();
+    for (size_t pos = 0; pos < key.size();) {
+      char32_t codepoint = 0;
+      size_t len = decodeSequence(key, pos, codepoint);
+      if (len == 0) {
+        ++pos;
+        continue;
+      }
+      if (std::find(seen.begin(), seen.end(), codepoint) == seen.end()) {
+        seen.push_back(codepoint);
+        ++key_counts[codepoint];
+      }
+      pos += len;
+    }
+  }
+
+  std::vector<std::pair<size_t, char32_t>> ranked;
+  for (const auto& [codepoint, count] : key_counts) {
+    if (count >= kMinLabelKeys) {
+      ranked.emplace_back(count, codepoint);
+    }
+  }
+  // Most frequent first; ties in codepoint order so builds are reproducible
+  std::sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+  });
+  if (ranked.size() > kMaxCodepointLabels) {
+    ranked.resize(kMaxCodepointLabels);
+  }
+
+  std::vector<char32_t> codepoints;
+  codepoints.reserve(ranked.size());
+  for (const auto& entry : ranked) {
+    codepoints.push_back(entry.second);
+  }
+  setCodepointLabels(std::move(codepoints));
+}
+
+void DoubleArray::setCodepointLabels(std::vector<char32_t> codepoints) {
+  label_codepoints_ = std::move(codepoints);
+  label_page_index_.assign(kLabelPageCount, 0);
+  label_pages_.assign(kBlockSize, 0);  // Page 0 maps everything to byte labels
+  for (size_t idx = 0; idx < label_codepoints_.size(); ++idx) {
+    char32_t codepoint = label_codepoints_[idx];
+    uint16_t& page = label_page_index_[codepoint >> 8];
+    if (page == 0) {
+      page = static_cast<uint16_t>(label_pages_.size() / kBlockSize);
+      label_pages_.resize(label_pages_.size() + kBlockSize, 0);
+    }
+    label_pages_[(static_cast<size_t>(page) << 8) | (codepoint & 0xFF)] =
+        static_cast<uint16_t>(kFirstCodepointLabel + idx);
+  }
+}
+
+void DoubleArray::buildRootChildren() {
+  // Root children are the only units whose check is 0; unused units also
+  // have check 0 but no base or value
+  root_children_.assign(kFirstCodepointLabel + label_codepoints_.size(), 0);
+  if (unit_count_ == 0) {
+    return;
+  }
+  size_t base_val = unit_data_[0].base();
+  for (size_t label = 1; label < root_children_.size(); ++label) {
+    size_t child_pos = base_val ^ label;
+    if (child_pos != 0 && child_pos < unit_count_ && unit_data_[child_pos].check == 0 &&
+        unit_data_[child_pos].base_or_value != 0) {
+      root_children_[label] = static_cast<uint32_t>(child_pos);
+    }
+  }
+}
+
+size_t DoubleArray::nextLabel(std::string_view text, size_t pos, uint32_t& label) const {
+  uint8_t lead = toByte(text[pos]);
+  if (lead >= 0x80 && !label_codepoints_.empty()) {
+    char32_t codepoint = 0;
+    size_t len = decodeSequence(text, pos, codepoint);
+    if (len != 0) {
+      uint16_t cp_label = label_pages_[(static_cast<size_t>(label_page_index_[codepoint >> 8]) << 8) |
+                                       (codepoint & 0xFF)];
+      if (cp_label != 0) {
+        label = cp_label;
+        return len;
+      }
+    }
+  }
+  label = lead;
+  return 1;
+}
+
+void DoubleArray::buildRecursive(BuildState& state, const std::vector<LabelString>& keys,
                                  const std::vector<int32_t>& values, size_t begin, size_t end, size_t depth,
                                  size_t parent_pos) {
   if (begin >= end) {
@@ -132,7 +306,7 @@ void DoubleArray::buildRecursive(BuildState& state, const std::vector<std::strin
   }
 
   // Collect unique children at current depth
-  std::vector<uint8_t> children;
+  std::vector<uint32_t> children;
   size_t leaf_begin = begin;
   size_t leaf_end = begin;
 
@@ -147,10 +321,10 @@ void DoubleArray::buildRecursive(BuildState& state, const std::vector<std::strin
   }
 
   // Collect other children
-  uint8_t prev_char = 0;
+  uint32_t prev_char = 0;
   bool first = true;
   for (size_t idx = leaf_end; idx < end; ++idx) {
-    uint8_t chr = toByte(keys[idx][depth]);
+    uint32_t chr = keys[idx][depth];
     if (first || chr != prev_char) {
       children.push_back(chr);
       prev_char = chr;
@@ -167,7 +341,7 @@ void DoubleArray::buildRecursive(BuildState& state, const std::vector<std::strin
 
   // Ensure array is large enough
   size_t max_pos = base_val;
-  for (uint8_t child : children) {
+  for (uint32_t child : children) {
     max_pos = std::max(max_pos, base_val ^ child);
   }
   if (max_pos >= state.units.size()) {
@@ -178,7 +352,7 @@ void DoubleArray::buildRecursive(BuildState& state, const std::vector<std::strin
   state.units[parent_pos].setBase(static_cast<uint32_t>(base_val));
 
   // First pass: mark all children as used (before recursion!)
-  for (uint8_t chr : children) {
+  for (uint32_t chr : children) {
     size_t child_pos = base_val ^ chr;
     if (child_pos >= state.units.size()) {
       state.resize(child_pos + kBlockSize);
@@ -200,12 +374,12 @@ void DoubleArray::buildRecursive(BuildState& state, const std::vector<std::strin
   // Handle other children
   size_t range_begin = leaf_end;
   for (size_t cidx = child_idx; cidx < children.size(); ++cidx) {
-    uint8_t chr = children[cidx];
+    uint32_t chr = children[cidx];
     size_t child_pos = base_val ^ chr;
 
     // Find range for this child
     size_t range_end = range_begin;
-    while (range_end < end && toByte(keys[range_end][depth]) == chr) {
+    while (range_end < end && keys[range_end][depth] == chr) {
       ++range_end;
     }
 
@@ -222,65 +396,41 @@ void DoubleArray::buildRecursive(BuildState& state, const std::vector<std::strin
 }
 
 int32_t DoubleArray::exactMatch(std::string_view key) const {
-  if (units_.empty()) {
+  if (unit_count_ == 0) {
     return -1;
   }
 
   size_t node_pos = 0;
 
-  for (char idx : key) {
-    uint8_t chr = toByte(idx);
-    size_t base_val = units_[node_pos].base();
-    size_t child_pos = base_val ^ chr;
-
-    if (child_pos >= units_.size()) {
-      return -1;
-    }
-
-    if (units_[child_pos].check != node_pos) {
+  for (size_t idx = 0; idx < key.size();) {
+    uint32_t label = 0;
+    idx += nextLabel(key, idx, label);
+    node_pos = child(node_pos, label);
+    if (node_pos == 0) {
       return -1;
     }
-
-    node_pos = child_pos;
   }
 
   // Check for null terminator (leaf)
-  size_t base_val = units_[node_pos].base();
-  size_t leaf_pos = base_val ^ 0;
-
-  if (leaf_pos >= units_.size()) {
-    return -1;
-  }
-
-  if (units_[leaf_pos].check != node_pos) {
-    return -1;
-  }
-
-  if (!units_[leaf_pos].hasLeaf()) {
-    return -1;
-  }
-
-  return units_[leaf_pos].value();
+  return leafValue(node_pos);
 }
 
 std::vector<DoubleArray::Result> DoubleArray::commonPrefixSearch(std::string_view text, size_t start,
                                                                  size_t max_results) const {
   std::vector<Result> results;
 
-  if (units_.empty() || start >= text.size()) {
+  if (unit_count_ == 0 || start >= text.size()) {
     return results;
   }
 
   size_t node_pos = 0;
 
-  for (size_t idx = start; idx <= text.size(); ++idx) {
+  for (size_t idx = start; idx <= text.size();) {
     // Check for null terminator (leaf) at current position
-    size_t base_val = units_[node_pos].base();
-    size_t leaf_pos = base_val ^ 0;
-
-    if (leaf_pos < units_.size() && units_[leaf_pos].check == node_pos && units_[leaf_pos].hasLeaf()) {
+    int32_t value = leafValue(node_pos);
+    if (value >= 0) {
       Result res{};
-      res.value = units_[leaf_pos].value();
+      res.value = value;
       res.length = idx - start;
       results.push_back(res);
 
@@ -295,35 +445,64 @@ std::vector<DoubleArray::Result> DoubleArray::commonPrefixSearch(std::string_vie
     }
 
     // Transition to next node
-    uint8_t chr = toByte(text[idx]);
-    size_t child_pos = base_val ^ chr;
-
-    if (child_pos >= units_.size() || units_[child_pos].check != node_pos) {
+    uint32_t label = 0;
+    idx += nextLabel(text, idx, label);
+    node_pos = child(node_pos, label);
+    if (node_pos == 0) {
       break;
     }
-
-    node_pos = child_pos;
   }
 
   return results;
 }
 
+DoubleArray& DoubleArray::operator=(DoubleArray&& other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+  units_ = std::move(other.units_);
+  unit_data_ = other.unit_data_;
+  unit_count_ = other.unit_count_;
+  labels_ = other.labels_;
+  label_codepoints_ = std::move(other.label_codepoints_);
+  label_page_index_ = std::move(other.label_page_index_);
+  label_pages_ = std::move(other.label_pages_);
+  root_children_ = std::move(other.root_children_);
+  other.clear();
+  return *this;
+}
+
 void DoubleArray::clear() {
   units_.clear();
+  unit_data_ = nullptr;
+  unit_count_ = 0;
+  labels_ = Labels::Bytes;
+  label_codepoints_.clear();
+  label_page_index_.clear();
+  label_pages_.clear();
+  root_children_.clear();
 }
 
 size_t DoubleArray::memoryUsage() const {
-  return units_.size() * sizeof(Unit);
+  return units_.size() * sizeof(Unit) + label_codepoints_.size() * sizeof(char32_t) +
+         label_page_index_.size() * sizeof(uint16_t) + label_pages_.size() * sizeof(uint16_t) +
+         root_children_.size() * sizeof(uint32_t);
 }
 
 std::vector<uint8_t> DoubleArray::serialize() const {
   // Format:
-  // [4 bytes] magic "DA02"
+  // [4 bytes] magic "DA02" (byte labels) or "DA03" (codepoint labels)
   // [4 bytes] number of units
+  // DA03 only:
+  //   [4 bytes] number of codepoint labels
+  //   [labels * 4 bytes] codepoint of each label, in label order
   // [units * 8 bytes] unit data (base_or_value, check)
 
-  size_t num_units = units_.size();
-  size_t total_size = 8 + num_units * sizeof(Unit);
+  bool codepoints = labels_ == Labels::Codepoints;
+  size_t num_units = unit_count_;
+  size_t num_labels = label_codepoints_.size();
+  size_t label_size = codepoints ? 4 + num_labels * sizeof(char32_t) : 0;
+  size_t total_size = 8 + label_size + num_units * sizeof(Unit);
 
   std::vector<uint8_t> data(total_size);
   uint8_t* ptr = data.data();
@@ -332,7 +511,7 @@ std::vector<uint8_t> DoubleArray::serialize() const {
   ptr[0] = 'D';
   ptr[1] = 'A';
   ptr[2] = '0';
-  ptr[3] = '2';
+  ptr[3] = codepoints ? '3' : '2';
   ptr += 4;
 
   // Number of units
@@ -340,13 +519,28 @@ std::vector<uint8_t> DoubleArray::serialize() const {
   std::memcpy(ptr, &num, 4);
   ptr += 4;
 
+  // Codepoint labels
+  if (codepoints) {
+    auto count = static_cast<uint32_t>(num_labels);
+    std::memcpy(ptr, &count, 4);
+    ptr += 4;
+    std::memcpy(ptr, label_codepoints_.data(), num_labels * sizeof(char32_t));
+    ptr += num_labels * sizeof(char32_t);
+  }
+
   // Unit data
-  std::memcpy(ptr, units_.data(), num_units * sizeof(Unit));
+  if (num_units > 0) {
+    std::memcpy(ptr, unit_data_, num_units * sizeof(Unit));
+  }
 
   return data;
 }
 
-bool DoubleArray::deserialize(const uint8_t* data, size_t size) {
+bool DoubleArray::deserialize(const uint8_t* data, size_t size) { return deserializeImpl(data, size, false); }
+
+bool DoubleArray::deserializeView(const uint8_t* data, size_t size) { return deserializeImpl(data, size, true); }
+
+bool DoubleArray::deserializeImpl(const uint8_t* data, size_t size, bool view) {
   if (data == nullptr) {
     return false;
   }
@@ -356,23 +550,64 @@ bool DoubleArray::deserialize(const uint8_t* data, size_t size) {
   }
 
   // Check magic
-  if (data[0] != 'D' || data[1] != 'A' || data[2] != '0' || data[3] != '2') {
+  if (data[0] != 'D' || data[1] != 'A' || data[2] != '0' || (data[3] != '2' && data[3] != '3')) {
     return false;
   }
+  bool codepoints = data[3] == '3';
 
   // Read number of units
   uint32_t num_units = 0;
   std::memcpy(&num_units, data + 4, 4);
+  size_t offset = 8;
+
+  // Read codepoint labels
+  std::vector<char32_t> loaded_codepoints;
+  if (codepoints) {
+    if (size - offset < 4) {
+      return false;
+    }
+    uint32_t num_labels = 0;
+    std::memcpy(&num_labels, data + offset, 4);
+    offset += 4;
+    if (num_labels > kMaxCodepointLabels || static_cast<size_t>(num_labels) > (size - offset) / sizeof(char32_t)) {
+      return false;
+    }
+    loaded_codepoints.resize(num_labels);
+    std::memcpy(loaded_codepoints.data(), data + offset, static_cast<size_t>(num_labels) * sizeof(char32_t));
+    offset += static_cast<size_t>(num_labels) * sizeof(char32_t);
+
+    // Labels must be distinct non-ASCII codepoints
+    std::vector<char32_t> sorted = loaded_codepoints;
+    std::sort(sorted.begin(), sorted.end());
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end() ||
+        (!sorted.empty() && (sorted.front() < 0x80 || sorted.back() >= 0x110000))) {
+      return false;
+    }
+  }
 
   // Validate size
-  if (static_cast<size_t>(num_units) > (size - 8) / sizeof(Unit)) {
+  if (static_cast<size_t>(num_units) > (size - offset) / sizeof(Unit)) {
     return false;
   }
 
-  // Read units
-  std::vector<Unit> loaded_units(num_units);
-  std::memcpy(loaded_units.data(), data + 8, static_cast<size_t>(num_units) * sizeof(Unit));
+  // Read units (in place when viewing aligned data)
+  const uint8_t* unit_bytes = data + offset;
+  view = view && reinterpret_cast<uintptr_t>(unit_bytes) % alignof(Unit) == 0;
+  std::vector<Unit> loaded_units;
+  if (!view) {
+    loaded_units.resize(num_units);
+    std::memcpy(loaded_units.data(), unit_bytes, static_cast<size_t>(num_units) * sizeof(Unit));
+  }
+
+  clear();
   units_ = std::move(loaded_units);
+  unit_data_ = view ? reinterpret_cast<const Unit*>(unit_bytes) : units_.data();
+  unit_count_ = num_units;
+  if (codepoints) {
+    labels_ = Labels::Codepoints;
+    setCodepointLabels(std::move(loaded_codepoints));
+  }
+  buildRootChildren();
 
   return true;
 }
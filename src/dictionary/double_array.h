@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace suzume::dictionary {
@@ -18,6 +19,14 @@ namespace suzume::dictionary {
  * - O(m) lookup where m is key length
  * - Compact memory representation
  * - WASM compatible (contiguous memory arrays)
+ *
+ * Transitions are labelled with UTF-8 bytes by default. With
+ * Labels::Codepoints, non-ASCII codepoints shared by several keys get their
+ * own labels (most frequent first, so common kana and kanji have the smallest
+ * IDs), making a typical Japanese character one transition instead of three.
+ * ASCII, rare codepoints and malformed bytes keep byte labels, so a key
+ * ending in a truncated UTF-8 sequence only matches that same truncation.
+ * The first transition is resolved through a table indexed by label.
  */
 class DoubleArray {
  public:
@@ -29,29 +38,39 @@ class DoubleArray {
     size_t length;  // Match length in bytes
   };
 
+  /**
+   * @brief Transition label encoding
+   */
+  enum class Labels : uint8_t {
+    Bytes,       // One transition per UTF-8 byte
+    Codepoints,  // One transition per frequent non-ASCII codepoint
+  };
+
   DoubleArray();
   ~DoubleArray() = default;
 
   // Non-copyable, movable
   DoubleArray(const DoubleArray&) = delete;
   DoubleArray& operator=(const DoubleArray&) = delete;
-  DoubleArray(DoubleArray&&) noexcept = default;
-  DoubleArray& operator=(DoubleArray&&) noexcept = default;
+  DoubleArray(DoubleArray&& other) noexcept { *this = std::move(other); }
+  DoubleArray& operator=(DoubleArray&& other) noexcept;
 
   /**
    * @brief Build double-array from sorted key-value pairs
    * @param keys Sorted keys (must be sorted lexicographically)
    * @param values Values corresponding to each key
+   * @param labels Transition label encoding
    * @return true on success, false on failure
    *
    * @note Keys MUST be sorted. Unsorted keys will cause incorrect results.
    */
-  bool build(const std::vector<std::string>& keys, const std::vector<int32_t>& values);
+  bool build(const std::vector<std::string>& keys, const std::vector<int32_t>& values, Labels labels = Labels::Bytes);
 
   /**
    * @brief Build with uint32_t values (convenience overload)
    */
-  bool build(const std::vector<std::string>& keys, const std::vector<uint32_t>& values);
+  bool build(const std::vector<std::string>& keys, const std::vector<uint32_t>& values,
+             Labels labels = Labels::Bytes);
 
   /**
    * @brief Search for exact match
@@ -69,15 +88,47 @@ class DoubleArray {
    */
   std::vector<Result> commonPrefixSearch(std::string_view text, size_t start = 0, size_t max_results = 0) const;
 
+  /**
+   * @brief Follow the transition for one byte (Labels::Bytes tries)
+   * @param node Node position (0 = root), advanced on success
+   * @return false if there is no such transition
+   *
+   * For walking keys in an order other than front to back, e.g. a trie of
+   * reversed suffixes matched from the end of a string.
+   */
+  bool followByte(size_t& node, uint8_t byte) const {
+    size_t next = unit_count_ == 0 ? 0 : child(node, byte);
+    if (next == 0) {
+      return false;
+    }
+    node = next;
+    return true;
+  }
+
+  /**
+   * @brief Get the value of the key ending at a node reached by followByte(), or -1
+   */
+  int32_t valueAt(size_t node) const { return leafValue(node); }
+
   /**
    * @brief Get size of the double-array (number of units)
    */
-  size_t size() const { return units_.size(); }
+  size_t size() const { return unit_count_; }
 
   /**
    * @brief Check if the double-array is empty
    */
-  bool empty() const { return units_.empty(); }
+  bool empty() const { return unit_count_ == 0; }
+
+  /**
+   * @brief Get the transition label encoding
+   */
+  Labels labels() const { return labels_; }
+
+  /**
+   * @brief Get the number of codepoint labels (0 for Labels::Bytes)
+   */
+  size_t codepointLabelCount() const { return label_codepoints_.size(); }
 
   /**
    * @brief Clear the double-array
@@ -85,7 +136,7 @@ class DoubleArray {
   void clear();
 
   /**
-   * @brief Get memory usage in bytes
+   * @brief Get memory usage in bytes (units read from an external buffer are not counted)
    */
   size_t memoryUsage() const;
 
@@ -103,6 +154,20 @@ class DoubleArray {
    */
   bool deserialize(const uint8_t* data, size_t size);
 
+  /**
+   * @brief Deserialize, reading units in place from the serialized data
+   *
+   * Skips copying the unit array, which is most of the trie, so a trie
+   * embedded in the binary or a retained file image is usable without
+   * touching new memory. Falls back to a copy when the units are not
+   * suitably aligned.
+   *
+   * @param data Binary data (must outlive this object or its next deserialize/build/clear)
+   * @param size Data size
+   * @return true on success
+   */
+  bool deserializeView(const uint8_t* data, size_t size);
+
  private:
   /**
    * @brief Double-array unit (packed 32-bit)
@@ -126,7 +191,50 @@ class DoubleArray {
     void setLeaf(int32_t val) { base_or_value = (static_cast<uint32_t>(val) & 0x7FFFFFFF) | 0x80000000; }
   };
 
-  std::vector<Unit> units_;
+  using LabelString = std::vector<uint32_t>;
+
+  std::vector<Unit> units_;          // Owned units (empty for a view)
+  const Unit* unit_data_{nullptr};  // units_ or the viewed serialized units
+  size_t unit_count_{0};
+  Labels labels_{Labels::Bytes};
+  std::vector<char32_t> label_codepoints_;  // Codepoint of each codepoint label, in label order
+  std::vector<uint16_t> label_page_index_;  // Codepoint >> 8 -> page in label_pages_ (0 = no labels)
+  std::vector<uint16_t> label_pages_;       // 256-entry label pages (0 = byte labels); page 0 is empty
+  std::vector<uint32_t> root_children_;     // Node reached from the root by each label (0 = none)
+
+  /**
+   * @brief Get the label of the transition at a text position
+   * @return Number of bytes the transition consumes
+   */
+  size_t nextLabel(std::string_view text, size_t pos, uint32_t& label) const;
+
+  /**
+   * @brief Follow a transition
+   * @return Child node position, or 0 if there is none
+   */
+  size_t child(size_t node_pos, uint32_t label) const {
+    if (node_pos == 0) {
+      return label < root_children_.size() ? root_children_[label] : 0;
+    }
+    size_t child_pos = unit_data_[node_pos].base() ^ label;
+    return child_pos < unit_count_ && unit_data_[child_pos].check == node_pos ? child_pos : 0;
+  }
+
+  /**
+   * @brief Get the value stored for a key ending at a node, or -1
+   */
+  int32_t leafValue(size_t node_pos) const {
+    size_t leaf_pos = unit_data_[node_pos].base();  // base ^ 0 (terminator)
+    if (leaf_pos < unit_count_ && unit_data_[leaf_pos].check == node_pos && unit_data_[leaf_pos].hasLeaf()) {
+      return unit_data_[leaf_pos].value();
+    }
+    return -1;
+  }
+
+  void assignCodepointLabels(const std::vector<std::string>& keys);
+  void setCodepointLabels(std::vector<char32_t> codepoints);
+  void buildRootChildren();
+  bool deserializeImpl(const uint8_t* data, size_t size, bool view);
 
   // Build helpers
   struct BuildState {
@@ -135,10 +243,10 @@ class DoubleArray {
     size_t next_check_pos = 0;
 
     void resize(size_t new_size);
-    size_t findBase(const std::vector<uint8_t>& children);
+    size_t findBase(const std::vector<uint32_t>& children);
   };
 
-  void buildRecursive(BuildState& state, const std::vector<std::string>& keys, const std::vector<int32_t>& values,
+  void buildRecursive(BuildState& state, const std::vector<LabelString>& keys, const std::vector<int32_t>& values,
                       size_t begin, size_t end, size_t depth, size_t parent_pos);
 };
 
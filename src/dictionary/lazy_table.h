@@ -0,0 +1,91 @@
+#ifndef SUZUME_DICTIONARY_LAZY_TABLE_H_
+#define SUZUME_DICTIONARY_LAZY_TABLE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace suzume::dictionary {
+
+/**
+ * @brief Table of records decoded on first access
+ *
+ * Dictionaries keep their records in a serialized image and decode one
+ * into its in-memory form (strings and derived fields) only when a lookup
+ * reaches it, so loading touches no per-entry memory. Decoded values stay
+ * at a fixed address for the lifetime of the table, and concurrent readers
+ * may share it: each slot is published once under a lock and read with a
+ * single atomic load afterwards.
+ */
+template <typename T>
+class LazyTable {
+ public:
+  LazyTable() = default;
+
+  /**
+   * @brief Drop decoded values and size the table for count records
+   */
+  void reset(size_t count) {
+    state_ = count == 0 ? nullptr : std::make_unique<State>(count);
+    count_ = count;
+  }
+
+  /**
+   * @brief Number of records
+   */
+  size_t size() const { return count_; }
+
+  /**
+   * @brief Number of records decoded so far
+   */
+  size_t decodedCount() const {
+    if (!state_) {
+      return 0;
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->values.size();
+  }
+
+  /**
+   * @brief Approximate heap bytes (slots and decoded values, not their own heap data)
+   */
+  size_t memoryUsage() const { return count_ * sizeof(std::atomic<const T*>) + decodedCount() * sizeof(T); }
+
+  /**
+   * @brief Get a record, decoding it on first access
+   * @param idx Record index (must be < size())
+   * @param decode Callable returning the T for idx; called at most once per index
+   */
+  template <typename Decode>
+  const T* get(size_t idx, const Decode& decode) const {
+    const T* value = state_->slots[idx].load(std::memory_order_acquire);
+    if (value != nullptr) {
+      return value;
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    value = state_->slots[idx].load(std::memory_order_relaxed);
+    if (value == nullptr) {
+      value = &state_->values.emplace_back(decode(idx));
+      state_->slots[idx].store(value, std::memory_order_release);
+    }
+    return value;
+  }
+
+ private:
+  struct State {
+    explicit State(size_t count) : slots(new std::atomic<const T*>[count]()) {}
+
+    std::mutex mutex;
+    std::deque<T> values;                            // Decoded records (stable addresses)
+    std::unique_ptr<std::atomic<const T*>[]> slots;  // Record index -> decoded value
+  };
+
+  std::unique_ptr<State> state_;
+  size_t count_{0};
+};
+
+}  // namespace suzume::dictionary
+
+#endif  // SUZUME_DICTIONARY_LAZY_TABLE_H_
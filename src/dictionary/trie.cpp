@@ -64,6 +64,26 @@ std::vector<std::pair<size_t, std::vector<uint32_t>>> Trie::prefixMatch(std::str
   return results;
 }
 
+size_t Trie::memoryUsage() const {
+  // Per child: the map node (key, owning pointer, next link) plus the child itself
+  constexpr size_t kChildNodeBytes = sizeof(char32_t) + sizeof(std::unique_ptr<TrieNode>) + sizeof(void*);
+  if (!root_) {
+    return 0;
+  }
+  size_t bytes = 0;
+  std::vector<const TrieNode*> pending{root_.get()};
+  while (!pending.empty()) {
+    const TrieNode* node = pending.back();
+    pending.pop_back();
+    bytes += sizeof(TrieNode) + node->entry_ids.capacity() * sizeof(uint32_t) +
+             node->children.bucket_count() * sizeof(void*) + node->children.size() * kChildNodeBytes;
+    for (const auto& [label, child] : node->children) {
+      pending.push_back(child.get());
+    }
+  }
+  return bytes;
+}
+
 void Trie::clear() {
   root_ = std::make_unique<TrieNode>();
   entry_count_ = 0;
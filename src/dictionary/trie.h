@@ -73,6 +73,11 @@ class Trie {
    */
   size_t size() const { return entry_count_; }
 
+  /**
+   * @brief Get memory usage in bytes (approximate; includes hash map nodes)
+   */
+  size_t memoryUsage() const;
+
   /**
    * @brief Clear the trie
    */
@@ -249,6 +249,13 @@ const DictionaryEntry* UserDictionary::getEntry(uint32_t idx) const {
   return nullptr;
 }
 
+core::MemoryUsage UserDictionary::memoryUsage() const {
+  core::MemoryUsage usage;
+  usage.dictionary_entries = entriesMemoryUsage(entries_);
+  usage.tries = trie_.memoryUsage();
+  return usage;
+}
+
 void UserDictionary::clear() {
   entries_.clear();
   trie_.clear();
@@ -70,6 +70,11 @@ class UserDictionary : public IDictionary {
    */
   size_t size() const override { return entries_.size(); }
 
+  /**
+   * @brief Approximate heap usage (entries and trie)
+   */
+  core::MemoryUsage memoryUsage() const;
+
   /**
    * @brief Clear all entries
    */
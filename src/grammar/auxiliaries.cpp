@@ -6,11 +6,27 @@
 #include "auxiliaries.h"
 
 #include "auxiliary_generator.h"
+#ifdef SUZUME_PREBUILT_TABLES
+#include "tables/builtin_tables.h"
+#endif
 
 namespace suzume::grammar {
 
 const std::vector<AuxiliaryEntry>& getAuxiliaries() {
+#ifdef SUZUME_PREBUILT_TABLES
+  static const std::vector<AuxiliaryEntry> kAuxiliaries = []() {
+    std::vector<AuxiliaryEntry> entries;
+    entries.reserve(tables::kAuxiliaryCount);
+    for (size_t idx = 0; idx < tables::kAuxiliaryCount; ++idx) {
+      const auto& record = tables::kAuxiliaries[idx];
+      entries.push_back(
+          {record.surface, record.reading, record.lemma, record.left_id, record.right_id, record.required_conn});
+    }
+    return entries;
+  }();
+#else
   static const std::vector<AuxiliaryEntry> kAuxiliaries = generateAllAuxiliaries();
+#endif
   return kAuxiliaries;
 }
 
@@ -54,14 +54,10 @@ std::vector<InflectionCandidate> Inflection::matchVerbStem(std::string_view rema
                                                            uint16_t required_conn) const {
   std::vector<InflectionCandidate> candidates;
   candidates.reserve(16);  // Typical max candidates
-  const auto& endings_by_conn = getVerbEndingsByConn();
-  auto iter = endings_by_conn.find(required_conn);
-  if (iter == endings_by_conn.end()) {
-    return candidates;
-  }
-  const auto& endings = iter->second;
+  const auto& all_endings = getVerbEndings();
 
-  for (const auto& ending : endings) {
+  for (uint16_t ending_idx : getVerbEndingsByConn(required_conn)) {
+    const auto& ending = all_endings[ending_idx];
     // Check if remaining ends with this verb ending
     if (remaining.size() < ending.suffix.size()) {
       continue;
@@ -382,8 +378,7 @@ const std::vector<InflectionCandidate>& Inflection::analyze(std::string_view sur
   // Early return for very short strings (less than 2 Japanese characters)
   // A conjugated verb needs at least stem + ending
   if (surface.size() < core::kTwoJapaneseCharBytes) {  // 2 Japanese chars = 6 bytes in UTF-8
-    auto [iter, inserted] = cache_.emplace(std::move(key), std::move(candidates));
-    return iter->second;
+    return storeInCache(std::move(key), std::move(candidates));
   }
 
   // First, try to match auxiliaries from the end
@@ -489,18 +484,42 @@ const std::vector<InflectionCandidate>& Inflection::analyze(std::string_view sur
     }
   }
 
-  // Evict cache if it grows too large (avoid unbounded memory growth)
-  if (cache_.size() > 50000) {
-    cache_.clear();
-  }
+  return storeInCache(std::move(key), std::move(candidates));
+}
 
-  // Cache the result
+const std::vector<InflectionCandidate>& Inflection::storeInCache(std::string key,
+                                                                 std::vector<InflectionCandidate> candidates) const {
   // Return reference to cached entry — safe because unordered_map references
   // are not invalidated by subsequent inserts.
   auto [iter, inserted] = cache_.emplace(std::move(key), std::move(candidates));
   return iter->second;
 }
 
+void Inflection::trimCache() const {
+  // Evict cache if it grows too large (avoid unbounded memory growth)
+  if (cache_.size() >= cache_capacity_) {
+    cache_.clear();
+    ++cache_generation_;
+  }
+}
+
+size_t Inflection::cacheMemoryUsage() const {
+  // Map node: key, value, next link and cached hash
+  constexpr size_t kNodeBytes = sizeof(std::string) + sizeof(std::vector<InflectionCandidate>) + 2 * sizeof(void*);
+  size_t bytes = cache_.bucket_count() * sizeof(void*);
+  for (const auto& [key, candidates] : cache_) {
+    bytes += kNodeBytes + key.capacity() + candidates.capacity() * sizeof(InflectionCandidate);
+    for (const auto& cand : candidates) {
+      bytes += cand.base_form.capacity() + cand.stem.capacity() + cand.suffix.capacity() +
+               cand.morphemes.capacity() * sizeof(std::string);
+      for (const auto& morpheme : cand.morphemes) {
+        bytes += morpheme.capacity();
+      }
+    }
+  }
+  return bytes;
+}
+
 bool Inflection::looksConjugated(std::string_view surface) const {
   return !analyze(surface).empty();
 }
@@ -11,6 +11,9 @@
 #ifndef SUZUME_GRAMMAR_INFLECTION_H_
 #define SUZUME_GRAMMAR_INFLECTION_H_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -27,13 +30,13 @@ namespace suzume::grammar {
  * @brief Analysis candidate from inflection analysis
  */
 struct InflectionCandidate {
-  std::string base_form;                ///< Inferred base form: 住む
-  std::string stem;                     ///< Stem: 住
-  std::string suffix;                   ///< Suffix chain: んでいます
-  VerbType verb_type;                   ///< Verb type: GodanMa
-  float confidence;                     ///< Confidence: 0.0-1.0
-  std::vector<std::string> morphemes;   ///< Decomposed: [ん, で, い, ます]
-  bool has_explanatory_suffix = false;  ///< True if matched via のだ/んだ stripping
+  std::string base_form;                   ///< Inferred base form: 住む
+  std::string stem;                        ///< Stem: 住
+  std::string suffix;                      ///< Suffix chain: んでいます
+  VerbType verb_type = VerbType::Unknown;  ///< Verb type: GodanMa
+  float confidence = 0.0F;                 ///< Confidence: 0.0-1.0
+  std::vector<std::string> morphemes;      ///< Decomposed: [ん, で, い, ます]
+  bool has_explanatory_suffix = false;     ///< True if matched via のだ/んだ stripping
 };
 
 /**
@@ -47,12 +50,23 @@ struct InflectionCandidate {
  */
 class Inflection {
  public:
+  /// Default maximum number of cached analyze() results
+  static constexpr size_t kDefaultCacheCapacity = 50000;
+  /// Smallest accepted capacity (a single chunk analyzes a few hundred spans)
+  static constexpr size_t kMinCacheCapacity = 1024;
+
   Inflection() = default;
 
+  /**
+   * @param cache_capacity Maximum number of cached analyze() results (raised
+   *        to kMinCacheCapacity), enforced by trimCache()
+   */
+  explicit Inflection(size_t cache_capacity) : cache_capacity_(std::max(cache_capacity, kMinCacheCapacity)) {}
+
   /**
    * @brief Analyze surface form and infer base form
    * @param surface Surface form: 住んでいます
-   * @return Candidates with possible base forms
+   * @return Candidates with possible base forms, valid until the next trimCache()
    */
   const std::vector<InflectionCandidate>& analyze(std::string_view surface) const;
 
@@ -66,6 +80,32 @@ class Inflection {
    */
   InflectionCandidate getBest(std::string_view surface) const;
 
+  /**
+   * @brief Drop the analyze() cache if it has reached its capacity
+   *
+   * Invalidates every reference returned by analyze(), so callers trim only
+   * where none is held (e.g. before analyzing a chunk); analyze() itself
+   * never evicts.
+   */
+  void trimCache() const;
+
+  /**
+   * @brief Cache generation, incremented whenever the analyze() cache is evicted
+   *
+   * References returned by analyze() stay valid while the generation is unchanged.
+   */
+  uint32_t cacheGeneration() const { return cache_generation_; }
+
+  /**
+   * @brief Maximum number of cached analyze() results
+   */
+  size_t cacheCapacity() const { return cache_capacity_; }
+
+  /**
+   * @brief Approximate heap usage of the analyze() cache
+   */
+  size_t cacheMemoryUsage() const;
+
  private:
   // Try matching auxiliary at end of surface
   std::vector<std::pair<const AuxiliaryEntry*, size_t>> matchAuxiliaries(std::string_view surface) const;
@@ -78,9 +118,15 @@ class Inflection {
   std::vector<InflectionCandidate> matchVerbStem(std::string_view remaining, const std::vector<std::string>& aux_chain,
                                                  uint16_t required_conn) const;
 
+  // Insert an analyze() result
+  const std::vector<InflectionCandidate>& storeInCache(std::string key,
+                                                       std::vector<InflectionCandidate> candidates) const;
+
   // Cache for analyze() results (mutable for const methods)
   // Note: single-threaded only. Add synchronization if multi-threading is needed.
   mutable std::unordered_map<std::string, std::vector<InflectionCandidate>> cache_;
+  mutable uint32_t cache_generation_{0};
+  size_t cache_capacity_{kDefaultCacheCapacity};
 };
 
 }  // namespace suzume::grammar
@@ -8,7 +8,12 @@
 
 #include "verb_endings.h"
 
+#include <algorithm>
+
 #include "normalize/utf8.h"
+#ifdef SUZUME_PREBUILT_TABLES
+#include "tables/builtin_tables.h"
+#endif
 
 namespace suzume::grammar {
 
@@ -112,33 +117,88 @@ const std::vector<VerbEnding> kIrregularEndings = {
 
 }  // namespace
 
-const std::vector<VerbEnding>& getVerbEndings() {
-  // Lazy initialization: generate Godan patterns and combine with irregulars
-  static const std::vector<VerbEnding> kEndings = []() {
-    std::vector<VerbEnding> all;
+std::vector<VerbEnding> buildVerbEndings() {
+  // Generate Godan patterns and combine with irregulars
+  std::vector<VerbEnding> all;
+
+  // Add generated Godan endings
+  auto godan = generateGodanEndings();
+  all.insert(all.end(), godan.begin(), godan.end());
 
-    // Add generated Godan endings
-    auto godan = generateGodanEndings();
-    all.insert(all.end(), godan.begin(), godan.end());
+  // Add irregular verb endings
+  all.insert(all.end(), kIrregularEndings.begin(), kIrregularEndings.end());
 
-    // Add irregular verb endings
-    all.insert(all.end(), kIrregularEndings.begin(), kIrregularEndings.end());
+  return all;
+}
 
+const std::vector<VerbEnding>& getVerbEndings() {
+#ifdef SUZUME_PREBUILT_TABLES
+  static const std::vector<VerbEnding> kEndings = []() {
+    std::vector<VerbEnding> all;
+    all.reserve(tables::kVerbEndingCount);
+    for (size_t idx = 0; idx < tables::kVerbEndingCount; ++idx) {
+      const auto& record = tables::kVerbEndings[idx];
+      all.push_back({record.suffix, record.base_suffix, static_cast<VerbType>(record.verb_type), record.provides_conn,
+                     record.is_onbin});
+    }
     return all;
   }();
-
+#else
+  static const std::vector<VerbEnding> kEndings = buildVerbEndings();
+#endif
   return kEndings;
 }
 
-const std::unordered_map<uint16_t, std::vector<VerbEnding>>& getVerbEndingsByConn() {
-  static const auto kGrouped = []() {
-    std::unordered_map<uint16_t, std::vector<VerbEnding>> grouped;
-    for (const auto& ending : getVerbEndings()) {
-      grouped[ending.provides_conn].push_back(ending);
+void groupVerbEndingsByConn(const std::vector<VerbEnding>& endings, std::vector<uint16_t>& indices,
+                            std::vector<VerbEndingGroupRange>& groups) {
+  indices.resize(endings.size());
+  for (size_t idx = 0; idx < endings.size(); ++idx) {
+    indices[idx] = static_cast<uint16_t>(idx);
+  }
+  std::stable_sort(indices.begin(), indices.end(), [&endings](uint16_t lhs, uint16_t rhs) {
+    return endings[lhs].provides_conn < endings[rhs].provides_conn;
+  });
+
+  groups.clear();
+  for (size_t idx = 0; idx < indices.size(); ++idx) {
+    uint16_t conn = endings[indices[idx]].provides_conn;
+    if (groups.empty() || groups.back().conn != conn) {
+      groups.push_back({conn, static_cast<uint16_t>(idx), 0});
     }
+    ++groups.back().count;
+  }
+}
+
+namespace {
+
+template <typename Range>
+VerbEndingGroup findGroup(const Range* groups, size_t count, const uint16_t* indices, uint16_t conn) {
+  const Range* groups_end = groups + count;
+  const Range* found =
+      std::lower_bound(groups, groups_end, conn, [](const Range& group, uint16_t key) { return group.conn < key; });
+  if (found == groups_end || found->conn != conn) {
+    return {};
+  }
+  return {indices + found->begin, indices + found->begin + found->count};
+}
+
+}  // namespace
+
+VerbEndingGroup getVerbEndingsByConn(uint16_t conn) {
+#ifdef SUZUME_PREBUILT_TABLES
+  return findGroup(tables::kVerbEndingGroups, tables::kVerbEndingGroupCount, tables::kVerbEndingsByConn, conn);
+#else
+  struct Grouped {
+    std::vector<uint16_t> indices;
+    std::vector<VerbEndingGroupRange> groups;
+  };
+  static const Grouped kGrouped = []() {
+    Grouped grouped;
+    groupVerbEndingsByConn(getVerbEndings(), grouped.indices, grouped.groups);
     return grouped;
   }();
-  return kGrouped;
+  return findGroup(kGrouped.groups.data(), kGrouped.groups.size(), kGrouped.indices.data(), conn);
+#endif
 }
 
 }  // namespace suzume::grammar
@@ -6,8 +6,8 @@
 #ifndef SUZUME_GRAMMAR_VERB_ENDINGS_H_
 #define SUZUME_GRAMMAR_VERB_ENDINGS_H_
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "conjugation.h"
@@ -29,6 +29,14 @@ struct VerbEnding {
   bool is_onbin;            ///< True if this is euphonic (音便) form
 };
 
+/**
+ * @brief Generate all verb ending patterns
+ *
+ * Used at build time by suzume-gen-tables, and on first use of
+ * getVerbEndings() when prebuilt tables are disabled.
+ */
+std::vector<VerbEnding> buildVerbEndings();
+
 /**
  * @brief Get all verb ending patterns for reverse lookup
  * @return Reference to static vector containing all verb endings
@@ -45,12 +53,44 @@ struct VerbEnding {
 const std::vector<VerbEnding>& getVerbEndings();
 
 /**
- * @brief Get verb endings grouped by provides_conn value for efficient lookup
- * @return Reference to static map from connection ID to matching verb endings
+ * @brief Indices into getVerbEndings() of the endings that provide one connection ID
+ */
+struct VerbEndingGroup {
+  const uint16_t* first{nullptr};
+  const uint16_t* last{nullptr};
+
+  const uint16_t* begin() const { return first; }
+  const uint16_t* end() const { return last; }
+};
+
+/**
+ * @brief Connection ID and index range of a group in groupVerbEndingsByConn() output
+ */
+struct VerbEndingGroupRange {
+  uint16_t conn;
+  uint16_t begin;
+  uint16_t count;
+};
+
+/**
+ * @brief Group verb endings by provides_conn
+ * @param endings Verb endings (getVerbEndings() order)
+ * @param indices Receives ending indices grouped by connection ID, in input order within a group
+ * @param groups Receives one range per connection ID, sorted by connection ID
+ *
+ * Used at build time by suzume-gen-tables, and on first use of
+ * getVerbEndingsByConn() when prebuilt tables are disabled.
+ */
+void groupVerbEndingsByConn(const std::vector<VerbEnding>& endings, std::vector<uint16_t>& indices,
+                            std::vector<VerbEndingGroupRange>& groups);
+
+/**
+ * @brief Get the verb endings that provide a connection ID
+ * @return Indices into getVerbEndings(), in order; empty if none provides conn
  *
  * Avoids scanning all ~120 endings when only a specific connection type is needed.
  */
-const std::unordered_map<uint16_t, std::vector<VerbEnding>>& getVerbEndingsByConn();
+VerbEndingGroup getVerbEndingsByConn(uint16_t conn);
 
 }  // namespace suzume::grammar
 
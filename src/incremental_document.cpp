@@ -0,0 +1,169 @@
+#include "incremental_document.h"
+
+#include <algorithm>
+
+#include "analysis/sentence_boundary.h"
+#include "normalize/utf8.h"
+#include "suzume.h"
+
+namespace suzume {
+
+IncrementalDocument::IncrementalDocument(const Suzume& suzume) : suzume_(suzume) {}
+
+void IncrementalDocument::setText(std::string_view text) {
+  text_.assign(text);
+  sentences_ = analyzeRange(0, text_.size(), 0);
+}
+
+core::Expected<size_t, core::Error> IncrementalDocument::applyEdit(size_t offset, size_t deleted_length,
+                                                                   std::string_view inserted_text) {
+  size_t doc_length = length();
+  if (offset > doc_length || deleted_length > doc_length - offset) {
+    return core::makeUnexpected(core::Error(core::ErrorCode::InvalidInput, "Edit range out of bounds"));
+  }
+  if (!normalize::isValidUtf8(inserted_text)) {
+    return core::makeUnexpected(core::Error(core::ErrorCode::InvalidUtf8, "Inserted text is not valid UTF-8"));
+  }
+
+  if (sentences_.empty()) {
+    setText(inserted_text);
+    return sentences_.size();
+  }
+
+  size_t edit_end = offset + deleted_length;
+  size_t first = findSentence(offset);
+  size_t last = findSentence(edit_end);
+  // A deletion that stops exactly at a sentence start leaves that sentence intact
+  if (last > first && sentences_[last].char_start == edit_end) {
+    --last;
+  }
+
+  auto byteOffsetIn = [this](const Sentence& sentence, size_t char_offset) {
+    std::string_view sentence_text = std::string_view(text_).substr(sentence.byte_start, sentence.byte_length);
+    return sentence.byte_start + normalize::charToByteOffset(sentence_text, char_offset - sentence.char_start);
+  };
+  size_t edit_byte_start = byteOffsetIn(sentences_[first], offset);
+  size_t edit_byte_end = byteOffsetIn(sentences_[last], edit_end);
+  size_t old_region_end = sentences_[last].byte_start + sentences_[last].byte_length;
+
+  text_.replace(edit_byte_start, edit_byte_end - edit_byte_start, inserted_text);
+
+  // Region to re-split, in post-edit byte coordinates
+  size_t region_start = sentences_[first].byte_start;
+  size_t region_end = old_region_end - (edit_byte_end - edit_byte_start) + inserted_text.size();
+
+  // If the edit removed a boundary (or inserted text without one at the end),
+  // the last sentence now runs into its successor: pull successors in until
+  // the region ends on a sentence boundary again.
+  size_t pos = region_start;
+  while (pos < region_end) {
+    pos = analysis::findSentenceEnd(text_, pos);
+    while (pos > region_end && last + 1 < sentences_.size()) {
+      ++last;
+      region_end += sentences_[last].byte_length;
+    }
+  }
+
+  auto replacement = analyzeRange(region_start, region_end, sentences_[first].char_start);
+  size_t reanalyzed = replacement.size();
+
+  sentences_.erase(sentences_.begin() + static_cast<std::ptrdiff_t>(first),
+                   sentences_.begin() + static_cast<std::ptrdiff_t>(last + 1));
+  sentences_.insert(sentences_.begin() + static_cast<std::ptrdiff_t>(first),
+                    std::make_move_iterator(replacement.begin()), std::make_move_iterator(replacement.end()));
+
+  // Shift the untouched sentences that follow
+  for (size_t idx = first + reanalyzed; idx < sentences_.size(); ++idx) {
+    if (idx == 0) {
+      sentences_[idx].byte_start = 0;
+      sentences_[idx].char_start = 0;
+      continue;
+    }
+    const auto& prev = sentences_[idx - 1];
+    sentences_[idx].byte_start = prev.byte_start + prev.byte_length;
+    sentences_[idx].char_start = prev.char_start + prev.char_length;
+  }
+
+  return reanalyzed;
+}
+
+size_t IncrementalDocument::length() const {
+  if (sentences_.empty()) {
+    return 0;
+  }
+  return sentences_.back().char_start + sentences_.back().char_length;
+}
+
+SentenceRange IncrementalDocument::sentenceRange(size_t index) const {
+  if (index >= sentences_.size()) {
+    return {};
+  }
+  const auto& sentence = sentences_[index];
+  return {sentence.char_start, sentence.char_start + sentence.char_length};
+}
+
+std::vector<core::Morpheme> IncrementalDocument::sentenceMorphemes(size_t index) const {
+  std::vector<core::Morpheme> result;
+  if (index < sentences_.size()) {
+    appendRebased(sentences_[index], result);
+  }
+  return result;
+}
+
+std::vector<core::Morpheme> IncrementalDocument::morphemes() const {
+  std::vector<core::Morpheme> result;
+  size_t total = 0;
+  for (const auto& sentence : sentences_) {
+    total += sentence.morphemes.size();
+  }
+  result.reserve(total);
+  for (const auto& sentence : sentences_) {
+    appendRebased(sentence, result);
+  }
+  return result;
+}
+
+std::vector<IncrementalDocument::Sentence> IncrementalDocument::analyzeRange(size_t byte_start, size_t byte_end,
+                                                                             size_t char_start) const {
+  std::vector<Sentence> result;
+  std::string_view text(text_);
+  size_t pos = byte_start;
+  while (pos < byte_end) {
+    size_t end = std::min(analysis::findSentenceEnd(text, pos), byte_end);
+    std::string_view sentence_text = text.substr(pos, end - pos);
+
+    Sentence sentence;
+    sentence.byte_start = pos;
+    sentence.byte_length = sentence_text.size();
+    sentence.char_start = char_start;
+    sentence.char_length = normalize::utf8Length(sentence_text);
+    sentence.morphemes = suzume_.analyze(sentence_text);
+
+    char_start += sentence.char_length;
+    pos = end;
+    result.push_back(std::move(sentence));
+  }
+  return result;
+}
+
+size_t IncrementalDocument::findSentence(size_t char_offset) const {
+  auto iter = std::upper_bound(sentences_.begin(), sentences_.end(), char_offset,
+                               [](size_t value, const Sentence& sentence) { return value < sentence.char_start; });
+  if (iter == sentences_.begin()) {
+    return 0;
+  }
+  return static_cast<size_t>(iter - sentences_.begin()) - 1;
+}
+
+void IncrementalDocument::appendRebased(const Sentence& sentence, std::vector<core::Morpheme>& out) {
+  for (const auto& morpheme : sentence.morphemes) {
+    core::Morpheme rebased = morpheme;
+    rebased.start += sentence.char_start;
+    rebased.end += sentence.char_start;
+    rebased.start_pos += sentence.char_start;
+    rebased.end_pos += sentence.char_start;
+    out.push_back(std::move(rebased));
+  }
+}
+
+}  // namespace suzume
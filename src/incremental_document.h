@@ -0,0 +1,124 @@
+#ifndef SUZUME_INCREMENTAL_DOCUMENT_H_
+#define SUZUME_INCREMENTAL_DOCUMENT_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/error.h"
+#include "core/morpheme.h"
+
+namespace suzume {
+
+class Suzume;
+
+/**
+ * @brief Character range of one sentence in an IncrementalDocument
+ */
+struct SentenceRange {
+  size_t start{0};  // Start character index (inclusive)
+  size_t end{0};    // End character index (exclusive)
+};
+
+/**
+ * @brief Document that keeps per-sentence analysis and re-analyzes on edit
+ *
+ * Intended for editor and IME integrations where the buffer changes by
+ * small edits. The text is split into sentences with the same boundary
+ * rules Analyzer uses for chunking (a sentence ends right after \n, !, ?,
+ * 。, ！ or ？). An edit re-analyzes only the sentences it touches;
+ * sentences after it are kept and only their offsets shift.
+ *
+ * All offsets are character (codepoint) indices, matching Morpheme::start
+ * and Morpheme::end.
+ *
+ * The referenced Suzume instance must outlive the document.
+ *
+ * @code
+ * Suzume suzume;
+ * IncrementalDocument doc(suzume);
+ * doc.setText("今日は晴れ。明日は雨。");
+ * doc.applyEdit(3, 2, "曇り");  // Only the first sentence is re-analyzed
+ * auto morphemes = doc.morphemes();
+ * @endcode
+ */
+class IncrementalDocument {
+ public:
+  explicit IncrementalDocument(const Suzume& suzume);
+
+  /**
+   * @brief Replace the whole text and analyze every sentence
+   * @param text UTF-8 text
+   */
+  void setText(std::string_view text);
+
+  /**
+   * @brief Apply an edit and re-analyze the affected sentences
+   * @param offset Character offset where the edit starts
+   * @param deleted_length Number of characters removed at offset
+   * @param inserted_text UTF-8 text inserted at offset
+   * @return Number of sentences re-analyzed, or error for an out-of-range
+   *         edit or invalid UTF-8 (the document is left unchanged)
+   */
+  core::Expected<size_t, core::Error> applyEdit(size_t offset, size_t deleted_length, std::string_view inserted_text);
+
+  /**
+   * @brief Current document text
+   */
+  const std::string& text() const { return text_; }
+
+  /**
+   * @brief Document length in characters
+   */
+  size_t length() const;
+
+  /**
+   * @brief Number of sentences
+   */
+  size_t sentenceCount() const { return sentences_.size(); }
+
+  /**
+   * @brief Character range of a sentence
+   */
+  SentenceRange sentenceRange(size_t index) const;
+
+  /**
+   * @brief Morphemes of one sentence (document offsets)
+   */
+  std::vector<core::Morpheme> sentenceMorphemes(size_t index) const;
+
+  /**
+   * @brief Morphemes of the whole document (document offsets)
+   */
+  std::vector<core::Morpheme> morphemes() const;
+
+ private:
+  struct Sentence {
+    size_t byte_start{0};
+    size_t byte_length{0};
+    size_t char_start{0};
+    size_t char_length{0};
+    std::vector<core::Morpheme> morphemes;  // Offsets relative to the sentence
+  };
+
+  const Suzume& suzume_;
+  std::string text_;
+  std::vector<Sentence> sentences_;
+
+  /**
+   * @brief Split bytes [byte_start, byte_end) into sentences and analyze them
+   */
+  std::vector<Sentence> analyzeRange(size_t byte_start, size_t byte_end, size_t char_start) const;
+
+  /**
+   * @brief Index of the sentence containing a character offset
+   */
+  size_t findSentence(size_t char_offset) const;
+
+  static void appendRebased(const Sentence& sentence, std::vector<core::Morpheme>& out);
+};
+
+}  // namespace suzume
+
+#endif  // SUZUME_INCREMENTAL_DOCUMENT_H_
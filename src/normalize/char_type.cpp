@@ -1,114 +1,131 @@
 #include "char_type.h"
 
-namespace suzume::normalize {
-
-CharType classifyChar(char32_t codepoint) {
-  // Hiragana: U+3040-U+309F
-  if (codepoint >= 0x3040 && codepoint <= 0x309F) {
-    return CharType::Hiragana;
-  }
-
-  // Katakana: U+30A0-U+30FF, U+31F0-U+31FF (small), U+FF66-U+FF9F (half-width)
-  if ((codepoint >= 0x30A0 && codepoint <= 0x30FF) || (codepoint >= 0x31F0 && codepoint <= 0x31FF) ||
-      (codepoint >= 0xFF66 && codepoint <= 0xFF9F)) {
-    return CharType::Katakana;
-  }
-
-  // Ideographic iteration mark (々) - treat as Kanji
-  // U+3005 repeats preceding kanji: 人々, 日々, 痛々しい
-  // Must check before CJK Symbols range (0x3000-0x303F)
-  if (codepoint == 0x3005) {
-    return CharType::Kanji;
-  }
-
-  // CJK Unified Ideographs (kanji)
-  if ((codepoint >= 0x4E00 && codepoint <= 0x9FFF) ||    // CJK Unified Ideographs
-      (codepoint >= 0x3400 && codepoint <= 0x4DBF) ||    // CJK Extension A
-      (codepoint >= 0x20000 && codepoint <= 0x2A6DF) ||  // CJK Extension B
-      (codepoint >= 0x2A700 && codepoint <= 0x2B73F) ||  // CJK Extension C
-      (codepoint >= 0x2B740 && codepoint <= 0x2B81F) ||  // CJK Extension D
-      (codepoint >= 0xF900 && codepoint <= 0xFAFF) ||    // CJK Compatibility Ideographs
-      (codepoint >= 0x2F00 && codepoint <= 0x2FDF)) {    // Kangxi Radicals
-    return CharType::Kanji;
-  }
-
-  // ASCII alphabet
-  if ((codepoint >= 'A' && codepoint <= 'Z') || (codepoint >= 'a' && codepoint <= 'z')) {
-    return CharType::Alphabet;
-  }
+#include <algorithm>
+#include <array>
+#include <iterator>
 
-  // Full-width alphabet
-  if ((codepoint >= 0xFF21 && codepoint <= 0xFF3A) || (codepoint >= 0xFF41 && codepoint <= 0xFF5A)) {
-    return CharType::Alphabet;
-  }
+namespace suzume::normalize {
 
-  // ASCII digits
-  if (codepoint >= '0' && codepoint <= '9') {
-    return CharType::Digit;
+namespace {
+
+/**
+ * @brief Codepoint range with a character type
+ */
+struct CharRange {
+  char32_t first;
+  char32_t last;
+  CharType type;
+};
+
+// Classification rules; the first matching range wins
+constexpr CharRange kCharRanges[] = {
+    {0x3040, 0x309F, CharType::Hiragana},  // Hiragana
+    {0x30A0, 0x30FF, CharType::Katakana},  // Katakana
+    {0x31F0, 0x31FF, CharType::Katakana},  // Katakana phonetic extensions (small)
+    {0xFF66, 0xFF9F, CharType::Katakana},  // Half-width katakana
+    {0x3005, 0x3005, CharType::Kanji},     // Iteration mark (々), before CJK Symbols
+    {0x4E00, 0x9FFF, CharType::Kanji},     // CJK Unified Ideographs
+    {0x3400, 0x4DBF, CharType::Kanji},     // CJK Extension A
+    {0x20000, 0x2A6DF, CharType::Kanji},   // CJK Extension B
+    {0x2A700, 0x2B73F, CharType::Kanji},   // CJK Extension C
+    {0x2B740, 0x2B81F, CharType::Kanji},   // CJK Extension D
+    {0xF900, 0xFAFF, CharType::Kanji},     // CJK Compatibility Ideographs
+    {0x2F00, 0x2FDF, CharType::Kanji},     // Kangxi Radicals
+    {U'A', U'Z', CharType::Alphabet},      // ASCII alphabet
+    {U'a', U'z', CharType::Alphabet},      // ASCII alphabet
+    {0xFF21, 0xFF3A, CharType::Alphabet},  // Full-width alphabet
+    {0xFF41, 0xFF5A, CharType::Alphabet},  // Full-width alphabet
+    {U'0', U'9', CharType::Digit},         // ASCII digits
+    {0xFF10, 0xFF19, CharType::Digit},     // Full-width digits
+    {0x3000, 0x303F, CharType::Symbol},    // CJK Symbols and Punctuation
+    {0xFF00, 0xFF0F, CharType::Symbol},    // Full-width symbols
+    {0x0020, 0x002F, CharType::Symbol},    // ASCII punctuation
+    {0x003A, 0x0040, CharType::Symbol},    // ASCII punctuation
+    {0x005B, 0x0060, CharType::Symbol},    // ASCII punctuation
+    {0x007B, 0x007E, CharType::Symbol},    // ASCII punctuation
+    // Emoji (Unicode 15.0+)
+    {0x1F600, 0x1F64F, CharType::Emoji},   // Emoticons
+    {0x1F300, 0x1F5FF, CharType::Emoji},   // Misc Symbols and Pictographs
+    {0x1F680, 0x1F6FF, CharType::Emoji},   // Transport and Map
+    {0x1F700, 0x1F77F, CharType::Emoji},   // Alchemical Symbols
+    {0x1F780, 0x1F7FF, CharType::Emoji},   // Geometric Shapes Extended
+    {0x1F800, 0x1F8FF, CharType::Emoji},   // Supplemental Arrows-C
+    {0x1F900, 0x1F9FF, CharType::Emoji},   // Supplemental Symbols and Pictographs
+    {0x1FA00, 0x1FA6F, CharType::Emoji},   // Chess Symbols
+    {0x1FA70, 0x1FAFF, CharType::Emoji},   // Symbols and Pictographs Extended-A
+    {0x1FB00, 0x1FBFF, CharType::Emoji},   // Symbols for Legacy Computing
+    {0x2600, 0x26FF, CharType::Emoji},     // Misc symbols
+    {0x2700, 0x27BF, CharType::Emoji},     // Dingbats
+    {0x2300, 0x23FF, CharType::Emoji},     // Misc Technical (⌚⌛⏰ etc.)
+    {0x2B50, 0x2B55, CharType::Emoji},     // Stars and circles (⭐⭕ etc.)
+    {0x2934, 0x2935, CharType::Emoji},     // Arrows
+    {0x25AA, 0x25AB, CharType::Emoji},     // Squares
+    {0x25B6, 0x25C0, CharType::Emoji},     // Triangles
+    {0x25FB, 0x25FE, CharType::Emoji},     // Squares
+    {0x2614, 0x2615, CharType::Emoji},     // Umbrella, hot beverage
+    {0x2648, 0x2653, CharType::Emoji},     // Zodiac signs
+    {0x267F, 0x267F, CharType::Emoji},     // Wheelchair
+    {0x2693, 0x2693, CharType::Emoji},     // Anchor
+    {0x26A1, 0x26A1, CharType::Emoji},     // High voltage
+    {0x26AA, 0x26AB, CharType::Emoji},     // Circles
+    {0x26BD, 0x26BE, CharType::Emoji},     // Sports balls
+    {0x26C4, 0x26C5, CharType::Emoji},     // Snowman, sun
+    {0x26CE, 0x26CE, CharType::Emoji},     // Ophiuchus
+    {0x26D4, 0x26D4, CharType::Emoji},     // No entry
+    {0x26EA, 0x26EA, CharType::Emoji},     // Church
+    {0x26F2, 0x26F3, CharType::Emoji},     // Fountain, golf
+    {0x26F5, 0x26F5, CharType::Emoji},     // Sailboat
+    {0x26FA, 0x26FA, CharType::Emoji},     // Tent
+    {0x26FD, 0x26FD, CharType::Emoji},     // Fuel pump
+    {0x231A, 0x231B, CharType::Emoji},     // Watch, hourglass
+    {0x23E9, 0x23F3, CharType::Emoji},     // Media controls
+    {0x23F8, 0x23FA, CharType::Emoji},     // Media controls
+    {0x200D, 0x200D, CharType::Emoji},     // ZWJ (Zero Width Joiner)
+    {0xFE0E, 0xFE0F, CharType::Emoji},     // Variation selectors
+    {0x20E3, 0x20E3, CharType::Emoji},     // Combining enclosing keycap
+    {0xE0020, 0xE007F, CharType::Emoji},   // Tag characters (flags)
+    {0x1F1E6, 0x1F1FF, CharType::Emoji},   // Regional Indicator Symbols
+    {0x1F3FB, 0x1F3FF, CharType::Emoji},   // Skin tone modifiers
+};
+
+constexpr char32_t kBmpSize = 0x10000;
+
+CharType classifyByRange(char32_t codepoint) {
+  for (const auto& range : kCharRanges) {
+    if (codepoint >= range.first && codepoint <= range.last) {
+      return range.type;
+    }
   }
+  return CharType::Unknown;
+}
 
-  // Full-width digits
-  if (codepoint >= 0xFF10 && codepoint <= 0xFF19) {
-    return CharType::Digit;
-  }
+// Flat table for the BMP, filled back to front so earlier ranges take
+// precedence. Built on first use: a constexpr table would exceed the
+// constant-evaluation limits of some compilers.
+const std::array<CharType, kBmpSize>& bmpCharTypes() {
+  static const std::array<CharType, kBmpSize> table = [] {
+    std::array<CharType, kBmpSize> types{};
+    types.fill(CharType::Unknown);
+    for (auto iter = std::rbegin(kCharRanges); iter != std::rend(kCharRanges); ++iter) {
+      if (iter->first >= kBmpSize) {
+        continue;
+      }
+      char32_t last = std::min<char32_t>(iter->last, kBmpSize - 1);
+      std::fill(types.begin() + iter->first, types.begin() + last + 1, iter->type);
+    }
+    return types;
+  }();
+  return table;
+}
 
-  // Common punctuation and symbols
-  if ((codepoint >= 0x3000 && codepoint <= 0x303F) ||  // CJK Symbols and Punctuation
-      (codepoint >= 0xFF00 && codepoint <= 0xFF0F) ||  // Full-width symbols
-      (codepoint >= 0x0020 && codepoint <= 0x002F) ||  // ASCII punctuation
-      (codepoint >= 0x003A && codepoint <= 0x0040) ||  // ASCII punctuation
-      (codepoint >= 0x005B && codepoint <= 0x0060) ||  // ASCII punctuation
-      (codepoint >= 0x007B && codepoint <= 0x007E)) {  // ASCII punctuation
-    return CharType::Symbol;
-  }
+}  // namespace
 
-  // Emoji ranges (comprehensive, Unicode 15.0+)
-  if ((codepoint >= 0x1F600 && codepoint <= 0x1F64F) ||  // Emoticons
-      (codepoint >= 0x1F300 && codepoint <= 0x1F5FF) ||  // Misc Symbols and Pictographs
-      (codepoint >= 0x1F680 && codepoint <= 0x1F6FF) ||  // Transport and Map
-      (codepoint >= 0x1F700 && codepoint <= 0x1F77F) ||  // Alchemical Symbols
-      (codepoint >= 0x1F780 && codepoint <= 0x1F7FF) ||  // Geometric Shapes Extended
-      (codepoint >= 0x1F800 && codepoint <= 0x1F8FF) ||  // Supplemental Arrows-C
-      (codepoint >= 0x1F900 && codepoint <= 0x1F9FF) ||  // Supplemental Symbols and Pictographs
-      (codepoint >= 0x1FA00 && codepoint <= 0x1FA6F) ||  // Chess Symbols
-      (codepoint >= 0x1FA70 && codepoint <= 0x1FAFF) ||  // Symbols and Pictographs Extended-A
-      (codepoint >= 0x1FB00 && codepoint <= 0x1FBFF) ||  // Symbols for Legacy Computing
-      (codepoint >= 0x2600 && codepoint <= 0x26FF) ||    // Misc symbols
-      (codepoint >= 0x2700 && codepoint <= 0x27BF) ||    // Dingbats
-      (codepoint >= 0x2300 && codepoint <= 0x23FF) ||    // Misc Technical (⌚⌛⏰ etc.)
-      (codepoint >= 0x2B50 && codepoint <= 0x2B55) ||    // Stars and circles (⭐⭕ etc.)
-      (codepoint >= 0x2934 && codepoint <= 0x2935) ||    // Arrows
-      (codepoint >= 0x25AA && codepoint <= 0x25AB) ||    // Squares
-      (codepoint >= 0x25B6 && codepoint <= 0x25C0) ||    // Triangles
-      (codepoint >= 0x25FB && codepoint <= 0x25FE) ||    // Squares
-      (codepoint >= 0x2614 && codepoint <= 0x2615) ||    // Umbrella, hot beverage
-      (codepoint >= 0x2648 && codepoint <= 0x2653) ||    // Zodiac signs
-      (codepoint >= 0x267F && codepoint <= 0x267F) ||    // Wheelchair
-      (codepoint >= 0x2693 && codepoint <= 0x2693) ||    // Anchor
-      (codepoint >= 0x26A1 && codepoint <= 0x26A1) ||    // High voltage
-      (codepoint >= 0x26AA && codepoint <= 0x26AB) ||    // Circles
-      (codepoint >= 0x26BD && codepoint <= 0x26BE) ||    // Sports balls
-      (codepoint >= 0x26C4 && codepoint <= 0x26C5) ||    // Snowman, sun
-      (codepoint >= 0x26CE && codepoint <= 0x26CE) ||    // Ophiuchus
-      (codepoint >= 0x26D4 && codepoint <= 0x26D4) ||    // No entry
-      (codepoint >= 0x26EA && codepoint <= 0x26EA) ||    // Church
-      (codepoint >= 0x26F2 && codepoint <= 0x26F3) ||    // Fountain, golf
-      (codepoint >= 0x26F5 && codepoint <= 0x26F5) ||    // Sailboat
-      (codepoint >= 0x26FA && codepoint <= 0x26FA) ||    // Tent
-      (codepoint >= 0x26FD && codepoint <= 0x26FD) ||    // Fuel pump
-      (codepoint >= 0x231A && codepoint <= 0x231B) ||    // Watch, hourglass
-      (codepoint >= 0x23E9 && codepoint <= 0x23F3) ||    // Media controls
-      (codepoint >= 0x23F8 && codepoint <= 0x23FA) ||    // Media controls
-      (codepoint >= 0x200D && codepoint <= 0x200D) ||    // ZWJ (Zero Width Joiner)
-      (codepoint >= 0xFE0E && codepoint <= 0xFE0F) ||    // Variation selectors
-      (codepoint >= 0x20E3 && codepoint <= 0x20E3) ||    // Combining enclosing keycap
-      (codepoint >= 0xE0020 && codepoint <= 0xE007F) ||  // Tag characters (flags)
-      (codepoint >= 0x1F1E6 && codepoint <= 0x1F1FF) ||  // Regional Indicator Symbols
-      (codepoint >= 0x1F3FB && codepoint <= 0x1F3FF)) {  // Skin tone modifiers
-    return CharType::Emoji;
+CharType classifyChar(char32_t codepoint) {
+  if (codepoint < kBmpSize) {
+    return bmpCharTypes()[codepoint];
   }
-
-  return CharType::Unknown;
+  // Supplementary planes (CJK extensions, most emoji) are rare in text
+  return classifyByRange(codepoint);
 }
 
 std::string_view charTypeToString(CharType type) {
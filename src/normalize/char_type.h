@@ -27,6 +27,16 @@ enum class CharType : uint8_t {
  */
 CharType classifyChar(char32_t codepoint);
 
+/**
+ * @brief Bit for a character type in a script-class mask
+ *
+ * A mask ORs the bits of the characters of a string, so "only hiragana" or
+ * "contains kanji" become single comparisons (see LatticeEdge::char_classes).
+ */
+constexpr uint8_t charTypeBit(CharType type) {
+  return static_cast<uint8_t>(1U << static_cast<uint8_t>(type));
+}
+
 /**
  * @brief Convert character type to string
  */
@@ -1,8 +1,10 @@
 #include "postprocess/lemmatizer.h"
 
 #include <algorithm>
+#include <map>
 
 #include "core/utf8_constants.h"
+#include "dictionary/double_array.h"
 #include "grammar/char_patterns.h"
 #include "grammar/conjugation.h"
 #include "normalize/char_type.h"
@@ -10,9 +12,17 @@
 
 namespace suzume::postprocess {
 
-Lemmatizer::Lemmatizer() = default;
+Lemmatizer::Lemmatizer() : Lemmatizer(nullptr, nullptr) {}
 
-Lemmatizer::Lemmatizer(const dictionary::DictionaryManager* dict_manager) : dict_manager_(dict_manager) {}
+Lemmatizer::Lemmatizer(const dictionary::DictionaryManager* dict_manager) : Lemmatizer(dict_manager, nullptr) {}
+
+Lemmatizer::Lemmatizer(const dictionary::DictionaryManager* dict_manager, const grammar::Inflection* inflection)
+    : inflection_(inflection), dict_manager_(dict_manager) {
+  if (inflection_ == nullptr) {
+    owned_inflection_ = std::make_unique<grammar::Inflection>();
+    inflection_ = owned_inflection_.get();
+  }
+}
 
 namespace {
 
@@ -329,6 +339,64 @@ const VerbEnding kAdjectiveEndings[] = {
     {"くなかった", "い"}, {"くない", "い"},   {"かった", "い"}, {"くて", "い"},   {"く", "い"},     {"さ", "い"},
 };
 
+/**
+ * @brief Ending table compiled into a trie over byte-reversed suffixes
+ *
+ * find() returns the first entry in table order whose suffix ends the
+ * surface, the same result as scanning the table linearly.
+ */
+class ReverseSuffixIndex {
+ public:
+  template <size_t N>
+  explicit ReverseSuffixIndex(const VerbEnding (&table)[N]) : table_(table) {
+    // Reversed suffix -> first entry using it (std::map keeps keys sorted for build)
+    std::map<std::string, int32_t> first_entry;
+    for (size_t idx = 0; idx < N; ++idx) {
+      std::string key(table[idx].suffix.rbegin(), table[idx].suffix.rend());
+      first_entry.emplace(std::move(key), static_cast<int32_t>(idx));
+    }
+    std::vector<std::string> keys;
+    std::vector<int32_t> values;
+    keys.reserve(first_entry.size());
+    values.reserve(first_entry.size());
+    for (auto& [key, idx] : first_entry) {
+      keys.push_back(key);
+      values.push_back(idx);
+    }
+    trie_.build(keys, values);
+  }
+
+  const VerbEnding* find(std::string_view surface) const {
+    // Walk the trie from the last byte of the surface towards the first
+    int32_t best = -1;
+    size_t node = 0;
+    for (size_t pos = surface.size(); pos > 0; --pos) {
+      if (!trie_.followByte(node, static_cast<uint8_t>(surface[pos - 1]))) {
+        break;
+      }
+      int32_t value = trie_.valueAt(node);
+      if (value >= 0 && (best < 0 || value < best)) {
+        best = value;
+      }
+    }
+    return best < 0 ? nullptr : &table_[best];
+  }
+
+ private:
+  const VerbEnding* table_;
+  dictionary::DoubleArray trie_;
+};
+
+const ReverseSuffixIndex& verbEndingIndex() {
+  static const ReverseSuffixIndex kIndex(kVerbEndings);
+  return kIndex;
+}
+
+const ReverseSuffixIndex& adjectiveEndingIndex() {
+  static const ReverseSuffixIndex kIndex(kAdjectiveEndings);
+  return kIndex;
+}
+
 }  // namespace
 
 bool Lemmatizer::endsWith(std::string_view str, std::string_view suffix) {
@@ -339,12 +407,10 @@ bool Lemmatizer::endsWith(std::string_view str, std::string_view suffix) {
 }
 
 std::string Lemmatizer::lemmatizeVerb(std::string_view surface) {
-  for (const auto& ending : kVerbEndings) {
-    if (endsWith(surface, ending.suffix)) {
-      std::string result(surface.substr(0, surface.size() - ending.suffix.size()));
-      result += ending.base;
-      return result;
-    }
+  if (const VerbEnding* ending = verbEndingIndex().find(surface)) {
+    std::string result(surface.substr(0, surface.size() - ending->suffix.size()));
+    result += ending->base;
+    return result;
   }
   return std::string(surface);
 }
@@ -363,12 +429,10 @@ std::string Lemmatizer::lemmatizeAdjective(std::string_view surface) {
     return "ない";
   }
 
-  for (const auto& ending : kAdjectiveEndings) {
-    if (endsWith(surface, ending.suffix)) {
-      std::string result(surface.substr(0, surface.size() - ending.suffix.size()));
-      result += ending.base;
-      return result;
-    }
+  if (const VerbEnding* ending = adjectiveEndingIndex().find(surface)) {
+    std::string result(surface.substr(0, surface.size() - ending->suffix.size()));
+    result += ending->base;
+    return result;
   }
   return std::string(surface);
 }
@@ -428,10 +492,18 @@ std::string Lemmatizer::lemmatizeByGrammar(std::string_view surface, core::PartO
         return std::string(surface);
       }
     }
+
+    // Pre-expanded conjugation index (dict compile --conjugation-index):
+    // known verb/adjective forms resolve without inflection analysis
+    if (const auto* conjugated = dict_manager_->findConjugated(surface);
+        conjugated != nullptr && conjugated->pos == pos &&
+        (conj_type == dictionary::ConjugationType::None || conjugated->conj_type == conj_type)) {
+      return conjugated->lemma;
+    }
   }
 
   // Get all candidates (const reference to cached result)
-  const auto& all_candidates = inflection_.analyze(surface);
+  const auto& all_candidates = inflection().analyze(surface);
 
   if (all_candidates.empty()) {
     return std::string(surface);
@@ -837,6 +909,10 @@ std::string Lemmatizer::lemmatize(const core::Morpheme& morpheme) const {
 }
 
 void Lemmatizer::lemmatizeAll(std::vector<core::Morpheme>& morphemes) const {
+  // A shared analyzer is trimmed by its owner between chunks
+  if (owned_inflection_) {
+    owned_inflection_->trimCache();
+  }
   for (size_t i = 0; i < morphemes.size(); ++i) {
     auto& morpheme = morphemes[i];
     // B45: Special fix for ない adjective + さ + そう pattern
@@ -926,8 +1002,11 @@ void Lemmatizer::lemmatizeAll(std::vector<core::Morpheme>& morphemes) const {
     // 1. Lemma is empty, OR
     // 2. Lemma equals surface AND it's a conjugated form (not dictionary form)
     //    Dictionary forms end with: る, う, く, ぐ, す, つ, ぬ, ぶ, む (verbs), い (adjectives)
+    // Lemmas carried over from the lattice (dictionary or verified candidate)
+    // are never re-derived, which avoids a second inflection analysis.
     bool needs_lemmatization = morpheme.lemma.empty();
-    if (!needs_lemmatization && morpheme.lemma == morpheme.surface) {
+    if (!needs_lemmatization && morpheme.lemma == morpheme.surface &&
+        morpheme.lemma_source == core::LemmaSource::Unknown) {
       if (morpheme.pos == core::PartOfSpeech::Verb) {
         // Check if surface looks like a dictionary form verb
         // Dictionary form verbs end with: る, う, く, ぐ, す, つ, ぬ, ぶ, む
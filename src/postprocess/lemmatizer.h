@@ -31,6 +31,14 @@ class Lemmatizer {
    */
   explicit Lemmatizer(const dictionary::DictionaryManager* dict_manager);
 
+  /**
+   * @brief Construct a lemmatizer sharing the analyzer's inflection analyzer
+   * @param dict_manager Dictionary manager for verifying candidate base forms
+   * @param inflection Inflection analyzer (and its cache) to use; must outlive this object.
+   *                   When nullptr, the lemmatizer creates its own.
+   */
+  Lemmatizer(const dictionary::DictionaryManager* dict_manager, const grammar::Inflection* inflection);
+
   ~Lemmatizer() = default;
 
   /**
@@ -58,9 +66,12 @@ class Lemmatizer {
                                           std::string_view next_lemma = "");
 
  private:
-  grammar::Inflection inflection_;
+  std::unique_ptr<grammar::Inflection> owned_inflection_;  // Only when no shared analyzer is given
+  const grammar::Inflection* inflection_{nullptr};         // owned_inflection_ or the shared analyzer
   const dictionary::DictionaryManager* dict_manager_{nullptr};
 
+  const grammar::Inflection& inflection() const { return *inflection_; }
+
   /**
    * @brief Lemmatize using grammar-based inflection analysis
    *
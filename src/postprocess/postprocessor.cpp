@@ -9,11 +9,29 @@ namespace suzume::postprocess {
 
 Postprocessor::Postprocessor(const PostprocessOptions& options) : options_(options), lemmatizer_() {}
 
-Postprocessor::Postprocessor(const dictionary::DictionaryManager* dict_manager, const PostprocessOptions& options)
-    : options_(options), lemmatizer_(dict_manager) {}
+Postprocessor::Postprocessor(const dictionary::DictionaryManager* dict_manager, const PostprocessOptions& options,
+                             const grammar::Inflection* inflection)
+    : options_(options), lemmatizer_(dict_manager, inflection) {}
+
+namespace {
+
+// Compact a pass's output in place: move morphemes[from] to slot `to` (to <= from)
+inline void keepAt(std::vector<core::Morpheme>& morphemes, size_t& to, size_t from) {
+  if (to != from) {
+    morphemes[to] = std::move(morphemes[from]);
+  }
+  ++to;
+}
+
+}  // namespace
 
 std::vector<core::Morpheme> Postprocessor::process(const std::vector<core::Morpheme>& morphemes) const {
   std::vector<core::Morpheme> result = morphemes;
+  processInPlace(result);
+  return result;
+}
+
+void Postprocessor::processInPlace(std::vector<core::Morpheme>& result) const {
   [[maybe_unused]] size_t before_count = 0;
 
   // Note: NOUN + SUFFIX merging is intentionally disabled.
@@ -25,12 +43,12 @@ std::vector<core::Morpheme> Postprocessor::process(const std::vector<core::Morph
   // Convert PREFIX + VERB to PREFIX + NOUN (renyoukei nominalization)
   // e.g., お願い → お(PREFIX) + 願い(NOUN), not 願い(VERB)
   before_count = result.size();
-  result = convertPrefixVerbToNoun(result);
+  convertPrefixVerbToNoun(result);
   // Note: this function logs individual changes, so no summary needed
 
   // Merge consecutive numeric expressions (always applied)
   before_count = result.size();
-  result = mergeNumericExpressions(result);
+  mergeNumericExpressions(result);
   if (result.size() != before_count) {
     SUZUME_DEBUG_LOG("[POSTPROC] mergeNumericExpressions: " << before_count << " → " << result.size() << "\n");
   }
@@ -48,7 +66,7 @@ std::vector<core::Morpheme> Postprocessor::process(const std::vector<core::Morph
   // Merge verb renyokei + もの → compound noun (食べもの, 飲みもの, etc.)
   // Must run after lemmatize so conj_form is set
   before_count = result.size();
-  result = mergeVerbRenyokeiMono(result);
+  mergeVerbRenyokeiMono(result);
   if (result.size() != before_count) {
     SUZUME_DEBUG_LOG("[POSTPROC] mergeVerbRenyokeiMono: " << before_count << " → " << result.size() << "\n");
   }
@@ -56,7 +74,7 @@ std::vector<core::Morpheme> Postprocessor::process(const std::vector<core::Morph
   // Merge noun compounds
   if (options_.merge_noun_compounds) {
     before_count = result.size();
-    result = mergeNounCompounds(result);
+    mergeNounCompounds(result);
     if (result.size() != before_count) {
       SUZUME_DEBUG_LOG("[POSTPROC] mergeNounCompounds: " << before_count << " → " << result.size() << "\n");
     }
@@ -64,33 +82,25 @@ std::vector<core::Morpheme> Postprocessor::process(const std::vector<core::Morph
 
   // Merge prolonged sound mark (ー) with preceding token
   before_count = result.size();
-  result = mergeProlongedSoundMark(result);
+  mergeProlongedSoundMark(result);
   if (result.size() != before_count) {
     SUZUME_DEBUG_LOG("[POSTPROC] mergeProlongedSoundMark: " << before_count << " → " << result.size() << "\n");
   }
 
   // Filter unwanted morphemes
-  result = filterMorphemes(result);
-
-  return result;
+  filterMorphemes(result);
 }
 
-std::vector<core::Morpheme> Postprocessor::mergeNounCompounds(const std::vector<core::Morpheme>& morphemes) {
-  if (morphemes.empty()) {
-    return morphemes;
-  }
-
-  std::vector<core::Morpheme> result;
-  result.reserve(morphemes.size());
-
+void Postprocessor::mergeNounCompounds(std::vector<core::Morpheme>& morphemes) {
+  size_t out = 0;
   size_t idx = 0;
   while (idx < morphemes.size()) {
-    const auto& current = morphemes[idx];
+    auto& current = morphemes[idx];
 
     // Check if this is a noun that can be merged
     if (current.pos == core::PartOfSpeech::Noun && !current.features.is_formal_noun) {
       // Collect consecutive nouns
-      core::Morpheme merged = current;
+      core::Morpheme& merged = current;
       size_t merge_end = idx + 1;
       size_t merge_count = 1;
 
@@ -115,30 +125,29 @@ std::vector<core::Morpheme> Postprocessor::mergeNounCompounds(const std::vector<
 
       SUZUME_DEBUG_IF(merge_count > 1) {
         SUZUME_DEBUG_STREAM << "[POSTPROC] Merged " << merge_count << " nouns: ";
-        for (size_t i = idx; i < merge_end; ++i) {
-          if (i > idx)
+        for (size_t i = idx + 1; i < merge_end; ++i) {
+          if (i > idx + 1)
             SUZUME_DEBUG_STREAM << " + ";
           SUZUME_DEBUG_STREAM << "\"" << morphemes[i].surface << "\"";
         }
-        SUZUME_DEBUG_STREAM << " → \"" << merged.surface << "\"\n";
+        SUZUME_DEBUG_STREAM << " into \"" << merged.surface << "\"\n";
       }
 
-      result.push_back(merged);
+      keepAt(morphemes, out, idx);
       idx = merge_end;
     } else {
-      result.push_back(current);
+      keepAt(morphemes, out, idx);
       ++idx;
     }
   }
-
-  return result;
+  morphemes.resize(out);
 }
 
-std::vector<core::Morpheme> Postprocessor::filterMorphemes(const std::vector<core::Morpheme>& morphemes) const {
-  std::vector<core::Morpheme> result;
-  result.reserve(morphemes.size());
+void Postprocessor::filterMorphemes(std::vector<core::Morpheme>& morphemes) const {
+  size_t out = 0;
+  for (size_t idx = 0; idx < morphemes.size(); ++idx) {
+    const auto& morpheme = morphemes[idx];
 
-  for (const auto& morpheme : morphemes) {
     // Skip symbols if option is set
     if (options_.remove_symbols && morpheme.pos == core::PartOfSpeech::Symbol) {
       continue;
@@ -149,25 +158,18 @@ std::vector<core::Morpheme> Postprocessor::filterMorphemes(const std::vector<cor
       continue;
     }
 
-    result.push_back(morpheme);
+    keepAt(morphemes, out, idx);
   }
-
-  return result;
+  morphemes.resize(out);
 }
 
-std::vector<core::Morpheme> Postprocessor::convertPrefixVerbToNoun(const std::vector<core::Morpheme>& morphemes) {
-  if (morphemes.size() < 2) {
-    return morphemes;
-  }
-
-  std::vector<core::Morpheme> result;
-  result.reserve(morphemes.size());
-
-  for (size_t i = 0; i < morphemes.size(); ++i) {
-    core::Morpheme m = morphemes[i];
+void Postprocessor::convertPrefixVerbToNoun(std::vector<core::Morpheme>& morphemes) {
+  // A converted morpheme is a verb, so it never changes the PREFIX test of its successor
+  for (size_t i = 1; i < morphemes.size(); ++i) {
+    core::Morpheme& m = morphemes[i];
 
     // Check if previous morpheme was PREFIX (お or ご)
-    if (i > 0 && morphemes[i - 1].pos == core::PartOfSpeech::Prefix) {
+    if (morphemes[i - 1].pos == core::PartOfSpeech::Prefix) {
       const std::string& prefix_surface = morphemes[i - 1].surface;
       // Only for honorific prefixes お and ご
       if (utf8::equalsAny(prefix_surface, {"お", "ご", "御"})) {
@@ -195,44 +197,32 @@ std::vector<core::Morpheme> Postprocessor::convertPrefixVerbToNoun(const std::ve
         }
       }
     }
-
-    result.push_back(m);
   }
-
-  return result;
 }
 
-std::vector<core::Morpheme> Postprocessor::mergeVerbRenyokeiMono(const std::vector<core::Morpheme>& morphemes) {
-  if (morphemes.size() < 2) {
-    return morphemes;
-  }
-
-  std::vector<core::Morpheme> result;
-  result.reserve(morphemes.size());
-
+void Postprocessor::mergeVerbRenyokeiMono(std::vector<core::Morpheme>& morphemes) {
+  size_t out = 0;
   for (size_t i = 0; i < morphemes.size(); ++i) {
     // Check: VERB + もの(formal noun) → compound NOUN
     // e.g., 食べ+もの → 食べもの, 飲み+もの → 飲みもの, 乗り+もの → 乗りもの
     if (i + 1 < morphemes.size() && morphemes[i].pos == core::PartOfSpeech::Verb &&
         morphemes[i].conj_form == grammar::ConjForm::Renyokei && morphemes[i + 1].surface == "もの" &&
         morphemes[i + 1].features.is_formal_noun) {
-      core::Morpheme merged = morphemes[i];
+      SUZUME_DEBUG_LOG("[POSTPROC] Merged verb+もの: \"" << morphemes[i].surface << "\" + \"もの\"\n");
+      core::Morpheme& merged = morphemes[i];
       merged.surface += morphemes[i + 1].surface;
       merged.pos = core::PartOfSpeech::Noun;
       merged.extended_pos = core::ExtendedPOS::Noun;
       merged.lemma = merged.surface;
       merged.end = morphemes[i + 1].end;
       merged.end_pos = morphemes[i + 1].end_pos;
-      SUZUME_DEBUG_LOG("[POSTPROC] Merged verb+もの: \"" << morphemes[i].surface << "\" + \"もの\" → \""
-                                                         << merged.surface << "\"\n");
-      result.push_back(merged);
+      keepAt(morphemes, out, i);
       ++i;  // skip もの
       continue;
     }
-    result.push_back(morphemes[i]);
+    keepAt(morphemes, out, i);
   }
-
-  return result;
+  morphemes.resize(out);
 }
 
 std::vector<core::Morpheme> Postprocessor::mergeNounSuffix(const std::vector<core::Morpheme>& morphemes) {
@@ -363,22 +353,16 @@ bool endsWithContinuableUnit(const std::string& surface) {
 
 }  // namespace
 
-std::vector<core::Morpheme> Postprocessor::mergeNumericExpressions(const std::vector<core::Morpheme>& morphemes) {
-  if (morphemes.empty()) {
-    return morphemes;
-  }
-
-  std::vector<core::Morpheme> result;
-  result.reserve(morphemes.size());
-
+void Postprocessor::mergeNumericExpressions(std::vector<core::Morpheme>& morphemes) {
+  size_t out = 0;
   size_t idx = 0;
   while (idx < morphemes.size()) {
-    const auto& current = morphemes[idx];
+    auto& current = morphemes[idx];
 
     // Pattern 1: Merge large numbers (3億 + 5000万円)
     if (current.pos == core::PartOfSpeech::Noun && isNumericExpression(current.surface) &&
         endsWithContinuableUnit(current.surface)) {
-      core::Morpheme merged = current;
+      core::Morpheme& merged = current;
       size_t merge_end = idx + 1;
 
       // Collect consecutive numeric expressions
@@ -402,15 +386,15 @@ std::vector<core::Morpheme> Postprocessor::mergeNumericExpressions(const std::ve
 
       SUZUME_DEBUG_IF(merge_end > idx + 1) {
         SUZUME_DEBUG_STREAM << "[POSTPROC] Merged numeric: ";
-        for (size_t i = idx; i < merge_end; ++i) {
-          if (i > idx)
+        for (size_t i = idx + 1; i < merge_end; ++i) {
+          if (i > idx + 1)
             SUZUME_DEBUG_STREAM << " + ";
           SUZUME_DEBUG_STREAM << "\"" << morphemes[i].surface << "\"";
         }
-        SUZUME_DEBUG_STREAM << " → \"" << merged.surface << "\"\n";
+        SUZUME_DEBUG_STREAM << " into \"" << merged.surface << "\"\n";
       }
 
-      result.push_back(merged);
+      keepAt(morphemes, out, idx);
       idx = merge_end;
       continue;
     }
@@ -422,16 +406,15 @@ std::vector<core::Morpheme> Postprocessor::mergeNumericExpressions(const std::ve
       const auto& next = morphemes[idx + 1];
       bool is_versus = (next.surface == "対");
       if (next.pos == core::PartOfSpeech::Noun && looksLikeUnit(next.surface) && !is_versus) {
-        core::Morpheme merged = current;
+        SUZUME_DEBUG_LOG_VERBOSE("[POSTPROC] Merged number+unit: \"" << current.surface << "\" + \"" << next.surface
+                                                                     << "\"\n");
+        core::Morpheme& merged = current;
         merged.surface += next.surface;
         merged.lemma = merged.surface;
         merged.end = next.end;
         merged.end_pos = next.end_pos;
 
-        SUZUME_DEBUG_LOG_VERBOSE("[POSTPROC] Merged number+unit: \"" << current.surface << "\" + \"" << next.surface
-                                                                     << "\" → \"" << merged.surface << "\"\n");
-
-        result.push_back(merged);
+        keepAt(morphemes, out, idx);
         idx += 2;
         continue;
       }
@@ -442,16 +425,15 @@ std::vector<core::Morpheme> Postprocessor::mergeNumericExpressions(const std::ve
       const auto& next = morphemes[idx + 1];
       // Check for common time/counter suffixes that get split
       if (next.pos == core::PartOfSpeech::Noun && utf8::equalsAny(next.surface, {"間", "半", "目"})) {
-        core::Morpheme merged = current;
+        SUZUME_DEBUG_LOG_VERBOSE("[POSTPROC] Merged numeric+suffix: \"" << current.surface << "\" + \"" << next.surface
+                                                                        << "\"\n");
+        core::Morpheme& merged = current;
         merged.surface += next.surface;
         merged.lemma = merged.surface;
         merged.end = next.end;
         merged.end_pos = next.end_pos;
 
-        SUZUME_DEBUG_LOG_VERBOSE("[POSTPROC] Merged numeric+suffix: \"" << current.surface << "\" + \"" << next.surface
-                                                                        << "\" → \"" << merged.surface << "\"\n");
-
-        result.push_back(merged);
+        keepAt(morphemes, out, idx);
         idx += 2;
         continue;
       }
@@ -463,28 +445,25 @@ std::vector<core::Morpheme> Postprocessor::mergeNumericExpressions(const std::ve
         utf8::equalsAny(current.surface, {"数", "幾", "何"}) && idx + 1 < morphemes.size()) {
       const auto& next = morphemes[idx + 1];
       if (next.pos == core::PartOfSpeech::Suffix) {
-        core::Morpheme merged = current;
+        SUZUME_DEBUG_LOG_VERBOSE("[POSTPROC] Merged indefinite+suffix: \"" << current.surface << "\" + \""
+                                                                            << next.surface << "\"\n");
+        core::Morpheme& merged = current;
         merged.pos = core::PartOfSpeech::Noun;  // Merged result is always NOUN
         merged.surface += next.surface;
         merged.lemma = merged.surface;
         merged.end = next.end;
         merged.end_pos = next.end_pos;
 
-        SUZUME_DEBUG_LOG_VERBOSE("[POSTPROC] Merged indefinite+suffix: \""
-                                 << current.surface << "\" + \"" << next.surface << "\" → \"" << merged.surface
-                                 << "\"\n");
-
-        result.push_back(merged);
+        keepAt(morphemes, out, idx);
         idx += 2;
         continue;
       }
     }
 
-    result.push_back(current);
+    keepAt(morphemes, out, idx);
     ++idx;
   }
-
-  return result;
+  morphemes.resize(out);
 }
 
 std::vector<core::Morpheme> Postprocessor::mergeNaAdjectiveNa(const std::vector<core::Morpheme>& morphemes) {
@@ -539,14 +518,8 @@ std::vector<core::Morpheme> Postprocessor::mergeNaAdjectiveNa(const std::vector<
   return result;
 }
 
-std::vector<core::Morpheme> Postprocessor::mergeProlongedSoundMark(const std::vector<core::Morpheme>& morphemes) {
-  if (morphemes.size() < 2) {
-    return morphemes;
-  }
-
-  std::vector<core::Morpheme> result;
-  result.reserve(morphemes.size());
-
+void Postprocessor::mergeProlongedSoundMark(std::vector<core::Morpheme>& morphemes) {
+  size_t out = 0;
   for (size_t i = 0; i < morphemes.size(); ++i) {
     // Check if next morpheme is ー (or consecutive ーs)
     if (i + 1 < morphemes.size()) {
@@ -560,10 +533,11 @@ std::vector<core::Morpheme> Postprocessor::mergeProlongedSoundMark(const std::ve
       }
 
       if (next_is_prolonged && !next.surface.empty()) {
-        const auto& current = morphemes[i];
+        auto& current = morphemes[i];
         // Only merge if preceding token is not a symbol
         if (current.pos != core::PartOfSpeech::Symbol) {
-          core::Morpheme merged = current;
+          SUZUME_DEBUG_LOG("[POSTPROC] Merged prolonged sound mark: \"" << current.surface << "\" + \"ー\"\n");
+          core::Morpheme& merged = current;
           // Merge consecutive ーs into one ー
           merged.surface += "ー";
           merged.end = next.end;
@@ -590,18 +564,15 @@ std::vector<core::Morpheme> Postprocessor::mergeProlongedSoundMark(const std::ve
             ++skip;
           }
 
-          SUZUME_DEBUG_LOG("[POSTPROC] Merged prolonged sound mark: \"" << current.surface << "\" + \"ー\" → \""
-                                                                        << merged.surface << "\"\n");
-          result.push_back(merged);
+          keepAt(morphemes, out, i);
           i = skip - 1;  // Will be incremented by loop
           continue;
         }
       }
     }
-    result.push_back(morphemes[i]);
+    keepAt(morphemes, out, i);
   }
-
-  return result;
+  morphemes.resize(out);
 }
 
 }  // namespace suzume::postprocess
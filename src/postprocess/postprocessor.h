@@ -31,8 +31,10 @@ class Postprocessor {
    * @brief Construct with dictionary for lemmatization verification
    * @param dict_manager Dictionary manager for verifying lemma candidates
    * @param options Post-processing options
+   * @param inflection Optional inflection analyzer to share with the analyzer (must outlive this object)
    */
-  Postprocessor(const dictionary::DictionaryManager* dict_manager, const PostprocessOptions& options = {});
+  Postprocessor(const dictionary::DictionaryManager* dict_manager, const PostprocessOptions& options = {},
+                const grammar::Inflection* inflection = nullptr);
 
   ~Postprocessor() = default;
 
@@ -43,6 +45,12 @@ class Postprocessor {
    */
   std::vector<core::Morpheme> process(const std::vector<core::Morpheme>& morphemes) const;
 
+  /**
+   * @brief Process morpheme sequence in place, reusing its storage
+   * @param morphemes Morphemes to process; merged and filtered entries are compacted away
+   */
+  void processInPlace(std::vector<core::Morpheme>& morphemes) const;
+
   /**
    * @brief Update post-processing options while keeping dictionary-aware lemmatization.
    */
@@ -55,7 +63,7 @@ class Postprocessor {
   /**
    * @brief Merge consecutive nouns
    */
-  static std::vector<core::Morpheme> mergeNounCompounds(const std::vector<core::Morpheme>& morphemes);
+  static void mergeNounCompounds(std::vector<core::Morpheme>& morphemes);
 
   /**
    * @brief Merge NOUN/PRONOUN + SUFFIX into compound noun
@@ -65,7 +73,7 @@ class Postprocessor {
   /**
    * @brief Merge consecutive numeric expressions (e.g., 3億 + 5000万円 → 3億5000万円)
    */
-  static std::vector<core::Morpheme> mergeNumericExpressions(const std::vector<core::Morpheme>& morphemes);
+  static void mergeNumericExpressions(std::vector<core::Morpheme>& morphemes);
 
   /**
    * @brief Merge na-adjective + な into attributive form (e.g., 静か + な → 静かな)
@@ -76,25 +84,25 @@ class Postprocessor {
    * @brief Convert PREFIX + VERB to PREFIX + NOUN (renyoukei nominalization)
    * e.g., お願い → お(PREFIX) + 願い(NOUN), not 願い(VERB)
    */
-  static std::vector<core::Morpheme> convertPrefixVerbToNoun(const std::vector<core::Morpheme>& morphemes);
+  static void convertPrefixVerbToNoun(std::vector<core::Morpheme>& morphemes);
 
   /**
    * @brief Merge verb renyokei + もの into compound noun
    * e.g., 食べ + もの → 食べもの, 飲み + もの → 飲みもの
    */
-  static std::vector<core::Morpheme> mergeVerbRenyokeiMono(const std::vector<core::Morpheme>& morphemes);
+  static void mergeVerbRenyokeiMono(std::vector<core::Morpheme>& morphemes);
 
   /**
    * @brief Merge prolonged sound mark (ー) with preceding token
    * e.g., あの + ー → あのー, すごー + ーー → すごー
    * Also merges consecutive ーs into one.
    */
-  static std::vector<core::Morpheme> mergeProlongedSoundMark(const std::vector<core::Morpheme>& morphemes);
+  static void mergeProlongedSoundMark(std::vector<core::Morpheme>& morphemes);
 
   /**
    * @brief Remove unwanted morphemes
    */
-  std::vector<core::Morpheme> filterMorphemes(const std::vector<core::Morpheme>& morphemes) const;
+  void filterMorphemes(std::vector<core::Morpheme>& morphemes) const;
 };
 
 }  // namespace suzume::postprocess
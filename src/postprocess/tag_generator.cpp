@@ -78,38 +78,50 @@ bool TagGenerator::shouldInclude(const core::Morpheme& morpheme) const {
   return true;
 }
 
-std::string TagGenerator::getTagString(const core::Morpheme& morpheme) const {
+std::string_view TagGenerator::getTagString(const core::Morpheme& morpheme) const {
   if (options_.use_lemma && !morpheme.lemma.empty()) {
     return morpheme.lemma;
   }
   return morpheme.surface;
 }
 
-std::vector<TagEntry> TagGenerator::generate(const std::vector<core::Morpheme>& morphemes) const {
-  std::vector<TagEntry> tags;
-  std::unordered_set<std::string> seen;
+bool TagGenerator::acceptTag(const core::Morpheme& morpheme, std::string_view& tag) const {
+  if (!shouldInclude(morpheme)) {
+    return false;
+  }
+
+  tag = getTagString(morpheme);
+
+  // Check minimum length
+  return countChars(tag) >= options_.min_tag_length;
+}
 
+void TagGenerator::forEachTerm(const std::vector<core::Morpheme>& morphemes, TermSink& sink) const {
+  std::string_view tag;
   for (const auto& morpheme : morphemes) {
-    if (!shouldInclude(morpheme)) {
-      continue;
+    if (acceptTag(morpheme, tag)) {
+      sink.onTerm(TermView{tag, morpheme.pos, morpheme.start, morpheme.end});
     }
+  }
+}
 
-    std::string tag = getTagString(morpheme);
+std::vector<TagEntry> TagGenerator::generate(const std::vector<core::Morpheme>& morphemes) const {
+  std::vector<TagEntry> tags;
+  // Views into morphemes, which outlive this call
+  std::unordered_set<std::string_view> seen;
 
-    // Check minimum length
-    if (countChars(tag) < options_.min_tag_length) {
+  std::string_view tag;
+  for (const auto& morpheme : morphemes) {
+    if (!acceptTag(morpheme, tag)) {
       continue;
     }
 
     // Check for duplicates
-    if (options_.remove_duplicates) {
-      if (seen.find(tag) != seen.end()) {
-        continue;
-      }
-      seen.insert(tag);
+    if (options_.remove_duplicates && !seen.insert(tag).second) {
+      continue;
     }
 
-    tags.push_back({tag, morpheme.pos});
+    tags.push_back({std::string(tag), morpheme.pos});
 
     // Check max tags
     if (options_.max_tags > 0 && tags.size() >= options_.max_tags) {
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -43,6 +44,28 @@ struct TagEntry {
   core::PartOfSpeech pos;
 };
 
+/**
+ * @brief Term emitted to a TermSink
+ *
+ * term points into the morpheme it came from and is only valid during the
+ * onTerm() call.
+ */
+struct TermView {
+  std::string_view term;  // Lemma (or surface, per TagGeneratorOptions::use_lemma)
+  core::PartOfSpeech pos;
+  size_t start;  // Character offsets in the analyzed text
+  size_t end;
+};
+
+/**
+ * @brief Receiver for TagGenerator::forEachTerm()
+ */
+class TermSink {
+ public:
+  virtual ~TermSink() = default;
+  virtual void onTerm(const TermView& term) = 0;
+};
+
 /**
  * @brief Tag generator from morphemes
  */
@@ -58,6 +81,17 @@ class TagGenerator {
    */
   std::vector<TagEntry> generate(const std::vector<core::Morpheme>& morphemes) const;
 
+  /**
+   * @brief Emit every tag-worthy term, in order and including repeats
+   *
+   * Applies the same filters as generate() except remove_duplicates and
+   * max_tags, without copying any strings.
+   *
+   * @param morphemes Input morphemes
+   * @param sink Receives one call per term
+   */
+  void forEachTerm(const std::vector<core::Morpheme>& morphemes, TermSink& sink) const;
+
   /**
    * @brief Generate tags from text using analyzer
    * @param text Input text
@@ -76,7 +110,12 @@ class TagGenerator {
   /**
    * @brief Get tag string from morpheme
    */
-  std::string getTagString(const core::Morpheme& morpheme) const;
+  std::string_view getTagString(const core::Morpheme& morpheme) const;
+
+  /**
+   * @brief Check filters and minimum length; sets tag on success
+   */
+  bool acceptTag(const core::Morpheme& morpheme, std::string_view& tag) const;
 
   /**
    * @brief Count UTF-8 characters
@@ -0,0 +1,99 @@
+#include "postprocess/term_frequencies.h"
+
+#include <functional>
+
+namespace suzume::postprocess {
+
+void TermFrequencies::clearCounts() {
+  for (const auto& entry : counts_) {
+    count_index_[entry.id] = kEmptySlot;
+  }
+  counts_.clear();
+}
+
+uint32_t TermFrequencies::add(std::string_view term, core::PartOfSpeech pos) {
+  uint32_t id = intern(term);
+  uint32_t& index = count_index_[id];
+  if (index == kEmptySlot) {
+    index = static_cast<uint32_t>(counts_.size());
+    counts_.push_back(TermCount{id, 1, pos});
+  } else {
+    ++counts_[index].count;
+  }
+  return id;
+}
+
+uint32_t TermFrequencies::countOf(uint32_t id) const {
+  if (id >= count_index_.size() || count_index_[id] == kEmptySlot) {
+    return 0;
+  }
+  return counts_[count_index_[id]].count;
+}
+
+bool TermFrequencies::find(std::string_view term, uint32_t& id) const {
+  if (slots_.empty()) {
+    return false;
+  }
+  uint32_t found = slots_[findSlot(term, std::hash<std::string_view>{}(term))];
+  if (found == kEmptySlot) {
+    return false;
+  }
+  id = found;
+  return true;
+}
+
+std::string_view TermFrequencies::term(uint32_t id) const {
+  return std::string_view(pool_).substr(term_offsets_[id], term_lengths_[id]);
+}
+
+size_t TermFrequencies::findSlot(std::string_view term, uint64_t hash) const {
+  const size_t mask = slots_.size() - 1;
+  size_t slot = hash & mask;
+  while (slots_[slot] != kEmptySlot) {
+    uint32_t id = slots_[slot];
+    if (term_hashes_[id] == hash && this->term(id) == term) {
+      break;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+uint32_t TermFrequencies::intern(std::string_view term) {
+  if (slots_.empty()) {
+    slots_.assign(kInitialSlots, kEmptySlot);
+  }
+  uint64_t hash = std::hash<std::string_view>{}(term);
+  size_t slot = findSlot(term, hash);
+  if (slots_[slot] != kEmptySlot) {
+    return slots_[slot];
+  }
+
+  auto id = static_cast<uint32_t>(term_offsets_.size());
+  term_offsets_.push_back(static_cast<uint32_t>(pool_.size()));
+  term_lengths_.push_back(static_cast<uint32_t>(term.size()));
+  term_hashes_.push_back(hash);
+  pool_.append(term);
+  count_index_.push_back(kEmptySlot);
+  slots_[slot] = id;
+
+  // Keep the load factor at or below one half
+  if (term_offsets_.size() * 2 > slots_.size()) {
+    growSlots();
+  }
+  return id;
+}
+
+void TermFrequencies::growSlots() {
+  slots_.assign(slots_.size() * 2, kEmptySlot);
+  const size_t mask = slots_.size() - 1;
+  for (uint32_t id = 0; id < term_offsets_.size(); ++id) {
+    size_t slot = term_hashes_[id] & mask;
+    while (slots_[slot] != kEmptySlot) {
+      slot = (slot + 1) & mask;
+    }
+    slots_[slot] = id;
+  }
+}
+
+}  // namespace suzume::postprocess
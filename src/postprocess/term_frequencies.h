@@ -0,0 +1,110 @@
+/**
+ * @file term_frequencies.h
+ * @brief Reusable per-document term counting for indexing
+ *
+ * Terms are interned once into dense IDs; each document's counts live in a
+ * flat array indexed by ID and are reset by walking the touched IDs, so a
+ * warm table counts a document without allocating.
+ */
+
+#ifndef SUZUME_POSTPROCESS_TERM_FREQUENCIES_H_
+#define SUZUME_POSTPROCESS_TERM_FREQUENCIES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/types.h"
+#include "postprocess/tag_generator.h"
+
+namespace suzume::postprocess {
+
+/**
+ * @brief Count of one term in the current document
+ */
+struct TermCount {
+  uint32_t id;             // Interned term ID (see TermFrequencies::term())
+  uint32_t count;          // Occurrences in the current document
+  core::PartOfSpeech pos;  // POS of the first occurrence
+};
+
+/**
+ * @brief Term interner plus per-document frequency counts
+ *
+ * IDs are stable for the lifetime of the table, so they can be used as
+ * posting-list keys across documents. Not thread-safe; use one table per
+ * thread.
+ */
+class TermFrequencies : public TermSink {
+ public:
+  TermFrequencies() = default;
+
+  /**
+   * @brief Reset counts for the next document (interned terms are kept)
+   */
+  void clearCounts();
+
+  /**
+   * @brief Count one occurrence of term
+   * @return Interned term ID
+   */
+  uint32_t add(std::string_view term, core::PartOfSpeech pos);
+
+  /**
+   * @brief TermSink entry point; counts term.term
+   */
+  void onTerm(const TermView& term) override { add(term.term, term.pos); }
+
+  /**
+   * @brief Counts for the current document, in first-occurrence order
+   */
+  const std::vector<TermCount>& counts() const { return counts_; }
+
+  /**
+   * @brief Count of an interned term in the current document (0 if absent)
+   */
+  uint32_t countOf(uint32_t id) const;
+
+  /**
+   * @brief Look up a term's ID without interning it
+   * @return true and sets id if the term has been seen
+   */
+  bool find(std::string_view term, uint32_t& id) const;
+
+  /**
+   * @brief Interned term text
+   */
+  std::string_view term(uint32_t id) const;
+
+  /**
+   * @brief Number of distinct terms interned so far
+   */
+  size_t termCount() const { return term_offsets_.size(); }
+
+ private:
+  static constexpr uint32_t kEmptySlot = 0xFFFFFFFF;
+  static constexpr size_t kInitialSlots = 1024;
+
+  // Interned strings: text of term id is pool_[offset, offset + length)
+  std::string pool_;
+  std::vector<uint32_t> term_offsets_;
+  std::vector<uint32_t> term_lengths_;
+  std::vector<uint64_t> term_hashes_;
+
+  // Open-addressing index of term IDs (linear probing, power-of-two size)
+  std::vector<uint32_t> slots_;
+
+  // Per-document counts: index into counts_ by term ID (kEmptySlot = absent)
+  std::vector<uint32_t> count_index_;
+  std::vector<TermCount> counts_;
+
+  uint32_t intern(std::string_view term);
+  size_t findSlot(std::string_view term, uint64_t hash) const;
+  void growSlots();
+};
+
+}  // namespace suzume::postprocess
+
+#endif  // SUZUME_POSTPROCESS_TERM_FREQUENCIES_H_
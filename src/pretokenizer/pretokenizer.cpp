@@ -1,7 +1,14 @@
 #include "pretokenizer/pretokenizer.h"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstdint>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "normalize/utf8.h"
 
@@ -24,74 +31,92 @@ bool isAsciiAlnum(char chr) {
   return isAsciiDigit(chr) || isAsciiAlpha(chr);
 }
 
-// Check if this is a full-width digit (０-９)
-bool isFullwidthDigit(char32_t codepoint) {
-  return codepoint >= 0xFF10 && codepoint <= 0xFF19;
+// Width in bytes of an ASCII or full-width digit (０-９ = EF BC 90-99) at idx, 0 if none
+size_t digitWidth(std::string_view text, size_t idx, uint32_t& digit) {
+  char chr = text[idx];
+  if (isAsciiDigit(chr)) {
+    digit = static_cast<uint32_t>(chr - '0');
+    return 1;
+  }
+  if (static_cast<unsigned char>(chr) == 0xEF && idx + 2 < text.size() &&
+      static_cast<unsigned char>(text[idx + 1]) == 0xBC) {
+    auto third = static_cast<unsigned char>(text[idx + 2]);
+    if (third >= 0x90 && third <= 0x99) {
+      digit = static_cast<uint32_t>(third - 0x90);
+      return 3;
+    }
+  }
+  return 0;
 }
 
+// Run of integer digits parsed without allocating
+struct DigitRun {
+  size_t count{0};    // Number of digits
+  uint64_t value{0};  // Numeric value (only meaningful for short runs)
+
+  bool empty() const { return count == 0; }
+};
+
 // Parse integer digits only (no decimal points), return end position
-size_t parseInteger(std::string_view text, size_t pos, std::string& digits) {
-  digits.clear();
+size_t parseInteger(std::string_view text, size_t pos, DigitRun& run) {
+  run = {};
   size_t idx = pos;
+  uint32_t digit = 0;
   while (idx < text.size()) {
-    char chr = text[idx];
-    if (isAsciiDigit(chr)) {
-      digits += chr;
-      ++idx;
-    } else {
-      // Check for full-width digits
-      size_t byte_pos = idx;
-      char32_t codepoint = normalize::decodeUtf8(text, byte_pos);
-      if (isFullwidthDigit(codepoint)) {
-        digits += static_cast<char>('0' + (codepoint - 0xFF10));
-        idx = byte_pos;
-      } else {
-        break;
-      }
+    size_t width = digitWidth(text, idx, digit);
+    if (width == 0) {
+      break;
     }
+    run.value = run.value * 10 + digit;
+    ++run.count;
+    idx += width;
   }
   return idx;
 }
 
-// Parse digits at position (including decimals), return end position
-size_t parseDigits(std::string_view text, size_t pos, std::string& digits) {
-  digits.clear();
+// Parse digits at position (including decimals and thousand separators), return end position.
+// The number is non-empty iff the returned position is past pos.
+size_t parseDigits(std::string_view text, size_t pos) {
   size_t idx = pos;
+  uint32_t digit = 0;
   while (idx < text.size()) {
     char chr = text[idx];
-    if (isAsciiDigit(chr)) {
-      digits += chr;
-      ++idx;
-    } else if (chr == '.') {
-      // Check if followed by digit (decimal point)
-      if (idx + 1 < text.size() && isAsciiDigit(text[idx + 1])) {
-        digits += chr;
-        ++idx;
-      } else {
-        break;
-      }
-    } else if (chr == ',') {
-      // Thousand separator - skip but continue
+    if (chr == '.' || chr == ',') {
+      // Decimal point or thousand separator - only when followed by a digit
       if (idx + 1 < text.size() && isAsciiDigit(text[idx + 1])) {
         ++idx;
       } else {
         break;
       }
     } else {
-      // Check for full-width digits
-      size_t byte_pos = idx;
-      char32_t codepoint = normalize::decodeUtf8(text, byte_pos);
-      if (isFullwidthDigit(codepoint)) {
-        digits += static_cast<char>('0' + (codepoint - 0xFF10));
-        idx = byte_pos;
-      } else {
+      size_t width = digitWidth(text, idx, digit);
+      if (width == 0) {
         break;
       }
+      idx += width;
     }
   }
   return idx;
 }
 
+// Copy a run of digits and separators, folding full-width digits to ASCII
+std::string foldDigits(std::string_view run) {
+  std::string folded;
+  folded.reserve(run.size());
+  uint32_t digit = 0;
+  size_t idx = 0;
+  while (idx < run.size()) {
+    size_t width = digitWidth(run, idx, digit);
+    if (width == 0) {
+      folded += run[idx++];
+    } else {
+      folded += static_cast<char>('0' + digit);
+      idx += width;
+    }
+  }
+  return folded;
+}
+
 // Check if text at pos starts with given string (case-insensitive for ASCII)
 bool startsWithCI(std::string_view text, size_t pos, std::string_view prefix) {
   if (pos + prefix.size() > text.size()) {
@@ -107,6 +132,109 @@ bool startsWithCI(std::string_view text, size_t pos, std::string_view prefix) {
   return true;
 }
 
+// Matchers that can start at a given first byte (bit order = priority order in process())
+enum TriggerBit : uint16_t {
+  kTriggerUrl = 1U << 0,
+  kTriggerEmail = 1U << 1,
+  kTriggerHashtag = 1U << 2,
+  kTriggerMention = 1U << 3,
+  kTriggerDate = 1U << 4,
+  kTriggerTime = 1U << 5,
+  kTriggerCurrency = 1U << 6,
+  kTriggerStorage = 1U << 7,
+  kTriggerPercentage = 1U << 8,
+  kTriggerAddress = 1U << 9,
+  kTriggerVersion = 1U << 10,
+  kTriggerAsciiDots = 1U << 11,
+};
+
+constexpr uint16_t kTriggerNumeric = kTriggerDate | kTriggerTime | kTriggerCurrency | kTriggerStorage |
+                                     kTriggerPercentage | kTriggerAddress | kTriggerVersion;
+
+constexpr std::array<uint16_t, 256> buildTriggerTable() {
+  std::array<uint16_t, 256> table{};
+  for (int chr = '0'; chr <= '9'; ++chr) {
+    table[chr] = kTriggerEmail | kTriggerNumeric | kTriggerAsciiDots;
+  }
+  for (int chr = 'a'; chr <= 'z'; ++chr) {
+    table[chr] = kTriggerEmail | kTriggerAsciiDots;
+    table[chr - 'a' + 'A'] = kTriggerEmail | kTriggerAsciiDots;
+  }
+  table['h'] |= kTriggerUrl;
+  table['H'] |= kTriggerUrl;
+  table['v'] |= kTriggerVersion;
+  table['V'] |= kTriggerVersion;
+  table['-'] = kTriggerEmail;
+  table['_'] = kTriggerEmail;
+  table['+'] = kTriggerEmail;
+  table['#'] = kTriggerHashtag;
+  table['@'] = kTriggerMention;
+  // Lead byte of full-width digits (EF BC 90-99) and ＃ (EF BC 83)
+  table[0xEF] = kTriggerHashtag | kTriggerNumeric;
+  return table;
+}
+
+constexpr std::array<uint16_t, 256> kTriggerTable = buildTriggerTable();
+
+// Whether a match or sentence boundary can start at idx.
+// Conservative for ASCII (every ASCII byte is a candidate); exact for the
+// multi-byte triggers: 。(E3 80 82), ・(E3 83 BB) and EF BC xx (full-width
+// digits, ＃, ！, ？).
+bool isCandidate(std::string_view text, size_t idx) {
+  auto lead = static_cast<unsigned char>(text[idx]);
+  if (lead < 0x80) {
+    return true;
+  }
+  if (idx + 2 >= text.size()) {
+    return lead == 0xEF || lead == 0xE3;
+  }
+  auto second = static_cast<unsigned char>(text[idx + 1]);
+  auto third = static_cast<unsigned char>(text[idx + 2]);
+  if (lead == 0xEF) {
+    return second == 0xBC;
+  }
+  return lead == 0xE3 && ((second == 0x80 && third == 0x82) || (second == 0x83 && third == 0xBB));
+}
+
+// Find the next candidate position at or after pos (text.size() if none).
+// Pure kana/kanji runs contain no candidates and are skipped 16 bytes at a time.
+size_t findNextCandidate(std::string_view text, size_t pos) {
+#if defined(__SSE2__)
+  const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+  const __m128i lead_e3 = _mm_set1_epi8(static_cast<char>(0xE3));
+  const __m128i lead_ef = _mm_set1_epi8(static_cast<char>(0xEF));
+  const __m128i byte_80 = _mm_set1_epi8(static_cast<char>(0x80));
+  const __m128i byte_82 = _mm_set1_epi8(static_cast<char>(0x82));
+  const __m128i byte_83 = _mm_set1_epi8(static_cast<char>(0x83));
+  const __m128i byte_bb = _mm_set1_epi8(static_cast<char>(0xBB));
+  const __m128i byte_bc = _mm_set1_epi8(static_cast<char>(0xBC));
+
+  // Three overlapping loads see each lead byte together with its two trail bytes
+  while (pos + 18 <= text.size()) {
+    __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+    __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 1));
+    __m128i third = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 2));
+
+    __m128i maru = _mm_and_si128(_mm_cmpeq_epi8(second, byte_80), _mm_cmpeq_epi8(third, byte_82));
+    __m128i nakaguro = _mm_and_si128(_mm_cmpeq_epi8(second, byte_83), _mm_cmpeq_epi8(third, byte_bb));
+    __m128i cjk = _mm_and_si128(_mm_cmpeq_epi8(first, lead_e3), _mm_or_si128(maru, nakaguro));
+    __m128i fullwidth = _mm_and_si128(_mm_cmpeq_epi8(first, lead_ef), _mm_cmpeq_epi8(second, byte_bc));
+
+    // ASCII bytes have the high bit clear
+    auto ascii_mask = static_cast<unsigned>(~_mm_movemask_epi8(first)) & 0xFFFFU;
+    auto mask = ascii_mask | static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(cjk, fullwidth)));
+    if (mask != 0) {
+      return pos + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    pos += 16;
+  }
+#endif
+  while (pos < text.size() && !isCandidate(text, pos)) {
+    ++pos;
+  }
+  return pos;
+}
+
 }  // namespace
 
 bool PreTokenizer::tryMatchUrl(std::string_view text, size_t pos, PreToken& token) const {
@@ -155,10 +283,10 @@ bool PreTokenizer::tryMatchUrl(std::string_view text, size_t pos, PreToken& toke
 
 bool PreTokenizer::tryMatchDate(std::string_view text, size_t pos, PreToken& token) const {
   // Match patterns: YYYY年MM月DD日, YYYY年MM月, YYYY年
-  std::string year_str;
-  size_t idx = parseInteger(text, pos, year_str);
+  DigitRun year;
+  size_t idx = parseInteger(text, pos, year);
 
-  if (year_str.empty() || year_str.size() < 1 || year_str.size() > 4) {
+  if (year.empty() || year.count > 4) {
     return false;
   }
 
@@ -175,10 +303,10 @@ bool PreTokenizer::tryMatchDate(std::string_view text, size_t pos, PreToken& tok
   idx = byte_pos;
 
   // Try to match month
-  std::string month_str;
-  size_t month_end = parseInteger(text, idx, month_str);
+  DigitRun month;
+  size_t month_end = parseInteger(text, idx, month);
 
-  if (!month_str.empty() && month_str.size() <= 2) {
+  if (!month.empty() && month.count <= 2) {
     byte_pos = month_end;
     if (byte_pos < text.size()) {
       codepoint = normalize::decodeUtf8(text, byte_pos);
@@ -186,10 +314,10 @@ bool PreTokenizer::tryMatchDate(std::string_view text, size_t pos, PreToken& tok
         idx = byte_pos;
 
         // Try to match day
-        std::string day_str;
-        size_t day_end = parseInteger(text, idx, day_str);
+        DigitRun day;
+        size_t day_end = parseInteger(text, idx, day);
 
-        if (!day_str.empty() && day_str.size() <= 2) {
+        if (!day.empty() && day.count <= 2) {
           byte_pos = day_end;
           if (byte_pos < text.size()) {
             codepoint = normalize::decodeUtf8(text, byte_pos);
@@ -216,10 +344,9 @@ bool PreTokenizer::tryMatchDate(std::string_view text, size_t pos, PreToken& tok
 
 bool PreTokenizer::tryMatchCurrency(std::string_view text, size_t pos, PreToken& token) const {
   // Match patterns: 数字+[万億兆]?円
-  std::string num_str;
-  size_t idx = parseDigits(text, pos, num_str);
+  size_t idx = parseDigits(text, pos);
 
-  if (num_str.empty()) {
+  if (idx == pos) {
     return false;
   }
 
@@ -256,10 +383,9 @@ bool PreTokenizer::tryMatchCurrency(std::string_view text, size_t pos, PreToken&
 
 bool PreTokenizer::tryMatchStorage(std::string_view text, size_t pos, PreToken& token) const {
   // Match patterns: 数字[KMGT]?B
-  std::string num_str;
-  size_t idx = parseDigits(text, pos, num_str);
+  size_t idx = parseDigits(text, pos);
 
-  if (num_str.empty()) {
+  if (idx == pos) {
     return false;
   }
 
@@ -298,9 +424,9 @@ bool PreTokenizer::tryMatchVersion(std::string_view text, size_t pos, PreToken&
   }
 
   // First number (use parseInteger to avoid consuming decimal points)
-  std::string num_str;
-  size_t num_end = parseInteger(text, idx, num_str);
-  if (num_str.empty()) {
+  DigitRun num;
+  size_t num_end = parseInteger(text, idx, num);
+  if (num.empty()) {
     return false;
   }
   idx = num_end;
@@ -311,8 +437,8 @@ bool PreTokenizer::tryMatchVersion(std::string_view text, size_t pos, PreToken&
   }
   ++idx;
 
-  num_end = parseInteger(text, idx, num_str);
-  if (num_str.empty()) {
+  num_end = parseInteger(text, idx, num);
+  if (num.empty()) {
     return false;
   }
   idx = num_end;
@@ -320,8 +446,8 @@ bool PreTokenizer::tryMatchVersion(std::string_view text, size_t pos, PreToken&
   // Additional .number segments
   while (idx < text.size() && text[idx] == '.') {
     size_t next = idx + 1;
-    num_end = parseInteger(text, next, num_str);
-    if (num_str.empty()) {
+    num_end = parseInteger(text, next, num);
+    if (num.empty()) {
       break;
     }
     idx = num_end;
@@ -337,10 +463,9 @@ bool PreTokenizer::tryMatchVersion(std::string_view text, size_t pos, PreToken&
 
 bool PreTokenizer::tryMatchPercentage(std::string_view text, size_t pos, PreToken& token) const {
   // Match patterns: 数字%
-  std::string num_str;
-  size_t idx = parseDigits(text, pos, num_str);
+  size_t idx = parseDigits(text, pos);
 
-  if (num_str.empty()) {
+  if (idx == pos) {
     return false;
   }
 
@@ -373,32 +498,22 @@ bool PreTokenizer::tryMatchPercentage(std::string_view text, size_t pos, PreToke
 bool PreTokenizer::tryMatchAddressNumber(std::string_view text, size_t pos, PreToken& token) const {
   // Match address number patterns: 1-2-3, 1-2-3-4 etc.
   // Pattern: digit(s) + (hyphen + digit(s))+
-  std::string num_str;
-  size_t idx = parseInteger(text, pos, num_str);
+  DigitRun num;
+  size_t idx = parseInteger(text, pos, num);
 
-  if (num_str.empty()) {
+  if (num.empty()) {
     return false;
   }
 
   // Must have at least one hyphen-number sequence
   bool has_hyphen = false;
-  std::string surface = num_str;
 
   while (idx < text.size() && text[idx] == '-') {
-    size_t hyphen_pos = idx;
-    ++idx;
-
-    // Parse the next number
-    std::string next_num;
-    size_t next_end = parseInteger(text, idx, next_num);
-    if (next_num.empty()) {
-      // No number after hyphen, revert
-      idx = hyphen_pos;
+    // Parse the next number; a trailing hyphen is not part of the token
+    size_t next_end = parseInteger(text, idx + 1, num);
+    if (num.empty()) {
       break;
     }
-
-    surface += '-';
-    surface += next_num;
     idx = next_end;
     has_hyphen = true;
   }
@@ -407,7 +522,7 @@ bool PreTokenizer::tryMatchAddressNumber(std::string_view text, size_t pos, PreT
     return false;
   }
 
-  token.surface = surface;
+  token.surface = foldDigits(text.substr(pos, idx - pos));
   token.start = pos;
   token.end = idx;
   token.type = PreTokenType::Number;
@@ -495,16 +610,15 @@ bool PreTokenizer::tryMatchTime(std::string_view text, size_t pos, PreToken& tok
     // This requires looking back at UTF-8 boundary
   }
 
-  std::string hour_str;
-  size_t idx = parseInteger(text, pos, hour_str);
+  DigitRun hour;
+  size_t idx = parseInteger(text, pos, hour);
 
-  if (hour_str.empty() || hour_str.size() > 2) {
+  if (hour.empty() || hour.count > 2) {
     return false;
   }
 
   // Validate hour (0-23 or 1-24)
-  int hour = std::stoi(hour_str);
-  if (hour < 0 || hour > 24) {
+  if (hour.value > 24) {
     return false;
   }
 
@@ -521,12 +635,11 @@ bool PreTokenizer::tryMatchTime(std::string_view text, size_t pos, PreToken& tok
   idx = byte_pos;
 
   // Try to match minutes
-  std::string min_str;
-  size_t min_end = parseInteger(text, idx, min_str);
+  DigitRun minute;
+  size_t min_end = parseInteger(text, idx, minute);
 
-  if (!min_str.empty() && min_str.size() <= 2) {
-    int minute = std::stoi(min_str);
-    if (minute >= 0 && minute <= 59) {
+  if (!minute.empty() && minute.count <= 2) {
+    if (minute.value <= 59) {
       byte_pos = min_end;
       if (byte_pos < text.size()) {
         codepoint = normalize::decodeUtf8(text, byte_pos);
@@ -534,12 +647,11 @@ bool PreTokenizer::tryMatchTime(std::string_view text, size_t pos, PreToken& tok
           idx = byte_pos;
 
           // Try to match seconds
-          std::string sec_str;
-          size_t sec_end = parseInteger(text, idx, sec_str);
+          DigitRun second;
+          size_t sec_end = parseInteger(text, idx, second);
 
-          if (!sec_str.empty() && sec_str.size() <= 2) {
-            int second = std::stoi(sec_str);
-            if (second >= 0 && second <= 59) {
+          if (!second.empty() && second.count <= 2) {
+            if (second.value <= 59) {
               byte_pos = sec_end;
               if (byte_pos < text.size()) {
                 codepoint = normalize::decodeUtf8(text, byte_pos);
@@ -753,29 +865,55 @@ PreTokenResult PreTokenizer::process(std::string_view text) const {
     return result;
   }
 
+  // Matchers in priority order
+  // Note: URL must come before Email (URLs contain @ in some cases)
+  // Note: Email must come before Mention (emails have @ followed by domain)
+  // Note: Percentage must come before Version to avoid "3.14%" being parsed as version
+  // Note: Date must come before Time (日付 includes 日 which looks like time suffix)
+  using Matcher = bool (PreTokenizer::*)(std::string_view, size_t, PreToken&) const;
+  static constexpr std::array<std::pair<uint16_t, Matcher>, 12> kMatchers = {{
+      {kTriggerUrl, &PreTokenizer::tryMatchUrl},
+      {kTriggerEmail, &PreTokenizer::tryMatchEmail},
+      {kTriggerHashtag, &PreTokenizer::tryMatchHashtag},
+      {kTriggerMention, &PreTokenizer::tryMatchMention},
+      {kTriggerDate, &PreTokenizer::tryMatchDate},
+      {kTriggerTime, &PreTokenizer::tryMatchTime},
+      {kTriggerCurrency, &PreTokenizer::tryMatchCurrency},
+      {kTriggerStorage, &PreTokenizer::tryMatchStorage},
+      {kTriggerPercentage, &PreTokenizer::tryMatchPercentage},
+      {kTriggerAddress, &PreTokenizer::tryMatchAddressNumber},
+      {kTriggerVersion, &PreTokenizer::tryMatchVersion},
+      {kTriggerAsciiDots, &PreTokenizer::tryMatchAsciiWithDots},
+  }};
+
   size_t pos = 0;
   size_t span_start = 0;
 
   while (pos < text.size()) {
+    // Skip straight to the next byte that can start a token or boundary
+    pos = findNextCandidate(text, pos);
+    if (pos >= text.size()) {
+      break;
+    }
+
     PreToken token;
+    uint16_t triggers = kTriggerTable[static_cast<unsigned char>(text[pos])];
+    bool matched = false;
+    for (const auto& [bit, matcher] : kMatchers) {
+      if ((triggers & bit) != 0 && (this->*matcher)(text, pos, token)) {
+        matched = true;
+        break;
+      }
+    }
 
-    // Try to match patterns in priority order
-    // Note: URL must come before Email (URLs contain @ in some cases)
-    // Note: Email must come before Mention (emails have @ followed by domain)
-    // Note: Percentage must come before Version to avoid "3.14%" being parsed as version
-    // Note: Date must come before Time (日付 includes 日 which looks like time suffix)
-    if (tryMatchUrl(text, pos, token) || tryMatchEmail(text, pos, token) || tryMatchHashtag(text, pos, token) ||
-        tryMatchMention(text, pos, token) || tryMatchDate(text, pos, token) || tryMatchTime(text, pos, token) ||
-        tryMatchCurrency(text, pos, token) || tryMatchStorage(text, pos, token) ||
-        tryMatchPercentage(text, pos, token) || tryMatchAddressNumber(text, pos, token) ||
-        tryMatchVersion(text, pos, token) || tryMatchAsciiWithDots(text, pos, token)) {
+    if (matched) {
       // Add span before this token if any
       if (pos > span_start) {
         result.spans.push_back({span_start, pos});
       }
 
-      result.tokens.push_back(token);
-      pos = token.end;
+      result.tokens.push_back(std::move(token));
+      pos = result.tokens.back().end;
       span_start = pos;
       continue;
     }
@@ -808,8 +946,8 @@ PreTokenResult PreTokenizer::process(std::string_view text) const {
   }
 
   // Add final span if any
-  if (pos > span_start) {
-    result.spans.push_back({span_start, pos});
+  if (text.size() > span_start) {
+    result.spans.push_back({span_start, text.size()});
   }
 
   return result;
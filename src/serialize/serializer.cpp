@@ -0,0 +1,360 @@
+/**
+ * @file serializer.cpp
+ * @brief Morpheme sequence serializers (TSV, JSON, ChaSen, binary)
+ */
+
+#include "serialize/serializer.h"
+
+#include <charconv>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "core/types.h"
+#include "grammar/conjugation.h"
+
+namespace suzume::serialize {
+
+namespace {
+
+constexpr uint8_t kBinaryVersion = 1;
+constexpr uint8_t kFlagDictionary = 1U << 0;
+constexpr uint8_t kFlagUserDict = 1U << 1;
+constexpr uint8_t kFlagUnknown = 1U << 2;
+
+// True for bytes that need escaping in a JSON string
+bool needsJsonEscape(unsigned char chr) {
+  return chr < 0x20 || chr == '"' || chr == '\\';
+}
+
+void appendEscapedByte(OutputBuffer& out, unsigned char chr) {
+  static constexpr char kHex[] = "0123456789abcdef";
+  switch (chr) {
+    case '"':
+      out.append("\\\"");
+      break;
+    case '\\':
+      out.append("\\\\");
+      break;
+    case '\b':
+      out.append("\\b");
+      break;
+    case '\f':
+      out.append("\\f");
+      break;
+    case '\n':
+      out.append("\\n");
+      break;
+    case '\r':
+      out.append("\\r");
+      break;
+    case '\t':
+      out.append("\\t");
+      break;
+    default: {
+      char escaped[6] = {'\\', 'u', '0', '0', kHex[chr >> 4], kHex[chr & 0x0F]};
+      out.append(std::string_view(escaped, sizeof(escaped)));
+      break;
+    }
+  }
+}
+
+// Position of the first byte at or after pos that needs escaping (value.size() if none)
+size_t findJsonEscape(std::string_view value, size_t pos) {
+#if defined(__SSE2__)
+  const auto* data = reinterpret_cast<const unsigned char*>(value.data());
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i control_max = _mm_set1_epi8(0x1F);
+  while (pos + 16 <= value.size()) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+    // Unsigned chr <= 0x1F  <=>  max(chr, 0x1F) == 0x1F
+    __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, control_max), control_max);
+    __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+    auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(control, special)));
+    if (mask != 0) {
+      return pos + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    pos += 16;
+  }
+#endif
+  while (pos < value.size() && !needsJsonEscape(static_cast<unsigned char>(value[pos]))) {
+    ++pos;
+  }
+  return pos;
+}
+
+void appendJsonString(OutputBuffer& out, std::string_view value) {
+  out.append('"');
+  appendJsonEscaped(out, value);
+  out.append('"');
+}
+
+bool hasConjugation(const core::Morpheme& mor) {
+  return mor.pos == core::PartOfSpeech::Verb || mor.pos == core::PartOfSpeech::Adjective;
+}
+
+// Bounds-checked reader for readBinary
+class BinaryReader {
+ public:
+  explicit BinaryReader(std::string_view data) : data_(data) {}
+
+  size_t pos() const { return pos_; }
+
+  bool readByte(uint8_t& out) {
+    if (pos_ >= data_.size()) {
+      return false;
+    }
+    out = static_cast<uint8_t>(data_[pos_++]);
+    return true;
+  }
+
+  bool readVarint(uint64_t& out) {
+    out = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+      uint8_t byte = 0;
+      if (!readByte(byte)) {
+        return false;
+      }
+      out |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool readString(std::string& out) {
+    uint64_t length = 0;
+    if (!readVarint(length) || length > data_.size() - pos_) {
+      return false;
+    }
+    out.assign(data_.data() + pos_, static_cast<size_t>(length));
+    pos_ += static_cast<size_t>(length);
+    return true;
+  }
+
+ private:
+  std::string_view data_;
+  size_t pos_{0};
+};
+
+core::Unexpected<core::Error> binaryError(const std::string& message) {
+  return core::makeUnexpected(core::Error(core::ErrorCode::ParseError, "Invalid binary morphemes: " + message));
+}
+
+}  // namespace
+
+void OutputBuffer::appendUInt(uint64_t value) {
+  char digits[20];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  data_.append(digits, static_cast<size_t>(result.ptr - digits));
+}
+
+void OutputBuffer::appendVarint(uint64_t value) {
+  while (value >= 0x80) {
+    data_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  data_.push_back(static_cast<char>(value));
+}
+
+void appendJsonEscaped(OutputBuffer& out, std::string_view value) {
+  size_t pos = 0;
+  while (pos < value.size()) {
+    size_t special = findJsonEscape(value, pos);
+    // Copy the clean run in one append
+    out.append(value.substr(pos, special - pos));
+    if (special >= value.size()) {
+      break;
+    }
+    appendEscapedByte(out, static_cast<unsigned char>(value[special]));
+    pos = special + 1;
+  }
+}
+
+void writeMorphemeLines(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes) {
+  for (const auto& mor : morphemes) {
+    out.append(mor.surface);
+    out.append('\t');
+    out.append(core::posToString(mor.pos));
+    out.append('\t');
+    out.append(mor.lemma);
+    out.append('\n');
+  }
+}
+
+void writeTsv(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes) {
+  for (const auto& mor : morphemes) {
+    out.append(mor.surface);
+    out.append('\t');
+    out.append(core::posToString(mor.pos));
+    out.append('\t');
+    out.append(mor.lemma);
+    out.append('\t');
+    out.appendUInt(mor.start_pos);
+    out.append('\t');
+    out.appendUInt(mor.end_pos);
+    out.append('\n');
+  }
+}
+
+void writeJsonArray(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes) {
+  out.append('[');
+  for (size_t idx = 0; idx < morphemes.size(); ++idx) {
+    const auto& mor = morphemes[idx];
+    if (idx > 0) {
+      out.append(',');
+    }
+    out.append(R"({"surface":)");
+    appendJsonString(out, mor.surface);
+    out.append(R"(,"pos":")");
+    out.append(core::posToString(mor.pos));
+    out.append(R"(","lemma":)");
+    appendJsonString(out, mor.lemma);
+    out.append(R"(,"start":)");
+    out.appendUInt(mor.start_pos);
+    out.append(R"(,"end":)");
+    out.appendUInt(mor.end_pos);
+    out.append('}');
+  }
+  out.append(']');
+}
+
+void writeJsonDocument(OutputBuffer& out, std::string_view input, const std::vector<core::Morpheme>& morphemes) {
+  out.append("{\n  \"input\": ");
+  appendJsonString(out, input);
+  out.append(",\n  \"morphemes\": [\n");
+  for (size_t idx = 0; idx < morphemes.size(); ++idx) {
+    const auto& mor = morphemes[idx];
+    out.append(R"(    {"surface": )");
+    appendJsonString(out, mor.surface);
+    out.append(R"(, "pos": ")");
+    out.append(core::posToString(mor.pos));
+    out.append(R"(", "lemma": )");
+    appendJsonString(out, mor.lemma);
+    out.append('}');
+    if (idx + 1 < morphemes.size()) {
+      out.append(',');
+    }
+    out.append('\n');
+  }
+  out.append("  ]\n}\n");
+}
+
+void writeChasen(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes) {
+  for (const auto& mor : morphemes) {
+    out.append(mor.surface);
+    // Reading column placeholder (Suzume does not generate readings)
+    out.append("\t*\t");
+    out.append(mor.getLemma());
+    out.append('\t');
+    out.append(core::posToJapanese(mor.pos));
+    out.append('\t');
+    if (hasConjugation(mor)) {
+      out.append(grammar::verbTypeToJapanese(grammar::conjTypeToVerbType(mor.conj_type)));
+      out.append('\t');
+      out.append(grammar::conjFormToJapanese(mor.conj_form));
+    } else {
+      out.append("*\t*");
+    }
+    out.append('\n');
+  }
+  out.append("EOS\n");
+}
+
+void writeBinary(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes) {
+  out.append(static_cast<char>(kBinaryVersion));
+  out.appendVarint(morphemes.size());
+  for (const auto& mor : morphemes) {
+    out.appendVarint(mor.start);
+    out.appendVarint(mor.end >= mor.start ? mor.end - mor.start : 0);
+    out.append(static_cast<char>(mor.pos));
+    out.append(static_cast<char>(mor.extended_pos));
+    out.append(static_cast<char>(mor.conj_type));
+    out.append(static_cast<char>(mor.conj_form));
+    uint8_t flags = 0;
+    flags |= mor.features.is_dictionary ? kFlagDictionary : 0;
+    flags |= mor.features.is_user_dict ? kFlagUserDict : 0;
+    flags |= mor.is_unknown ? kFlagUnknown : 0;
+    out.append(static_cast<char>(flags));
+    out.appendVarint(mor.surface.size());
+    out.append(mor.surface);
+    out.appendVarint(mor.lemma.size());
+    out.append(mor.lemma);
+  }
+}
+
+core::Expected<size_t, core::Error> readBinary(std::string_view data, std::vector<core::Morpheme>& morphemes) {
+  BinaryReader reader(data);
+  uint8_t version = 0;
+  if (!reader.readByte(version) || version != kBinaryVersion) {
+    return binaryError("unsupported version");
+  }
+  uint64_t count = 0;
+  // Every morpheme takes at least 9 bytes, which bounds a corrupt count
+  if (!reader.readVarint(count) || count > data.size() / 9) {
+    return binaryError("bad morpheme count");
+  }
+
+  morphemes.clear();
+  morphemes.reserve(static_cast<size_t>(count));
+  for (uint64_t idx = 0; idx < count; ++idx) {
+    core::Morpheme mor;
+    uint64_t start = 0;
+    uint64_t length = 0;
+    uint8_t pos = 0;
+    uint8_t extended_pos = 0;
+    uint8_t conj_type = 0;
+    uint8_t conj_form = 0;
+    uint8_t flags = 0;
+    if (!reader.readVarint(start) || !reader.readVarint(length) || !reader.readByte(pos) ||
+        !reader.readByte(extended_pos) || !reader.readByte(conj_type) || !reader.readByte(conj_form) ||
+        !reader.readByte(flags) || !reader.readString(mor.surface) || !reader.readString(mor.lemma)) {
+      return binaryError("truncated morpheme " + std::to_string(idx));
+    }
+    if (pos >= static_cast<uint8_t>(core::PartOfSpeech::Count_) ||
+        extended_pos >= static_cast<uint8_t>(core::ExtendedPOS::Count_)) {
+      return binaryError("bad part of speech in morpheme " + std::to_string(idx));
+    }
+    if (conj_type > static_cast<uint8_t>(dictionary::ConjugationType::ProperGiven) ||
+        conj_form > static_cast<uint8_t>(grammar::ConjForm::Ishikei)) {
+      return binaryError("bad conjugation in morpheme " + std::to_string(idx));
+    }
+    mor.start = static_cast<size_t>(start);
+    mor.end = static_cast<size_t>(start + length);
+    mor.pos = static_cast<core::PartOfSpeech>(pos);
+    mor.extended_pos = static_cast<core::ExtendedPOS>(extended_pos);
+    mor.conj_type = static_cast<dictionary::ConjugationType>(conj_type);
+    mor.conj_form = static_cast<grammar::ConjForm>(conj_form);
+    mor.features.is_dictionary = (flags & kFlagDictionary) != 0;
+    mor.features.is_user_dict = (flags & kFlagUserDict) != 0;
+    mor.is_unknown = (flags & kFlagUnknown) != 0;
+    mor.syncPositions();
+    morphemes.push_back(std::move(mor));
+  }
+  return reader.pos();
+}
+
+void serialize(OutputBuffer& out, SerialFormat format, const std::vector<core::Morpheme>& morphemes) {
+  switch (format) {
+    case SerialFormat::Morpheme:
+      writeMorphemeLines(out, morphemes);
+      break;
+    case SerialFormat::Tsv:
+      writeTsv(out, morphemes);
+      break;
+    case SerialFormat::Json:
+      writeJsonArray(out, morphemes);
+      break;
+    case SerialFormat::Chasen:
+      writeChasen(out, morphemes);
+      break;
+    case SerialFormat::Binary:
+      writeBinary(out, morphemes);
+      break;
+  }
+}
+
+}  // namespace suzume::serialize
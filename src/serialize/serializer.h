@@ -0,0 +1,131 @@
+/**
+ * @file serializer.h
+ * @brief Morpheme sequence serializers (TSV, JSON, ChaSen, binary)
+ *
+ * Shared by the CLI, the C API and server modes. Writers append to an
+ * OutputBuffer instead of formatting through iostreams, so a whole document
+ * is produced with a handful of amortized appends and no per-field
+ * temporaries.
+ */
+
+#ifndef SUZUME_SERIALIZE_SERIALIZER_H_
+#define SUZUME_SERIALIZE_SERIALIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/error.h"
+#include "core/morpheme.h"
+
+namespace suzume::serialize {
+
+/**
+ * @brief Output format for serialize()
+ */
+enum class SerialFormat : uint8_t {
+  Morpheme = 0,  // surface TAB pos TAB lemma
+  Tsv,           // surface TAB pos TAB lemma TAB start TAB end
+  Json,          // Compact array of {"surface","pos","lemma","start","end"}
+  Chasen,        // ChaSen-like lines terminated by EOS
+  Binary,        // Length-prefixed binary (see writeBinary)
+};
+
+/**
+ * @brief Growable byte buffer for serializer output
+ */
+class OutputBuffer {
+ public:
+  OutputBuffer() = default;
+  explicit OutputBuffer(size_t reserve_bytes) { data_.reserve(reserve_bytes); }
+
+  void append(std::string_view bytes) { data_.append(bytes.data(), bytes.size()); }
+  void append(char chr) { data_.push_back(chr); }
+
+  /**
+   * @brief Append an unsigned integer in decimal
+   */
+  void appendUInt(uint64_t value);
+
+  /**
+   * @brief Append an unsigned LEB128 varint
+   */
+  void appendVarint(uint64_t value);
+
+  std::string_view view() const { return data_; }
+  const char* data() const { return data_.data(); }
+  size_t size() const { return data_.size(); }
+  bool empty() const { return data_.empty(); }
+  void clear() { data_.clear(); }
+  void reserve(size_t bytes) { data_.reserve(bytes); }
+
+  /**
+   * @brief Move the contents out (the buffer is left empty)
+   */
+  std::string release() { return std::move(data_); }
+
+ private:
+  std::string data_;
+};
+
+/**
+ * @brief Append a string with JSON escaping (no surrounding quotes)
+ *
+ * Escapes '"', '\\' and control characters; other bytes, including UTF-8
+ * sequences, are copied as-is. Runs without special bytes are copied 16
+ * bytes at a time where SSE2 is available.
+ */
+void appendJsonEscaped(OutputBuffer& out, std::string_view value);
+
+/**
+ * @brief surface TAB pos TAB lemma, one morpheme per line
+ */
+void writeMorphemeLines(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief surface TAB pos TAB lemma TAB start TAB end, one morpheme per line
+ */
+void writeTsv(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief Compact JSON array: [{"surface":..,"pos":..,"lemma":..,"start":..,"end":..},...]
+ */
+void writeJsonArray(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief Indented JSON document {"input":..,"morphemes":[{"surface","pos","lemma"}]}
+ */
+void writeJsonDocument(OutputBuffer& out, std::string_view input, const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief ChaSen-like format: surface, reading (*), lemma, POS, conjugation type/form; EOS line
+ */
+void writeChasen(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief Length-prefixed binary encoding
+ *
+ * Layout: version byte (1), varint count, then per morpheme: varint start,
+ * varint length (end - start, in characters), pos, extended_pos, conj_type,
+ * conj_form and flags bytes (bit 0 dictionary, bit 1 user dictionary,
+ * bit 2 unknown), varint surface byte length + bytes, varint lemma byte
+ * length + bytes.
+ */
+void writeBinary(OutputBuffer& out, const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief Decode writeBinary output
+ * @return Number of bytes consumed, or ParseError on malformed input
+ */
+core::Expected<size_t, core::Error> readBinary(std::string_view data, std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief Write morphemes in the given format
+ */
+void serialize(OutputBuffer& out, SerialFormat format, const std::vector<core::Morpheme>& morphemes);
+
+}  // namespace suzume::serialize
+
+#endif  // SUZUME_SERIALIZE_SERIALIZER_H_
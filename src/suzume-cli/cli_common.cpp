@@ -3,10 +3,9 @@
 #include <unistd.h>
 
 #include <cstring>
-#include <iomanip>
 #include <limits>
-#include <sstream>
 
+#include "serialize/serializer.h"
 #include "suzume.h"
 
 namespace suzume::cli {
@@ -79,43 +78,9 @@ bool parseSizeOption(std::string_view value, size_t* out) {
 }
 
 std::string jsonEscape(std::string_view value) {
-  std::ostringstream out;
-  out << std::hex << std::setfill('0');
-
-  for (unsigned char chr : value) {
-    switch (chr) {
-      case '"':
-        out << "\\\"";
-        break;
-      case '\\':
-        out << "\\\\";
-        break;
-      case '\b':
-        out << "\\b";
-        break;
-      case '\f':
-        out << "\\f";
-        break;
-      case '\n':
-        out << "\\n";
-        break;
-      case '\r':
-        out << "\\r";
-        break;
-      case '\t':
-        out << "\\t";
-        break;
-      default:
-        if (chr < 0x20) {
-          out << "\\u" << std::setw(4) << static_cast<int>(chr);
-        } else {
-          out << static_cast<char>(chr);
-        }
-        break;
-    }
-  }
-
-  return out.str();
+  serialize::OutputBuffer out(value.size());
+  serialize::appendJsonEscaped(out, value);
+  return out.release();
 }
 
 std::vector<std::string> readStdin() {
@@ -252,11 +217,38 @@ CommandArgs parseArgs(int argc, char* argv[]) {
       continue;
     }
 
+    // Bulk analysis: worker threads
+    if ((arg == "-j" || arg == "--jobs") && idx + 1 < argc) {
+      size_t jobs = 0;
+      if (!parseSizeOption(argv[++idx], &jobs)) {
+        printError(std::string("Invalid --jobs value: ") + argv[idx]);
+        exit(1);
+      }
+      args.jobs = jobs;
+      ++idx;
+      continue;
+    }
+
+    // Bulk analysis: input files
+    if (arg == "--input" && idx + 1 < argc) {
+      args.inputs.emplace_back(argv[++idx]);
+      ++idx;
+      continue;
+    }
+
+    // Bulk analysis: one document per line
+    if (arg == "--lines") {
+      args.per_line = true;
+      ++idx;
+      continue;
+    }
+
     // Command or positional argument
     if (arg[0] != '-') {
       if (args.command.empty()) {
         // Check if it's a known command
-        if (arg == "analyze" || arg == "dict" || arg == "test" || arg == "version" || arg == "help") {
+        if (arg == "analyze" || arg == "dict" || arg == "test" || arg == "serve" || arg == "version" ||
+            arg == "help") {
           args.command = arg;
         } else {
           // Not a command, treat as text input (implicit analyze)
@@ -292,6 +284,7 @@ Commands:
   analyze     Morphological analysis (default)
   dict        Dictionary management
   test        Verification and testing
+  serve       Persistent analyzer answering JSON lines (stdin or socket)
   version     Show version information
   help        Show this help
 
@@ -315,6 +308,7 @@ Examples:
   suzume-cli analyze -f json "text"  Analyze with JSON output
   suzume-cli dict compile user.tsv   Compile dictionary
   suzume-cli dict -i user.tsv        Interactive dictionary editor
+  suzume-cli serve < requests.jsonl  Answer JSON requests with one warm analyzer
 
 Use 'suzume-cli [command] --help' for command-specific help.
 )";
@@ -337,8 +331,17 @@ Options:
   --normalize-vu         Normalize ヴ to ビ etc. (default: preserve)
   --lowercase            Convert ASCII to lowercase (default: preserve)
   --preserve-symbols     Keep symbols/emoji in output (default: remove)
+  -j, --jobs N           Analyze documents on N threads (0 = all cores)
+  --input PATH           Input file, directory or glob (can specify multiple)
+  --lines                One document per line in --input files
+                         (stdin is always one document per line with --jobs)
   -h, --help             Show this help
 
+Bulk Mode (--jobs or --input):
+  Documents are analyzed in parallel and written in input order. json
+  output is one JSON object per document with an "id" (line number, path or
+  path:line); other formats end each document with an EOS line.
+
 Output Formats:
   morpheme               surface TAB pos TAB lemma (default)
   tags                   Tags only, one per line
@@ -355,6 +358,8 @@ Examples:
   suzume-cli analyze --compare -d user.dic "text"
   suzume-cli analyze --normalize-vu "ヴァイオリン"
   echo "text" | suzume-cli analyze
+  suzume-cli analyze -j 8 -f json < corpus.txt
+  suzume-cli analyze -j 0 --input 'docs/*.txt' -f tsv
 )";
 }
 
@@ -377,8 +382,9 @@ Subcommands:
   new <file.tsv>         Create new dictionary file
   info [file]            Show dictionary information
   validate [file]        Validate dictionary
-  compile <in.tsv> [out.dic]
+  compile [--conjugation-index] <in.tsv> [out.dic]
                          Compile to binary format (default: in.dic)
+                         --conjugation-index also stores conjugated forms
   decompile <in.dic> [out.tsv]
                          Decompile binary to TSV (default: in.tsv)
   -i, --interactive [file.tsv]
@@ -417,6 +423,10 @@ Subcommands:
                          Run tests from file
   benchmark [--iterations=N] [-f <corpus.txt>]
                          Run performance benchmark
+  startup [--budget-us=N] [--text <text>]
+                         Time analyzer construction and first analysis
+  worst-case [--budget-us=N] [--edges-per-position=N] [--edges-per-chunk=N] [--compare]
+                         Time pathological inputs under the work budgets
   regression -f <baseline.tsv>
                          Run regression tests
   coverage -d <dict.dic> -f <corpus.txt>
@@ -424,6 +434,7 @@ Subcommands:
 
 Options:
   -d, --dict PATH        Load user dictionary
+  --no-user-dict         Disable user dictionary
   -h, --help             Show this help
 
 Test File Format (TSV):
@@ -434,6 +445,50 @@ Examples:
   suzume-cli test -f tests.tsv
   suzume-cli test -f tests.tsv -d user.dic
   suzume-cli test benchmark --iterations=1000
+  suzume-cli test startup --no-user-dict --budget-us=5000
+  suzume-cli test worst-case --compare
+)";
+}
+
+void printServeHelp() {
+  std::cout << R"(suzume-cli serve - Persistent analysis server
+
+Usage:
+  suzume-cli serve [options]
+  suzume-cli serve --socket PATH [options]
+
+Keeps analyzers and dictionaries loaded and answers one request per line.
+Responses are written one per line in request order; requests may be
+pipelined without waiting for responses. Without --socket, requests are
+read from stdin until EOF. With --socket, connections are served
+concurrently, each with its own analyzers. Request lines longer than
+16 MiB are answered with an error and skipped.
+
+Options:
+  --socket PATH          Listen on a Unix domain socket instead of stdin
+  -j, --jobs N           Connections served at once (default: all cores)
+  -d, --dict PATH        Load user dictionary (can specify multiple)
+  -m, --mode MODE        Default analysis mode: normal, search, split
+  --no-user-dict         Disable user dictionary
+  --normalize-vu         Default: normalize ヴ to ビ etc.
+  --lowercase            Default: convert ASCII to lowercase
+  --preserve-symbols     Default: keep symbols/emoji in output
+  -h, --help             Show this help
+
+Request (one JSON object per line; other lines are analyzed as plain text):
+  {"id": 1, "text": "...", "mode": "search", "format": "json",
+   "options": {"preserve_symbols": true, "normalize_vu": false, "lowercase": false}}
+  All fields except "text" are optional; "id" (a string, number or null)
+  is echoed back.
+
+Response:
+  {"id":1,"morphemes":[{"surface":"...","pos":"...","lemma":"...","start":0,"end":2}]}
+  {"id":1,"output":"..."}    (format morpheme, tags, tsv or chasen)
+  {"id":1,"error":"..."}
+
+Examples:
+  suzume-cli serve < requests.jsonl
+  suzume-cli serve --socket /tmp/suzume.sock -d user.dic
 )";
 }
 
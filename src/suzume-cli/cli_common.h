@@ -2,6 +2,7 @@
 #define SUZUME_CLI_CLI_COMMON_H_
 
 #include <iostream>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -108,6 +109,11 @@ struct CommandArgs {
 
   // Postprocess options
   bool preserve_symbols = false;  // --preserve-symbols: keep symbols in output
+
+  // Bulk analysis options
+  std::optional<size_t> jobs;       // -j, --jobs: worker threads (0 = all cores)
+  std::vector<std::string> inputs;  // --input: files, directories or globs
+  bool per_line = false;            // --lines: one document per input line
 };
 
 /**
@@ -138,6 +144,11 @@ void printDictHelp();
  */
 void printTestHelp();
 
+/**
+ * @brief Print help for serve command
+ */
+void printServeHelp();
+
 }  // namespace suzume::cli
 
 #endif  // SUZUME_CLI_CLI_COMMON_H_
@@ -1,84 +1,230 @@
 #include "cmd_analyze.h"
 
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
 
-#include "grammar/conjugation.h"
+#include "input_files.h"
+#include "ordered_pipeline.h"
+#include "serve_protocol.h"
 #include "suzume.h"
 
 namespace suzume::cli {
 
 namespace {
 
-void outputMorpheme(const std::vector<core::Morpheme>& morphemes) {
-  for (const auto& morpheme : morphemes) {
-    std::cout << morpheme.surface << "\t" << core::posToString(morpheme.pos) << "\t" << morpheme.lemma << "\n";
+void outputTags(serialize::OutputBuffer& out, const std::vector<postprocess::TagEntry>& tags) {
+  for (const auto& tag : tags) {
+    out.append(tag.tag);
+    out.append('\t');
+    out.append(core::posToString(tag.pos));
+    out.append('\n');
   }
 }
 
-void outputTags(const std::vector<postprocess::TagEntry>& tags) {
-  for (const auto& tag : tags) {
-    std::cout << tag.tag << "\t" << core::posToString(tag.pos) << "\n";
+// Bulk mode batching: documents are handed to workers in groups to amortize
+// synchronization, and the writer flushes output in large chunks.
+constexpr size_t kBatchMaxDocuments = 256;
+constexpr size_t kBatchMaxBytes = 256 * 1024;
+constexpr size_t kBatchesInFlightPerJob = 4;
+constexpr size_t kOutputBufferBytes = 1 << 20;
+
+struct BulkDocument {
+  std::string id;  // JSON value identifying the document (json output)
+  std::string text;
+};
+
+using BulkBatch = std::vector<BulkDocument>;
+
+/**
+ * @brief Reads documents from stdin (one per line) or files (whole or per line)
+ */
+class BulkReader {
+ public:
+  BulkReader(std::vector<std::string> files, bool per_line) : files_(std::move(files)), per_line_(per_line) {}
+
+  bool next(BulkBatch& batch) {
+    batch.clear();
+    size_t bytes = 0;
+    BulkDocument doc;
+    while (batch.size() < kBatchMaxDocuments && bytes < kBatchMaxBytes && nextDocument(doc)) {
+      bytes += doc.text.size();
+      batch.push_back(std::move(doc));
+      doc = BulkDocument{};
+    }
+    return !batch.empty();
   }
-}
 
-void outputJson(const std::string& input, const std::vector<core::Morpheme>& morphemes) {
-  std::cout << "{\n";
-  std::cout << R"(  "input": ")" << jsonEscape(input) << "\",\n";
-  std::cout << "  \"morphemes\": [\n";
-
-  for (size_t idx = 0; idx < morphemes.size(); ++idx) {
-    const auto& mor = morphemes[idx];
-    std::cout << "    {";
-    std::cout << R"("surface": ")" << jsonEscape(mor.surface) << "\", ";
-    std::cout << R"("pos": ")" << core::posToString(mor.pos) << "\", ";
-    std::cout << R"("lemma": ")" << jsonEscape(mor.lemma) << "\"";
-    std::cout << "}";
-    if (idx + 1 < morphemes.size()) {
-      std::cout << ",";
+ private:
+  std::vector<std::string> files_;
+  bool per_line_;
+  size_t file_idx_{0};
+  std::ifstream stream_;
+  size_t line_number_{0};
+
+  static std::string quoted(std::string_view value) { return "\"" + jsonEscape(value) + "\""; }
+
+  bool nextDocument(BulkDocument& doc) {
+    if (files_.empty()) {
+      // stdin: one document per line
+      if (!std::getline(std::cin, doc.text)) {
+        return false;
+      }
+      doc.id = std::to_string(++line_number_);
+      return true;
     }
-    std::cout << "\n";
+
+    while (file_idx_ < files_.size()) {
+      const std::string& path = files_[file_idx_];
+      if (!stream_.is_open()) {
+        stream_.open(path, std::ios::binary);
+        if (!stream_) {
+          throw std::runtime_error("Cannot open input file: " + path);
+        }
+        line_number_ = 0;
+      }
+
+      if (!per_line_) {
+        std::ostringstream content;
+        content << stream_.rdbuf();
+        doc.text = content.str();
+        doc.id = quoted(path);
+        closeCurrent();
+        return true;
+      }
+
+      if (std::getline(stream_, doc.text)) {
+        doc.id = quoted(path + ":" + std::to_string(++line_number_));
+        return true;
+      }
+      closeCurrent();
+    }
+    return false;
   }
 
-  std::cout << "  ]\n";
-  std::cout << "}\n";
+  void closeCurrent() {
+    stream_.close();
+    stream_.clear();
+    ++file_idx_;
+  }
+};
+
+SuzumeOptions makeSuzumeOptions(const CommandArgs& args) {
+  SuzumeOptions options;
+  options.mode = parseMode(args.mode);
+  // Default is preserve (true), flags invert to normalize
+  options.normalize_options.preserve_vu = !args.normalize_vu;
+  options.normalize_options.preserve_case = !args.lowercase;
+  // Default is remove symbols (true), flag inverts to preserve
+  options.remove_symbols = !args.preserve_symbols;
+  options.skip_user_dictionary = args.no_user_dict;
+  return options;
 }
 
-void outputTsv(const std::vector<core::Morpheme>& morphemes) {
-  for (const auto& mor : morphemes) {
-    std::cout << mor.surface << "\t" << core::posToString(mor.pos) << "\t" << mor.lemma << "\t" << mor.start_pos << "\t"
-              << mor.end_pos << "\n";
+/**
+ * @brief Analyze many documents on worker threads, writing output in input order
+ *
+ * json output is one JSON object per document ({"id":...,"morphemes":[...]});
+ * other formats are followed by an EOS line per document (chasen already
+ * ends with one).
+ */
+int analyzeBulk(const CommandArgs& args) {
+  if (!args.args.empty()) {
+    printError("Text arguments cannot be combined with --jobs/--input");
+    return 1;
+  }
+  if (args.compare || args.debug) {
+    printError("--compare and --debug are not supported with --jobs/--input");
+    return 1;
   }
-}
 
-void outputChasen(const std::vector<core::Morpheme>& morphemes) {
-  for (const auto& mor : morphemes) {
-    // Surface form
-    std::cout << mor.surface << "\t";
+  std::vector<std::string> files;
+  if (!args.inputs.empty()) {
+    auto expanded = expandInputPaths(args.inputs);
+    if (!expanded.hasValue()) {
+      printError(expanded.error().message);
+      return 1;
+    }
+    files = std::move(expanded.value());
+  }
 
-    // Reading column placeholder (Suzume does not generate readings)
-    std::cout << "*\t";
+  size_t jobs = args.jobs.value_or(1);
+  if (jobs == 0) {
+    jobs = std::max(1U, std::thread::hardware_concurrency());
+  }
+  if (args.verbose) {
+    printInfo("Analyzing " + (files.empty() ? std::string("stdin") : std::to_string(files.size()) + " file(s)") +
+              " with " + std::to_string(jobs) + " job(s)");
+  }
 
-    // Lemma (base form)
-    std::cout << mor.getLemma() << "\t";
+  SuzumeOptions options = makeSuzumeOptions(args);
+  BulkReader reader(std::move(files), args.per_line || args.inputs.empty());
+
+  // Output is collected and written in large chunks
+  serialize::OutputBuffer pending(kOutputBufferBytes);
+  auto flush_pending = [&pending]() {
+    std::fwrite(pending.data(), 1, pending.size(), stdout);
+    pending.clear();
+  };
+
+  try {
+    runOrderedPipeline<Suzume, BulkBatch, std::string>(
+        jobs, jobs * kBatchesInFlightPerJob, [&reader](BulkBatch& batch) { return reader.next(batch); },
+        [&args, &options]() {
+          auto analyzer = std::make_unique<Suzume>(options);
+          for (const auto& dict_path : args.dict_paths) {
+            auto load_result = analyzer->loadUserDictionaryResult(dict_path);
+            if (!load_result.hasValue()) {
+              throw std::runtime_error("Failed to load dictionary: " + dict_path + ": " + load_result.error().message);
+            }
+          }
+          return analyzer;
+        },
+        [&args](Suzume& analyzer, BulkBatch& batch) {
+          serialize::OutputBuffer out;
+          for (const auto& doc : batch) {
+            if (args.format == OutputFormat::Json) {
+              appendServeMorphemes(out, doc.id, analyzer.analyze(doc.text));
+              out.append('\n');
+              continue;
+            }
+            writeAnalysis(out, args.format, analyzer, doc.text);
+            if (args.format != OutputFormat::Chasen) {
+              out.append("EOS\n");
+            }
+          }
+          return out.release();
+        },
+        [&pending, &flush_pending](std::string& output) {
+          pending.append(output);
+          if (pending.size() >= kOutputBufferBytes) {
+            flush_pending();
+          }
+        });
+  } catch (const std::exception& err) {
+    flush_pending();
+    std::fflush(stdout);
+    printError(err.what());
+    return 1;
+  }
 
-    // Part of speech (Japanese)
-    std::cout << core::posToJapanese(mor.pos) << "\t";
+  flush_pending();
+  std::fflush(stdout);
+  return 0;
+}
 
-    // Conjugation type and form (for verbs and adjectives)
-    if (mor.pos == core::PartOfSpeech::Verb || mor.pos == core::PartOfSpeech::Adjective) {
-      auto verb_type = grammar::conjTypeToVerbType(mor.conj_type);
-      std::cout << grammar::verbTypeToJapanese(verb_type) << "\t";
-      std::cout << grammar::conjFormToJapanese(mor.conj_form);
-    } else {
-      std::cout << "*\t*";
-    }
-    std::cout << "\n";
-  }
-  std::cout << "EOS\n";
+void writeMorphemes(const std::vector<core::Morpheme>& morphemes) {
+  serialize::OutputBuffer out;
+  serialize::writeMorphemeLines(out, morphemes);
+  std::cout.write(out.data(), static_cast<std::streamsize>(out.size()));
 }
 
+}  // namespace
+
 core::AnalysisMode parseMode(const std::string& mode_str) {
   if (mode_str == "search") {
     return core::AnalysisMode::Search;
@@ -89,7 +235,25 @@ core::AnalysisMode parseMode(const std::string& mode_str) {
   return core::AnalysisMode::Normal;
 }
 
-}  // namespace
+void writeAnalysis(serialize::OutputBuffer& out, OutputFormat format, const Suzume& analyzer, const std::string& text) {
+  switch (format) {
+    case OutputFormat::Morpheme:
+      serialize::writeMorphemeLines(out, analyzer.analyze(text));
+      break;
+    case OutputFormat::Tags:
+      outputTags(out, analyzer.generateTags(text));
+      break;
+    case OutputFormat::Json:
+      serialize::writeJsonDocument(out, text, analyzer.analyze(text));
+      break;
+    case OutputFormat::Tsv:
+      serialize::writeTsv(out, analyzer.analyze(text));
+      break;
+    case OutputFormat::Chasen:
+      serialize::writeChasen(out, analyzer.analyze(text));
+      break;
+  }
+}
 
 int cmdAnalyze(const CommandArgs& args) {
   if (args.help) {
@@ -97,6 +261,10 @@ int cmdAnalyze(const CommandArgs& args) {
     return 0;
   }
 
+  if (args.jobs.has_value() || !args.inputs.empty()) {
+    return analyzeBulk(args);
+  }
+
   // Get input text
   std::string text;
   if (!args.args.empty()) {
@@ -129,14 +297,7 @@ int cmdAnalyze(const CommandArgs& args) {
   }
 
   // Create analyzer
-  SuzumeOptions options;
-  options.mode = parseMode(args.mode);
-  // Default is preserve (true), flags invert to normalize
-  options.normalize_options.preserve_vu = !args.normalize_vu;
-  options.normalize_options.preserve_case = !args.lowercase;
-  // Default is remove symbols (true), flag inverts to preserve
-  options.remove_symbols = !args.preserve_symbols;
-  options.skip_user_dictionary = args.no_user_dict;
+  SuzumeOptions options = makeSuzumeOptions(args);
   options.report_scorer_config = args.verbose;
 
   Suzume analyzer(options);
@@ -159,14 +320,14 @@ int cmdAnalyze(const CommandArgs& args) {
     auto base_morphemes = base_analyzer.analyze(text);
 
     std::cout << "[Without user dictionary]\n";
-    outputMorpheme(base_morphemes);
+    writeMorphemes(base_morphemes);
     std::cout << "\n";
 
     // Analyze with user dictionary
     auto morphemes = analyzer.analyze(text);
 
     std::cout << "[With user dictionary]\n";
-    outputMorpheme(morphemes);
+    writeMorphemes(morphemes);
     std::cout << "\n";
 
     // Show diff (simplified)
@@ -225,38 +386,14 @@ int cmdAnalyze(const CommandArgs& args) {
     }
 
     std::cout << "\n=== Result ===\n";
-    outputMorpheme(morphemes);
+    writeMorphemes(morphemes);
     return 0;
   }
 
   // Normal analysis
-  switch (args.format) {
-    case OutputFormat::Morpheme: {
-      auto morphemes = analyzer.analyze(text);
-      outputMorpheme(morphemes);
-      break;
-    }
-    case OutputFormat::Tags: {
-      auto tags = analyzer.generateTags(text);
-      outputTags(tags);
-      break;
-    }
-    case OutputFormat::Json: {
-      auto morphemes = analyzer.analyze(text);
-      outputJson(text, morphemes);
-      break;
-    }
-    case OutputFormat::Tsv: {
-      auto morphemes = analyzer.analyze(text);
-      outputTsv(morphemes);
-      break;
-    }
-    case OutputFormat::Chasen: {
-      auto morphemes = analyzer.analyze(text);
-      outputChasen(morphemes);
-      break;
-    }
-  }
+  serialize::OutputBuffer out;
+  writeAnalysis(out, args.format, analyzer, text);
+  std::cout.write(out.data(), static_cast<std::streamsize>(out.size()));
 
   return 0;
 }
@@ -1,7 +1,12 @@
 #ifndef SUZUME_CLI_CMD_ANALYZE_H_
 #define SUZUME_CLI_CMD_ANALYZE_H_
 
+#include <string>
+
 #include "cli_common.h"
+#include "core/types.h"
+#include "serialize/serializer.h"
+#include "suzume.h"
 
 namespace suzume::cli {
 
@@ -12,6 +17,16 @@ namespace suzume::cli {
  */
 int cmdAnalyze(const CommandArgs& args);
 
+/**
+ * @brief Parse analysis mode name (normal, search, split; unknown = normal)
+ */
+core::AnalysisMode parseMode(const std::string& mode_str);
+
+/**
+ * @brief Analyze text and write it in the given output format
+ */
+void writeAnalysis(serialize::OutputBuffer& out, OutputFormat format, const Suzume& analyzer, const std::string& text);
+
 }  // namespace suzume::cli
 
 #endif  // SUZUME_CLI_CMD_ANALYZE_H_
@@ -128,9 +128,10 @@ int cmdDictInfo(const std::vector<std::string>& args, bool /* verbose */) {
     }
 
     std::cout << "Dictionary: " << path << "\n";
-    std::cout << "Format: Binary v" << dictionary::BinaryDictHeader::kVersionMajor << "."
-              << dictionary::BinaryDictHeader::kVersionMinor << "\n";
+    std::cout << "Format: Binary v" << dictionary::BinaryDictHeader::kVersionMajor << "." << dict.versionMinor()
+              << "\n";
     std::cout << "Entries: " << dict.size() << "\n";
+    std::cout << "Conjugated forms: " << dict.conjugationCount() << "\n";
 
     // File size
     std::ifstream file(path, std::ios::binary | std::ios::ate);
@@ -254,19 +255,22 @@ std::vector<std::string> expandGlobs(const std::vector<std::string>& paths) {
 int cmdDictCompile(const std::vector<std::string>& args, bool verbose) {
   if (args.empty()) {
     printError(
-        "Usage: suzume-cli dict compile [--filter-trivial] <input.tsv>... "
+        "Usage: suzume-cli dict compile [--filter-trivial] [--conjugation-index] <input.tsv>... "
         "<output.dic>\n"
-        "       suzume-cli dict compile [--filter-trivial] <input.tsv>  "
+        "       suzume-cli dict compile [--filter-trivial] [--conjugation-index] <input.tsv>  "
         "(output: input.dic)");
     return 1;
   }
 
-  // Extract --filter-trivial flag from args
+  // Extract --filter-trivial / --conjugation-index flags from args
   bool filter_trivial = false;
+  bool conjugation_index = false;
   std::vector<std::string> file_args;
   for (const auto& arg : args) {
     if (arg == "--filter-trivial") {
       filter_trivial = true;
+    } else if (arg == "--conjugation-index") {
+      conjugation_index = true;
     } else {
       file_args.push_back(arg);
     }
@@ -280,6 +284,7 @@ int cmdDictCompile(const std::vector<std::string>& args, bool verbose) {
   DictCompiler compiler;
   compiler.setVerbose(verbose);
   compiler.setFilterTrivial(filter_trivial);
+  compiler.setConjugationIndex(conjugation_index);
 
   // Single file mode: dict compile foo.tsv -> foo.dic
   if (file_args.size() == 1) {
@@ -0,0 +1,472 @@
+#include "cmd_serve.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+#include "cmd_analyze.h"
+#include "serve_protocol.h"
+#include "suzume.h"
+
+namespace suzume::cli {
+
+namespace {
+
+/**
+ * @brief Warm analyzers keyed by option set, created on first use
+ */
+class ServeSession {
+ public:
+  explicit ServeSession(const CommandArgs& args) : args_(args) {}
+
+  /**
+   * @brief Create the default analyzer up front (fail fast on bad dictionaries)
+   */
+  bool init(std::string& error) { return analyzerFor(ServeOptions{}, error) != nullptr; }
+
+  /**
+   * @brief Handle one request line and return the response line (no newline)
+   */
+  std::string handle(std::string_view line) {
+    std::string id;
+    auto parsed = parseServeRequest(line, &id);
+    if (!parsed.hasValue()) {
+      return formatServeError(id, parsed.error().message);
+    }
+    const ServeRequest& request = parsed.value();
+
+    std::string error;
+    Suzume* analyzer = analyzerFor(request.options, error);
+    if (analyzer == nullptr) {
+      return formatServeError(request.id, error);
+    }
+
+    try {
+      core::AnalysisMode mode = parseMode(request.mode.value_or(args_.mode));
+      if (analyzer->mode() != mode) {
+        analyzer->setMode(mode);
+      }
+
+      OutputFormat format = request.format.value_or(OutputFormat::Json);
+      if (format == OutputFormat::Json) {
+        return formatServeMorphemes(request.id, analyzer->analyze(request.text));
+      }
+      serialize::OutputBuffer out;
+      writeAnalysis(out, format, *analyzer, request.text);
+      return formatServeOutput(request.id, out.view());
+    } catch (const std::exception& err) {
+      return formatServeError(request.id, err.what());
+    }
+  }
+
+ private:
+  const CommandArgs& args_;
+  std::map<unsigned, std::unique_ptr<Suzume>> analyzers_;
+
+  Suzume* analyzerFor(const ServeOptions& request_options, std::string& error) {
+    bool preserve_symbols = request_options.preserve_symbols.value_or(args_.preserve_symbols);
+    bool normalize_vu = request_options.normalize_vu.value_or(args_.normalize_vu);
+    bool lowercase = request_options.lowercase.value_or(args_.lowercase);
+    unsigned key = (preserve_symbols ? 1U : 0U) | (normalize_vu ? 2U : 0U) | (lowercase ? 4U : 0U);
+
+    auto iter = analyzers_.find(key);
+    if (iter != analyzers_.end()) {
+      return iter->second.get();
+    }
+
+    SuzumeOptions options;
+    options.mode = parseMode(args_.mode);
+    options.normalize_options.preserve_vu = !normalize_vu;
+    options.normalize_options.preserve_case = !lowercase;
+    options.remove_symbols = !preserve_symbols;
+    options.skip_user_dictionary = args_.no_user_dict;
+
+    auto analyzer = std::make_unique<Suzume>(options);
+    for (const auto& dict_path : args_.dict_paths) {
+      auto load_result = analyzer->loadUserDictionaryResult(dict_path);
+      if (!load_result.hasValue()) {
+        error = "Failed to load dictionary: " + dict_path + ": " + load_result.error().message;
+        return nullptr;
+      }
+    }
+    return analyzers_.emplace(key, std::move(analyzer)).first->second.get();
+  }
+};
+
+/**
+ * @brief Response line for a request, or the error for an overlong line
+ */
+std::string respond(ServeSession& session, std::string_view line, bool too_long) {
+  if (too_long) {
+    return formatServeError("", "Request line exceeds " + std::to_string(kMaxServeLineBytes) + " bytes");
+  }
+  return session.handle(line);
+}
+
+int serveStdin(ServeSession& session) {
+  // Unsynced streams let in_avail() report pipelined input still buffered
+  std::ios::sync_with_stdio(false);
+
+  std::streambuf* input = std::cin.rdbuf();
+  LineSplitter splitter;
+  auto answer = [&session](std::string_view line, bool too_long) {
+    std::cout << respond(session, line, too_long) << '\n';
+  };
+
+  char buffer[65536];
+  while (true) {
+    std::streamsize count = input->in_avail();
+    if (count <= 0) {
+      // Batch responses while more requests are already buffered; block for the next byte
+      std::cout.flush();
+      int chr = input->sbumpc();
+      if (chr == std::char_traits<char>::eof()) {
+        break;
+      }
+      buffer[0] = static_cast<char>(chr);
+      count = 1;
+    } else {
+      count = input->sgetn(buffer, std::min<std::streamsize>(count, sizeof(buffer)));
+    }
+    splitter.feed(std::string_view(buffer, static_cast<size_t>(count)), answer);
+  }
+  splitter.finish(answer);
+  std::cout.flush();
+  return 0;
+}
+
+#ifndef _WIN32
+
+volatile std::sig_atomic_t g_stop_requested = 0;
+
+void onStopSignal(int /*signum*/) {
+  g_stop_requested = 1;
+}
+
+bool writeAll(int fd, std::string_view data) {
+  while (!data.empty()) {
+    ssize_t written = ::write(fd, data.data(), data.size());
+    if (written < 0) {
+      if (errno == EINTR && g_stop_requested == 0) {
+        continue;
+      }
+      return false;
+    }
+    data.remove_prefix(static_cast<size_t>(written));
+  }
+  return true;
+}
+
+/**
+ * @brief Answer requests on one connection until the peer closes it
+ */
+void serveConnection(ServeSession& session, int fd) {
+  LineSplitter splitter;
+  std::string responses;
+  auto answer = [&](std::string_view line, bool too_long) {
+    responses += respond(session, line, too_long);
+    responses += '\n';
+  };
+  char buffer[65536];
+
+  while (g_stop_requested == 0) {
+    ssize_t count = ::read(fd, buffer, sizeof(buffer));
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+
+    // Answer every complete line received so far, then write them in one go
+    bool eof = count <= 0;
+    if (eof) {
+      splitter.finish(answer);
+    } else {
+      splitter.feed(std::string_view(buffer, static_cast<size_t>(count)), answer);
+    }
+
+    if (!responses.empty()) {
+      if (!writeAll(fd, responses)) {
+        return;
+      }
+      responses.clear();
+    }
+    if (eof) {
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Idle sessions handed to connections, so warm analyzers are reused
+ */
+class SessionPool {
+ public:
+  SessionPool(const CommandArgs& args, std::unique_ptr<ServeSession> first) : args_(args) {
+    idle_.push_back(std::move(first));
+  }
+
+  std::unique_ptr<ServeSession> acquire(std::string& error) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!idle_.empty()) {
+        auto session = std::move(idle_.back());
+        idle_.pop_back();
+        return session;
+      }
+    }
+    auto session = std::make_unique<ServeSession>(args_);
+    if (!session->init(error)) {
+      return nullptr;
+    }
+    return session;
+  }
+
+  void release(std::unique_ptr<ServeSession> session) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_.push_back(std::move(session));
+  }
+
+ private:
+  const CommandArgs& args_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<ServeSession>> idle_;
+};
+
+int serveSocket(SessionPool& pool, const std::string& path, size_t max_connections, bool verbose) {
+  sockaddr_un addr{};
+  if (path.size() >= sizeof(addr.sun_path)) {
+    printError("Socket path too long: " + path);
+    return 1;
+  }
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+  // Replace a stale socket from a previous run, but never a regular file
+  struct stat info {};
+  if (::lstat(path.c_str(), &info) == 0) {
+    if (!S_ISSOCK(info.st_mode)) {
+      printError("Refusing to replace non-socket file: " + path);
+      return 1;
+    }
+    ::unlink(path.c_str());
+  }
+
+  // Handlers go in before listening, so a client that got connected can always stop the server
+  g_stop_requested = 0;
+  std::signal(SIGPIPE, SIG_IGN);  // Clients that disconnect mid-response must not kill the server
+  struct sigaction action {};
+  action.sa_handler = onStopSignal;
+  sigemptyset(&action.sa_mask);
+  action.sa_flags = 0;  // No SA_RESTART: accept() returns EINTR on shutdown
+  struct sigaction saved_int {};
+  struct sigaction saved_term {};
+  sigaction(SIGINT, &action, &saved_int);
+  sigaction(SIGTERM, &action, &saved_term);
+  auto restore_signals = [&] {
+    sigaction(SIGINT, &saved_int, nullptr);
+    sigaction(SIGTERM, &saved_term, nullptr);
+  };
+
+  int server_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server_fd < 0) {
+    printError(std::string("socket() failed: ") + std::strerror(errno));
+    restore_signals();
+    return 1;
+  }
+  if (::bind(server_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(server_fd, 16) != 0) {
+    printError("Failed to listen on " + path + ": " + std::strerror(errno));
+    ::close(server_fd);
+    restore_signals();
+    return 1;
+  }
+
+  if (verbose) {
+    printInfo("Listening on " + path);
+  }
+
+  // Each connection gets its own thread and session (Suzume instances are
+  // single-threaded); at most max_connections are served at once and
+  // further clients wait in the listen backlog. A worker closes its own
+  // connection, so a client sees EOF as soon as it is answered; this thread
+  // only joins finished workers, which can wait until accept() returns.
+  struct Worker {
+    std::thread thread;
+    int fd;  // -1 once the worker has closed it
+  };
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::map<uint64_t, Worker> workers;  // By connection number (fds are reused after close)
+  std::vector<uint64_t> done;          // Workers that can be joined
+  uint64_t next_connection = 0;
+
+  // Workers block the stop signals so they reach accept() on this thread
+  sigset_t stop_signals;
+  sigemptyset(&stop_signals);
+  sigaddset(&stop_signals, SIGINT);
+  sigaddset(&stop_signals, SIGTERM);
+
+  // Takes the finished list first: workers append to it while the lock is
+  // released for joining
+  auto reap = [&](std::unique_lock<std::mutex>& lock) {
+    std::vector<std::thread> threads;
+    for (uint64_t connection : done) {
+      auto worker = workers.find(connection);
+      threads.push_back(std::move(worker->second.thread));
+      workers.erase(worker);
+    }
+    done.clear();
+    lock.unlock();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    lock.lock();
+  };
+
+  while (g_stop_requested == 0) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      reap(lock);
+      if (workers.size() >= max_connections) {
+        // Poll so a stop signal is noticed while all workers are busy
+        finished.wait_for(lock, std::chrono::milliseconds(100));
+        continue;
+      }
+    }
+
+    // Poll as well, so a signal landing just before accept() is not missed
+    pollfd listening{server_fd, POLLIN, 0};
+    if (::poll(&listening, 1, 100) <= 0) {
+      continue;
+    }
+    int client_fd = ::accept(server_fd, nullptr, nullptr);
+    if (client_fd < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      printError(std::string("accept() failed: ") + std::strerror(errno));
+      break;
+    }
+
+    std::string error;
+    auto session = pool.acquire(error);
+    if (!session) {
+      writeAll(client_fd, formatServeError("", error) + "\n");
+      ::close(client_fd);
+      continue;
+    }
+
+    sigset_t saved;
+    pthread_sigmask(SIG_BLOCK, &stop_signals, &saved);
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t connection = next_connection++;
+    Worker& worker = workers[connection];
+    worker.fd = client_fd;
+    worker.thread = std::thread([&, connection, client_fd, owned = std::move(session)]() mutable {
+      serveConnection(*owned, client_fd);
+      pool.release(std::move(owned));
+      std::lock_guard<std::mutex> done_lock(mutex);
+      ::shutdown(client_fd, SHUT_RDWR);
+      ::close(client_fd);
+      workers[connection].fd = -1;
+      done.push_back(connection);
+      finished.notify_one();
+    });
+    pthread_sigmask(SIG_SETMASK, &saved, nullptr);
+  }
+
+  // Unblock workers still reading, then wait for them
+  std::unique_lock<std::mutex> lock(mutex);
+  for (auto& worker : workers) {
+    if (worker.second.fd >= 0) {
+      ::shutdown(worker.second.fd, SHUT_RDWR);
+    }
+  }
+  finished.wait(lock, [&] { return done.size() == workers.size(); });
+  reap(lock);
+  lock.unlock();
+
+  ::close(server_fd);
+  ::unlink(path.c_str());
+  restore_signals();
+  return 0;
+}
+
+#endif  // _WIN32
+
+}  // namespace
+
+int cmdServe(const CommandArgs& args) {
+  if (args.help) {
+    printServeHelp();
+    return 0;
+  }
+
+  std::string socket_path;
+  for (size_t idx = 0; idx < args.args.size(); ++idx) {
+    if (args.args[idx] == "--socket" && idx + 1 < args.args.size()) {
+      socket_path = args.args[++idx];
+    } else {
+      printError("Unknown serve argument: " + args.args[idx]);
+      printServeHelp();
+      return 1;
+    }
+  }
+
+  if (!socket_path.empty()) {
+#ifdef _WIN32
+    printError("--socket is not supported on Windows");
+    return 1;
+#else
+    return serveUnixSocket(args, socket_path, args.jobs.value_or(0));
+#endif
+  }
+
+  ServeSession session(args);
+  std::string error;
+  if (!session.init(error)) {
+    printError(error);
+    return 1;
+  }
+  return serveStdin(session);
+}
+
+#ifndef _WIN32
+
+int serveUnixSocket(const CommandArgs& args, const std::string& path, size_t max_connections) {
+  auto session = std::make_unique<ServeSession>(args);
+  std::string error;
+  if (!session->init(error)) {
+    printError(error);
+    return 1;
+  }
+  if (max_connections == 0) {
+    max_connections = std::max(1U, std::thread::hardware_concurrency());
+  }
+  SessionPool pool(args, std::move(session));
+  return serveSocket(pool, path, max_connections, args.verbose);
+}
+
+#endif  // _WIN32
+
+}  // namespace suzume::cli
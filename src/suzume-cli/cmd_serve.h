@@ -0,0 +1,40 @@
+#ifndef SUZUME_CLI_CMD_SERVE_H_
+#define SUZUME_CLI_CMD_SERVE_H_
+
+#include <cstddef>
+#include <string>
+
+#include "cli_common.h"
+
+namespace suzume::cli {
+
+/**
+ * @brief Execute serve command
+ *
+ * Keeps warm analyzers and answers newline-delimited JSON requests on stdin
+ * (or a Unix domain socket with --socket PATH), one response line per
+ * request, in request order.
+ *
+ * @param args Parsed command arguments
+ * @return Exit code (0 = success)
+ */
+int cmdServe(const CommandArgs& args);
+
+#ifndef _WIN32
+/**
+ * @brief Answer requests on a Unix domain socket until SIGINT or SIGTERM
+ *
+ * Each connection is served on its own thread and closed as soon as its
+ * requests are answered. The socket file is removed on return.
+ *
+ * @param args Parsed command arguments (analyzer options)
+ * @param path Socket path (a stale socket is replaced, any other file is not)
+ * @param max_connections Connections served at once (0 = hardware concurrency)
+ * @return Exit code (0 = success)
+ */
+int serveUnixSocket(const CommandArgs& args, const std::string& path, size_t max_connections);
+#endif
+
+}  // namespace suzume::cli
+
+#endif  // SUZUME_CLI_CMD_SERVE_H_
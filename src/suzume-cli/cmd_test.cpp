@@ -309,6 +309,146 @@ int cmdTestBenchmark(const std::vector<std::string>& args, bool /* verbose */,
   return 0;
 }
 
+/**
+ * @brief Time a cold start: analyzer construction plus the first analysis
+ *
+ * Meant to be run in a fresh process. With --budget-us=N, fails when the
+ * total exceeds N microseconds so scripts can guard startup latency.
+ */
+int cmdTestStartup(const std::vector<std::string>& args, bool skip_user_dict) {
+  size_t budget_us = 0;
+  std::string text = "東京に行きました";
+
+  for (size_t idx = 0; idx < args.size(); ++idx) {
+    if (args[idx].substr(0, 12) == "--budget-us=") {
+      if (!parseSizeOption(args[idx].substr(12), &budget_us)) {
+        printError("Invalid budget: " + args[idx].substr(12));
+        return 1;
+      }
+    } else if (args[idx] == "--text" && idx + 1 < args.size()) {
+      text = args[++idx];
+    }
+  }
+
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_us = [](Clock::time_point from, Clock::time_point to) {
+    return static_cast<size_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+  };
+
+  SuzumeOptions options;
+  options.skip_user_dictionary = skip_user_dict;
+
+  auto start = Clock::now();
+  Suzume analyzer(options);
+  auto constructed = Clock::now();
+  auto morphemes = analyzer.analyze(text);
+  auto analyzed = Clock::now();
+
+  size_t construct_us = elapsed_us(start, constructed);
+  size_t analyze_us = elapsed_us(constructed, analyzed);
+  size_t total_us = construct_us + analyze_us;
+
+  std::cout << "Construct: " << construct_us << " us\n";
+  std::cout << "First analyze: " << analyze_us << " us (" << morphemes.size() << " morphemes)\n";
+  std::cout << "Total: " << total_us << " us\n";
+
+  if (budget_us > 0 && total_us > budget_us) {
+    printError("Startup took " + std::to_string(total_us) + " us, budget is " + std::to_string(budget_us) + " us");
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Time inputs that make candidate generation blow up
+ *
+ * Analyzes each input with the work budgets set and prints its latency and
+ * lattice size. With --budget-us=N, fails when any input takes longer than
+ * N microseconds or is not cut short by the budgets. --compare also times
+ * each input without budgets.
+ */
+int cmdTestWorstCase(const std::vector<std::string>& args, bool skip_user_dict, bool compare) {
+  size_t budget_us = 0;
+  size_t edges_per_position = 16;
+  size_t edges_per_chunk = 2000;
+
+  for (const auto& arg : args) {
+    if (arg.substr(0, 12) == "--budget-us=") {
+      if (!parseSizeOption(arg.substr(12), &budget_us)) {
+        printError("Invalid budget: " + arg.substr(12));
+        return 1;
+      }
+    } else if (arg.substr(0, 21) == "--edges-per-position=") {
+      if (!parseSizeOption(arg.substr(21), &edges_per_position)) {
+        printError("Invalid edge limit: " + arg.substr(21));
+        return 1;
+      }
+    } else if (arg.substr(0, 18) == "--edges-per-chunk=") {
+      if (!parseSizeOption(arg.substr(18), &edges_per_chunk)) {
+        printError("Invalid edge limit: " + arg.substr(18));
+        return 1;
+      }
+    }
+  }
+
+  auto repeat = [](const std::string& unit, size_t count) {
+    std::string text;
+    for (size_t idx = 0; idx < count; ++idx) {
+      text += unit;
+    }
+    return text;
+  };
+  const std::vector<std::string> inputs = {repeat("あいうえおかきくけこ", 100),
+                                           repeat("してみていって", 150),
+                                           "やばい" + repeat("ー", 1000),
+                                           "きた" + repeat("あ", 1000),
+                                           repeat("漢字熟語処理", 150),
+                                           repeat("カタカナ", 250)};
+
+  SuzumeOptions options;
+  options.skip_user_dictionary = skip_user_dict;
+  Suzume unbounded(options);
+  options.max_edges_per_position = edges_per_position;
+  options.max_edges_per_chunk = edges_per_chunk;
+  Suzume bounded(options);
+
+  using Clock = std::chrono::steady_clock;
+  auto time_us = [](Suzume& analyzer, const std::string& text) {
+    analyzer.resetStats();
+    auto start = Clock::now();
+    analyzer.analyze(text);
+    return static_cast<size_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+  };
+
+  size_t worst_us = 0;
+  bool all_degraded = true;
+  for (const auto& input : inputs) {
+    size_t bounded_us = time_us(bounded, input);
+    auto stats = bounded.stats();
+    worst_us = std::max(worst_us, bounded_us);
+    all_degraded = all_degraded && stats.degraded_chunks > 0;
+
+    std::cout << input.substr(0, 18) << "... (" << input.size() << " bytes): " << bounded_us << " us, "
+              << stats.lattice_edges << " edges, " << stats.degraded_chunks << " degraded chunks";
+    if (compare) {
+      size_t unbounded_us = time_us(unbounded, input);
+      std::cout << " | unbounded: " << unbounded_us << " us, " << unbounded.stats().lattice_edges << " edges";
+    }
+    std::cout << "\n";
+  }
+  std::cout << "Worst: " << worst_us << " us\n";
+
+  if (budget_us > 0 && !all_degraded) {
+    printError("Work budgets did not cut every input short");
+    return 1;
+  }
+  if (budget_us > 0 && worst_us > budget_us) {
+    printError("Worst case took " + std::to_string(worst_us) + " us, budget is " + std::to_string(budget_us) + " us");
+    return 1;
+  }
+  return 0;
+}
+
 }  // namespace
 
 int cmdTest(const CommandArgs& args) {
@@ -328,6 +468,12 @@ int cmdTest(const CommandArgs& args) {
   if (subcommand == "benchmark") {
     return cmdTestBenchmark(subargs, args.verbose, args.dict_paths);
   }
+  if (subcommand == "startup") {
+    return cmdTestStartup(subargs, args.no_user_dict);
+  }
+  if (subcommand == "worst-case") {
+    return cmdTestWorstCase(subargs, args.no_user_dict, args.compare);
+  }
 
   // Check for -f flag (file test)
   bool has_file_flag = false;
@@ -1,6 +1,7 @@
 #include "dict_compiler.h"
 
 #include <iostream>
+#include <map>
 #include <tuple>
 
 #include "cli_common.h"
@@ -118,6 +119,50 @@ std::vector<dictionary::DictionaryEntry> expandVerb(const dictionary::Dictionary
   return result;
 }
 
+using ConjugationIndex = std::map<std::string, dictionary::ConjugatedSurface>;
+
+// Add a conjugated surface; on conflict the longer lemma (more specific) wins
+void addToIndex(ConjugationIndex& index, const std::string& surface, const dictionary::ConjugatedSurface& info) {
+  auto [it, inserted] = index.emplace(surface, info);
+  if (!inserted && it->second.pos == info.pos && info.lemma.size() > it->second.lemma.size()) {
+    it->second = info;
+  }
+}
+
+// Index expanded dictionary forms and generated auxiliary chains of one entry
+// The extended POS of a chain is that of its longest expanded-form prefix
+// (食べました → 食べ, 書いた → 書い), i.e. the word the analyzer emits first.
+void indexConjugations(const dictionary::DictionaryEntry& base_entry, grammar::VerbType verb_type,
+                       const std::vector<dictionary::DictionaryEntry>& expanded_entries, ConjugationIndex& index) {
+  if (verb_type == grammar::VerbType::Unknown) {
+    return;
+  }
+  auto conj_type = grammar::verbTypeToConjType(verb_type);
+  for (const auto& exp_entry : expanded_entries) {
+    addToIndex(index, exp_entry.surface, {exp_entry.lemma, exp_entry.pos, exp_entry.extended_pos, conj_type});
+  }
+
+  // いい conjugates through よい; its chains would be wrong (see expandIAdjective)
+  if (base_entry.surface == "いい") {
+    return;
+  }
+  static grammar::Conjugation conj;
+  for (const auto& form : conj.generate(base_entry.surface, verb_type)) {
+    const dictionary::DictionaryEntry* leading = nullptr;
+    for (const auto& exp_entry : expanded_entries) {
+      if (utf8::startsWith(form.surface, exp_entry.surface) &&
+          (leading == nullptr || exp_entry.surface.size() > leading->surface.size())) {
+        leading = &exp_entry;
+      }
+    }
+    if (leading == nullptr) {
+      continue;  // Derived words outside the paradigm (高さ)
+    }
+    addToIndex(index, form.surface,
+               {leading->lemma, leading->pos, leading->extended_pos, conj_type, form.surface != leading->surface});
+  }
+}
+
 }  // namespace
 
 bool isTrivialEntry(std::string_view surface) {
@@ -221,7 +266,9 @@ core::Expected<size_t, core::Error> DictCompiler::compileEntries(const std::vect
   dictionary::BinaryDictWriter writer;
   entries_compiled_ = 0;
   conj_expanded_ = 0;
+  conj_indexed_ = 0;
   size_t duplicates_skipped = 0;
+  ConjugationIndex conjugation_index;
 
   // Deduplication: track surfaces (trie requires unique keys)
   // When duplicate surfaces arise from different verb base forms (e.g., 降り from
@@ -288,16 +335,16 @@ core::Expected<size_t, core::Error> DictCompiler::compileEntries(const std::vect
     base_entry.lemma = tsv_entry.surface;
 
     std::vector<dictionary::DictionaryEntry> expanded_entries;
+    grammar::VerbType verb_type = grammar::VerbType::Unknown;
 
     if (tsv_entry.pos == core::PartOfSpeech::Adjective &&
         tsv_entry.conj_type == dictionary::ConjugationType::IAdjective) {
       // I-adjective: expand to all conjugated forms
       base_entry.extended_pos = core::ExtendedPOS::AdjBasic;
       expanded_entries = expandIAdjective(base_entry);
+      verb_type = grammar::VerbType::IAdjective;
     } else if (tsv_entry.pos == core::PartOfSpeech::Verb) {
       // Verb: detect type and expand
-      grammar::VerbType verb_type = grammar::VerbType::Unknown;
-
       // Use conj_type hint if available, otherwise detect
       switch (tsv_entry.conj_type) {
         case dictionary::ConjugationType::Ichidan:
@@ -346,6 +393,10 @@ core::Expected<size_t, core::Error> DictCompiler::compileEntries(const std::vect
       expanded_entries = expandVerb(base_entry, verb_type);
     }
 
+    if (conjugation_index_) {
+      indexConjugations(base_entry, verb_type, expanded_entries, conjugation_index);
+    }
+
     // Add expanded entries with deduplication (by surface)
     // When duplicate surfaces exist and both are VERB, prefer the longer lemma
     // (e.g., 降りる > 降る for surface 降り — ichidan is more specific)
@@ -379,6 +430,14 @@ core::Expected<size_t, core::Error> DictCompiler::compileEntries(const std::vect
     printInfo("Skipped " + std::to_string(duplicates_skipped) + " duplicate entries");
   }
 
+  for (const auto& [surface, info] : conjugation_index) {
+    writer.addConjugatedSurface(surface, info);
+  }
+  conj_indexed_ = conjugation_index.size();
+  if (verbose_ && conj_indexed_ > 0) {
+    printInfo("Indexed " + std::to_string(conj_indexed_) + " conjugated surfaces");
+  }
+
   auto write_result = writer.writeToFile(dic_path);
   if (!write_result.hasValue()) {
     return core::makeUnexpected(write_result.error());
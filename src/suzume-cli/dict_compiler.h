@@ -83,11 +83,29 @@ class DictCompiler {
    */
   void setFilterTrivial(bool filter) { filter_trivial_ = filter; }
 
+  /**
+   * @brief Enable/disable the conjugation index
+   *
+   * When enabled, every verb and i-adjective is also expanded into its
+   * conjugated forms and common auxiliary chains (食べました, 書いている, ...),
+   * stored with lemma, conjugation type and the form of the leading word.
+   * The analyzer uses the index to resolve lemmas without inflection
+   * analysis; lattice candidates are unchanged.
+   */
+  void setConjugationIndex(bool enable) { conjugation_index_ = enable; }
+
+  /**
+   * @brief Number of surfaces written to the conjugation index
+   */
+  size_t conjIndexed() const { return conj_indexed_; }
+
  private:
   size_t entries_compiled_ = 0;
   size_t conj_expanded_ = 0;
+  size_t conj_indexed_ = 0;
   bool verbose_ = false;
   bool filter_trivial_ = false;
+  bool conjugation_index_ = false;
 };
 
 }  // namespace suzume::cli
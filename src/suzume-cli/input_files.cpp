@@ -0,0 +1,81 @@
+#include "input_files.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+namespace suzume::cli {
+
+namespace fs = std::filesystem;
+
+bool wildcardMatch(std::string_view pattern, std::string_view name) {
+  // Iterative matcher with single-star backtracking
+  size_t pat = 0;
+  size_t str = 0;
+  size_t star = std::string_view::npos;
+  size_t star_str = 0;
+  while (str < name.size()) {
+    if (pat < pattern.size() && (pattern[pat] == '?' || pattern[pat] == name[str])) {
+      ++pat;
+      ++str;
+    } else if (pat < pattern.size() && pattern[pat] == '*') {
+      star = pat++;
+      star_str = str;
+    } else if (star != std::string_view::npos) {
+      pat = star + 1;
+      str = ++star_str;
+    } else {
+      return false;
+    }
+  }
+  while (pat < pattern.size() && pattern[pat] == '*') {
+    ++pat;
+  }
+  return pat == pattern.size();
+}
+
+namespace {
+
+std::vector<std::string> listRegularFiles(const fs::path& dir, std::string_view pattern) {
+  std::vector<std::string> files;
+  std::error_code err;
+  for (fs::directory_iterator iter(dir, err), end; !err && iter != end; iter.increment(err)) {
+    if (!iter->is_regular_file(err)) {
+      continue;
+    }
+    if (pattern.empty() || wildcardMatch(pattern, iter->path().filename().string())) {
+      files.push_back(iter->path().string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+}  // namespace
+
+core::Expected<std::vector<std::string>, core::Error> expandInputPaths(const std::vector<std::string>& inputs) {
+  std::vector<std::string> files;
+  for (const auto& input : inputs) {
+    fs::path path(input);
+    std::string filename = path.filename().string();
+    std::error_code err;
+
+    std::vector<std::string> matched;
+    if (filename.find_first_of("*?") != std::string::npos) {
+      fs::path dir = path.parent_path();
+      matched = listRegularFiles(dir.empty() ? fs::path(".") : dir, filename);
+    } else if (fs::is_directory(path, err)) {
+      matched = listRegularFiles(path, {});
+    } else if (fs::is_regular_file(path, err)) {
+      matched.push_back(input);
+    }
+
+    if (matched.empty()) {
+      return core::makeUnexpected(core::Error(core::ErrorCode::FileNotFound, "No input files match: " + input));
+    }
+    files.insert(files.end(), matched.begin(), matched.end());
+  }
+  return files;
+}
+
+}  // namespace suzume::cli
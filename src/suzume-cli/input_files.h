@@ -0,0 +1,31 @@
+#ifndef SUZUME_CLI_INPUT_FILES_H_
+#define SUZUME_CLI_INPUT_FILES_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/error.h"
+
+namespace suzume::cli {
+
+/**
+ * @brief Match a file name against a wildcard pattern ('*' and '?')
+ */
+bool wildcardMatch(std::string_view pattern, std::string_view name);
+
+/**
+ * @brief Expand --input arguments into a list of regular files
+ *
+ * Each argument may be a file, a directory (its regular files, sorted, not
+ * recursive) or a pattern with wildcards in the last path component
+ * (e.g. "*.txt" under "corpus/", matches sorted). Expansion order follows the
+ * argument order so output order is reproducible.
+ *
+ * @return File paths, or FileNotFound if an argument matches nothing
+ */
+core::Expected<std::vector<std::string>, core::Error> expandInputPaths(const std::vector<std::string>& inputs);
+
+}  // namespace suzume::cli
+
+#endif  // SUZUME_CLI_INPUT_FILES_H_
@@ -3,6 +3,7 @@
 #include "cli_common.h"
 #include "cmd_analyze.h"
 #include "cmd_dict.h"
+#include "cmd_serve.h"
 #include "cmd_test.h"
 
 using namespace suzume::cli;
@@ -40,6 +41,10 @@ int main(int argc, char* argv[]) {
     return cmdTest(args);
   }
 
+  if (args.command == "serve") {
+    return cmdServe(args);
+  }
+
   // Unknown command
   printError("Unknown command: " + args.command);
   printHelp();
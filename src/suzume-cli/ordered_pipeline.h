@@ -0,0 +1,153 @@
+#ifndef SUZUME_CLI_ORDERED_PIPELINE_H_
+#define SUZUME_CLI_ORDERED_PIPELINE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace suzume::cli {
+
+/**
+ * @brief Process items on worker threads and consume the results in input order
+ *
+ * Every worker owns a State created on its own thread by make_state, so
+ * non-thread-safe objects (e.g. one Suzume per worker) can be used. The
+ * calling thread pulls inputs from next_input and hands results to consume
+ * strictly in input order. At most max_in_flight items are queued or waiting
+ * to be consumed, which bounds memory on arbitrarily long inputs.
+ *
+ * An exception thrown by make_state or process stops the pipeline and is
+ * rethrown on the calling thread after all workers have exited.
+ *
+ * @param jobs Number of worker threads (at least 1)
+ * @param max_in_flight Maximum queued + unconsumed items (at least jobs)
+ * @param next_input Fills the next input; returns false at end of input
+ * @param make_state Creates per-worker state
+ * @param process Maps one input to its output using the worker state
+ * @param consume Receives outputs in input order
+ */
+template <typename State, typename Input, typename Output>
+void runOrderedPipeline(size_t jobs, size_t max_in_flight, const std::function<bool(Input&)>& next_input,
+                        const std::function<std::unique_ptr<State>()>& make_state,
+                        const std::function<Output(State&, Input&)>& process,
+                        const std::function<void(Output&)>& consume) {
+  jobs = jobs == 0 ? 1 : jobs;
+  max_in_flight = max_in_flight < jobs ? jobs : max_in_flight;
+
+  std::mutex mutex;
+  std::condition_variable work_ready;    // Workers wait for input
+  std::condition_variable result_ready;  // Caller waits for the next result
+  std::deque<std::pair<size_t, Input>> queue;
+  std::map<size_t, Output> results;  // Reorder buffer
+  bool input_done = false;
+  bool stop = false;
+  std::exception_ptr failure;
+
+  auto worker = [&]() {
+    try {
+      std::unique_ptr<State> state = make_state();
+      while (true) {
+        std::pair<size_t, Input> item;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          work_ready.wait(lock, [&]() { return stop || !queue.empty() || input_done; });
+          if (stop || queue.empty()) {
+            return;
+          }
+          item = std::move(queue.front());
+          queue.pop_front();
+        }
+        Output output = process(*state, item.second);
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          results.emplace(item.first, std::move(output));
+        }
+        result_ready.notify_one();
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!failure) {
+          failure = std::current_exception();
+        }
+        stop = true;
+      }
+      work_ready.notify_all();
+      result_ready.notify_one();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(jobs);
+  for (size_t idx = 0; idx < jobs; ++idx) {
+    workers.emplace_back(worker);
+  }
+
+  size_t next_seq = 0;      // Next input sequence number
+  size_t consumed_seq = 0;  // Next sequence number to consume
+  bool exhausted = false;
+  try {
+    while (true) {
+      // Top up the queue while under the in-flight limit
+      while (!exhausted && next_seq - consumed_seq < max_in_flight) {
+        Input input;
+        if (!next_input(input)) {
+          exhausted = true;
+          std::lock_guard<std::mutex> lock(mutex);
+          input_done = true;
+        } else {
+          std::lock_guard<std::mutex> lock(mutex);
+          queue.emplace_back(next_seq++, std::move(input));
+        }
+        work_ready.notify_all();
+      }
+      if (exhausted && consumed_seq == next_seq) {
+        break;
+      }
+
+      Output output;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        result_ready.wait(lock, [&]() { return stop || results.count(consumed_seq) != 0; });
+        if (stop) {
+          break;
+        }
+        auto iter = results.find(consumed_seq);
+        output = std::move(iter->second);
+        results.erase(iter);
+      }
+      consume(output);
+      ++consumed_seq;
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!failure) {
+      failure = std::current_exception();
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    input_done = true;
+    stop = stop || static_cast<bool>(failure);
+  }
+  work_ready.notify_all();
+  for (auto& thread : workers) {
+    thread.join();
+  }
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+}
+
+}  // namespace suzume::cli
+
+#endif  // SUZUME_CLI_ORDERED_PIPELINE_H_
@@ -0,0 +1,466 @@
+#include "serve_protocol.h"
+
+#include <cstdint>
+
+#include "core/types.h"
+
+namespace suzume::cli {
+
+namespace {
+
+/**
+ * @brief Minimal JSON reader for flat request objects
+ *
+ * Handles strings (with \uXXXX escapes and surrogate pairs), numbers,
+ * literals and nested values; nested objects/arrays are only skipped.
+ */
+class JsonReader {
+ public:
+  explicit JsonReader(std::string_view text) : text_(text) {}
+
+  size_t pos() const { return pos_; }
+  const std::string& error() const { return error_; }
+  bool atEnd() {
+    skipSpace();
+    return pos_ >= text_.size();
+  }
+
+  void skipSpace() {
+    while (pos_ < text_.size() &&
+           (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\r' || text_[pos_] == '\n')) {
+      ++pos_;
+    }
+  }
+
+  bool consume(char expected) {
+    skipSpace();
+    if (pos_ < text_.size() && text_[pos_] == expected) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  bool expect(char expected) {
+    if (consume(expected)) {
+      return true;
+    }
+    return fail(std::string("expected '") + expected + "'");
+  }
+
+  bool readString(std::string& out) {
+    out.clear();
+    skipSpace();
+    if (pos_ >= text_.size() || text_[pos_] != '"') {
+      return fail("expected string");
+    }
+    ++pos_;
+    while (pos_ < text_.size()) {
+      char chr = text_[pos_++];
+      if (chr == '"') {
+        return true;
+      }
+      if (chr != '\\') {
+        out += chr;
+        continue;
+      }
+      if (pos_ >= text_.size()) {
+        break;
+      }
+      char esc = text_[pos_++];
+      switch (esc) {
+        case '"':
+        case '\\':
+        case '/':
+          out += esc;
+          break;
+        case 'b':
+          out += '\b';
+          break;
+        case 'f':
+          out += '\f';
+          break;
+        case 'n':
+          out += '\n';
+          break;
+        case 'r':
+          out += '\r';
+          break;
+        case 't':
+          out += '\t';
+          break;
+        case 'u': {
+          char32_t codepoint = 0;
+          if (!readHex4(codepoint)) {
+            return false;
+          }
+          if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            char32_t low = 0;
+            if (pos_ + 1 >= text_.size() || text_[pos_] != '\\' || text_[pos_ + 1] != 'u') {
+              return fail("unpaired surrogate");
+            }
+            pos_ += 2;
+            if (!readHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+              return fail("unpaired surrogate");
+            }
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+          }
+          appendUtf8(out, codepoint);
+          break;
+        }
+        default:
+          return fail("invalid escape");
+      }
+    }
+    return fail("unterminated string");
+  }
+
+  /**
+   * @brief Read a request id: a string, number or null, returned as JSON text
+   *
+   * Strings are re-escaped so the id can be echoed into a response verbatim.
+   */
+  bool readId(std::string& out) {
+    skipSpace();
+    if (pos_ < text_.size() && text_[pos_] == '"') {
+      std::string value;
+      if (!readString(value)) {
+        return false;
+      }
+      serialize::OutputBuffer buf(value.size() + 2);
+      buf.append('"');
+      serialize::appendJsonEscaped(buf, value);
+      buf.append('"');
+      out = buf.release();
+      return true;
+    }
+    size_t start = pos_;
+    if (text_.substr(pos_, 4) == "null") {
+      pos_ += 4;
+    } else if (!readNumber()) {
+      return fail("id must be a string, number or null");
+    }
+    // Reject "01", "1x", "nullx" before the id is reported to the caller
+    if (pos_ < text_.size() && std::string_view(" \t\r\n,}").find(text_[pos_]) == std::string_view::npos) {
+      pos_ = start;
+      return fail("id must be a string, number or null");
+    }
+    out = std::string(text_.substr(start, pos_ - start));
+    return true;
+  }
+
+  bool readBool(bool& out) {
+    skipSpace();
+    if (text_.substr(pos_, 4) == "true") {
+      pos_ += 4;
+      out = true;
+      return true;
+    }
+    if (text_.substr(pos_, 5) == "false") {
+      pos_ += 5;
+      out = false;
+      return true;
+    }
+    return fail("expected true or false");
+  }
+
+  /**
+   * @brief Skip any value
+   */
+  bool skipValue() {
+    skipSpace();
+    size_t start = pos_;
+    if (pos_ >= text_.size()) {
+      return fail("expected value");
+    }
+    char chr = text_[pos_];
+    if (chr == '"') {
+      std::string ignored;
+      if (!readString(ignored)) {
+        return false;
+      }
+    } else if (chr == '{' || chr == '[') {
+      char close = (chr == '{') ? '}' : ']';
+      ++pos_;
+      if (!consume(close)) {
+        do {
+          if (chr == '{') {
+            std::string key;
+            if (!readString(key) || !expect(':')) {
+              return false;
+            }
+          }
+          if (!skipValue()) {
+            return false;
+          }
+        } while (consume(','));
+        if (!expect(close)) {
+          return false;
+        }
+      }
+    } else {
+      // Number or literal
+      while (pos_ < text_.size() && text_[pos_] != ',' && text_[pos_] != '}' && text_[pos_] != ']' &&
+             text_[pos_] != ' ' && text_[pos_] != '\t') {
+        ++pos_;
+      }
+      if (pos_ == start) {
+        return fail("expected value");
+      }
+    }
+    return true;
+  }
+
+  bool fail(std::string message) {
+    if (error_.empty()) {
+      error_ = std::move(message) + " at column " + std::to_string(pos_ + 1);
+    }
+    return false;
+  }
+
+ private:
+  std::string_view text_;
+  size_t pos_{0};
+  std::string error_;
+
+  // Number per the JSON grammar: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+  bool readNumber() {
+    size_t pos = pos_;
+    auto digits = [&]() {
+      size_t begin = pos;
+      while (pos < text_.size() && text_[pos] >= '0' && text_[pos] <= '9') {
+        ++pos;
+      }
+      return pos - begin;
+    };
+    if (pos < text_.size() && text_[pos] == '-') {
+      ++pos;
+    }
+    if (pos < text_.size() && text_[pos] == '0') {
+      ++pos;
+    } else if (digits() == 0) {
+      return false;
+    }
+    if (pos < text_.size() && text_[pos] == '.') {
+      ++pos;
+      if (digits() == 0) {
+        return false;
+      }
+    }
+    if (pos < text_.size() && (text_[pos] == 'e' || text_[pos] == 'E')) {
+      ++pos;
+      if (pos < text_.size() && (text_[pos] == '+' || text_[pos] == '-')) {
+        ++pos;
+      }
+      if (digits() == 0) {
+        return false;
+      }
+    }
+    pos_ = pos;
+    return true;
+  }
+
+  bool readHex4(char32_t& out) {
+    if (pos_ + 4 > text_.size()) {
+      return fail("truncated \\u escape");
+    }
+    out = 0;
+    for (size_t idx = 0; idx < 4; ++idx) {
+      char chr = text_[pos_++];
+      out <<= 4;
+      if (chr >= '0' && chr <= '9') {
+        out |= static_cast<char32_t>(chr - '0');
+      } else if (chr >= 'a' && chr <= 'f') {
+        out |= static_cast<char32_t>(chr - 'a' + 10);
+      } else if (chr >= 'A' && chr <= 'F') {
+        out |= static_cast<char32_t>(chr - 'A' + 10);
+      } else {
+        return fail("invalid \\u escape");
+      }
+    }
+    return true;
+  }
+
+  static void appendUtf8(std::string& out, char32_t codepoint) {
+    if (codepoint < 0x80) {
+      out += static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+      out += static_cast<char>(0xC0 | (codepoint >> 6));
+      out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else if (codepoint < 0x10000) {
+      out += static_cast<char>(0xE0 | (codepoint >> 12));
+      out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+      out += static_cast<char>(0xF0 | (codepoint >> 18));
+      out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+      out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+  }
+};
+
+core::Unexpected<core::Error> parseError(std::string message) {
+  return core::makeUnexpected(core::Error(core::ErrorCode::ParseError, std::move(message)));
+}
+
+bool isKnownFormat(std::string_view name) {
+  return name == "morpheme" || name == "tags" || name == "json" || name == "tsv" || name == "chasen";
+}
+
+bool readOptions(JsonReader& reader, ServeOptions& options) {
+  if (!reader.expect('{')) {
+    return false;
+  }
+  if (reader.consume('}')) {
+    return true;
+  }
+  do {
+    std::string key;
+    if (!reader.readString(key) || !reader.expect(':')) {
+      return false;
+    }
+    bool value = false;
+    if (key == "preserve_symbols") {
+      if (!reader.readBool(value)) {
+        return false;
+      }
+      options.preserve_symbols = value;
+    } else if (key == "normalize_vu") {
+      if (!reader.readBool(value)) {
+        return false;
+      }
+      options.normalize_vu = value;
+    } else if (key == "lowercase") {
+      if (!reader.readBool(value)) {
+        return false;
+      }
+      options.lowercase = value;
+    } else if (!reader.skipValue()) {
+      return false;
+    }
+  } while (reader.consume(','));
+  return reader.expect('}');
+}
+
+void beginResponse(serialize::OutputBuffer& out, std::string_view id) {
+  out.append('{');
+  if (!id.empty()) {
+    out.append("\"id\":");
+    out.append(id);
+    out.append(',');
+  }
+}
+
+std::string formatServeString(std::string_view id, std::string_view key, std::string_view value) {
+  serialize::OutputBuffer out(key.size() + value.size() + id.size() + 16);
+  beginResponse(out, id);
+  out.append('"');
+  out.append(key);
+  out.append("\":\"");
+  serialize::appendJsonEscaped(out, value);
+  out.append("\"}");
+  return out.release();
+}
+
+}  // namespace
+
+core::Expected<ServeRequest, core::Error> parseServeRequest(std::string_view line, std::string* id_out) {
+  ServeRequest request;
+
+  size_t first = line.find_first_not_of(" \t\r");
+  if (first == std::string_view::npos || line[first] != '{') {
+    // Plain text line
+    request.text = std::string(line);
+    return request;
+  }
+
+  JsonReader reader(line);
+  bool has_text = false;
+  auto fail = [&reader]() { return parseError("Invalid request: " + reader.error()); };
+
+  if (!reader.expect('{')) {
+    return fail();
+  }
+  if (!reader.consume('}')) {
+    do {
+      std::string key;
+      if (!reader.readString(key) || !reader.expect(':')) {
+        return fail();
+      }
+      if (key == "id") {
+        if (!reader.readId(request.id)) {
+          return fail();
+        }
+        if (id_out != nullptr) {
+          *id_out = request.id;
+        }
+      } else if (key == "text") {
+        if (!reader.readString(request.text)) {
+          return fail();
+        }
+        has_text = true;
+      } else if (key == "mode") {
+        std::string mode;
+        if (!reader.readString(mode)) {
+          return fail();
+        }
+        if (mode != "normal" && mode != "search" && mode != "split") {
+          return parseError("Unknown mode: " + mode);
+        }
+        request.mode = std::move(mode);
+      } else if (key == "format") {
+        std::string format;
+        if (!reader.readString(format)) {
+          return fail();
+        }
+        if (!isKnownFormat(format)) {
+          return parseError("Unknown format: " + format);
+        }
+        request.format = parseOutputFormat(format);
+      } else if (key == "options") {
+        if (!readOptions(reader, request.options)) {
+          return fail();
+        }
+      } else if (!reader.skipValue()) {
+        return fail();
+      }
+    } while (reader.consume(','));
+    if (!reader.expect('}')) {
+      return fail();
+    }
+  }
+
+  if (!reader.atEnd()) {
+    reader.fail("trailing characters");
+    return fail();
+  }
+  if (!has_text) {
+    return parseError("Missing \"text\"");
+  }
+  return request;
+}
+
+void appendServeMorphemes(serialize::OutputBuffer& out, std::string_view id,
+                          const std::vector<core::Morpheme>& morphemes) {
+  beginResponse(out, id);
+  out.append("\"morphemes\":");
+  serialize::writeJsonArray(out, morphemes);
+  out.append('}');
+}
+
+std::string formatServeMorphemes(std::string_view id, const std::vector<core::Morpheme>& morphemes) {
+  serialize::OutputBuffer out;
+  appendServeMorphemes(out, id, morphemes);
+  return out.release();
+}
+
+std::string formatServeOutput(std::string_view id, std::string_view output) {
+  return formatServeString(id, "output", output);
+}
+
+std::string formatServeError(std::string_view id, std::string_view message) {
+  return formatServeString(id, "error", message);
+}
+
+}  // namespace suzume::cli
@@ -0,0 +1,144 @@
+#ifndef SUZUME_CLI_SERVE_PROTOCOL_H_
+#define SUZUME_CLI_SERVE_PROTOCOL_H_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cli_common.h"
+#include "core/error.h"
+#include "core/morpheme.h"
+#include "serialize/serializer.h"
+
+namespace suzume::cli {
+
+/**
+ * @brief Longest request line accepted, in bytes (without the newline)
+ */
+constexpr size_t kMaxServeLineBytes = size_t{16} << 20;
+
+/**
+ * @brief Splits a byte stream into request lines
+ *
+ * A line longer than kMaxServeLineBytes is answered with an error and
+ * dropped up to its newline without being buffered.
+ */
+class LineSplitter {
+ public:
+  /**
+   * @brief Append received bytes and answer every line they complete
+   * @param handle Called as handle(line, too_long) for each non-empty line (without '\n' or '\r'),
+   *               or with an empty line and too_long set for an overlong one
+   */
+  template <typename Handler>
+  void feed(std::string_view data, Handler&& handle) {
+    while (!data.empty()) {
+      size_t newline = data.find('\n');
+      bool complete = newline != std::string_view::npos;
+      std::string_view part = data.substr(0, newline);
+      data.remove_prefix(complete ? newline + 1 : data.size());
+
+      if (discarding_) {
+        discarding_ = !complete;
+        continue;
+      }
+      if (pending_.size() + part.size() > kMaxServeLineBytes) {
+        pending_.clear();
+        discarding_ = !complete;
+        handle(std::string_view(), true);
+        continue;
+      }
+      pending_.append(part);
+      if (complete) {
+        emit(handle);
+      }
+    }
+  }
+
+  /**
+   * @brief Answer a final line without a trailing newline
+   */
+  template <typename Handler>
+  void finish(Handler&& handle) {
+    if (!discarding_) {
+      emit(handle);
+    }
+    discarding_ = false;
+  }
+
+ private:
+  std::string pending_;
+  bool discarding_{false};  // Skipping the rest of an overlong line
+
+  template <typename Handler>
+  void emit(Handler&& handle) {
+    std::string_view line = pending_;
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    if (!line.empty()) {
+      handle(line, false);
+    }
+    pending_.clear();
+  }
+};
+
+/**
+ * @brief Per-request analyzer options (unset fields use the server defaults)
+ */
+struct ServeOptions {
+  std::optional<bool> preserve_symbols;
+  std::optional<bool> normalize_vu;
+  std::optional<bool> lowercase;
+};
+
+/**
+ * @brief One serve request (one line of input)
+ *
+ * JSON form: {"id": 1, "text": "...", "mode": "search", "format": "tsv",
+ *             "options": {"preserve_symbols": true}}
+ * Any line that does not start with '{' is analyzed as plain text.
+ */
+struct ServeRequest {
+  std::string id;  // JSON string, number or null echoed back (empty if absent)
+  std::string text;
+  std::optional<std::string> mode;
+  std::optional<OutputFormat> format;
+  ServeOptions options;
+};
+
+/**
+ * @brief Parse one request line
+ * @param line Line without the trailing newline
+ * @param id_out If not null, receives the request id as soon as it is read,
+ *               so a later parse error can still be correlated
+ * @return Parsed request, or ParseError
+ */
+core::Expected<ServeRequest, core::Error> parseServeRequest(std::string_view line, std::string* id_out = nullptr);
+
+/**
+ * @brief Response line with structured morphemes (json format)
+ */
+std::string formatServeMorphemes(std::string_view id, const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief Append a formatServeMorphemes line (without newline) to a buffer
+ */
+void appendServeMorphemes(serialize::OutputBuffer& out, std::string_view id,
+                          const std::vector<core::Morpheme>& morphemes);
+
+/**
+ * @brief Response line carrying pre-rendered output (morpheme, tsv, tags, chasen)
+ */
+std::string formatServeOutput(std::string_view id, std::string_view output);
+
+/**
+ * @brief Response line reporting an error
+ */
+std::string formatServeError(std::string_view id, std::string_view message);
+
+}  // namespace suzume::cli
+
+#endif  // SUZUME_CLI_SERVE_PROTOCOL_H_
@@ -1,5 +1,6 @@
 #include "suzume.h"
 
+#include <algorithm>
 #include <cstdlib>
 #ifndef __EMSCRIPTEN__
 #include <filesystem>
@@ -75,8 +76,13 @@ struct Suzume::Impl {
   SuzumeOptions options;
   analysis::Analyzer analyzer;
   postprocess::Postprocessor postprocessor;
+  postprocess::Postprocessor coarse_postprocessor;  // analyzeMultiGranular() coarse stream
+  postprocess::Postprocessor fine_postprocessor;    // analyzeMultiGranular() fine stream
+  postprocess::TagGenerator tag_generator;          // options.tag_options
   std::shared_ptr<dictionary::UserDictionary> custom_dict;
   std::vector<std::string> dictionary_warnings;
+  core::StageStats postprocess_stats;
+  std::vector<core::Morpheme> term_buffer;  // forEachTerm() analysis, reused across documents
 
   static analysis::ScorerOptions loadScorerConfig(const SuzumeOptions& opts) {
     analysis::ScorerOptions scorer_opts = opts.scorer_options;
@@ -102,14 +108,35 @@ struct Suzume::Impl {
     return scorer_opts;
   }
 
-  static postprocess::PostprocessOptions postprocessOptionsFor(const SuzumeOptions& opts) {
-    bool merge_noun_compounds = opts.merge_compounds || opts.mode == core::AnalysisMode::Search;
-    if (opts.mode == core::AnalysisMode::Split) {
+  static analysis::AnalyzerOptions analyzerOptionsFor(const SuzumeOptions& opts) {
+    analysis::AnalyzerOptions analyzer_opts;
+    analyzer_opts.mode = opts.mode;
+    analyzer_opts.scorer_options = loadScorerConfig(opts);
+    analyzer_opts.normalize_options = opts.normalize_options;
+    analyzer_opts.sentence_cache_capacity = opts.sentence_cache_capacity;
+    analyzer_opts.sentence_cache_max_bytes = opts.sentence_cache_max_bytes;
+    analyzer_opts.unknown_options.inflection_cache_capacity = opts.inflection_cache_capacity;
+    analyzer_opts.sentence_cache = opts.sentence_cache;
+    analyzer_opts.time_generators = opts.time_generators;
+    analyzer_opts.max_edges_per_position = opts.max_edges_per_position;
+    analyzer_opts.max_edges_per_chunk = opts.max_edges_per_chunk;
+    analyzer_opts.deadline = opts.deadline;
+    return analyzer_opts;
+  }
+
+  static postprocess::PostprocessOptions postprocessOptionsFor(const SuzumeOptions& opts, core::AnalysisMode mode) {
+    bool merge_noun_compounds = opts.merge_compounds || mode == core::AnalysisMode::Search;
+    if (mode == core::AnalysisMode::Split) {
       merge_noun_compounds = false;
     }
     return postprocess::PostprocessOptions{merge_noun_compounds, opts.lemmatize, opts.remove_symbols};
   }
 
+  // Coarse granularity for multi-granular analysis (Split falls back to Normal)
+  static core::AnalysisMode coarseMode(core::AnalysisMode mode) {
+    return mode == core::AnalysisMode::Split ? core::AnalysisMode::Normal : mode;
+  }
+
   void warnDictionaryLoad(const std::string& path, const core::Error& error) {
     std::string message = "Failed to auto-load dictionary " + path + ": " + error.message;
     dictionary_warnings.push_back(message);
@@ -120,8 +147,13 @@ struct Suzume::Impl {
 
   Impl(const SuzumeOptions& opts)
       : options(opts),
-        analyzer(analysis::AnalyzerOptions{opts.mode, loadScorerConfig(opts), {}, opts.normalize_options}),
-        postprocessor(&analyzer.dictionaryManager(), postprocessOptionsFor(opts)) {
+        analyzer(analyzerOptionsFor(opts)),
+        postprocessor(&analyzer.dictionaryManager(), postprocessOptionsFor(opts, opts.mode), &analyzer.inflection()),
+        coarse_postprocessor(&analyzer.dictionaryManager(), postprocessOptionsFor(opts, coarseMode(opts.mode)),
+                             &analyzer.inflection()),
+        fine_postprocessor(&analyzer.dictionaryManager(), postprocessOptionsFor(opts, core::AnalysisMode::Split),
+                           &analyzer.inflection()),
+        tag_generator(opts.tag_options) {
     // Auto-load core.dic if found (binary format)
     std::string core_path = findDictionary("core.dic");
     if (!core_path.empty()) {
@@ -144,10 +176,16 @@ struct Suzume::Impl {
     }
   }
 
+  std::vector<core::Morpheme> postprocess(const std::vector<core::Morpheme>& morphemes) {
+    core::ScopedStageTimer timer(&postprocess_stats);
+    return postprocessor.process(morphemes);
+  }
+
   void setMode(core::AnalysisMode mode) {
     options.mode = mode;
     analyzer.setMode(mode);
-    postprocessor.setOptions(postprocessOptionsFor(options));
+    postprocessor.setOptions(postprocessOptionsFor(options, mode));
+    coarse_postprocessor.setOptions(postprocessOptionsFor(options, coarseMode(mode)));
   }
 };
 
@@ -207,29 +245,90 @@ std::vector<std::string> Suzume::dictionaryWarnings() const {
 
 std::vector<core::Morpheme> Suzume::analyze(std::string_view text) const {
   auto morphemes = impl_->analyzer.analyze(text);
-  return impl_->postprocessor.process(morphemes);
+  return impl_->postprocess(morphemes);
+}
+
+analysis::MultiGranularResult Suzume::analyzeMultiGranular(std::string_view text) const {
+  auto result = impl_->analyzer.analyzeMultiGranular(text);
+  core::ScopedStageTimer timer(&impl_->postprocess_stats);
+  result.coarse = impl_->coarse_postprocessor.process(result.coarse);
+  result.fine = impl_->fine_postprocessor.process(result.fine);
+  return result;
+}
+
+std::vector<analysis::NBestPath> Suzume::analyzeNBest(std::string_view text, size_t k) const {
+  auto paths = impl_->analyzer.analyzeNBest(text, k);
+  std::vector<analysis::NBestPath> result;
+  result.reserve(paths.size());
+  for (auto& path : paths) {
+    path.morphemes = impl_->postprocess(path.morphemes);
+    bool duplicate = std::any_of(result.begin(), result.end(), [&path](const analysis::NBestPath& seen) {
+      return std::equal(seen.morphemes.begin(), seen.morphemes.end(), path.morphemes.begin(), path.morphemes.end(),
+                        [](const core::Morpheme& lhs, const core::Morpheme& rhs) {
+                          return lhs.surface == rhs.surface && lhs.pos == rhs.pos && lhs.lemma == rhs.lemma;
+                        });
+    });
+    if (!duplicate) {
+      result.push_back(std::move(path));
+    }
+  }
+  return result;
 }
 
 std::vector<core::Morpheme> Suzume::analyzeDebug(std::string_view text, core::Lattice* out_lattice) const {
   auto morphemes = impl_->analyzer.analyzeDebug(text, out_lattice);
-  return impl_->postprocessor.process(morphemes);
+  return impl_->postprocess(morphemes);
 }
 
 std::vector<postprocess::TagEntry> Suzume::generateTags(std::string_view text) const {
   auto morphemes = impl_->analyzer.analyze(text);
-  auto processed = impl_->postprocessor.process(morphemes);
-  postprocess::TagGenerator generator(impl_->options.tag_options);
-  return generator.generate(processed);
+  auto processed = impl_->postprocess(morphemes);
+  return impl_->tag_generator.generate(processed);
 }
 
 std::vector<postprocess::TagEntry> Suzume::generateTags(std::string_view text,
                                                         const postprocess::TagGeneratorOptions& options) const {
   auto morphemes = impl_->analyzer.analyze(text);
-  auto processed = impl_->postprocessor.process(morphemes);
+  auto processed = impl_->postprocess(morphemes);
   postprocess::TagGenerator generator(options);
   return generator.generate(processed);
 }
 
+void Suzume::forEachTerm(std::string_view text, postprocess::TermSink& sink) const {
+  auto& morphemes = impl_->term_buffer;
+  impl_->analyzer.analyzeInto(text, morphemes);
+  {
+    core::ScopedStageTimer timer(&impl_->postprocess_stats);
+    impl_->postprocessor.processInPlace(morphemes);
+  }
+  impl_->tag_generator.forEachTerm(morphemes, sink);
+}
+
+void Suzume::termFrequencies(std::string_view text, postprocess::TermFrequencies& table) const {
+  table.clearCounts();
+  forEachTerm(text, table);
+}
+
+analysis::SentenceCacheStats Suzume::sentenceCacheStats() const {
+  const auto* cache = impl_->analyzer.sentenceCache();
+  return cache != nullptr ? cache->stats() : analysis::SentenceCacheStats{};
+}
+
+core::AnalysisStats Suzume::stats() const {
+  core::AnalysisStats snapshot = impl_->analyzer.stats();
+  snapshot.stage(core::AnalysisStage::Postprocess) = impl_->postprocess_stats;
+  return snapshot;
+}
+
+core::MemoryUsage Suzume::memoryUsage() const {
+  return impl_->analyzer.memoryUsage();
+}
+
+void Suzume::resetStats() {
+  impl_->analyzer.resetStats();
+  impl_->postprocess_stats = {};
+}
+
 core::AnalysisMode Suzume::mode() const {
   return impl_->options.mode;
 }
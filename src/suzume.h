@@ -1,6 +1,7 @@
 #ifndef SUZUME_SUZUME_H_
 #define SUZUME_SUZUME_H_
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -8,11 +9,15 @@
 
 #include "analysis/analyzer.h"
 #include "core/lattice.h"
+#include "core/memory_usage.h"
 #include "core/morpheme.h"
+#include "core/stats.h"
 #include "core/types.h"
 #include "dictionary/user_dict.h"
+#include "grammar/inflection.h"
 #include "normalize/normalizer.h"
 #include "postprocess/tag_generator.h"
+#include "postprocess/term_frequencies.h"
 
 namespace suzume {
 
@@ -29,6 +34,24 @@ struct SuzumeOptions {
   postprocess::TagGeneratorOptions tag_options;
   normalize::NormalizeOptions normalize_options;
   analysis::ScorerOptions scorer_options;  // Scoring parameters (tunable at runtime)
+
+  // Sentence result cache for repeated text (0 = disabled). Set sentence_cache
+  // to an analysis::SharedSentenceCache to share one cache between instances
+  // on different threads; entries are keyed by dictionaries and options, so
+  // only instances configured alike reuse each other's results.
+  size_t sentence_cache_capacity = 0;
+  size_t sentence_cache_max_bytes = 0;  // Also bound the cache by approximate bytes (0 = entries only)
+  std::shared_ptr<analysis::SentenceCache> sentence_cache;
+  bool time_generators = false;  // Time each candidate generator (see stats())
+
+  // Soft cap on cached inflection analyses (at least 1024): checked between
+  // chunks, clearing the cache once reached, so one chunk may exceed it
+  size_t inflection_cache_capacity = grammar::Inflection::kDefaultCacheCapacity;
+
+  // Work budgets for untrusted input (0 = unlimited); see analysis::AnalyzerOptions
+  size_t max_edges_per_position = 0;
+  size_t max_edges_per_chunk = 0;
+  std::chrono::microseconds deadline{0};  // Wall-clock budget per analyze call
 };
 
 /**
@@ -119,6 +142,29 @@ class Suzume {
    */
   std::vector<core::Morpheme> analyze(std::string_view text) const;
 
+  /**
+   * @brief Analyze text into coarse and fine morphemes in one pass
+   *
+   * Returns the same streams as analyze() in the current mode (Normal when
+   * the mode is Split) and analyze() in AnalysisMode::Split, but builds each
+   * lattice only once. Both streams share character offsets.
+   */
+  analysis::MultiGranularResult analyzeMultiGranular(std::string_view text) const;
+
+  /**
+   * @brief Analyze text into its k cheapest segmentations
+   *
+   * Intended for query expansion: the first segmentation matches analyze(),
+   * followed by the cheapest alternatives with their lattice path costs.
+   * Each path is postprocessed like analyze(); paths that become identical
+   * after postprocessing are reported once, so fewer than k may be returned.
+   *
+   * @param text UTF-8 encoded Japanese text
+   * @param k Maximum number of segmentations
+   * @return analyze() result first, then alternatives in ascending cost order
+   */
+  std::vector<analysis::NBestPath> analyzeNBest(std::string_view text, size_t k) const;
+
   /**
    * @brief Debug analyze - returns lattice for debugging
    * @param text UTF-8 encoded Japanese text
@@ -143,6 +189,62 @@ class Suzume {
   std::vector<postprocess::TagEntry> generateTags(std::string_view text,
                                                   const postprocess::TagGeneratorOptions& options) const;
 
+  /**
+   * @brief Stream terms of text to a sink (indexing path)
+   *
+   * Emits the terms generateTags() would consider, using the instance tag
+   * options, but in text order with repeats and as views into the analysis
+   * result rather than copied strings. The analysis goes into a buffer
+   * owned by this instance and reused by the next call, so views are only
+   * valid during the sink call and the sink must not call back into this
+   * instance.
+   *
+   * @param text UTF-8 encoded Japanese text
+   * @param sink Receives one call per term
+   */
+  void forEachTerm(std::string_view text, postprocess::TermSink& sink) const;
+
+  /**
+   * @brief Count terms of text into a reusable frequency table
+   *
+   * Clears the table's counts, then counts every term forEachTerm() emits.
+   * Interned term IDs persist across calls, so a table reused for many
+   * documents only allocates for terms it has not seen before.
+   *
+   * @param text UTF-8 encoded Japanese text
+   * @param table Frequency table (one per thread)
+   */
+  void termFrequencies(std::string_view text, postprocess::TermFrequencies& table) const;
+
+  /**
+   * @brief Sentence cache statistics (all zero if the cache is disabled)
+   */
+  analysis::SentenceCacheStats sentenceCacheStats() const;
+
+  /**
+   * @brief Snapshot of stage timers and counters
+   *
+   * Always collected: per-stage time (normalize, pretokenize, lattice build,
+   * Viterbi, postprocess), per-generator call and edge counts, pruning and
+   * sentence cache counters. Per-generator time requires
+   * SuzumeOptions::time_generators.
+   */
+  core::AnalysisStats stats() const;
+
+  /**
+   * @brief Approximate heap usage by component
+   *
+   * Covers dictionaries (entries, tries, retained images), the inflection
+   * and sentence caches, and buffers reused between calls. Shared
+   * dictionaries and caches are counted in full by every instance.
+   */
+  core::MemoryUsage memoryUsage() const;
+
+  /**
+   * @brief Reset all stats counters to zero
+   */
+  void resetStats();
+
   /**
    * @brief Get analysis mode
    */
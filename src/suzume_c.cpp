@@ -5,6 +5,8 @@
 
 #include "suzume_c.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
@@ -15,8 +17,10 @@
 #include <string>
 #include <string_view>
 
+#include "core/stats.h"
 #include "grammar/conjugation.h"
 #include "postprocess/tag_generator.h"
+#include "serialize/serializer.h"
 #include "suzume.h"
 
 // Internal handle structure
@@ -27,6 +31,9 @@ struct SuzumeHandle {
   explicit SuzumeHandle(const suzume::SuzumeOptions& opts) : instance(opts) {}
 };
 
+static_assert(SUZUME_STATS_STAGE_COUNT == suzume::core::kNumAnalysisStages, "stage count mismatch");
+static_assert(SUZUME_STATS_GENERATOR_COUNT == suzume::core::kNumGeneratorKinds, "generator count mismatch");
+
 namespace {
 
 thread_local std::string last_error;
@@ -114,6 +121,10 @@ SUZUME_EXPORT void suzume_init_extended_options(suzume_extended_options_t* optio
   options->mode = 0;
   options->lemmatize = 1;
   options->merge_compounds = 0;
+  options->max_edges_per_position = 0;
+  options->max_edges_per_chunk = 0;
+  options->deadline_us = 0;
+  options->inflection_cache_size = 0;
 }
 
 SUZUME_EXPORT suzume_t suzume_create_with_extended_options(const suzume_extended_options_t* options) {
@@ -149,6 +160,23 @@ SUZUME_EXPORT suzume_t suzume_create_with_extended_options(const suzume_extended
               options, offsetof(suzume_extended_options_t, merge_compounds) + sizeof(options->merge_compounds))) {
         opts.merge_compounds = (options->merge_compounds != 0);
       }
+      if (hasExtendedOptionField(options, offsetof(suzume_extended_options_t, max_edges_per_position) +
+                                              sizeof(options->max_edges_per_position))) {
+        opts.max_edges_per_position = options->max_edges_per_position;
+      }
+      if (hasExtendedOptionField(options, offsetof(suzume_extended_options_t, max_edges_per_chunk) +
+                                              sizeof(options->max_edges_per_chunk))) {
+        opts.max_edges_per_chunk = options->max_edges_per_chunk;
+      }
+      if (hasExtendedOptionField(options,
+                                 offsetof(suzume_extended_options_t, deadline_us) + sizeof(options->deadline_us))) {
+        opts.deadline = std::chrono::microseconds(options->deadline_us);
+      }
+      if (hasExtendedOptionField(options, offsetof(suzume_extended_options_t, inflection_cache_size) +
+                                              sizeof(options->inflection_cache_size)) &&
+          options->inflection_cache_size != 0) {
+        opts.inflection_cache_capacity = options->inflection_cache_size;
+      }
     }
     return new SuzumeHandle(opts);
   } catch (...) {
@@ -222,6 +250,39 @@ SUZUME_EXPORT suzume_result_t* suzume_analyze(suzume_t handle, const char* text)
   }
 }
 
+SUZUME_EXPORT char* suzume_analyze_serialized(suzume_t handle, const char* text, int format, size_t* out_length) {
+  if (handle == nullptr || text == nullptr) {
+    setLastError("suzume_analyze_serialized: null handle or text");
+    return nullptr;
+  }
+  if (format < SUZUME_FORMAT_MORPHEME || format > SUZUME_FORMAT_BINARY) {
+    setLastError("suzume_analyze_serialized: unknown format");
+    return nullptr;
+  }
+
+  clearLastError();
+  try {
+    auto morphemes = handle->instance.analyze(text);
+    suzume::serialize::OutputBuffer out;
+    suzume::serialize::serialize(out, static_cast<suzume::serialize::SerialFormat>(format), morphemes);
+
+    auto* buffer = static_cast<char*>(std::malloc(out.size() + 1));
+    if (buffer == nullptr) {
+      setLastError("suzume_analyze_serialized: out of memory");
+      return nullptr;
+    }
+    std::memcpy(buffer, out.data(), out.size());
+    buffer[out.size()] = '\0';
+    if (out_length != nullptr) {
+      *out_length = out.size();
+    }
+    return buffer;
+  } catch (...) {
+    setLastErrorFromException();
+    return nullptr;
+  }
+}
+
 SUZUME_EXPORT void suzume_result_free(suzume_result_t* result) {
   if (result == nullptr) {
     return;
@@ -393,6 +454,104 @@ SUZUME_EXPORT int suzume_load_binary_dict(suzume_t handle, const uint8_t* data,
   }
 }
 
+SUZUME_EXPORT int suzume_get_stats(suzume_t handle, suzume_stats_t* stats) {
+  if (handle == nullptr || stats == nullptr) {
+    setLastError("suzume_get_stats: null handle or stats");
+    return 0;
+  }
+  if (stats->size < sizeof(stats->size)) {
+    setLastError("suzume_get_stats: stats->size is not set");
+    return 0;
+  }
+
+  clearLastError();
+  try {
+    suzume::core::AnalysisStats snapshot = handle->instance.stats();
+
+    suzume_stats_t full{};
+    full.size = static_cast<uint32_t>(std::min<size_t>(stats->size, sizeof(suzume_stats_t)));
+    full.analyze_calls = snapshot.analyze_calls;
+    full.input_bytes = snapshot.input_bytes;
+    full.chunks = snapshot.chunks;
+    full.lattice_edges = snapshot.lattice_edges;
+    full.pruned_edges = snapshot.pruned_edges;
+    full.cache_lookups = snapshot.cache_lookups;
+    full.cache_hits = snapshot.cache_hits;
+    for (size_t i = 0; i < SUZUME_STATS_STAGE_COUNT; ++i) {
+      full.stage_calls[i] = snapshot.stages[i].calls;
+      full.stage_ns[i] = snapshot.stages[i].nanoseconds;
+    }
+    for (size_t i = 0; i < SUZUME_STATS_GENERATOR_COUNT; ++i) {
+      full.generator_calls[i] = snapshot.generators[i].calls;
+      full.generator_edges[i] = snapshot.generators[i].edges;
+      full.generator_ns[i] = snapshot.generators[i].nanoseconds;
+      full.generator_skipped[i] = snapshot.generators[i].skipped;
+      full.generator_productive[i] = snapshot.generators[i].productive;
+    }
+    full.degraded_chunks = snapshot.degraded_chunks;
+
+    // Older callers pass a smaller struct; copy only what they have room for
+    std::memcpy(stats, &full, full.size);
+    return 1;
+  } catch (...) {
+    setLastErrorFromException();
+    return 0;
+  }
+}
+
+SUZUME_EXPORT int suzume_get_memory_usage(suzume_t handle, suzume_memory_usage_t* usage) {
+  if (handle == nullptr || usage == nullptr) {
+    setLastError("suzume_get_memory_usage: null handle or usage");
+    return 0;
+  }
+  if (usage->size < sizeof(usage->size)) {
+    setLastError("suzume_get_memory_usage: usage->size is not set");
+    return 0;
+  }
+
+  clearLastError();
+  try {
+    suzume::core::MemoryUsage snapshot = handle->instance.memoryUsage();
+
+    suzume_memory_usage_t full{};
+    full.size = static_cast<uint32_t>(std::min<size_t>(usage->size, sizeof(suzume_memory_usage_t)));
+    full.dictionary_entries = snapshot.dictionary_entries;
+    full.tries = snapshot.tries;
+    full.string_pools = snapshot.string_pools;
+    full.inflection_cache = snapshot.inflection_cache;
+    full.sentence_cache = snapshot.sentence_cache;
+    full.scratch = snapshot.scratch;
+    full.total = snapshot.total();
+
+    std::memcpy(usage, &full, full.size);
+    return 1;
+  } catch (...) {
+    setLastErrorFromException();
+    return 0;
+  }
+}
+
+SUZUME_EXPORT void suzume_reset_stats(suzume_t handle) {
+  if (handle == nullptr) {
+    return;
+  }
+  handle->instance.resetStats();
+}
+
+SUZUME_EXPORT const char* suzume_stats_stage_name(uint32_t index) {
+  if (index >= SUZUME_STATS_STAGE_COUNT) {
+    return nullptr;
+  }
+  return suzume::core::analysisStageName(static_cast<suzume::core::AnalysisStage>(index));
+}
+
+SUZUME_EXPORT const char* suzume_stats_generator_name(uint32_t index) {
+  if (index >= SUZUME_STATS_GENERATOR_COUNT) {
+    return nullptr;
+  }
+  return suzume::core::generatorKindName(static_cast<suzume::core::GeneratorKind>(index));
+}
+
 SUZUME_EXPORT const char* suzume_version(void) {
   static std::string version_str = suzume::Suzume::version();
   return version_str.c_str();
@@ -406,6 +565,14 @@ SUZUME_EXPORT size_t suzume_sizeof_result(void) {
   return sizeof(suzume_result_t);
 }
 
+SUZUME_EXPORT size_t suzume_sizeof_stats(void) {
+  return sizeof(suzume_stats_t);
+}
+
+SUZUME_EXPORT size_t suzume_sizeof_memory_usage(void) {
+  return sizeof(suzume_memory_usage_t);
+}
+
 SUZUME_EXPORT size_t suzume_sizeof_morpheme(void) {
   return sizeof(suzume_morpheme_t);
 }
@@ -500,6 +667,14 @@ SUZUME_EXPORT size_t suzume_offsetof_extended_options(uint32_t field) {
       return offsetof(suzume_extended_options_t, lemmatize);
     case 6:
       return offsetof(suzume_extended_options_t, merge_compounds);
+    case 7:
+      return offsetof(suzume_extended_options_t, max_edges_per_position);
+    case 8:
+      return offsetof(suzume_extended_options_t, max_edges_per_chunk);
+    case 9:
+      return offsetof(suzume_extended_options_t, deadline_us);
+    case 10:
+      return offsetof(suzume_extended_options_t, inflection_cache_size);
     default:
       return static_cast<size_t>(-1);
   }
@@ -75,15 +75,75 @@ typedef struct {
  * true values such as preserve_case and lemmatize are preserved.
  */
 typedef struct {
-  uint32_t size;        /**< Structure size for forward/backward compatibility */
-  int preserve_vu;      /**< Preserve ヴ (don't normalize to ビ etc.) */
-  int preserve_case;    /**< Preserve case (don't lowercase ASCII) */
-  int preserve_symbols; /**< Preserve symbols/emoji (don't remove from output) */
-  int mode;             /**< 0=normal, 1=search, 2=split */
-  int lemmatize;        /**< Apply lemmatization */
-  int merge_compounds;  /**< Merge consecutive noun compounds */
+  uint32_t size;                   /**< Structure size for forward/backward compatibility */
+  int preserve_vu;                 /**< Preserve ヴ (don't normalize to ビ etc.) */
+  int preserve_case;               /**< Preserve case (don't lowercase ASCII) */
+  int preserve_symbols;            /**< Preserve symbols/emoji (don't remove from output) */
+  int mode;                        /**< 0=normal, 1=search, 2=split */
+  int lemmatize;                   /**< Apply lemmatization */
+  int merge_compounds;             /**< Merge consecutive noun compounds */
+  uint32_t max_edges_per_position; /**< Lattice edges per position before skipping generators (0=unlimited) */
+  uint32_t max_edges_per_chunk;    /**< Lattice edges per chunk before dictionary-only mode (0=unlimited) */
+  uint32_t deadline_us;            /**< Wall-clock budget per analyze call in microseconds (0=none) */
+  uint32_t inflection_cache_size;  /**< Soft cap on cached inflection analyses, checked between chunks (0=default) */
 } suzume_extended_options_t;
 
+/** Number of entries in suzume_stats_t stage arrays */
+#define SUZUME_STATS_STAGE_COUNT 5
+/** Number of entries in suzume_stats_t generator arrays */
+#define SUZUME_STATS_GENERATOR_COUNT 13
+
+/**
+ * @brief Analysis statistics snapshot
+ *
+ * Set size to sizeof(suzume_stats_t) before calling suzume_get_stats();
+ * only the first size bytes are written. Array indices are named by
+ * suzume_stats_stage_name() and suzume_stats_generator_name().
+ */
+typedef struct {
+  uint32_t size;                                               /**< Structure size for compatibility */
+  uint64_t analyze_calls;                                      /**< Analyze calls */
+  uint64_t input_bytes;                                        /**< Total input bytes */
+  uint64_t chunks;                                             /**< Chunks run through lattice + Viterbi */
+  uint64_t lattice_edges;                                      /**< Lattice edges generated */
+  uint64_t pruned_edges;                                       /**< Edges removed before Viterbi */
+  uint64_t cache_lookups;                                      /**< Sentence cache lookups */
+  uint64_t cache_hits;                                         /**< Sentence cache hits */
+  uint64_t stage_calls[SUZUME_STATS_STAGE_COUNT];              /**< Calls per stage */
+  uint64_t stage_ns[SUZUME_STATS_STAGE_COUNT];                 /**< Nanoseconds per stage */
+  uint64_t generator_calls[SUZUME_STATS_GENERATOR_COUNT];      /**< Calls per generator */
+  uint64_t generator_edges[SUZUME_STATS_GENERATOR_COUNT];      /**< Edges per generator */
+  uint64_t generator_ns[SUZUME_STATS_GENERATOR_COUNT];         /**< Nanoseconds per generator (if timed) */
+  uint64_t generator_skipped[SUZUME_STATS_GENERATOR_COUNT];    /**< Positions skipped by generator prefilters */
+  uint64_t generator_productive[SUZUME_STATS_GENERATOR_COUNT]; /**< Generator calls that added edges */
+  uint64_t degraded_chunks;                                    /**< Chunks cut short by a work budget */
+} suzume_stats_t;
+
+/**
+ * @brief Approximate heap usage by component, in bytes
+ *
+ * Set size to sizeof(suzume_memory_usage_t) before calling
+ * suzume_get_memory_usage(); only the first size bytes are written.
+ * Shared dictionaries are counted in full by every instance.
+ */
+typedef struct {
+  uint32_t size;               /**< Structure size for compatibility */
+  uint64_t dictionary_entries; /**< Parsed dictionary entries and their strings */
+  uint64_t tries;              /**< Double-array and user dictionary tries */
+  uint64_t string_pools;       /**< Dictionary images kept after loading */
+  uint64_t inflection_cache;   /**< Inflection analysis cache */
+  uint64_t sentence_cache;     /**< Sentence result cache */
+  uint64_t scratch;            /**< Buffers kept between analyze calls */
+  uint64_t total;              /**< Sum of the above */
+} suzume_memory_usage_t;
+
+/** Output formats for suzume_analyze_serialized() */
+#define SUZUME_FORMAT_MORPHEME 0 /**< surface TAB pos TAB lemma lines */
+#define SUZUME_FORMAT_TSV 1      /**< surface TAB pos TAB lemma TAB start TAB end lines */
+#define SUZUME_FORMAT_JSON 2     /**< Compact JSON array of morpheme objects */
+#define SUZUME_FORMAT_CHASEN 3   /**< ChaSen-like lines terminated by EOS */
+#define SUZUME_FORMAT_BINARY 4   /**< Length-prefixed binary encoding */
+
 // --- Lifecycle functions ---
 
 /**
@@ -131,6 +191,21 @@ SUZUME_EXPORT void suzume_destroy(suzume_t handle);
  */
 SUZUME_EXPORT suzume_result_t* suzume_analyze(suzume_t handle, const char* text);
 
+/**
+ * @brief Analyze text and serialize the morphemes in one call
+ *
+ * Avoids building a suzume_result_t when the caller only needs text or
+ * binary output (e.g. to forward over a pipe or from WASM).
+ *
+ * @param handle Suzume handle
+ * @param text UTF-8 encoded Japanese text
+ * @param format One of SUZUME_FORMAT_*
+ * @param out_length If not NULL, receives the output length in bytes
+ *        (excluding the terminating NUL, which is always appended)
+ * @return Output buffer, or NULL on failure. Free with suzume_free.
+ */
+SUZUME_EXPORT char* suzume_analyze_serialized(suzume_t handle, const char* text, int format, size_t* out_length);
+
 /**
  * @brief Free analysis result
  * @param result Result to free
@@ -196,6 +271,43 @@ SUZUME_EXPORT int suzume_load_user_dict(suzume_t handle, const char* data, size_
  */
 SUZUME_EXPORT int suzume_load_binary_dict(suzume_t handle, const uint8_t* data, size_t size);
 
+// --- Statistics functions ---
+
+/**
+ * @brief Get cumulative analysis statistics
+ * @param handle Suzume handle
+ * @param stats Output structure (size field must be set)
+ * @return 1 on success, 0 on failure
+ */
+SUZUME_EXPORT int suzume_get_stats(suzume_t handle, suzume_stats_t* stats);
+
+/**
+ * @brief Reset analysis statistics to zero
+ * @param handle Suzume handle
+ * @note Passing NULL is allowed and has no effect.
+ */
+SUZUME_EXPORT void suzume_reset_stats(suzume_t handle);
+
+/**
+ * @brief Name of a stage array index (e.g. "viterbi")
+ * @return Static string, or NULL if index is out of range
+ */
+SUZUME_EXPORT const char* suzume_stats_stage_name(uint32_t index);
+
+/**
+ * @brief Name of a generator array index (e.g. "dictionary")
+ * @return Static string, or NULL if index is out of range
+ */
+SUZUME_EXPORT const char* suzume_stats_generator_name(uint32_t index);
+
+/**
+ * @brief Get approximate heap usage by component
+ * @param handle Suzume handle
+ * @param usage Output structure (size field must be set)
+ * @return 1 on success, 0 on failure
+ */
+SUZUME_EXPORT int suzume_get_memory_usage(suzume_t handle, suzume_memory_usage_t* usage);
+
 // --- Utility functions ---
 
 /**
@@ -235,6 +347,16 @@ SUZUME_EXPORT size_t suzume_sizeof_tag_options(void);
  */
 SUZUME_EXPORT size_t suzume_sizeof_extended_options(void);
 
+/**
+ * @brief Get sizeof(suzume_stats_t)
+ */
+SUZUME_EXPORT size_t suzume_sizeof_stats(void);
+
+/**
+ * @brief Get sizeof(suzume_memory_usage_t)
+ */
+SUZUME_EXPORT size_t suzume_sizeof_memory_usage(void);
+
 /**
  * @brief Get byte offset of field in suzume_result_t
  * @param field 0=morphemes, 1=count
@@ -265,7 +387,9 @@ SUZUME_EXPORT size_t suzume_offsetof_tag_options(uint32_t field);
  * @brief Get byte offset of field in suzume_extended_options_t
  * @param field 0=size, 1=preserve_vu, 2=preserve_case,
  *              3=preserve_symbols, 4=mode, 5=lemmatize,
- *              6=merge_compounds
+ *              6=merge_compounds, 7=max_edges_per_position,
+ *              8=max_edges_per_chunk, 9=deadline_us,
+ *              10=inflection_cache_size
  */
 SUZUME_EXPORT size_t suzume_offsetof_extended_options(uint32_t field);
 
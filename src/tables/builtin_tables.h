@@ -0,0 +1,81 @@
+/**
+ * @file builtin_tables.h
+ * @brief Build-time generated grammar and core dictionary tables
+ *
+ * suzume-gen-tables runs the core dictionary, auxiliary and verb-ending
+ * generators at build time and writes their output as constant arrays, so
+ * analyzers built with SUZUME_PREBUILT_TABLES copy ready-made records at
+ * startup instead of generating, sorting and building tries.
+ */
+
+#ifndef SUZUME_TABLES_BUILTIN_TABLES_H_
+#define SUZUME_TABLES_BUILTIN_TABLES_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace suzume::tables {
+
+/**
+ * @brief Core dictionary entry (sorted by surface, as CoreDictionary stores them)
+ */
+struct CoreEntryRecord {
+  const char* surface;
+  const char* lemma;
+  uint8_t pos;           // core::PartOfSpeech
+  uint8_t extended_pos;  // core::ExtendedPOS
+};
+
+/**
+ * @brief Auxiliary entry (grammar::AuxiliaryEntry, in getAuxiliaries() order)
+ */
+struct AuxiliaryRecord {
+  const char* surface;
+  const char* reading;
+  const char* lemma;
+  uint16_t left_id;
+  uint16_t right_id;
+  uint16_t required_conn;
+};
+
+/**
+ * @brief Verb ending (grammar::VerbEnding, in getVerbEndings() order)
+ */
+struct VerbEndingRecord {
+  const char* suffix;
+  const char* base_suffix;
+  uint8_t verb_type;  // grammar::VerbType
+  uint16_t provides_conn;
+  bool is_onbin;
+};
+
+extern const CoreEntryRecord kCoreEntries[];
+extern const size_t kCoreEntryCount;
+
+// Serialized DoubleArray (DoubleArray::serialize() format) over kCoreEntries
+extern const uint8_t kCoreTrie[];
+extern const size_t kCoreTrieSize;
+
+extern const AuxiliaryRecord kAuxiliaries[];
+extern const size_t kAuxiliaryCount;
+
+extern const VerbEndingRecord kVerbEndings[];
+extern const size_t kVerbEndingCount;
+
+/**
+ * @brief Range of kVerbEndingsByConn holding the endings that provide one connection ID
+ */
+struct VerbEndingGroupRecord {
+  uint16_t conn;
+  uint16_t begin;
+  uint16_t count;
+};
+
+// grammar::groupVerbEndingsByConn() over kVerbEndings (groups sorted by conn)
+extern const uint16_t kVerbEndingsByConn[];
+extern const VerbEndingGroupRecord kVerbEndingGroups[];
+extern const size_t kVerbEndingGroupCount;
+
+}  // namespace suzume::tables
+
+#endif  // SUZUME_TABLES_BUILTIN_TABLES_H_
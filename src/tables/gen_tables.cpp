@@ -0,0 +1,145 @@
+/**
+ * @file gen_tables.cpp
+ * @brief Build-time generator for builtin_tables.cpp
+ *
+ * Usage: suzume-gen-tables <output.cpp>
+ *
+ * Runs the same generators the library falls back to without
+ * SUZUME_PREBUILT_TABLES and writes their results as constant arrays
+ * declared in builtin_tables.h.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dictionary/core_dict.h"
+#include "dictionary/double_array.h"
+#include "grammar/auxiliary_generator.h"
+#include "grammar/verb_endings.h"
+
+namespace {
+
+using suzume::dictionary::CoreDictionary;
+using suzume::dictionary::DictionaryEntry;
+using suzume::dictionary::DoubleArray;
+
+// C++ string literal; UTF-8 bytes are kept as is
+std::string literal(std::string_view value) {
+  std::string out = "\"";
+  for (char chr : value) {
+    auto byte = static_cast<unsigned char>(chr);
+    if (chr == '"' || chr == '\\') {
+      out += '\\';
+      out += chr;
+    } else if (byte < 0x20) {
+      static const char* const kHex = "0123456789abcdef";
+      out += "\\x";
+      out += kHex[byte >> 4];
+      out += kHex[byte & 0xF];
+      out += "\" \"";  // Stop the hex escape from absorbing the next byte
+    } else {
+      out += chr;
+    }
+  }
+  out += '"';
+  return out;
+}
+
+void writeCoreEntries(std::ostream& out) {
+  std::vector<DictionaryEntry> entries = CoreDictionary::collectEntries();
+  out << "const CoreEntryRecord kCoreEntries[] = {\n";
+  for (const auto& entry : entries) {
+    out << "    {" << literal(entry.surface) << ", " << literal(entry.lemma) << ", "
+        << static_cast<int>(entry.pos) << ", " << static_cast<int>(entry.extended_pos) << "},\n";
+  }
+  out << "};\n";
+  out << "const size_t kCoreEntryCount = " << entries.size() << ";\n\n";
+
+  DoubleArray trie;
+  CoreDictionary::buildTrie(entries, trie);
+  std::vector<uint8_t> bytes = trie.serialize();
+  out << "alignas(4) const uint8_t kCoreTrie[] = {";
+  for (size_t idx = 0; idx < bytes.size(); ++idx) {
+    out << (idx % 16 == 0 ? "\n    " : " ") << static_cast<int>(bytes[idx]) << ",";
+  }
+  out << "\n};\n";
+  out << "const size_t kCoreTrieSize = " << bytes.size() << ";\n\n";
+}
+
+void writeAuxiliaries(std::ostream& out) {
+  auto auxiliaries = suzume::grammar::generateAllAuxiliaries();
+  out << "const AuxiliaryRecord kAuxiliaries[] = {\n";
+  for (const auto& aux : auxiliaries) {
+    out << "    {" << literal(aux.surface) << ", " << literal(aux.reading) << ", " << literal(aux.lemma) << ", "
+        << aux.left_id << ", " << aux.right_id << ", " << aux.required_conn << "},\n";
+  }
+  out << "};\n";
+  out << "const size_t kAuxiliaryCount = " << auxiliaries.size() << ";\n\n";
+}
+
+void writeVerbEndings(std::ostream& out) {
+  auto endings = suzume::grammar::buildVerbEndings();
+  out << "const VerbEndingRecord kVerbEndings[] = {\n";
+  for (const auto& ending : endings) {
+    out << "    {" << literal(ending.suffix) << ", " << literal(ending.base_suffix) << ", "
+        << static_cast<int>(ending.verb_type) << ", " << ending.provides_conn << ", "
+        << (ending.is_onbin ? "true" : "false") << "},\n";
+  }
+  out << "};\n";
+  out << "const size_t kVerbEndingCount = " << endings.size() << ";\n\n";
+
+  std::vector<uint16_t> indices;
+  std::vector<suzume::grammar::VerbEndingGroupRange> groups;
+  suzume::grammar::groupVerbEndingsByConn(endings, indices, groups);
+  out << "const uint16_t kVerbEndingsByConn[] = {";
+  for (size_t idx = 0; idx < indices.size(); ++idx) {
+    out << (idx % 16 == 0 ? "\n    " : " ") << indices[idx] << ",";
+  }
+  out << "\n};\n";
+  out << "const VerbEndingGroupRecord kVerbEndingGroups[] = {\n";
+  for (const auto& group : groups) {
+    out << "    {" << group.conn << ", " << group.begin << ", " << group.count << "},\n";
+  }
+  out << "};\n";
+  out << "const size_t kVerbEndingGroupCount = " << groups.size() << ";\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    std::cerr << "Usage: suzume-gen-tables <output.cpp>\n";
+    return 1;
+  }
+
+  std::ostringstream out;
+  out << "// Generated by suzume-gen-tables. Do not edit.\n\n"
+      << "#include \"tables/builtin_tables.h\"\n\n"
+      << "namespace suzume::tables {\n\n";
+  writeCoreEntries(out);
+  writeAuxiliaries(out);
+  writeVerbEndings(out);
+  out << "\n}  // namespace suzume::tables\n";
+
+  // Leave an unchanged file untouched so dependents are not rebuilt
+  std::string content = out.str();
+  {
+    std::ifstream existing(argv[1], std::ios::binary);
+    std::ostringstream previous;
+    previous << existing.rdbuf();
+    if (existing && previous.str() == content) {
+      return 0;
+    }
+  }
+  std::ofstream file(argv[1], std::ios::binary | std::ios::trunc);
+  if (!file || !file.write(content.data(), static_cast<std::streamsize>(content.size()))) {
+    std::cerr << "suzume-gen-tables: cannot write " << argv[1] << "\n";
+    return 1;
+  }
+  return 0;
+}
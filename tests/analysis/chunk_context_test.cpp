@@ -0,0 +1,120 @@
+/**
+ * @file chunk_context_test.cpp
+ * @brief Tests for per-chunk span accessor and inflection memo
+ */
+
+#include "analysis/chunk_context.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include "dictionary/binary_dict.h"
+#include "dictionary/dictionary.h"
+#include "normalize/utf8.h"
+
+namespace suzume::analysis {
+namespace {
+
+class ChunkContextTest : public ::testing::Test {
+ protected:
+  grammar::Inflection inflection_;
+};
+
+TEST_F(ChunkContextTest, BytePosMatchesUtf8Offsets) {
+  std::string text = "aあ漢x";
+  auto codepoints = normalize::utf8::decode(text);
+  ChunkContext chunk(text, codepoints, inflection_);
+
+  ASSERT_EQ(chunk.size(), 4u);
+  EXPECT_EQ(chunk.bytePos(0), 0u);
+  EXPECT_EQ(chunk.bytePos(1), 1u);
+  EXPECT_EQ(chunk.bytePos(2), 4u);
+  EXPECT_EQ(chunk.bytePos(3), 7u);
+  EXPECT_EQ(chunk.bytePos(4), 8u);
+  // Out of range clamps to text size
+  EXPECT_EQ(chunk.bytePos(100), text.size());
+}
+
+TEST_F(ChunkContextTest, SpanReturnsViewIntoText) {
+  std::string text = "書いている";
+  auto codepoints = normalize::utf8::decode(text);
+  ChunkContext chunk(text, codepoints, inflection_);
+
+  EXPECT_EQ(chunk.span(0, 2), "書い");
+  EXPECT_EQ(chunk.span(2, 5), "ている");
+  EXPECT_EQ(chunk.span(0, 2).data(), text.data());
+}
+
+TEST_F(ChunkContextTest, SpanInvalidRangeIsEmpty) {
+  std::string text = "書く";
+  auto codepoints = normalize::utf8::decode(text);
+  ChunkContext chunk(text, codepoints, inflection_);
+
+  EXPECT_TRUE(chunk.span(1, 1).empty());
+  EXPECT_TRUE(chunk.span(2, 1).empty());
+  EXPECT_TRUE(chunk.span(0, 3).empty());
+}
+
+TEST_F(ChunkContextTest, AnalyzeSpanMatchesInflection) {
+  std::string text = "読んだ本";
+  auto codepoints = normalize::utf8::decode(text);
+  ChunkContext chunk(text, codepoints, inflection_);
+
+  const auto& memoized = chunk.analyzeSpan(0, 3);
+  const auto& direct = inflection_.analyze("読んだ");
+  ASSERT_EQ(memoized.size(), direct.size());
+  ASSERT_FALSE(memoized.empty());
+  EXPECT_EQ(memoized[0].base_form, "読む");
+
+  // Second call for the same span returns the same cached result
+  EXPECT_EQ(&chunk.analyzeSpan(0, 3), &memoized);
+}
+
+TEST_F(ChunkContextTest, PassedDeadlineSkipsNewSpans) {
+  std::string text = "読んだ本を書いた";
+  auto codepoints = normalize::utf8::decode(text);
+  ChunkContext chunk(text, codepoints, inflection_);
+
+  const auto& before = chunk.analyzeSpan(0, 3);
+  ASSERT_FALSE(before.empty());
+  EXPECT_FALSE(chunk.deadlineExpired());
+
+  chunk.setDeadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+  // Memoized spans still answer; new ones get nothing
+  EXPECT_EQ(&chunk.analyzeSpan(0, 3), &before);
+  EXPECT_TRUE(chunk.analyzeSpan(5, 8).empty());
+  EXPECT_TRUE(chunk.deadlineExpired());
+}
+
+TEST_F(ChunkContextTest, ConjugationIndexSkipsAuxiliaryChains) {
+  dictionary::BinaryDictWriter writer;
+  dictionary::DictionaryEntry entry;
+  entry.surface = "書く";
+  entry.lemma = "書く";
+  entry.pos = core::PartOfSpeech::Verb;
+  writer.addEntry(entry);
+  writer.addConjugatedSurface("書か", {"書く", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbMizenkei,
+                                       dictionary::ConjugationType::GodanKa});
+  writer.addConjugatedSurface("書かない", {"書く", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbMizenkei,
+                                           dictionary::ConjugationType::GodanKa, true});
+  auto data = writer.build();
+  ASSERT_TRUE(data.hasValue());
+  dictionary::DictionaryManager manager;
+  ASSERT_TRUE(manager.loadUserBinaryDictionaryFromMemory(data.value().data(), data.value().size()));
+
+  std::string text = "書かない";
+  auto codepoints = normalize::utf8::decode(text);
+  ChunkContext chunk(text, codepoints, inflection_);
+  ASSERT_FALSE(chunk.analyzeSpan(0, 4).empty());
+
+  // Chains are left to the lattice; other spans are still analyzed
+  ChunkContext indexed(text, codepoints, inflection_);
+  indexed.setConjugationIndex(&manager);
+  EXPECT_TRUE(indexed.analyzeSpan(0, 4).empty());
+  EXPECT_EQ(&indexed.analyzeSpan(0, 2), &chunk.analyzeSpan(0, 2));
+}
+
+}  // namespace
+}  // namespace suzume::analysis
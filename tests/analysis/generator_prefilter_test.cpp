@@ -0,0 +1,66 @@
+/**
+ * @file generator_prefilter_test.cpp
+ * @brief Tests for candidate generator trigger prefilters
+ */
+
+#include "analysis/generator_prefilter.h"
+
+#include <gtest/gtest.h>
+
+#include "analysis/join_candidates.h"
+#include "normalize/utf8.h"
+
+namespace suzume::analysis {
+namespace {
+
+using core::GeneratorKind;
+
+TEST(GeneratorPrefilterTest, UndeclaredGeneratorsAlwaysApply) {
+  auto codepoints = normalize::utf8::decode("今日は");
+  GeneratorPrefilter prefilter(codepoints, {});
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::Dictionary, 0));
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::TeFormAuxiliary, 2));
+}
+
+TEST(GeneratorPrefilterTest, TriggerMustFallInsideWindow) {
+  auto codepoints = normalize::utf8::decode("あいうえお");
+  GeneratorPrefilter prefilter(codepoints, {{GeneratorKind::HiraganaCompoundVerbJoin, {U'う', U'え'}, 0, 2, 3}});
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::HiraganaCompoundVerbJoin, 0));
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::HiraganaCompoundVerbJoin, 1));
+  EXPECT_FALSE(prefilter.mayApply(GeneratorKind::HiraganaCompoundVerbJoin, 2));  // Window is お and past the end
+  EXPECT_FALSE(prefilter.mayApply(GeneratorKind::HiraganaCompoundVerbJoin, 4));
+}
+
+TEST(GeneratorPrefilterTest, BigramAndUnboundedWindow) {
+  auto codepoints = normalize::utf8::decode("泰然自若然と");
+  GeneratorPrefilter prefilter(
+      codepoints, {{GeneratorKind::TaruAdjectiveJoin, {U'然'}, U'と', 1, GeneratorTrigger::kUnbounded}});
+  // Only the second 然 is followed by と
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::TaruAdjectiveJoin, 0));
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::TaruAdjectiveJoin, 3));
+  EXPECT_FALSE(prefilter.mayApply(GeneratorKind::TaruAdjectiveJoin, 4));
+  EXPECT_FALSE(prefilter.mayApply(GeneratorKind::TaruAdjectiveJoin, 5));
+}
+
+TEST(GeneratorPrefilterTest, EmptyTriggerSetDisablesGenerator) {
+  auto codepoints = normalize::utf8::decode("シンプルすぎる");
+  GeneratorPrefilter prefilter(codepoints, {{GeneratorKind::KatakanaSugiruJoin, {}, 0, 0, 0}});
+  for (size_t pos = 0; pos < codepoints.size(); ++pos) {
+    EXPECT_FALSE(prefilter.mayApply(GeneratorKind::KatakanaSugiruJoin, pos));
+  }
+}
+
+TEST(GeneratorPrefilterTest, JoinTriggersMatchTheirPatterns) {
+  const auto& triggers = joinGeneratorTriggers();
+  auto codepoints = normalize::utf8::decode("不安で読み込んでみる");
+  GeneratorPrefilter prefilter(codepoints, triggers);
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::PrefixNounJoin, 0));   // 不
+  EXPECT_FALSE(prefilter.mayApply(GeneratorKind::PrefixNounJoin, 1));  // 安
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::CompoundVerbJoin, 3));  // 読 + み + 込
+  EXPECT_TRUE(prefilter.mayApply(GeneratorKind::TeFormAuxiliary, 7));  // で
+  EXPECT_FALSE(prefilter.mayApply(GeneratorKind::TeFormAuxiliary, 8));
+  EXPECT_FALSE(prefilter.mayApply(GeneratorKind::TaruAdjectiveJoin, 0));
+}
+
+}  // namespace
+}  // namespace suzume::analysis
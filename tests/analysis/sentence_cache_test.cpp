@@ -0,0 +1,208 @@
+/**
+ * @file sentence_cache_test.cpp
+ * @brief Tests for sentence result cache
+ */
+
+#include "analysis/sentence_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "analysis/analyzer.h"
+
+namespace suzume::analysis {
+namespace {
+
+std::vector<core::Morpheme> makeMorphemes(const std::string& surface) {
+  core::Morpheme morpheme;
+  morpheme.surface = surface;
+  morpheme.start = 0;
+  morpheme.end = 1;
+  morpheme.syncPositions();
+  return {morpheme};
+}
+
+TEST(SentenceCacheTest, HitReturnsStoredMorphemes) {
+  SentenceCache cache(4);
+  SentenceCacheKey key{"猫", core::AnalysisMode::Normal, 0};
+  std::vector<core::Morpheme> out;
+
+  EXPECT_FALSE(cache.lookup(key, out));
+  cache.insert(key, makeMorphemes("猫"));
+  ASSERT_TRUE(cache.lookup(key, out));
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].surface, "猫");
+
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.lookups, 2u);
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.entries, 1u);
+  EXPECT_GT(stats.memory_bytes, 0u);
+  EXPECT_DOUBLE_EQ(stats.hitRate(), 0.5);
+}
+
+TEST(SentenceCacheTest, ModeGenerationAndOptionsArePartOfKey) {
+  SentenceCache cache(4);
+  cache.insert({"猫", core::AnalysisMode::Normal, 0}, makeMorphemes("猫"));
+  std::vector<core::Morpheme> out;
+  EXPECT_FALSE(cache.lookup({"猫", core::AnalysisMode::Search, 0}, out));
+  EXPECT_FALSE(cache.lookup({"猫", core::AnalysisMode::Normal, 1}, out));
+  EXPECT_FALSE(cache.lookup({"猫", core::AnalysisMode::Normal, 0, 1}, out));
+  EXPECT_FALSE(cache.lookup({"犬", core::AnalysisMode::Normal, 0}, out));
+}
+
+TEST(SentenceCacheTest, EvictsLeastRecentlyUsed) {
+  SentenceCache cache(2);
+  std::vector<core::Morpheme> out;
+  cache.insert({"a", core::AnalysisMode::Normal, 0}, makeMorphemes("a"));
+  cache.insert({"b", core::AnalysisMode::Normal, 0}, makeMorphemes("b"));
+  ASSERT_TRUE(cache.lookup({"a", core::AnalysisMode::Normal, 0}, out));  // a is now most recent
+  cache.insert({"c", core::AnalysisMode::Normal, 0}, makeMorphemes("c"));
+
+  EXPECT_TRUE(cache.lookup({"a", core::AnalysisMode::Normal, 0}, out));
+  EXPECT_FALSE(cache.lookup({"b", core::AnalysisMode::Normal, 0}, out));
+  EXPECT_TRUE(cache.lookup({"c", core::AnalysisMode::Normal, 0}, out));
+  EXPECT_EQ(cache.stats().entries, 2u);
+  EXPECT_EQ(cache.stats().evictions, 1u);
+}
+
+TEST(SentenceCacheTest, ZeroCapacityDisablesCache) {
+  SentenceCache cache(0);
+  std::vector<core::Morpheme> out;
+  cache.insert({"a", core::AnalysisMode::Normal, 0}, makeMorphemes("a"));
+  EXPECT_FALSE(cache.lookup({"a", core::AnalysisMode::Normal, 0}, out));
+  EXPECT_EQ(cache.stats().entries, 0u);
+}
+
+TEST(SentenceCacheTest, ByteLimitEvictsLeastRecentlyUsed) {
+  SentenceCache probe(4);
+  probe.insert({"a", core::AnalysisMode::Normal, 0}, makeMorphemes("a"));
+  size_t entry_bytes = probe.stats().memory_bytes;
+
+  // Room for two entries by size, four by count
+  SentenceCache cache(4, entry_bytes * 2 + entry_bytes / 2);
+  std::vector<core::Morpheme> out;
+  cache.insert({"a", core::AnalysisMode::Normal, 0}, makeMorphemes("a"));
+  cache.insert({"b", core::AnalysisMode::Normal, 0}, makeMorphemes("b"));
+  cache.insert({"c", core::AnalysisMode::Normal, 0}, makeMorphemes("c"));
+
+  EXPECT_FALSE(cache.lookup({"a", core::AnalysisMode::Normal, 0}, out));
+  EXPECT_TRUE(cache.lookup({"c", core::AnalysisMode::Normal, 0}, out));
+  EXPECT_EQ(cache.stats().entries, 2u);
+  EXPECT_LE(cache.stats().memory_bytes, cache.maxMemoryBytes());
+
+  // An entry larger than the whole budget is not cached
+  cache.insert({"d", core::AnalysisMode::Normal, 0}, makeMorphemes(std::string(entry_bytes * 4, 'x')));
+  EXPECT_FALSE(cache.lookup({"d", core::AnalysisMode::Normal, 0}, out));
+  EXPECT_EQ(cache.stats().entries, 2u);
+}
+
+TEST(SentenceCacheTest, ClearDropsEntries) {
+  SentenceCache cache(4);
+  cache.insert({"a", core::AnalysisMode::Normal, 0}, makeMorphemes("a"));
+  cache.clear();
+  EXPECT_EQ(cache.stats().entries, 0u);
+  EXPECT_EQ(cache.stats().memory_bytes, 0u);
+}
+
+TEST(SentenceCacheTest, SharedCacheIsThreadSafe) {
+  SharedSentenceCache cache(64);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache]() {
+      std::vector<core::Morpheme> out;
+      for (int i = 0; i < 500; ++i) {
+        std::string text = std::to_string(i % 100);
+        SentenceCacheKey key{text, core::AnalysisMode::Normal, 0};
+        if (!cache.lookup(key, out)) {
+          cache.insert(key, makeMorphemes(text));
+        } else {
+          EXPECT_EQ(out[0].surface, text);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.lookups, 2000u);
+  EXPECT_LE(stats.entries, 64u);
+}
+
+TEST(SentenceCacheTest, AnalyzerRebasesCachedOffsets) {
+  AnalyzerOptions options;
+  options.sentence_cache_capacity = 16;
+  Analyzer analyzer(options);
+  ASSERT_NE(analyzer.sentenceCache(), nullptr);
+
+  auto first = analyzer.analyze("猫が好き。");
+  auto repeated = analyzer.analyze("猫が好き。猫が好き。");
+  ASSERT_EQ(repeated.size(), first.size() * 2);
+  for (size_t i = 0; i < first.size(); ++i) {
+    const auto& again = repeated[first.size() + i];
+    EXPECT_EQ(again.surface, first[i].surface);
+    EXPECT_EQ(again.start, first[i].start + 5);
+    EXPECT_EQ(again.end_pos, first[i].end_pos + 5);
+  }
+  EXPECT_GE(analyzer.sentenceCache()->stats().hits, 2u);
+
+  // Dictionary changes invalidate cached results
+  auto hits_before = analyzer.sentenceCache()->stats().hits;
+  analyzer.addUserDictionary(std::make_shared<dictionary::UserDictionary>());
+  analyzer.analyze("猫が好き。");
+  EXPECT_EQ(analyzer.sentenceCache()->stats().hits, hits_before);
+}
+
+TEST(SentenceCacheTest, OptionsFingerprintCoversResultOptions) {
+  AnalyzerOptions options;
+  uint64_t fingerprint = Analyzer(options).optionsFingerprint();
+  EXPECT_EQ(Analyzer(AnalyzerOptions{}).optionsFingerprint(), fingerprint);
+
+  // Memory bounds and the mode (keyed separately) do not matter
+  AnalyzerOptions same = options;
+  same.unknown_options.inflection_cache_capacity = 4096;
+  same.sentence_cache_capacity = 8;
+  same.mode = core::AnalysisMode::Search;
+  EXPECT_EQ(Analyzer(same).optionsFingerprint(), fingerprint);
+
+  AnalyzerOptions scorer = options;
+  scorer.scorer_options.noun_prior += 0.5F;
+  EXPECT_NE(Analyzer(scorer).optionsFingerprint(), fingerprint);
+  AnalyzerOptions candidates = options;
+  candidates.scorer_options.candidates.verb.bonus_ichidan += 0.5F;
+  EXPECT_NE(Analyzer(candidates).optionsFingerprint(), fingerprint);
+  AnalyzerOptions unknown = options;
+  unknown.unknown_options.enable_character_speech = false;
+  EXPECT_NE(Analyzer(unknown).optionsFingerprint(), fingerprint);
+  AnalyzerOptions budget = options;
+  budget.max_edges_per_chunk = 1000;
+  EXPECT_NE(Analyzer(budget).optionsFingerprint(), fingerprint);
+}
+
+TEST(SentenceCacheTest, SharedCacheKeepsOptionsApart) {
+  auto cache = std::make_shared<SharedSentenceCache>(16);
+  AnalyzerOptions options;
+  options.sentence_cache = cache;
+  Analyzer first(options);
+  first.analyze("猫が好き。");
+
+  AnalyzerOptions tuned = options;
+  tuned.scorer_options.single_kanji_penalty += 1.0F;
+  Analyzer other(tuned);
+  other.analyze("猫が好き。");
+  EXPECT_EQ(cache->stats().hits, 0u);
+
+  AnalyzerOptions alike;
+  alike.sentence_cache = cache;
+  Analyzer same(alike);
+  same.analyze("猫が好き。");
+  EXPECT_EQ(cache->stats().hits, 1u);
+}
+
+}  // namespace
+}  // namespace suzume::analysis
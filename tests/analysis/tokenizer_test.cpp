@@ -0,0 +1,98 @@
+/**
+ * @file tokenizer_test.cpp
+ * @brief Tests for lattice construction
+ */
+
+#include "analysis/tokenizer.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "analysis/category_cost.h"
+#include "dictionary/user_dict.h"
+#include "normalize/utf8.h"
+#include "test_helpers.h"
+
+namespace suzume::analysis {
+namespace {
+
+core::Lattice buildLattice(const Tokenizer& tokenizer, std::string_view text, const LatticeBudget& budget = {},
+                           bool* degraded = nullptr) {
+  auto codepoints = normalize::utf8::decode(text);
+  std::vector<normalize::CharType> char_types;
+  for (char32_t cpt : codepoints) {
+    char_types.push_back(normalize::classifyChar(cpt));
+  }
+  return tokenizer.buildLattice(text, codepoints, char_types, nullptr, false, false, budget, degraded);
+}
+
+TEST(TokenizerTest, DictionaryEdgesCarryPrecomputedWordCost) {
+  dictionary::DictionaryManager dict_manager;
+  auto user_dict = std::make_shared<dictionary::UserDictionary>();
+  dictionary::DictionaryEntry entry;
+  entry.surface = "花見";
+  entry.lemma = "花見";
+  entry.pos = core::PartOfSpeech::Noun;
+  user_dict->addEntry(entry);
+  dict_manager.addUserDictionary(user_dict);
+
+  Scorer scorer;
+  UnknownWordGenerator unknown_gen({}, &dict_manager);
+  Tokenizer tokenizer(dict_manager, scorer, unknown_gen);
+
+  // Built twice: the second lattice reuses the per-entry costs of the first
+  for (int round = 0; round < 2; ++round) {
+    core::Lattice lattice = buildLattice(tokenizer, "美しい花見をしていた");
+    size_t precomputed = 0;
+    for (size_t idx = 0; idx < lattice.nextEdgeId(); ++idx) {
+      const core::LatticeEdge& edge = lattice.getEdge(idx);
+      if (!edge.final_cost) {
+        continue;
+      }
+      ++precomputed;
+      EXPECT_TRUE(edge.fromDictionary());
+      EXPECT_FALSE(edge.fromUserDict()) << edge.surface;  // Layer 4 can change at any time
+
+      // Same cost as scoring the edge as the tokenizer created it
+      core::LatticeEdge fresh = edge;
+      fresh.final_cost = false;
+      fresh.cost = getCategoryCost(edge.extended_pos);
+      EXPECT_FLOAT_EQ(scorer.wordCost(edge), scorer.wordCost(fresh)) << edge.surface;
+    }
+    EXPECT_GT(precomputed, 0u);
+  }
+  EXPECT_GT(tokenizer.entryWordCostBytes(), 0u);
+}
+
+TEST(TokenizerTest, WorkBudgetsBoundPathologicalInput) {
+  dictionary::DictionaryManager dict_manager;
+  Scorer scorer;
+  UnknownWordGenerator unknown_gen({}, &dict_manager);
+  Tokenizer tokenizer(dict_manager, scorer, unknown_gen);
+  LatticeBudget budget;
+  budget.max_edges_per_position = 16;
+  budget.max_edges_per_chunk = 2000;
+
+  for (const auto& input : test::pathologicalInputs()) {
+    bool degraded = false;
+    core::Lattice lattice = buildLattice(tokenizer, input, budget, &degraded);
+    EXPECT_TRUE(degraded) << input.substr(0, 30);
+    EXPECT_TRUE(lattice.isValid()) << input.substr(0, 30);
+
+    size_t generated = 0;  // Edges not from the dictionary (generators and fallback)
+    for (size_t pos = 0; pos < lattice.textLength(); ++pos) {
+      const auto& ids = lattice.edgeIdsAt(pos);
+      EXPECT_LE(ids.size(), budget.max_edges_per_position) << input.substr(0, 30) << " at " << pos;
+      for (uint32_t edge_id : ids) {
+        generated += lattice.getEdge(edge_id).fromDictionary() ? 0 : 1;
+      }
+    }
+    // Past the chunk budget only dictionary edges and one fallback per position are added
+    EXPECT_LE(generated, budget.max_edges_per_chunk + budget.max_edges_per_position + lattice.textLength())
+        << input.substr(0, 30);
+  }
+}
+
+}  // namespace
+}  // namespace suzume::analysis
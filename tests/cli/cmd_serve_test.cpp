@@ -0,0 +1,137 @@
+#include "cmd_serve.h"
+
+#include <gtest/gtest.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#endif
+
+namespace suzume::cli {
+namespace {
+
+#ifndef _WIN32
+
+// Connect to a Unix socket, retrying until the server listens (-1 on timeout)
+int connectWhenReady(const std::string& path) {
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+  auto give_up = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  while (std::chrono::steady_clock::now() < give_up) {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+      return fd;
+    }
+    ::close(fd);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return -1;
+}
+
+// Send requests, half-close, and read responses until EOF (or a 10 s stall)
+std::string roundTrip(const std::string& path, const std::string& requests, bool* got_eof) {
+  std::string received;
+  *got_eof = false;
+  int fd = connectWhenReady(path);
+  if (fd < 0) {
+    return received;
+  }
+  timeval timeout{10, 0};
+  ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  if (::write(fd, requests.data(), requests.size()) == static_cast<ssize_t>(requests.size())) {
+    ::shutdown(fd, SHUT_WR);
+    char buffer[4096];
+    while (true) {
+      ssize_t count = ::read(fd, buffer, sizeof(buffer));
+      if (count < 0 && errno == EINTR) {
+        continue;
+      }
+      if (count <= 0) {
+        *got_eof = count == 0;
+        break;
+      }
+      received.append(buffer, static_cast<size_t>(count));
+    }
+  }
+  ::close(fd);
+  return received;
+}
+
+TEST(CmdServeTest, SocketAnswersEveryClientAndStopsOnSignal) {
+  std::string path = "/tmp/suzume_serve_test_" + std::to_string(::getpid()) + ".sock";
+  CommandArgs args;
+  args.no_user_dict = true;
+
+  int exit_code = -1;
+  std::thread server([&] { exit_code = serveUnixSocket(args, path, 2); });
+
+  // More clients than connection slots: each must see EOF once answered,
+  // including the last one, while no further client is connecting
+  constexpr int kClients = 5;
+  std::vector<std::string> responses(kClients);
+  std::vector<char> eof(kClients, 0);
+  std::vector<std::thread> clients;
+  for (int idx = 0; idx < kClients; ++idx) {
+    clients.emplace_back([&, idx] {
+      bool got_eof = false;
+      std::string id = std::to_string(idx);
+      responses[idx] = roundTrip(path,
+                                 R"({"id": )" + id + R"(, "text": "東京に行く"})" + "\n" + "猫が鳴く\n" +
+                                     R"({"id": )" + id + R"(, "text": ")" + "\n",
+                                 &got_eof);
+      eof[idx] = got_eof ? 1 : 0;
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+
+  for (int idx = 0; idx < kClients; ++idx) {
+    EXPECT_TRUE(eof[idx]) << "client " << idx;
+    std::vector<std::string> lines;
+    size_t start = 0;
+    for (size_t newline; (newline = responses[idx].find('\n', start)) != std::string::npos; start = newline + 1) {
+      lines.push_back(responses[idx].substr(start, newline - start));
+    }
+    ASSERT_EQ(lines.size(), 3u) << responses[idx];
+    std::string id_field = "\"id\":" + std::to_string(idx);
+    EXPECT_NE(lines[0].find(id_field), std::string::npos) << lines[0];
+    EXPECT_NE(lines[0].find("東京"), std::string::npos) << lines[0];
+    EXPECT_NE(lines[1].find("猫"), std::string::npos) << lines[1];
+    EXPECT_NE(lines[2].find("\"error\""), std::string::npos) << lines[2];
+  }
+
+  ::pthread_kill(server.native_handle(), SIGTERM);
+  server.join();
+  EXPECT_EQ(exit_code, 0);
+  EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(CmdServeTest, SocketRefusesToReplaceRegularFile) {
+  std::string path = "/tmp/suzume_serve_test_file_" + std::to_string(::getpid());
+  { std::ofstream(path) << "keep"; }
+  CommandArgs args;
+  args.no_user_dict = true;
+  EXPECT_EQ(serveUnixSocket(args, path, 1), 1);
+  EXPECT_TRUE(std::filesystem::is_regular_file(path));
+  std::filesystem::remove(path);
+}
+
+#endif  // _WIN32
+
+}  // namespace
+}  // namespace suzume::cli
@@ -7,6 +7,7 @@
 
 // Include the header directly since we add the CLI source dir to includes
 #include "dict_compiler.h"
+#include "dictionary/binary_dict.h"
 
 namespace suzume::cli {
 namespace {
@@ -112,5 +113,53 @@ TEST_F(DictCompilerTest, CompileMultipleRejectsDuplicateSurfaceAndPosAcrossFiles
   EXPECT_FALSE(std::filesystem::exists(output));
 }
 
+TEST_F(DictCompilerTest, ConjugationIndexCoversAuxiliaryChains) {
+  auto input = writeFile("verbs.tsv", "食べる\tVERB\tICHIDAN\n書く\tVERB\tGODAN_KA\n高い\tADJ\tI_ADJ\n");
+  auto output = temp_dir_ / "out.dic";
+
+  DictCompiler compiler;
+  compiler.setConjugationIndex(true);
+  ASSERT_TRUE(compiler.compile(input.string(), output.string()).hasValue());
+  EXPECT_GT(compiler.conjIndexed(), compiler.entriesCompiled());
+
+  dictionary::BinaryDictionary dict;
+  ASSERT_TRUE(dict.loadFromFile(output.string()).hasValue());
+  ASSERT_TRUE(dict.hasConjugationIndex());
+
+  const auto* chain = dict.findConjugated("食べました");
+  ASSERT_NE(chain, nullptr);
+  EXPECT_EQ(chain->lemma, "食べる");
+  EXPECT_EQ(chain->pos, core::PartOfSpeech::Verb);
+  EXPECT_EQ(chain->conj_type, dictionary::ConjugationType::Ichidan);
+
+  // Extended POS is that of the leading word (書い in 書いた)
+  const auto* onbin = dict.findConjugated("書いた");
+  ASSERT_NE(onbin, nullptr);
+  EXPECT_EQ(onbin->lemma, "書く");
+  EXPECT_EQ(onbin->extended_pos, core::ExtendedPOS::VerbOnbinkei);
+  EXPECT_EQ(onbin->conj_type, dictionary::ConjugationType::GodanKa);
+
+  const auto* adj = dict.findConjugated("高くなかった");
+  ASSERT_NE(adj, nullptr);
+  EXPECT_EQ(adj->lemma, "高い");
+  EXPECT_EQ(adj->conj_type, dictionary::ConjugationType::IAdjective);
+
+  // Derived words outside the paradigm are not indexed
+  EXPECT_EQ(dict.findConjugated("高さ"), nullptr);
+}
+
+TEST_F(DictCompilerTest, ConjugationIndexIsOptIn) {
+  auto input = writeFile("verbs.tsv", "食べる\tVERB\tICHIDAN\n");
+  auto output = temp_dir_ / "out.dic";
+
+  DictCompiler compiler;
+  ASSERT_TRUE(compiler.compile(input.string(), output.string()).hasValue());
+
+  dictionary::BinaryDictionary dict;
+  ASSERT_TRUE(dict.loadFromFile(output.string()).hasValue());
+  EXPECT_FALSE(dict.hasConjugationIndex());
+  EXPECT_EQ(dict.findConjugated("食べました"), nullptr);
+}
+
 }  // namespace
 }  // namespace suzume::cli
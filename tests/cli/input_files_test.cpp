@@ -0,0 +1,62 @@
+#include "input_files.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace suzume::cli {
+namespace {
+
+class InputFilesTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    temp_dir_ = std::filesystem::temp_directory_path() /
+                ("suzume_input_files_test_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+    std::filesystem::create_directories(temp_dir_ / "sub");
+    for (const char* name : {"b.txt", "a.txt", "c.md", "sub/d.txt"}) {
+      std::ofstream(temp_dir_ / name) << "x";
+    }
+  }
+
+  void TearDown() override { std::filesystem::remove_all(temp_dir_); }
+
+  std::string path(const std::string& name) const { return (temp_dir_ / name).string(); }
+
+  std::filesystem::path temp_dir_;
+};
+
+TEST(WildcardMatchTest, MatchesStarAndQuestionMark) {
+  EXPECT_TRUE(wildcardMatch("*.txt", "a.txt"));
+  EXPECT_TRUE(wildcardMatch("*", ""));
+  EXPECT_TRUE(wildcardMatch("a?c*", "abcdef"));
+  EXPECT_TRUE(wildcardMatch("*a*b", "xaxxab"));
+  EXPECT_FALSE(wildcardMatch("*.txt", "a.md"));
+  EXPECT_FALSE(wildcardMatch("a?c", "ac"));
+}
+
+TEST_F(InputFilesTest, ExpandsGlobsSortedAndInArgumentOrder) {
+  auto files = expandInputPaths({path("*.txt"), path("c.md")});
+  ASSERT_TRUE(files.hasValue()) << files.error().message;
+  ASSERT_EQ(files.value().size(), 3u);
+  EXPECT_EQ(files.value()[0], path("a.txt"));
+  EXPECT_EQ(files.value()[1], path("b.txt"));
+  EXPECT_EQ(files.value()[2], path("c.md"));
+}
+
+TEST_F(InputFilesTest, DirectoryListsRegularFilesOnly) {
+  auto files = expandInputPaths({temp_dir_.string()});
+  ASSERT_TRUE(files.hasValue());
+  EXPECT_EQ(files.value().size(), 3u);  // sub/ is not descended into
+}
+
+TEST_F(InputFilesTest, ReportsUnmatchedInput) {
+  auto files = expandInputPaths({path("*.csv")});
+  ASSERT_FALSE(files.hasValue());
+  EXPECT_EQ(files.error().code, core::ErrorCode::FileNotFound);
+  EXPECT_FALSE(expandInputPaths({path("missing.txt")}).hasValue());
+}
+
+}  // namespace
+}  // namespace suzume::cli
@@ -0,0 +1,100 @@
+#include "ordered_pipeline.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace suzume::cli {
+namespace {
+
+struct WorkerState {
+  int calls{0};
+};
+
+TEST(OrderedPipelineTest, DeliversResultsInInputOrder) {
+  int next = 0;
+  std::vector<int> consumed;
+  std::atomic<int> states{0};
+
+  runOrderedPipeline<WorkerState, int, int>(
+      4, 8,
+      [&next](int& input) {
+        if (next == 200) {
+          return false;
+        }
+        input = next++;
+        return true;
+      },
+      [&states]() {
+        ++states;
+        return std::make_unique<WorkerState>();
+      },
+      [](WorkerState& state, int& input) {
+        ++state.calls;
+        // Uneven work so results finish out of order
+        if (input % 7 == 0) {
+          std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return input * 2;
+      },
+      [&consumed](int& output) { consumed.push_back(output); });
+
+  ASSERT_EQ(consumed.size(), 200u);
+  for (int idx = 0; idx < 200; ++idx) {
+    EXPECT_EQ(consumed[idx], idx * 2);
+  }
+  EXPECT_EQ(states.load(), 4);
+}
+
+TEST(OrderedPipelineTest, EmptyInputProducesNothing) {
+  int consumed = 0;
+  runOrderedPipeline<WorkerState, int, int>(
+      2, 2, [](int&) { return false; }, []() { return std::make_unique<WorkerState>(); },
+      [](WorkerState&, int& input) { return input; }, [&consumed](int&) { ++consumed; });
+  EXPECT_EQ(consumed, 0);
+}
+
+TEST(OrderedPipelineTest, RethrowsWorkerFailure) {
+  int next = 0;
+  auto run = [&next]() {
+    runOrderedPipeline<WorkerState, int, std::string>(
+        3, 6,
+        [&next](int& input) {
+          if (next == 50) {
+            return false;
+          }
+          input = next++;
+          return true;
+        },
+        []() { return std::make_unique<WorkerState>(); },
+        [](WorkerState&, int& input) {
+          if (input == 20) {
+            throw std::runtime_error("boom");
+          }
+          return std::to_string(input);
+        },
+        [](std::string&) {});
+  };
+  EXPECT_THROW(run(), std::runtime_error);
+}
+
+TEST(OrderedPipelineTest, RethrowsStateCreationFailure) {
+  auto run = []() {
+    runOrderedPipeline<WorkerState, int, int>(
+        2, 4,
+        [](int& input) {
+          input = 1;
+          return true;
+        },
+        []() -> std::unique_ptr<WorkerState> { throw std::runtime_error("no dictionary"); },
+        [](WorkerState&, int& input) { return input; }, [](int&) {});
+  };
+  EXPECT_THROW(run(), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace suzume::cli
@@ -0,0 +1,115 @@
+#include "serve_protocol.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace suzume::cli {
+namespace {
+
+TEST(ServeProtocolTest, ParsesFullRequest) {
+  auto parsed = parseServeRequest(
+      R"({"id": "req-1", "text": "東京\n", "mode": "search", "format": "tsv", "options": {"preserve_symbols": true}})");
+  ASSERT_TRUE(parsed.hasValue()) << parsed.error().message;
+  const auto& request = parsed.value();
+  EXPECT_EQ(request.id, "\"req-1\"");
+  EXPECT_EQ(request.text, "東京\n");
+  EXPECT_EQ(request.mode.value_or(""), "search");
+  ASSERT_TRUE(request.format.has_value());
+  EXPECT_EQ(*request.format, OutputFormat::Tsv);
+  EXPECT_EQ(request.options.preserve_symbols, std::optional<bool>(true));
+  EXPECT_FALSE(request.options.lowercase.has_value());
+}
+
+TEST(ServeProtocolTest, DecodesUnicodeEscapesAndSkipsUnknownKeys) {
+  auto parsed = parseServeRequest(R"({"extra": [1, {"a": null}], "text": "東京 😀", "id": 7})");
+  ASSERT_TRUE(parsed.hasValue()) << parsed.error().message;
+  EXPECT_EQ(parsed.value().text, "東京 😀");
+  EXPECT_EQ(parsed.value().id, "7");
+}
+
+TEST(ServeProtocolTest, IdMustBeStringNumberOrNull) {
+  auto parsed = parseServeRequest(R"({"id": "a\u0022b\n", "text": "x"})");
+  ASSERT_TRUE(parsed.hasValue()) << parsed.error().message;
+  EXPECT_EQ(parsed.value().id, R"("a\"b\n")");
+  EXPECT_EQ(parseServeRequest(R"({"id": -1.5e3, "text": "x"})").value().id, "-1.5e3");
+  EXPECT_EQ(parseServeRequest(R"({"id": null, "text": "x"})").value().id, "null");
+
+  // Anything else would be echoed into the response as invalid JSON
+  for (const char* line : {R"({"id": [1], "text": "x"})", R"({"id": {"a": 1}, "text": "x"})",
+                           R"({"id": true, "text": "x"})", R"({"id": 01, "text": "x"})",
+                           R"({"id": 1x, "text": "x"})", R"({"id": --1, "text": "x"})"}) {
+    std::string id;
+    EXPECT_FALSE(parseServeRequest(line, &id).hasValue()) << line;
+    EXPECT_TRUE(id.empty()) << line;
+  }
+}
+
+TEST(ServeProtocolTest, PlainLineIsText) {
+  auto parsed = parseServeRequest("今日は晴れ");
+  ASSERT_TRUE(parsed.hasValue());
+  EXPECT_EQ(parsed.value().text, "今日は晴れ");
+  EXPECT_TRUE(parsed.value().id.empty());
+}
+
+TEST(ServeProtocolTest, RejectsMalformedRequests) {
+  std::string id;
+  auto parsed = parseServeRequest(R"({"id": 3, "text": "abc)", &id);
+  ASSERT_FALSE(parsed.hasValue());
+  EXPECT_EQ(parsed.error().code, core::ErrorCode::ParseError);
+  EXPECT_EQ(id, "3");
+
+  EXPECT_FALSE(parseServeRequest(R"({"id": 1})").hasValue());
+  EXPECT_FALSE(parseServeRequest(R"({"text": "a", "mode": "fast"})").hasValue());
+  EXPECT_FALSE(parseServeRequest(R"({"text": "a", "format": "xml"})").hasValue());
+  EXPECT_FALSE(parseServeRequest(R"({"text": "a"} trailing)").hasValue());
+}
+
+TEST(ServeProtocolTest, FormatsResponses) {
+  core::Morpheme mor;
+  mor.surface = "東京";
+  mor.pos = core::PartOfSpeech::Noun;
+  mor.lemma = "東京";
+  mor.start_pos = 0;
+  mor.end_pos = 2;
+
+  EXPECT_EQ(formatServeMorphemes("1", {mor}),
+            R"({"id":1,"morphemes":[{"surface":"東京","pos":"NOUN","lemma":"東京","start":0,"end":2}]})");
+  EXPECT_EQ(formatServeOutput("", "a\tb\n"), R"({"output":"a\tb\n"})");
+  EXPECT_EQ(formatServeError("\"x\"", "bad \"input\""), R"({"id":"x","error":"bad \"input\""})");
+}
+
+// Lines seen by a LineSplitter handler ("!" marks an overlong line)
+struct SplitLines {
+  std::vector<std::string> lines;
+  void operator()(std::string_view line, bool too_long) { lines.emplace_back(too_long ? "!" : std::string(line)); }
+};
+
+TEST(ServeProtocolTest, LineSplitterJoinsChunksAndSkipsEmptyLines) {
+  LineSplitter splitter;
+  SplitLines seen;
+  splitter.feed("東", seen);
+  splitter.feed("京\r\n\n\r\nsecond\nthi", seen);
+  EXPECT_EQ(seen.lines, (std::vector<std::string>{"東京", "second"}));
+  splitter.finish(seen);
+  EXPECT_EQ(seen.lines, (std::vector<std::string>{"東京", "second", "thi"}));
+}
+
+TEST(ServeProtocolTest, LineSplitterDropsOverlongLine) {
+  LineSplitter splitter;
+  SplitLines seen;
+  std::string half(kMaxServeLineBytes / 2 + 1, 'x');
+  splitter.feed("ok\n" + half, seen);
+  splitter.feed(half, seen);  // Over the limit: answered once, nothing kept
+  splitter.feed(half + "\nnext\n", seen);
+  EXPECT_EQ(seen.lines, (std::vector<std::string>{"ok", "!", "next"}));
+
+  // A final overlong line without newline is not answered twice
+  splitter.feed(std::string(kMaxServeLineBytes + 1, 'x'), seen);
+  splitter.finish(seen);
+  EXPECT_EQ(seen.lines, (std::vector<std::string>{"ok", "!", "next", "!"}));
+}
+
+}  // namespace
+}  // namespace suzume::cli
@@ -0,0 +1,285 @@
+// Aggregation and baseline comparison for the data-driven accuracy runner.
+
+#include "accuracy_report.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace suzume::test {
+
+namespace {
+
+// Version 2: relative latency is against the reference workload
+constexpr int kBaselineVersion = 2;
+
+GroupMetrics summarize(const std::string& name, const std::vector<const CaseResult*>& cases) {
+  GroupMetrics group;
+  group.name = name;
+  group.cases = cases.size();
+
+  std::vector<double> latencies;
+  latencies.reserve(cases.size());
+  uint64_t edges = 0;
+  size_t chars = 0;
+  for (const CaseResult* result : cases) {
+    group.passed += result->passed ? 1 : 0;
+    latencies.push_back(result->latency_us);
+    edges += result->edges;
+    chars += result->chars;
+  }
+  group.p50_us = percentile(latencies, 50.0);
+  group.p99_us = percentile(std::move(latencies), 99.0);
+  group.edges_per_char = chars == 0 ? 0.0 : static_cast<double>(edges) / static_cast<double>(chars);
+  return group;
+}
+
+// Cursor over formatBaseline() output: flat objects of string and number values
+class BaselineParser {
+ public:
+  explicit BaselineParser(const std::string& json) : json_(json) {}
+
+  std::vector<GroupMetrics> parse() {
+    std::vector<GroupMetrics> groups;
+    size_t version_key = json_.find("\"version\"");
+    if (version_key != std::string::npos) {
+      pos_ = json_.find(':', version_key);
+      if (pos_ != std::string::npos) {
+        ++pos_;
+        skipWhitespace();
+        version_ = static_cast<int>(parseNumber());
+      }
+    }
+    size_t key = json_.find("\"groups\"");
+    if (key == std::string::npos) {
+      throw std::runtime_error("Baseline has no \"groups\" array");
+    }
+    pos_ = json_.find('[', key);
+    if (pos_ == std::string::npos) {
+      throw std::runtime_error("Baseline \"groups\" is not an array");
+    }
+    ++pos_;
+    while (true) {
+      skipWhitespace();
+      char chr = peek();
+      if (chr == ']') {
+        return groups;
+      }
+      if (chr == ',') {
+        ++pos_;
+        continue;
+      }
+      groups.push_back(parseGroup());
+    }
+  }
+
+ private:
+  GroupMetrics parseGroup() {
+    expect('{');
+    GroupMetrics group;
+    while (true) {
+      skipWhitespace();
+      if (peek() == '}') {
+        ++pos_;
+        break;
+      }
+      if (peek() == ',') {
+        ++pos_;
+        continue;
+      }
+      std::string key = parseString();
+      skipWhitespace();
+      expect(':');
+      skipWhitespace();
+      if (key == "name") {
+        group.name = parseString();
+        continue;
+      }
+      double value = parseNumber();
+      if (key == "cases") {
+        group.cases = static_cast<size_t>(value);
+      } else if (key == "passed") {
+        group.passed = static_cast<size_t>(value);
+      } else if (key == "p50_us") {
+        group.p50_us = value;
+      } else if (key == "p99_us") {
+        group.p99_us = value;
+      } else if (key == "relative_p50") {
+        group.relative_p50 = value;
+      } else if (key == "relative_p99") {
+        group.relative_p99 = value;
+      } else if (key == "edges_per_char") {
+        group.edges_per_char = value;
+      }
+    }
+    if (group.name.empty()) {
+      throw std::runtime_error("Baseline group without a name");
+    }
+    if (version_ < kBaselineVersion) {
+      group.relative_p50 = 0.0;  // Not comparable; checkGrowth() skips zero baselines
+      group.relative_p99 = 0.0;
+    }
+    return group;
+  }
+
+  std::string parseString() {
+    expect('"');
+    size_t end = json_.find('"', pos_);
+    if (end == std::string::npos) {
+      throw std::runtime_error("Unterminated string in baseline");
+    }
+    std::string value = json_.substr(pos_, end - pos_);
+    pos_ = end + 1;
+    return value;
+  }
+
+  double parseNumber() {
+    const char* begin = json_.c_str() + pos_;
+    char* end = nullptr;
+    double value = std::strtod(begin, &end);
+    if (end == begin) {
+      throw std::runtime_error("Expected a number in baseline at offset " + std::to_string(pos_));
+    }
+    pos_ += static_cast<size_t>(end - begin);
+    return value;
+  }
+
+  void skipWhitespace() {
+    while (pos_ < json_.size() && std::isspace(static_cast<unsigned char>(json_[pos_])) != 0) {
+      ++pos_;
+    }
+  }
+
+  char peek() {
+    if (pos_ >= json_.size()) {
+      throw std::runtime_error("Unexpected end of baseline");
+    }
+    return json_[pos_];
+  }
+
+  void expect(char chr) {
+    skipWhitespace();
+    if (peek() != chr) {
+      throw std::runtime_error(std::string("Expected '") + chr + "' in baseline at offset " + std::to_string(pos_));
+    }
+    ++pos_;
+  }
+
+  const std::string& json_;
+  size_t pos_{0};
+  int version_{0};
+};
+
+void checkGrowth(const GroupMetrics& group, const char* metric, double baseline, double current, double tolerance,
+                 std::vector<Regression>& out, bool warning = false) {
+  if (baseline > 0.0 && current > baseline * (1.0 + tolerance)) {
+    out.push_back({group.name, metric, baseline, current, warning});
+  }
+}
+
+}  // namespace
+
+std::string categoryOf(const std::string& file) {
+  std::string name = file;
+  if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0) {
+    name.resize(name.size() - 5);
+  }
+  return name.substr(0, name.find('_'));
+}
+
+double percentile(std::vector<double> values, double pct) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  std::sort(values.begin(), values.end());
+  auto rank = static_cast<size_t>(std::ceil(pct / 100.0 * static_cast<double>(values.size())));
+  return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+}
+
+std::vector<GroupMetrics> aggregate(const std::vector<CaseResult>& results, double reference_us) {
+  std::vector<const CaseResult*> all;
+  std::map<std::string, std::vector<const CaseResult*>> categories;
+  std::map<std::string, std::vector<const CaseResult*>> files;
+  for (const CaseResult& result : results) {
+    all.push_back(&result);
+    categories["category:" + categoryOf(result.file)].push_back(&result);
+    files["file:" + result.file].push_back(&result);
+  }
+
+  std::vector<GroupMetrics> groups;
+  groups.push_back(summarize("total", all));
+  for (const auto& [name, cases] : categories) {
+    groups.push_back(summarize(name, cases));
+  }
+  for (const auto& [name, cases] : files) {
+    groups.push_back(summarize(name, cases));
+  }
+
+  if (reference_us > 0.0) {
+    for (GroupMetrics& group : groups) {
+      group.relative_p50 = group.p50_us / reference_us;
+      group.relative_p99 = group.p99_us / reference_us;
+    }
+  }
+  return groups;
+}
+
+std::string formatBaseline(const std::vector<GroupMetrics>& groups) {
+  std::string out = "{\n  \"version\": " + std::to_string(kBaselineVersion) + ",\n  \"groups\": [\n";
+  char buf[512];
+  for (size_t idx = 0; idx < groups.size(); ++idx) {
+    const GroupMetrics& group = groups[idx];
+    std::snprintf(buf, sizeof(buf),
+                  "    {\"name\": \"%s\", \"cases\": %zu, \"passed\": %zu, \"p50_us\": %.2f, \"p99_us\": %.2f, "
+                  "\"relative_p50\": %.4f, \"relative_p99\": %.4f, \"edges_per_char\": %.4f}%s\n",
+                  group.name.c_str(), group.cases, group.passed, group.p50_us, group.p99_us, group.relative_p50,
+                  group.relative_p99, group.edges_per_char, idx + 1 < groups.size() ? "," : "");
+    out += buf;
+  }
+  out += "  ]\n}\n";
+  return out;
+}
+
+std::vector<GroupMetrics> parseBaseline(const std::string& json) { return BaselineParser(json).parse(); }
+
+std::vector<Regression> compareToBaseline(const std::vector<GroupMetrics>& current,
+                                          const std::vector<GroupMetrics>& baseline, const Tolerances& tolerances) {
+  std::map<std::string, const GroupMetrics*> previous;
+  for (const GroupMetrics& group : baseline) {
+    previous[group.name] = &group;
+  }
+
+  std::vector<Regression> regressions;
+  for (const GroupMetrics& group : current) {
+    auto found = previous.find(group.name);
+    if (found == previous.end()) {
+      continue;
+    }
+    const GroupMetrics& base = *found->second;
+
+    // Count failures rather than passes so newly added passing cases are not flagged
+    if (group.failed() > base.failed()) {
+      regressions.push_back(
+          {group.name, "failed", static_cast<double>(base.failed()), static_cast<double>(group.failed())});
+    }
+    checkGrowth(group, "edges_per_char", base.edges_per_char, group.edges_per_char, tolerances.edges, regressions);
+    size_t cases = std::min(group.cases, base.cases);
+    bool warning = !tolerances.gate_latency;
+    if (cases >= tolerances.min_latency_cases) {
+      checkGrowth(group, "relative_p50", base.relative_p50, group.relative_p50, tolerances.latency, regressions,
+                  warning);
+    }
+    if (cases >= tolerances.min_p99_cases) {
+      checkGrowth(group, "relative_p99", base.relative_p99, group.relative_p99, tolerances.latency, regressions,
+                  warning);
+    }
+  }
+  return regressions;
+}
+
+}  // namespace suzume::test
@@ -0,0 +1,84 @@
+// Aggregation and baseline comparison for the data-driven accuracy runner.
+//
+// Case results are grouped per JSON file and per category (the file name
+// prefix before the first '_', e.g. "verb" for verb_ichidan.json). Latency
+// is compared through each group's percentiles divided by the time of a
+// fixed reference workload that does not use the analyzer, so a baseline
+// recorded on a faster or slower machine stays comparable and one group
+// getting faster does not move the others. Accuracy and edges per character
+// are deterministic and gate; latency is noisy and only warns unless asked.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace suzume::test {
+
+// Outcome of one test case
+struct CaseResult {
+  std::string file;        // JSON file name (e.g., "verb_ichidan.json")
+  std::string id;          // Test case id
+  bool passed{false};      // Surfaces (and POS/lemma where given) matched
+  double latency_us{0.0};  // Fastest of the repeated analyze() calls
+  size_t chars{0};         // Input length in codepoints
+  uint64_t edges{0};       // Lattice edges generated for the input
+};
+
+// Aggregated metrics of a file, a category or the whole run
+struct GroupMetrics {
+  std::string name;  // "total", "category:<name>" or "file:<name>"
+  size_t cases{0};
+  size_t passed{0};
+  double p50_us{0.0};
+  double p99_us{0.0};
+  double relative_p50{0.0};  // p50_us / reference workload time
+  double relative_p99{0.0};  // p99_us / reference workload time
+  double edges_per_char{0.0};
+
+  size_t failed() const { return cases - passed; }
+  double accuracy() const { return cases == 0 ? 0.0 : static_cast<double>(passed) / static_cast<double>(cases); }
+};
+
+// Allowed growth before a metric counts as a regression
+struct Tolerances {
+  double latency = 0.25;          // Relative p50/p99 growth
+  double edges = 0.05;            // Edges per character growth
+  size_t min_latency_cases = 20;  // Smaller groups are too noisy for latency checks
+  size_t min_p99_cases = 100;     // Below this the nearest-rank p99 is the slowest case
+  bool gate_latency = false;      // Latency growth is a regression rather than a warning
+};
+
+// A metric that got worse than its baseline
+struct Regression {
+  std::string group;
+  std::string metric;  // "failed", "edges_per_char", "relative_p50" or "relative_p99"
+  double baseline{0.0};
+  double current{0.0};
+  bool warning{false};  // Reported but not failing (latency unless Tolerances::gate_latency)
+};
+
+// Category of a test data file name
+std::string categoryOf(const std::string& file);
+
+// Nearest-rank percentile (pct in [0, 100]); 0 for an empty set
+double percentile(std::vector<double> values, double pct);
+
+// Group results: "total" first, then categories, then files (each sorted by name)
+// reference_us: time of the reference workload on this machine (0 = no relative latency)
+std::vector<GroupMetrics> aggregate(const std::vector<CaseResult>& results, double reference_us);
+
+// Baseline JSON with one group object per line
+std::string formatBaseline(const std::vector<GroupMetrics>& groups);
+
+// Parse formatBaseline() output (throws std::runtime_error on malformed input).
+// Relative latency of version 1 baselines (relative to the run's total) is dropped.
+std::vector<GroupMetrics> parseBaseline(const std::string& json);
+
+// Compare groups present in both runs; groups missing from either side are ignored
+std::vector<Regression> compareToBaseline(const std::vector<GroupMetrics>& current,
+                                          const std::vector<GroupMetrics>& baseline, const Tolerances& tolerances);
+
+}  // namespace suzume::test
@@ -32,4 +32,20 @@ std::vector<std::string> getSurfaces(const std::vector<core::Morpheme>& result)
   return surfaces;
 }
 
+std::vector<std::string> pathologicalInputs() {
+  auto repeat = [](const std::string& unit, size_t count) {
+    std::string text;
+    for (size_t i = 0; i < count; ++i) {
+      text += unit;
+    }
+    return text;
+  };
+  return {repeat("あいうえおかきくけこ", 100),
+          repeat("してみていって", 150),
+          "やばい" + repeat("ー", 1000),
+          "きた" + repeat("あ", 1000),
+          repeat("漢字熟語処理", 150),
+          repeat("カタカナ", 250)};
+}
+
 }  // namespace suzume::test
@@ -18,4 +18,8 @@ bool hasSurface(const std::vector<core::Morpheme>& result, const std::string& su
 // Extract all surface forms from morpheme vector
 std::vector<std::string> getSurfaces(const std::vector<core::Morpheme>& result);
 
+// Inputs that blow up candidate generation without a work budget (long kana,
+// emphatic and kanji/katakana runs)
+std::vector<std::string> pathologicalInputs();
+
 }  // namespace suzume::test
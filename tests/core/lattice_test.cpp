@@ -0,0 +1,196 @@
+#include "core/lattice.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string_view>
+
+#include "core/viterbi.h"
+
+namespace suzume {
+namespace core {
+namespace {
+
+float edgeCost(const LatticeEdge& edge) { return edge.cost; }
+
+// Word cost only, no connection costs
+struct CostOnlyScorer {
+  float wordCost(const LatticeEdge& edge) const { return edge.cost; }
+  float connectionCost(const LatticeEdge& /*prev*/, const LatticeEdge& /*next*/) const { return 0.0F; }
+};
+
+TEST(LatticeTest, PruneKeepsCheapestDuplicate) {
+  Lattice lattice(2);
+  lattice.addEdge("食べ", 0, 2, PartOfSpeech::Verb, 1.0F, 0, "食べる");
+  size_t cheap = lattice.addEdge("食べ", 0, 2, PartOfSpeech::Verb, 0.5F, 0, "食べる");
+  lattice.addEdge("食べ", 0, 2, PartOfSpeech::Verb, 0.8F, 0, "食べる");
+
+  EXPECT_EQ(lattice.pruneDominatedEdges(edgeCost), 2u);
+  EXPECT_EQ(lattice.prunedEdgeCount(), 2u);
+  EXPECT_EQ(lattice.edgeCount(), 1u);
+
+  auto edges = lattice.edgesAt(0);
+  ASSERT_EQ(edges.size(), 1u);
+  EXPECT_EQ(edges[0].id, cheap);
+  // Removed edges remain addressable by ID
+  EXPECT_EQ(lattice.getEdge(0).surface, "食べ");
+}
+
+TEST(LatticeTest, PruneTieKeepsEarliestEdge) {
+  Lattice lattice(1);
+  size_t first = lattice.addEdge("は", 0, 1, PartOfSpeech::Particle, 0.2F, 0);
+  lattice.addEdge("は", 0, 1, PartOfSpeech::Particle, 0.2F, 0);
+
+  EXPECT_EQ(lattice.pruneDominatedEdges(edgeCost), 1u);
+  auto edges = lattice.edgesAt(0);
+  ASSERT_EQ(edges.size(), 1u);
+  EXPECT_EQ(edges[0].id, first);
+}
+
+TEST(LatticeTest, PruneKeepsEdgesThatDifferBeyondCost) {
+  Lattice lattice(2);
+  lattice.addEdge("食べ", 0, 2, PartOfSpeech::Verb, 1.0F, 0, "食べる");
+  lattice.addEdge("食べ", 0, 2, PartOfSpeech::Verb, 0.5F, 0, "食ぶ");                          // Different lemma
+  lattice.addEdge("食べ", 0, 2, PartOfSpeech::Noun, 0.5F, 0);                                  // Different POS
+  lattice.addEdge("食べ", 0, 2, PartOfSpeech::Verb, 0.5F, LatticeEdge::kFromDictionary, "食べる");  // Flags
+  lattice.addEdge("食", 0, 1, PartOfSpeech::Noun, 0.5F, 0);                                    // Different span
+
+  EXPECT_EQ(lattice.pruneDominatedEdges(edgeCost), 0u);
+  EXPECT_EQ(lattice.edgesAt(0).size(), 5u);
+}
+
+TEST(LatticeTest, PrunePreservesSurvivorOrder) {
+  Lattice lattice(2);
+  size_t a = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  size_t b = lattice.addEdge("あい", 0, 2, PartOfSpeech::Noun, 1.0F, 0);
+  size_t c = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 0.1F, 0);
+  size_t d = lattice.addEdge("あ", 0, 1, PartOfSpeech::Particle, 1.0F, 0);
+
+  EXPECT_EQ(lattice.pruneDominatedEdges(edgeCost), 1u);
+  auto edges = lattice.edgesAt(0);
+  ASSERT_EQ(edges.size(), 3u);
+  EXPECT_EQ(edges[0].id, b);
+  EXPECT_EQ(edges[1].id, c);
+  EXPECT_EQ(edges[2].id, d);
+  EXPECT_NE(edges[1].id, a);
+  EXPECT_TRUE(lattice.isValid());
+}
+
+TEST(LatticeTest, AddFlagsSinceTagsOnlyNewEdges) {
+  Lattice lattice(2);
+  size_t old_edge = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  size_t first = lattice.nextEdgeId();
+  size_t new_edge = lattice.addEdge("あい", 0, 2, PartOfSpeech::Noun, 1.0F, LatticeEdge::kFromDictionary);
+  lattice.addFlagsSince(first, LatticeEdge::kCoarseOnly);
+
+  EXPECT_FALSE(lattice.getEdge(old_edge).isCoarseOnly());
+  EXPECT_TRUE(lattice.getEdge(new_edge).isCoarseOnly());
+  EXPECT_TRUE(lattice.getEdge(new_edge).fromDictionary());
+}
+
+TEST(LatticeTest, ViterbiSkipsEdgesWithMaskedFlags) {
+  Lattice lattice(2);
+  size_t char1 = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  size_t char2 = lattice.addEdge("い", 1, 2, PartOfSpeech::Noun, 1.0F, 0);
+  size_t joined = lattice.addEdge("あい", 0, 2, PartOfSpeech::Noun, 0.5F, LatticeEdge::kCoarseOnly);
+
+  Viterbi viterbi;
+  CostOnlyScorer scorer;
+  auto coarse = viterbi.solve(lattice, scorer, LatticeEdge::kFineOnly);
+  ASSERT_EQ(coarse.path.size(), 1u);
+  EXPECT_EQ(coarse.path[0], joined);
+
+  auto fine = viterbi.solve(lattice, scorer, LatticeEdge::kCoarseOnly);
+  ASSERT_EQ(fine.path.size(), 2u);
+  EXPECT_EQ(fine.path[0], char1);
+  EXPECT_EQ(fine.path[1], char2);
+}
+
+TEST(LatticeTest, EdgesCarryCharClassesOfTheirSpan) {
+  Lattice lattice(3);
+  size_t unset = lattice.addEdge("食", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  lattice.setCharClasses({0x01, 0x02, 0x02});  // 食べる: kanji, hiragana, hiragana
+  size_t whole = lattice.addEdge("食べる", 0, 3, PartOfSpeech::Verb, 1.0F, 0);
+  LatticeEdge tail;
+  tail.surface = "べる";
+  tail.start = 1;
+  tail.end = 3;
+  tail.pos = PartOfSpeech::Verb;
+  lattice.addEdge(tail);
+
+  EXPECT_EQ(lattice.getEdge(unset).char_classes, 0);  // Added before the classes were set
+  EXPECT_EQ(lattice.getEdge(whole).char_classes, 0x03);
+  EXPECT_EQ(lattice.getEdge(whole + 1).char_classes, 0x02);
+}
+
+TEST(LatticeTest, SetWordCostMarksCostFinal) {
+  Lattice lattice(2);
+  size_t edge = lattice.addEdge("あい", 0, 2, PartOfSpeech::Noun, 1.0F, LatticeEdge::kFromDictionary);
+  EXPECT_FALSE(lattice.getEdge(edge).final_cost);
+
+  lattice.setWordCost(edge, -0.5F);
+  EXPECT_TRUE(lattice.getEdge(edge).final_cost);
+  EXPECT_FLOAT_EQ(lattice.getEdge(edge).cost, -0.5F);
+  lattice.setWordCost(lattice.nextEdgeId(), 1.0F);  // Unknown IDs are ignored
+}
+
+TEST(LatticeTest, HotFieldsLeadTheEdge) {
+  // Everything a Viterbi relaxation reads besides the strings fits in the
+  // first 24 bytes, ahead of the surface/lemma views
+  EXPECT_LT(offsetof(LatticeEdge, char_classes), offsetof(LatticeEdge, surface));
+  EXPECT_LT(offsetof(LatticeEdge, final_cost), offsetof(LatticeEdge, surface));
+  EXPECT_LE(offsetof(LatticeEdge, surface), 24U);
+  EXPECT_EQ(sizeof(LatticeEdge), offsetof(LatticeEdge, surface) + 2 * sizeof(std::string_view));
+}
+
+TEST(LatticeTest, DebugInfoIsKeptBesideEdges) {
+  Lattice lattice(2);
+  size_t plain = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  size_t traced = lattice.addEdge("書い", 0, 2, PartOfSpeech::Verb, 1.0F, 0, "書く",
+                                  dictionary::ConjugationType::GodanKa, CandidateOrigin::VerbKanji, 0.8F,
+                                  "godan_ta", ExtendedPOS::VerbOnbinkei, "candidate_gen");
+
+  EXPECT_EQ(lattice.debugInfo(plain).origin, CandidateOrigin::Unknown);
+  EXPECT_EQ(lattice.debugInfo(lattice.edgeCount() + 1).origin, CandidateOrigin::Unknown);
+#ifdef SUZUME_DEBUG_INFO
+  const EdgeDebugInfo& info = lattice.debugInfo(traced);
+  EXPECT_EQ(info.origin, CandidateOrigin::VerbKanji);
+  EXPECT_FLOAT_EQ(info.origin_confidence, 0.8F);
+  EXPECT_EQ(info.origin_detail, "godan_ta");
+  EXPECT_EQ(info.epos_source, "candidate_gen");
+  EXPECT_EQ(lattice.debugInfo(plain).epos_source, "lattice_default");
+#else
+  EXPECT_EQ(lattice.debugInfo(traced).origin, CandidateOrigin::Unknown);
+#endif
+  EXPECT_EQ(lattice.getEdge(traced).lemma, "書く");
+}
+
+TEST(LatticeTest, CopiedEdgeKeepsDebugInfo) {
+  Lattice source(4);
+  size_t traced = source.addEdge("書いた", 0, 3, PartOfSpeech::Verb, 0.5F, 0, "書く",
+                                 dictionary::ConjugationType::GodanKa, CandidateOrigin::VerbKanji, 0.8F, "godan_ta",
+                                 ExtendedPOS::VerbOnbinkei, "candidate_gen");
+
+  Lattice copy(4);
+  copy.addEdge(source.getEdge(traced), source.debugInfo(traced));
+  LatticeEdge plain = source.getEdge(traced);
+  plain.extended_pos = ExtendedPOS::Unknown;
+  plain.pos = PartOfSpeech::Noun;
+  copy.addEdge(plain);
+
+  ASSERT_EQ(copy.edgeCount(), 2U);
+#ifdef SUZUME_DEBUG_INFO
+  EXPECT_EQ(copy.debugInfo(0).origin, CandidateOrigin::VerbKanji);
+  EXPECT_FLOAT_EQ(copy.debugInfo(0).origin_confidence, 0.8F);
+  EXPECT_EQ(copy.debugInfo(0).origin_detail, "godan_ta");
+  EXPECT_EQ(copy.debugInfo(0).epos_source, "candidate_gen");
+  EXPECT_EQ(copy.debugInfo(1).origin, CandidateOrigin::Unknown);
+  EXPECT_EQ(copy.debugInfo(1).epos_source, "lattice_default");
+#else
+  EXPECT_EQ(copy.debugInfo(0).origin, CandidateOrigin::Unknown);
+#endif
+}
+
+}  // namespace
+}  // namespace core
+}  // namespace suzume
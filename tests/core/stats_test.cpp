@@ -0,0 +1,69 @@
+#include "core/stats.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace suzume {
+namespace core {
+namespace {
+
+TEST(StatsTest, StageAndGeneratorNamesAreUnique) {
+  for (size_t i = 0; i < kNumAnalysisStages; ++i) {
+    std::string name = analysisStageName(static_cast<AnalysisStage>(i));
+    EXPECT_NE(name, "unknown");
+    for (size_t j = i + 1; j < kNumAnalysisStages; ++j) {
+      EXPECT_NE(name, analysisStageName(static_cast<AnalysisStage>(j)));
+    }
+  }
+  for (size_t i = 0; i < kNumGeneratorKinds; ++i) {
+    std::string name = generatorKindName(static_cast<GeneratorKind>(i));
+    for (size_t j = i + 1; j < kNumGeneratorKinds; ++j) {
+      EXPECT_NE(name, generatorKindName(static_cast<GeneratorKind>(j)));
+    }
+  }
+  EXPECT_STREQ(analysisStageName(AnalysisStage::Viterbi), "viterbi");
+  EXPECT_STREQ(generatorKindName(GeneratorKind::Dictionary), "dictionary");
+}
+
+TEST(StatsTest, MergeAddsAllCounters) {
+  AnalysisStats lhs;
+  lhs.analyze_calls = 1;
+  lhs.cache_lookups = 4;
+  lhs.cache_hits = 1;
+  lhs.stage(AnalysisStage::Viterbi).calls = 2;
+  lhs.generator(GeneratorKind::Unknown).edges = 5;
+
+  AnalysisStats rhs;
+  rhs.analyze_calls = 2;
+  rhs.cache_lookups = 4;
+  rhs.cache_hits = 3;
+  rhs.stage(AnalysisStage::Viterbi).calls = 3;
+  rhs.stage(AnalysisStage::Viterbi).nanoseconds = 100;
+  rhs.generator(GeneratorKind::Unknown).edges = 7;
+
+  lhs.merge(rhs);
+  EXPECT_EQ(lhs.analyze_calls, 3u);
+  EXPECT_EQ(lhs.stage(AnalysisStage::Viterbi).calls, 5u);
+  EXPECT_EQ(lhs.stage(AnalysisStage::Viterbi).nanoseconds, 100u);
+  EXPECT_EQ(lhs.generator(GeneratorKind::Unknown).edges, 12u);
+  EXPECT_DOUBLE_EQ(lhs.cacheHitRate(), 0.5);
+}
+
+TEST(StatsTest, ScopedStageTimerCountsCallsAndAcceptsNull) {
+  StageStats stage;
+  {
+    ScopedStageTimer timer(&stage);
+  }
+  {
+    ScopedStageTimer timer(&stage);
+  }
+  EXPECT_EQ(stage.calls, 2u);
+
+  ScopedStageTimer noop(nullptr);
+  EXPECT_DOUBLE_EQ(AnalysisStats{}.cacheHitRate(), 0.0);
+}
+
+}  // namespace
+}  // namespace core
+}  // namespace suzume
@@ -0,0 +1,193 @@
+#include "core/viterbi.h"
+
+#include <gtest/gtest.h>
+
+namespace suzume {
+namespace core {
+namespace {
+
+// Word cost only, plus an optional penalty for NOUN -> NOUN
+struct TestScorer {
+  float noun_noun_penalty{0.0F};
+
+  float wordCost(const LatticeEdge& edge) const { return edge.cost; }
+  float connectionCost(const LatticeEdge& prev, const LatticeEdge& next) const {
+    if (prev.pos == PartOfSpeech::Noun && next.pos == PartOfSpeech::Noun) {
+      return noun_noun_penalty;
+    }
+    return 0.0F;
+  }
+};
+
+TEST(ViterbiTest, EmptyLatticeHasEmptyPath) {
+  Lattice lattice(0);
+  Viterbi viterbi;
+  auto result = viterbi.solve(lattice, TestScorer{});
+  EXPECT_TRUE(result.path.empty());
+  EXPECT_FLOAT_EQ(result.total_cost, 0.0F);
+}
+
+TEST(ViterbiTest, PicksCheapestSegmentation) {
+  Lattice lattice(3);
+  size_t whole = lattice.addEdge("あいう", 0, 3, PartOfSpeech::Noun, 2.5F, 0);
+  size_t head = lattice.addEdge("あ", 0, 1, PartOfSpeech::Particle, 0.5F, 0);
+  size_t tail = lattice.addEdge("いう", 1, 3, PartOfSpeech::Verb, 0.5F, 0);
+
+  Viterbi viterbi;
+  auto result = viterbi.solve(lattice, TestScorer{});
+  ASSERT_EQ(result.path.size(), 2u);
+  EXPECT_EQ(result.path[0], head);
+  EXPECT_EQ(result.path[1], tail);
+  EXPECT_NEAR(result.total_cost, 1.002F, 1e-5F);
+
+  size_t cheap_whole = lattice.addEdge("あいう", 0, 3, PartOfSpeech::Noun, 0.1F, 0);
+  result = viterbi.solve(lattice, TestScorer{});
+  ASSERT_EQ(result.path.size(), 1u);
+  EXPECT_EQ(result.path[0], cheap_whole);
+  EXPECT_NE(result.path[0], whole);
+}
+
+TEST(ViterbiTest, KeepsOnlyCheapestEdgePerPosAtEachPosition) {
+  // Two NOUN edges end at 1; only the cheaper one is extended
+  Lattice lattice(2);
+  size_t cheap_noun = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 0.1F, 0);
+  lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 0.2F, 0, "別");
+  size_t verb = lattice.addEdge("あ", 0, 1, PartOfSpeech::Verb, 0.9F, 0);
+  size_t noun2 = lattice.addEdge("い", 1, 2, PartOfSpeech::Noun, 0.1F, 0);
+
+  Viterbi viterbi;
+  TestScorer scorer;
+  auto result = viterbi.solve(lattice, scorer);
+  ASSERT_EQ(result.path.size(), 2u);
+  EXPECT_EQ(result.path[0], cheap_noun);
+  EXPECT_EQ(result.path[1], noun2);
+
+  // With a NOUN -> NOUN penalty the VERB state wins
+  scorer.noun_noun_penalty = 5.0F;
+  result = viterbi.solve(lattice, scorer);
+  ASSERT_EQ(result.path.size(), 2u);
+  EXPECT_EQ(result.path[0], verb);
+}
+
+TEST(ViterbiTest, TiesKeepFirstEdge) {
+  Lattice lattice(1);
+  size_t first = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0, "別");
+
+  Viterbi viterbi;
+  auto result = viterbi.solve(lattice, TestScorer{});
+  ASSERT_EQ(result.path.size(), 1u);
+  EXPECT_EQ(result.path[0], first);
+}
+
+TEST(ViterbiTest, PassedDeadlineExtendsCheapestStateOnly) {
+  // Same lattice as above: the NOUN -> NOUN penalty makes the VERB state win,
+  // but past the deadline only the cheaper NOUN state is extended
+  Lattice lattice(2);
+  size_t cheap_noun = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 0.1F, 0);
+  lattice.addEdge("あ", 0, 1, PartOfSpeech::Verb, 0.9F, 0);
+  lattice.addEdge("い", 1, 2, PartOfSpeech::Noun, 0.1F, 0);
+
+  Viterbi viterbi;
+  TestScorer scorer;
+  scorer.noun_noun_penalty = 5.0F;
+  auto result = viterbi.solve(lattice, scorer, 0, std::chrono::steady_clock::now() - std::chrono::seconds(1));
+  EXPECT_TRUE(result.degraded);
+  ASSERT_EQ(result.path.size(), 2u);
+  EXPECT_EQ(result.path[0], cheap_noun);
+
+  result = viterbi.solve(lattice, scorer, 0, std::chrono::steady_clock::now() + std::chrono::hours(1));
+  EXPECT_FALSE(result.degraded);
+  ASSERT_EQ(result.path.size(), 2u);
+  EXPECT_NE(result.path[0], cheap_noun);
+}
+
+TEST(ViterbiTest, UnreachableEndGivesEmptyPath) {
+  Lattice lattice(3);
+  lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  lattice.addEdge("う", 2, 3, PartOfSpeech::Noun, 1.0F, 0);
+
+  Viterbi viterbi;
+  auto result = viterbi.solve(lattice, TestScorer{});
+  EXPECT_TRUE(result.path.empty());
+}
+
+TEST(ViterbiTest, BuffersAreReusedAcrossLatticeSizes) {
+  Viterbi viterbi;
+  {
+    Lattice large(64);
+    for (uint32_t pos = 0; pos < 64; ++pos) {
+      large.addEdge("あ", pos, pos + 1, PartOfSpeech::Noun, 1.0F, 0);
+      if (pos + 2 <= 64) {
+        large.addEdge("ああ", pos, pos + 2, PartOfSpeech::Noun, 1.5F, 0);
+      }
+    }
+    auto result = viterbi.solve(large, TestScorer{});
+    EXPECT_EQ(result.path.size(), 32u);
+  }
+  size_t bytes = viterbi.bufferBytes();
+  EXPECT_GT(bytes, 0u);
+
+  Lattice small(2);
+  size_t word = small.addEdge("いう", 0, 2, PartOfSpeech::Verb, 0.5F, 0);
+  small.addEdge("い", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  auto result = viterbi.solve(small, TestScorer{});
+  ASSERT_EQ(result.path.size(), 1u);
+  EXPECT_EQ(result.path[0], word);
+  EXPECT_EQ(viterbi.bufferBytes(), bytes);  // Capacity is kept for the next call
+}
+
+TEST(ViterbiTest, NBestStartsWithBestPathAndOrdersAlternatives) {
+  Lattice lattice(3);
+  size_t whole = lattice.addEdge("あいう", 0, 3, PartOfSpeech::Noun, 2.5F, 0);
+  size_t head = lattice.addEdge("あ", 0, 1, PartOfSpeech::Particle, 0.5F, 0);
+  size_t tail = lattice.addEdge("いう", 1, 3, PartOfSpeech::Verb, 0.5F, 0);
+  size_t head2 = lattice.addEdge("あい", 0, 2, PartOfSpeech::Noun, 1.0F, 0);
+  size_t tail2 = lattice.addEdge("う", 2, 3, PartOfSpeech::Noun, 1.0F, 0);
+
+  Viterbi viterbi;
+  auto best = viterbi.solve(lattice, TestScorer{});
+  auto paths = viterbi.solveNBest(lattice, TestScorer{}, 5);
+  ASSERT_EQ(paths.size(), 3u);
+  EXPECT_EQ(paths[0].path, best.path);
+  EXPECT_EQ(paths[0].path, (std::vector<size_t>{head, tail}));
+  EXPECT_EQ(paths[1].path, (std::vector<size_t>{head2, tail2}));
+  EXPECT_NEAR(paths[1].total_cost, 2.002F, 1e-5F);
+  EXPECT_EQ(paths[2].path, (std::vector<size_t>{whole}));
+  EXPECT_NEAR(paths[2].total_cost, 2.501F, 1e-5F);
+
+  EXPECT_EQ(viterbi.solveNBest(lattice, TestScorer{}, 2).size(), 2u);
+  EXPECT_EQ(viterbi.solveNBest(lattice, TestScorer{}, 1).size(), 1u);
+  EXPECT_TRUE(viterbi.solveNBest(lattice, TestScorer{}, 0).empty());
+}
+
+TEST(ViterbiTest, NBestIncludesPathsMergedAwayBySolve) {
+  // The costlier NOUN edge at 1 is never extended by solve(), but is a valid
+  // alternative path
+  Lattice lattice(2);
+  size_t cheap_noun = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 0.1F, 0);
+  size_t other_noun = lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 0.2F, 0, "別");
+  size_t noun2 = lattice.addEdge("い", 1, 2, PartOfSpeech::Noun, 0.1F, 0);
+
+  Viterbi viterbi;
+  auto paths = viterbi.solveNBest(lattice, TestScorer{}, 3);
+  ASSERT_EQ(paths.size(), 2u);
+  EXPECT_EQ(paths[0].path, (std::vector<size_t>{cheap_noun, noun2}));
+  EXPECT_EQ(paths[1].path, (std::vector<size_t>{other_noun, noun2}));
+  EXPECT_LE(paths[0].total_cost, paths[1].total_cost);
+}
+
+TEST(ViterbiTest, NBestOfUnreachableEndIsEmptyPath) {
+  Lattice lattice(3);
+  lattice.addEdge("あ", 0, 1, PartOfSpeech::Noun, 1.0F, 0);
+  lattice.addEdge("う", 2, 3, PartOfSpeech::Noun, 1.0F, 0);
+
+  Viterbi viterbi;
+  auto paths = viterbi.solveNBest(lattice, TestScorer{}, 3);
+  ASSERT_EQ(paths.size(), 1u);
+  EXPECT_TRUE(paths[0].path.empty());
+}
+
+}  // namespace
+}  // namespace core
+}  // namespace suzume
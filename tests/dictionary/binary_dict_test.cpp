@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdio>
 #include <cstring>
 #include <filesystem>
@@ -552,6 +553,140 @@ TEST_F(BinaryDictTest, DictionaryManagerLoadUserBinaryDictionaryFromMemory) {
   EXPECT_TRUE(found);
 }
 
+TEST_F(BinaryDictTest, ConjugationIndexRoundTrip) {
+  BinaryDictWriter writer;
+  DictionaryEntry entry;
+  entry.surface = "食べ";
+  entry.lemma = "食べる";
+  entry.pos = core::PartOfSpeech::Verb;
+  entry.extended_pos = core::ExtendedPOS::VerbRenyokei;
+  writer.addEntry(entry);
+  writer.addConjugatedSurface("食べました", {"食べる", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbRenyokei,
+                                             ConjugationType::Ichidan});
+  writer.addConjugatedSurface("食べない", {"食べる", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbMizenkei,
+                                           ConjugationType::Ichidan});
+  auto data = writer.build();
+  ASSERT_TRUE(data.hasValue());
+
+  BinaryDictionary dict;
+  ASSERT_TRUE(dict.loadFromMemory(data.value().data(), data.value().size()).hasValue());
+  ASSERT_TRUE(dict.hasConjugationIndex());
+  const auto* found = dict.findConjugated("食べない");
+  ASSERT_NE(found, nullptr);
+  EXPECT_EQ(found->lemma, "食べる");
+  EXPECT_EQ(found->extended_pos, core::ExtendedPOS::VerbMizenkei);
+  EXPECT_EQ(found->conj_type, ConjugationType::Ichidan);
+  EXPECT_EQ(dict.findConjugated("食べ"), nullptr);
+  EXPECT_EQ(dict.findConjugated("食べまし"), nullptr);
+
+  // Regular lookups are unaffected by the index section
+  auto results = dict.lookup("食べました", 0);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0].entry->lemma, "食べる");
+
+  DictionaryManager manager;
+  EXPECT_FALSE(manager.hasConjugationIndex());
+  ASSERT_TRUE(manager.loadUserBinaryDictionaryFromMemory(data.value().data(), data.value().size()));
+  EXPECT_TRUE(manager.hasConjugationIndex());
+  ASSERT_NE(manager.findConjugated("食べました"), nullptr);
+  EXPECT_EQ(manager.findConjugated("食べました")->lemma, "食べる");
+}
+
+TEST_F(BinaryDictTest, LoadRejectsInvalidConjugationIndexRecord) {
+  BinaryDictWriter writer;
+  DictionaryEntry entry;
+  entry.surface = "見る";
+  entry.pos = core::PartOfSpeech::Verb;
+  writer.addEntry(entry);
+  writer.addConjugatedSurface("見た", {"見る", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbRenyokei,
+                                       ConjugationType::Ichidan});
+  auto data = writer.build();
+  ASSERT_TRUE(data.hasValue());
+  auto bytes = data.value();
+
+  // The only record sits right before the string pool; corrupt its conjugation type, then its flags
+  BinaryDictHeader header{};
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  ASSERT_NE(header.flags & BinaryDictHeader::kFlagConjugationIndex, 0u);
+  size_t record_offset = header.string_offset - sizeof(BinaryConjugationRecord);
+  auto corrupted = bytes;
+  corrupted[record_offset + offsetof(BinaryConjugationRecord, conj_type)] = 0xFF;
+  BinaryDictionary dict;
+  EXPECT_FALSE(dict.loadFromMemory(corrupted.data(), corrupted.size()).hasValue());
+
+  corrupted = bytes;
+  corrupted[record_offset + offsetof(BinaryConjugationRecord, flags)] = 0x80;
+  EXPECT_FALSE(dict.loadFromMemory(corrupted.data(), corrupted.size()).hasValue());
+
+  EXPECT_TRUE(dict.loadFromMemory(bytes.data(), bytes.size()).hasValue());
+}
+
+TEST_F(BinaryDictTest, MinorVersionMarksConjugationIndex) {
+  BinaryDictWriter writer;
+  DictionaryEntry entry;
+  entry.surface = "見る";
+  entry.pos = core::PartOfSpeech::Verb;
+  writer.addEntry(entry);
+  auto plain = writer.build();
+  ASSERT_TRUE(plain.hasValue());
+
+  // Images without the index stay readable by readers that predate it
+  BinaryDictionary dict;
+  ASSERT_TRUE(dict.loadFromMemory(plain.value().data(), plain.value().size()).hasValue());
+  EXPECT_EQ(dict.versionMinor(), BinaryDictHeader::kVersionMinorConjugationIndex - 1);
+  EXPECT_EQ(dict.conjugationCount(), 0u);
+
+  writer.addConjugatedSurface("見た", {"見る", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbRenyokei,
+                                       ConjugationType::Ichidan});
+  auto indexed = writer.build();
+  ASSERT_TRUE(indexed.hasValue());
+  ASSERT_TRUE(dict.loadFromMemory(indexed.value().data(), indexed.value().size()).hasValue());
+  EXPECT_EQ(dict.versionMinor(), BinaryDictHeader::kVersionMinorConjugationIndex);
+  EXPECT_EQ(dict.conjugationCount(), 1u);
+
+  // An index flag in an older minor version is rejected
+  auto bytes = indexed.value();
+  BinaryDictHeader header{};
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  header.version_minor = BinaryDictHeader::kVersionMinorConjugationIndex - 1;
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  EXPECT_FALSE(dict.loadFromMemory(bytes.data(), bytes.size()).hasValue());
+}
+
+TEST_F(BinaryDictTest, LookupConjugatedFindsChainsByPosition) {
+  BinaryDictWriter writer;
+  DictionaryEntry entry;
+  entry.surface = "書く";
+  entry.lemma = "書く";
+  entry.pos = core::PartOfSpeech::Verb;
+  writer.addEntry(entry);
+  writer.addConjugatedSurface("書か", {"書く", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbMizenkei,
+                                       ConjugationType::GodanKa});
+  writer.addConjugatedSurface("書かない", {"書く", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbMizenkei,
+                                           ConjugationType::GodanKa, true});
+  auto data = writer.build();
+  ASSERT_TRUE(data.hasValue());
+
+  BinaryDictionary dict;
+  ASSERT_TRUE(dict.loadFromMemory(data.value().data(), data.value().size()).hasValue());
+  ASSERT_NE(dict.findConjugated("書か"), nullptr);
+  EXPECT_FALSE(dict.findConjugated("書か")->auxiliary_chain);
+  ASSERT_NE(dict.findConjugated("書かない"), nullptr);
+  EXPECT_TRUE(dict.findConjugated("書かない")->auxiliary_chain);
+
+  // Matches are reported in characters from a byte position
+  std::string text = "を書かないで";
+  auto matches = dict.lookupConjugated(text, std::string("を").size());
+  ASSERT_EQ(matches.size(), 2u);
+  std::sort(matches.begin(), matches.end(),
+            [](const ConjugatedLookupResult& lhs, const ConjugatedLookupResult& rhs) { return lhs.length < rhs.length; });
+  EXPECT_EQ(matches[0].length, 2u);
+  EXPECT_FALSE(matches[0].surface->auxiliary_chain);
+  EXPECT_EQ(matches[1].length, 4u);
+  EXPECT_TRUE(matches[1].surface->auxiliary_chain);
+  EXPECT_TRUE(dict.lookupConjugated(text, 0).empty());
+}
+
 TEST_F(BinaryDictTest, DictionaryManagerLoadFromMemoryInvalidData) {
   std::vector<uint8_t> bad_data(10, 0);
 
@@ -0,0 +1,93 @@
+// Builtin table tests
+// With prebuilt tables, verifies the build-time tables match what the
+// generators produce at runtime; otherwise both sides run the generators.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "dictionary/core_dict.h"
+#include "grammar/auxiliaries.h"
+#include "grammar/auxiliary_generator.h"
+#include "grammar/verb_endings.h"
+
+namespace suzume {
+namespace {
+
+TEST(BuiltinTablesTest, CoreDictionaryMatchesGenerators) {
+  auto expected = dictionary::CoreDictionary::collectEntries();
+  dictionary::CoreDictionary dict;
+  ASSERT_EQ(dict.size(), expected.size());
+  for (uint32_t idx = 0; idx < expected.size(); ++idx) {
+    const auto* entry = dict.getEntry(idx);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->surface, expected[idx].surface) << idx;
+    EXPECT_EQ(entry->lemma, expected[idx].lemma) << idx;
+    EXPECT_EQ(entry->pos, expected[idx].pos) << idx;
+    EXPECT_EQ(entry->extended_pos, expected[idx].extended_pos) << idx;
+  }
+
+  // Every surface is found through the trie, starting at its first entry
+  for (uint32_t idx = 0; idx < expected.size(); ++idx) {
+    if (idx > 0 && expected[idx].surface == expected[idx - 1].surface) {
+      continue;
+    }
+    auto results = dict.lookup(expected[idx].surface, 0);
+    bool found = false;
+    for (const auto& result : results) {
+      found = found || result.entry_id == idx;
+    }
+    EXPECT_TRUE(found) << expected[idx].surface;
+  }
+}
+
+TEST(BuiltinTablesTest, AuxiliariesMatchGenerator) {
+  auto expected = grammar::generateAllAuxiliaries();
+  const auto& actual = grammar::getAuxiliaries();
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t idx = 0; idx < expected.size(); ++idx) {
+    EXPECT_EQ(actual[idx].surface, expected[idx].surface) << idx;
+    EXPECT_EQ(actual[idx].reading, expected[idx].reading) << idx;
+    EXPECT_EQ(actual[idx].lemma, expected[idx].lemma) << idx;
+    EXPECT_EQ(actual[idx].left_id, expected[idx].left_id) << idx;
+    EXPECT_EQ(actual[idx].right_id, expected[idx].right_id) << idx;
+    EXPECT_EQ(actual[idx].required_conn, expected[idx].required_conn) << idx;
+  }
+}
+
+TEST(BuiltinTablesTest, VerbEndingsMatchGenerator) {
+  auto expected = grammar::buildVerbEndings();
+  const auto& actual = grammar::getVerbEndings();
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t idx = 0; idx < expected.size(); ++idx) {
+    EXPECT_EQ(actual[idx].suffix, expected[idx].suffix) << idx;
+    EXPECT_EQ(actual[idx].base_suffix, expected[idx].base_suffix) << idx;
+    EXPECT_EQ(actual[idx].verb_type, expected[idx].verb_type) << idx;
+    EXPECT_EQ(actual[idx].provides_conn, expected[idx].provides_conn) << idx;
+    EXPECT_EQ(actual[idx].is_onbin, expected[idx].is_onbin) << idx;
+  }
+}
+
+TEST(BuiltinTablesTest, VerbEndingGroupsMatchScan) {
+  const auto& endings = grammar::getVerbEndings();
+  std::vector<uint16_t> conns;
+  for (const auto& ending : endings) {
+    conns.push_back(ending.provides_conn);
+  }
+  conns.push_back(0xFFFF);  // Provided by no ending
+
+  for (uint16_t conn : conns) {
+    std::vector<uint16_t> expected;
+    for (size_t idx = 0; idx < endings.size(); ++idx) {
+      if (endings[idx].provides_conn == conn) {
+        expected.push_back(static_cast<uint16_t>(idx));
+      }
+    }
+    auto group = grammar::getVerbEndingsByConn(conn);
+    EXPECT_EQ(std::vector<uint16_t>(group.begin(), group.end()), expected) << conn;
+  }
+}
+
+}  // namespace
+}  // namespace suzume
@@ -0,0 +1,117 @@
+#include "dictionary/dictionary_registry.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "dictionary/dictionary.h"
+
+namespace suzume {
+namespace dictionary {
+namespace {
+
+class DictionaryRegistryTest : public ::testing::Test {
+ protected:
+  void SetUp() override { temp_file_ = std::filesystem::temp_directory_path() / "registry_test_dict.dic"; }
+
+  void TearDown() override { std::filesystem::remove(temp_file_); }
+
+  void writeDict(const std::string& surface) {
+    BinaryDictWriter writer;
+    DictionaryEntry entry;
+    entry.surface = surface;
+    entry.lemma = surface;
+    entry.pos = core::PartOfSpeech::Noun;
+    writer.addEntry(entry);
+    ASSERT_TRUE(writer.writeToFile(temp_file_.string()).hasValue());
+  }
+
+  std::filesystem::path temp_file_;
+};
+
+TEST_F(DictionaryRegistryTest, SameFileIsShared) {
+  writeDict("共有");
+  auto& registry = DictionaryRegistry::instance();
+  size_t before = registry.size();
+
+  {
+    auto first = registry.acquire(temp_file_.string());
+    auto second = registry.acquire(temp_file_.string());
+    ASSERT_TRUE(first.hasValue());
+    ASSERT_TRUE(second.hasValue());
+    EXPECT_EQ(first.value().get(), second.value().get());
+    EXPECT_EQ(registry.size(), before + 1);
+  }
+
+  // Released once the last holder is gone
+  EXPECT_EQ(registry.size(), before);
+}
+
+TEST_F(DictionaryRegistryTest, ModifiedFileIsReloaded) {
+  writeDict("古い");
+  auto old_dict = DictionaryRegistry::instance().acquire(temp_file_.string());
+  ASSERT_TRUE(old_dict.hasValue());
+
+  writeDict("新しい単語");
+  std::filesystem::last_write_time(temp_file_,
+                                   std::filesystem::last_write_time(temp_file_) + std::chrono::seconds(1));
+  auto new_dict = DictionaryRegistry::instance().acquire(temp_file_.string());
+  ASSERT_TRUE(new_dict.hasValue());
+  EXPECT_NE(old_dict.value().get(), new_dict.value().get());
+
+  // The old instance stays usable for its holders
+  EXPECT_FALSE(old_dict.value()->lookup("古い", 0).empty());
+  EXPECT_FALSE(new_dict.value()->lookup("新しい単語", 0).empty());
+}
+
+TEST_F(DictionaryRegistryTest, MissingFileIsAnError) {
+  auto result = DictionaryRegistry::instance().acquire((temp_file_ / "missing.dic").string());
+  EXPECT_FALSE(result.hasValue());
+}
+
+TEST_F(DictionaryRegistryTest, ManagersShareLoadedDictionaries) {
+  writeDict("共有");
+  DictionaryManager first;
+  DictionaryManager second;
+  ASSERT_TRUE(first.loadCoreDictionary(temp_file_.string()));
+  size_t alive = DictionaryRegistry::instance().size();
+  ASSERT_TRUE(second.loadCoreDictionary(temp_file_.string()));
+  EXPECT_EQ(DictionaryRegistry::instance().size(), alive);
+  ASSERT_NE(first.coreBinaryDictionary(), nullptr);
+  EXPECT_EQ(first.coreBinaryDictionary(), second.coreBinaryDictionary());
+  EXPECT_FALSE(second.lookup("共有", 0).empty());
+
+  // A failed reload keeps the current dictionary
+  EXPECT_FALSE(second.loadCoreDictionary((temp_file_ / "missing.dic").string()));
+  EXPECT_TRUE(second.hasCoreBinaryDictionary());
+}
+
+TEST_F(DictionaryRegistryTest, GenerationIdentifiesDictionarySet) {
+  writeDict("共有");
+  DictionaryManager first;
+  DictionaryManager second;
+  EXPECT_EQ(first.generation(), second.generation());
+  ASSERT_TRUE(first.loadCoreDictionary(temp_file_.string()));
+  EXPECT_NE(first.generation(), second.generation());
+  ASSERT_TRUE(second.loadCoreDictionary(temp_file_.string()));
+  EXPECT_EQ(first.generation(), second.generation());
+
+  // Managers loading different user dictionaries never share a generation,
+  // even though each changed its set the same number of times
+  BinaryDictWriter writer;
+  DictionaryEntry entry;
+  entry.surface = "別";
+  entry.lemma = "別";
+  entry.pos = core::PartOfSpeech::Noun;
+  writer.addEntry(entry);
+  auto data = writer.build();
+  ASSERT_TRUE(data.hasValue());
+  ASSERT_TRUE(first.loadUserBinaryDictionaryFromMemory(data.value().data(), data.value().size()));
+  ASSERT_TRUE(second.loadUserBinaryDictionaryFromMemory(data.value().data(), data.value().size()));
+  EXPECT_NE(first.generation(), second.generation());
+}
+
+}  // namespace
+}  // namespace dictionary
+}  // namespace suzume
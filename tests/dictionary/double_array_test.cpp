@@ -147,6 +147,25 @@ TEST_F(DoubleArrayTest, CommonPrefixSearchNoMatch) {
   EXPECT_TRUE(results.empty());
 }
 
+TEST_F(DoubleArrayTest, FollowByteWalksKeys) {
+  std::vector<std::string> keys = {"a", "abc", "b"};
+  std::vector<uint32_t> values = {1, 2, 3};
+  EXPECT_TRUE(trie_.build(keys, values));
+
+  size_t node = 0;
+  ASSERT_TRUE(trie_.followByte(node, 'a'));
+  EXPECT_EQ(trie_.valueAt(node), 1);
+  ASSERT_TRUE(trie_.followByte(node, 'b'));
+  EXPECT_EQ(trie_.valueAt(node), -1);
+  ASSERT_TRUE(trie_.followByte(node, 'c'));
+  EXPECT_EQ(trie_.valueAt(node), 2);
+  EXPECT_FALSE(trie_.followByte(node, 'd'));
+
+  DoubleArray empty;
+  node = 0;
+  EXPECT_FALSE(empty.followByte(node, 'a'));
+}
+
 TEST_F(DoubleArrayTest, JapaneseText) {
   std::vector<std::string> keys = {
       "あ",      // Hiragana A
@@ -206,6 +225,31 @@ TEST_F(DoubleArrayTest, SerializeDeserialize) {
   EXPECT_EQ(trie2.exactMatch("c"), -1);
 }
 
+TEST_F(DoubleArrayTest, DeserializeViewReadsInPlace) {
+  std::vector<std::string> keys = {"食べる", "食べ物", "飲む"};
+  std::vector<uint32_t> values = {1, 2, 3};
+  EXPECT_TRUE(trie_.build(keys, values, DoubleArray::Labels::Codepoints));
+  auto data = trie_.serialize();
+
+  DoubleArray view;
+  ASSERT_TRUE(view.deserializeView(data.data(), data.size()));
+  EXPECT_EQ(view.exactMatch("食べ物"), 2);
+  EXPECT_EQ(view.exactMatch("飲む"), 3);
+
+  // A move keeps reading the same buffer
+  DoubleArray moved = std::move(view);
+  EXPECT_EQ(moved.exactMatch("食べる"), 1);
+  EXPECT_EQ(moved.size(), trie_.size());
+
+  // Misaligned data falls back to a copy
+  std::vector<uint8_t> shifted(data.size() + 1);
+  std::memcpy(shifted.data() + 1, data.data(), data.size());
+  DoubleArray copied;
+  ASSERT_TRUE(copied.deserializeView(shifted.data() + 1, data.size()));
+  shifted.assign(shifted.size(), 0);
+  EXPECT_EQ(copied.exactMatch("飲む"), 3);
+}
+
 TEST_F(DoubleArrayTest, DeserializeInvalidData) {
   DoubleArray trie2;
 
@@ -238,6 +282,64 @@ TEST_F(DoubleArrayTest, DeserializeFailurePreservesExistingTrie) {
   EXPECT_EQ(trie_.exactMatch("a"), 7);
 }
 
+TEST_F(DoubleArrayTest, CodepointLabelsMatchByteLabels) {
+  // Codepoints shared by several keys get labels; 駅 and ASCII stay on byte
+  // labels, as does the malformed byte
+  std::vector<std::string> keys = {"abc", "あ", "あい", "いい", "東", "東京", "東京都", "京都", "京都駅", "\xFF"};
+  std::sort(keys.begin(), keys.end());
+  std::vector<uint32_t> values(keys.size());
+  for (size_t idx = 0; idx < values.size(); ++idx) {
+    values[idx] = static_cast<uint32_t>(idx);
+  }
+
+  DoubleArray bytes;
+  ASSERT_TRUE(bytes.build(keys, values));
+  ASSERT_TRUE(trie_.build(keys, values, DoubleArray::Labels::Codepoints));
+  EXPECT_EQ(trie_.labels(), DoubleArray::Labels::Codepoints);
+  EXPECT_EQ(trie_.codepointLabelCount(), 5u);  // あ い 東 京 都
+
+  for (size_t idx = 0; idx < keys.size(); ++idx) {
+    EXPECT_EQ(trie_.exactMatch(keys[idx]), static_cast<int32_t>(values[idx])) << keys[idx];
+  }
+  EXPECT_EQ(trie_.exactMatch("東京駅"), -1);
+
+  for (std::string text : {"東京都庁", "京都駅前", "あいう", "abcd", "いいえ", "\xFFz"}) {
+    for (size_t start = 0; start < text.size(); ++start) {
+      auto expected = bytes.commonPrefixSearch(text, start);
+      auto actual = trie_.commonPrefixSearch(text, start);
+      ASSERT_EQ(actual.size(), expected.size()) << text << " @" << start;
+      for (size_t idx = 0; idx < expected.size(); ++idx) {
+        EXPECT_EQ(actual[idx].value, expected[idx].value);
+        EXPECT_EQ(actual[idx].length, expected[idx].length);
+      }
+    }
+  }
+}
+
+TEST_F(DoubleArrayTest, CodepointLabelsSerializeDeserialize) {
+  std::vector<std::string> keys = {"がく", "がくせい", "せい", "せいと"};
+  std::vector<uint32_t> values = {1, 2, 3, 4};
+  ASSERT_TRUE(trie_.build(keys, values, DoubleArray::Labels::Codepoints));
+
+  auto data = trie_.serialize();
+  EXPECT_EQ(data[3], '3');
+
+  DoubleArray trie2;
+  ASSERT_TRUE(trie2.deserialize(data.data(), data.size()));
+  EXPECT_EQ(trie2.labels(), DoubleArray::Labels::Codepoints);
+  EXPECT_EQ(trie2.codepointLabelCount(), trie_.codepointLabelCount());
+  EXPECT_EQ(trie2.exactMatch("がくせい"), 2);
+  auto results = trie2.commonPrefixSearch("せいとかい");
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_EQ(results[1].value, 4);
+  EXPECT_EQ(results[1].length, 9u);
+
+  // Label codepoints must be distinct and non-ASCII
+  std::vector<uint8_t> bad_labels = {'D', 'A', '0', '3', 0, 0, 0, 0, 1, 0, 0, 0, 'a', 0, 0, 0};
+  EXPECT_FALSE(trie2.deserialize(bad_labels.data(), bad_labels.size()));
+  EXPECT_EQ(trie2.exactMatch("がくせい"), 2);
+}
+
 TEST_F(DoubleArrayTest, Clear) {
   std::vector<std::string> keys = {"a", "b"};
   std::vector<uint32_t> values = {1, 2};
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "grammar/inflection.h"
 
 namespace suzume::grammar {
@@ -319,5 +321,28 @@ TEST_F(InflectionBasicTest, Desiderative_TakuNakatta) {
   EXPECT_EQ(result.verb_type, VerbType::Ichidan);
 }
 
+TEST(InflectionCacheTest, CapacityBoundsCache) {
+  Inflection inflection(10);
+  EXPECT_EQ(inflection.cacheCapacity(), Inflection::kMinCacheCapacity);  // Raised to the minimum
+
+  inflection.analyze("食べます");
+  size_t one_entry = inflection.cacheMemoryUsage();
+  EXPECT_GT(one_entry, 0u);
+
+  // analyze() never evicts, so earlier results stay valid past the capacity
+  const auto& held = inflection.analyze("食べます");
+  uint32_t generation = inflection.cacheGeneration();
+  for (size_t i = 0; i <= Inflection::kMinCacheCapacity; ++i) {
+    inflection.analyze(std::to_string(i) + "ます");
+  }
+  EXPECT_EQ(inflection.cacheGeneration(), generation);
+  ASSERT_FALSE(held.empty());
+  EXPECT_EQ(held[0].base_form, "食べる");
+
+  inflection.trimCache();
+  EXPECT_NE(inflection.cacheGeneration(), generation);
+  EXPECT_EQ(inflection.getBest("食べます").base_form, "食べる");
+}
+
 }  // namespace
 }  // namespace suzume::grammar
@@ -0,0 +1,146 @@
+#include "incremental_document.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "suzume.h"
+
+namespace suzume {
+namespace {
+
+class IncrementalDocumentTest : public ::testing::Test {
+ protected:
+  static SuzumeOptions makeTestOptions() {
+    SuzumeOptions opts;
+    opts.skip_user_dictionary = true;
+    return opts;
+  }
+
+  // Edited document must match a document built from scratch on the same text
+  void expectMatchesFresh(const IncrementalDocument& doc) {
+    IncrementalDocument fresh(suzume_);
+    fresh.setText(doc.text());
+    ASSERT_EQ(doc.sentenceCount(), fresh.sentenceCount());
+    EXPECT_EQ(doc.length(), fresh.length());
+    for (size_t i = 0; i < doc.sentenceCount(); ++i) {
+      EXPECT_EQ(doc.sentenceRange(i).start, fresh.sentenceRange(i).start);
+      EXPECT_EQ(doc.sentenceRange(i).end, fresh.sentenceRange(i).end);
+    }
+    auto actual = doc.morphemes();
+    auto expected = fresh.morphemes();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+      EXPECT_EQ(actual[i].surface, expected[i].surface);
+      EXPECT_EQ(actual[i].start, expected[i].start);
+      EXPECT_EQ(actual[i].end, expected[i].end);
+      EXPECT_EQ(actual[i].pos, expected[i].pos);
+    }
+  }
+
+  Suzume suzume_{makeTestOptions()};
+};
+
+TEST_F(IncrementalDocumentTest, SplitsSentencesLikeAnalyzer) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ。明日は雨！本当？");
+  ASSERT_EQ(doc.sentenceCount(), 3u);
+  EXPECT_EQ(doc.sentenceRange(0).start, 0u);
+  EXPECT_EQ(doc.sentenceRange(0).end, 6u);
+  EXPECT_EQ(doc.sentenceRange(1).start, 6u);
+  EXPECT_EQ(doc.sentenceRange(1).end, 11u);
+  EXPECT_EQ(doc.sentenceRange(2).end, 14u);
+  EXPECT_EQ(doc.length(), 14u);
+}
+
+TEST_F(IncrementalDocumentTest, MorphemeOffsetsAreDocumentRelative) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ。明日は雨。");
+  auto second = doc.sentenceMorphemes(1);
+  ASSERT_FALSE(second.empty());
+  EXPECT_EQ(second.front().start, 6u);
+  for (const auto& morpheme : second) {
+    EXPECT_GE(morpheme.start, 6u);
+    EXPECT_LE(morpheme.end, 11u);
+  }
+}
+
+TEST_F(IncrementalDocumentTest, EditInsideSentenceOnlyReanalyzesThatSentence) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ。明日は雨。昨日は雪。");
+  auto result = doc.applyEdit(9, 1, "曇り");
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), 1u);
+  EXPECT_EQ(doc.text(), "今日は晴れ。明日は曇り。昨日は雪。");
+  EXPECT_EQ(doc.sentenceRange(2).start, 12u);
+  expectMatchesFresh(doc);
+}
+
+TEST_F(IncrementalDocumentTest, DeletingBoundaryMergesSentences) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ。明日は雨。昨日は雪。");
+  auto result = doc.applyEdit(5, 1, "");
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(doc.sentenceCount(), 2u);
+  expectMatchesFresh(doc);
+}
+
+TEST_F(IncrementalDocumentTest, InsertingBoundarySplitsSentence) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ明日は雨。");
+  auto result = doc.applyEdit(5, 0, "。");
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), 2u);
+  EXPECT_EQ(doc.sentenceCount(), 2u);
+  expectMatchesFresh(doc);
+}
+
+TEST_F(IncrementalDocumentTest, EditSpanningSentences) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ。明日は雨。昨日は雪。");
+  ASSERT_TRUE(doc.applyEdit(3, 6, "").hasValue());
+  EXPECT_EQ(doc.text(), "今日は雨。昨日は雪。");
+  expectMatchesFresh(doc);
+}
+
+TEST_F(IncrementalDocumentTest, DeletingFirstSentenceShiftsRest) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ。明日は雨。");
+  auto result = doc.applyEdit(0, 6, "");
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), 0u);
+  ASSERT_EQ(doc.sentenceCount(), 1u);
+  EXPECT_EQ(doc.sentenceRange(0).start, 0u);
+  expectMatchesFresh(doc);
+}
+
+TEST_F(IncrementalDocumentTest, AppendAndEmptyDocument) {
+  IncrementalDocument doc(suzume_);
+  EXPECT_EQ(doc.sentenceCount(), 0u);
+  ASSERT_TRUE(doc.applyEdit(0, 0, "猫が").hasValue());
+  ASSERT_TRUE(doc.applyEdit(2, 0, "鳴いた。").hasValue());
+  ASSERT_TRUE(doc.applyEdit(doc.length(), 0, "犬も").hasValue());
+  EXPECT_EQ(doc.text(), "猫が鳴いた。犬も");
+  expectMatchesFresh(doc);
+
+  ASSERT_TRUE(doc.applyEdit(0, doc.length(), "").hasValue());
+  EXPECT_EQ(doc.sentenceCount(), 0u);
+  EXPECT_TRUE(doc.morphemes().empty());
+}
+
+TEST_F(IncrementalDocumentTest, RejectsInvalidEdits) {
+  IncrementalDocument doc(suzume_);
+  doc.setText("今日は晴れ。");
+  auto out_of_range = doc.applyEdit(5, 3, "");
+  ASSERT_FALSE(out_of_range.hasValue());
+  EXPECT_EQ(out_of_range.error().code, core::ErrorCode::InvalidInput);
+
+  auto bad_utf8 = doc.applyEdit(0, 0, "\xFF");
+  ASSERT_FALSE(bad_utf8.hasValue());
+  EXPECT_EQ(bad_utf8.error().code, core::ErrorCode::InvalidUtf8);
+  EXPECT_EQ(doc.text(), "今日は晴れ。");
+}
+
+}  // namespace
+}  // namespace suzume
@@ -1,11 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <string>
+#include <vector>
 
+#include "normalize/utf8.h"
 #include "suzume.h"
+#include "test_helpers.h"
 
 namespace suzume {
 namespace {
@@ -315,5 +321,365 @@ TEST_F(SuzumeApiTest, ScorerEnvWarningsCanBeReported) {
 #endif
 }
 
+TEST_F(SuzumeApiTest, SentenceCacheReportsHits) {
+  SuzumeOptions opts = makeTestOptions();
+  opts.sentence_cache_capacity = 8;
+  Suzume instance(opts);
+
+  auto first = instance.analyze("今日は晴れ。");
+  auto second = instance.analyze("今日は晴れ。");
+  ASSERT_EQ(first.size(), second.size());
+  for (size_t i = 0; i < first.size(); ++i) {
+    EXPECT_EQ(first[i].surface, second[i].surface);
+    EXPECT_EQ(first[i].lemma, second[i].lemma);
+  }
+
+  auto stats = instance.sentenceCacheStats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.entries, 1u);
+}
+
+TEST_F(SuzumeApiTest, SentenceCacheKeepsSegmentation) {
+  // Caching works on the same chunks as uncached analysis, so turning it on
+  // only changes speed
+  SuzumeOptions opts = makeTestOptions();
+  Suzume plain(opts);
+  opts.sentence_cache_capacity = 8;
+  Suzume cached(opts);
+  for (const char* input : {"今日は晴れ。明日は雨。", "東京に住んでいる。昨日は本を読みました。東京に住んでいる。"}) {
+    auto expected = plain.analyze(input);
+    for (int pass = 0; pass < 2; ++pass) {
+      auto result = cached.analyze(input);
+      ASSERT_EQ(result.size(), expected.size()) << input;
+      for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i].surface, expected[i].surface) << input;
+        EXPECT_EQ(result[i].start, expected[i].start) << input;
+      }
+    }
+  }
+}
+
+TEST_F(SuzumeApiTest, SentenceCacheDisabledByDefault) {
+  Suzume instance(makeTestOptions());
+  instance.analyze("今日は晴れ。");
+  EXPECT_EQ(instance.sentenceCacheStats().lookups, 0u);
+}
+
+TEST_F(SuzumeApiTest, StatsCountStagesAndReset) {
+  Suzume instance(makeTestOptions());
+  instance.analyze("今日は晴れ。");
+  instance.analyze("東京に行く");
+
+  auto stats = instance.stats();
+  EXPECT_EQ(stats.analyze_calls, 2u);
+  EXPECT_GT(stats.input_bytes, 0u);
+  EXPECT_GE(stats.chunks, 2u);
+  EXPECT_GT(stats.lattice_edges, 0u);
+  EXPECT_GE(stats.stage(core::AnalysisStage::LatticeBuild).calls, 2u);
+  EXPECT_GE(stats.stage(core::AnalysisStage::Viterbi).calls, 2u);
+  EXPECT_EQ(stats.stage(core::AnalysisStage::Postprocess).calls, 2u);
+  EXPECT_GT(stats.generator(core::GeneratorKind::Unknown).calls, 0u);
+  EXPECT_GT(stats.generator(core::GeneratorKind::Unknown).productive, 0u);
+  // No て/で in either input, so the te-form generator never runs
+  EXPECT_GT(stats.generator(core::GeneratorKind::TeFormAuxiliary).skipped, 0u);
+  EXPECT_EQ(stats.generator(core::GeneratorKind::TeFormAuxiliary).calls, 0u);
+  // Generator timing is opt-in
+  EXPECT_EQ(stats.generator(core::GeneratorKind::Unknown).nanoseconds, 0u);
+
+  instance.resetStats();
+  stats = instance.stats();
+  EXPECT_EQ(stats.analyze_calls, 0u);
+  EXPECT_EQ(stats.stage(core::AnalysisStage::Postprocess).calls, 0u);
+}
+
+TEST_F(SuzumeApiTest, StatsCountSentenceCacheHits) {
+  SuzumeOptions options = makeTestOptions();
+  options.sentence_cache_capacity = 8;
+  Suzume instance(options);
+  instance.analyze("今日は晴れ。");
+  instance.analyze("今日は晴れ。");
+
+  auto stats = instance.stats();
+  EXPECT_EQ(stats.cache_lookups, 2u);
+  EXPECT_EQ(stats.cache_hits, 1u);
+  EXPECT_DOUBLE_EQ(stats.cacheHitRate(), 0.5);
+}
+
+TEST_F(SuzumeApiTest, MemoryUsageBreaksDownComponents) {
+  SuzumeOptions opts = makeTestOptions();
+  opts.sentence_cache_capacity = 8;
+  Suzume instance(opts);
+
+  auto before = instance.memoryUsage();
+  EXPECT_GT(before.dictionary_entries, 0u);  // Builtin core dictionary
+  EXPECT_GT(before.tries, 0u);
+  EXPECT_EQ(before.sentence_cache, 0u);
+
+  instance.analyze("東京に住んでいる。昨日は本を読みました。");
+  auto after = instance.memoryUsage();
+  EXPECT_GT(after.inflection_cache, 0u);
+  EXPECT_GT(after.sentence_cache, 0u);
+  EXPECT_GT(after.scratch, 0u);
+  EXPECT_EQ(after.sentence_cache, instance.sentenceCacheStats().memory_bytes);
+  EXPECT_EQ(after.total(), after.dictionary_entries + after.tries + after.string_pools + after.inflection_cache +
+                               after.sentence_cache + after.scratch);
+  EXPECT_GT(after.total(), before.total());
+}
+
+TEST_F(SuzumeApiTest, SentenceCacheByteLimitIsApplied) {
+  SuzumeOptions opts = makeTestOptions();
+  opts.sentence_cache_capacity = 1000;
+  opts.sentence_cache_max_bytes = 4096;
+  Suzume instance(opts);
+  for (int i = 0; i < 50; ++i) {
+    instance.analyze("文" + std::to_string(i) + "番目の文を解析する。");
+  }
+  auto cache_stats = instance.sentenceCacheStats();
+  EXPECT_LE(cache_stats.memory_bytes, 4096u);
+  EXPECT_GT(cache_stats.evictions, 0u);
+}
+
+// Latency of these inputs is tracked by `suzume-cli test worst-case` (worst-case-latency target)
+TEST_F(SuzumeApiTest, EdgeBudgetsBoundPathologicalInput) {
+  SuzumeOptions opts = makeTestOptions();
+  opts.max_edges_per_position = 16;
+  opts.max_edges_per_chunk = 2000;
+  Suzume bounded(opts);
+
+  for (const auto& input : test::pathologicalInputs()) {
+    bounded.resetStats();
+    auto result = bounded.analyze(input);
+    size_t chars = normalize::utf8::decode(input).size();
+
+    // Degraded, but still covering the whole input
+    ASSERT_FALSE(result.empty());
+    EXPECT_EQ(result.back().end_pos, chars);
+    EXPECT_GT(bounded.stats().degraded_chunks, 0u) << input.substr(0, 30);
+    // Past the chunk limit a position gets a few dictionary edges or the fallback
+    EXPECT_LE(bounded.stats().lattice_edges, opts.max_edges_per_chunk + 2 * chars) << input.substr(0, 30);
+  }
+}
+
+TEST_F(SuzumeApiTest, EdgeBudgetsCapEmphaticDictionaryVariants) {
+  SuzumeOptions opts = makeTestOptions();
+  opts.max_edges_per_position = 1;
+  Suzume bounded(opts);
+
+  // Unbounded, です absorbs the whole sokuon run; the cap leaves no room for that variant
+  std::string input = "ですっっっ";
+  auto result = bounded.analyze(input);
+  ASSERT_FALSE(result.empty());
+  EXPECT_LT(result.front().end_pos, normalize::utf8::decode(input).size());
+  EXPECT_GT(bounded.stats().degraded_chunks, 0u);
+
+  Suzume unbounded(makeTestOptions());
+  auto whole = unbounded.analyze(input);
+  ASSERT_EQ(whole.size(), 1u);
+  EXPECT_EQ(unbounded.stats().degraded_chunks, 0u);
+}
+
+TEST_F(SuzumeApiTest, GenerousBudgetsLeaveResultsUnchanged) {
+  SuzumeOptions opts = makeTestOptions();
+  Suzume plain(opts);
+  opts.max_edges_per_position = 10000;
+  opts.max_edges_per_chunk = 1000000;
+  opts.deadline = std::chrono::seconds(60);
+  Suzume budgeted(opts);
+
+  for (const char* input : {"東京都に住んでいる", "毅然とした態度で食べ物の読み方を説明した", "シンプルすぎる"}) {
+    EXPECT_EQ(budgeted.analyze(input).size(), plain.analyze(input).size()) << input;
+  }
+  EXPECT_EQ(budgeted.stats().degraded_chunks, 0u);
+}
+
+TEST_F(SuzumeApiTest, DeadlineDegradesWithoutCaching) {
+  SuzumeOptions opts = makeTestOptions();
+  opts.sentence_cache_capacity = 8;
+  opts.deadline = std::chrono::microseconds(1);
+  Suzume instance(opts);
+
+  std::string text = test::pathologicalInputs()[0];
+  auto first = instance.analyze(text);
+  auto second = instance.analyze(text);
+  ASSERT_FALSE(first.empty());
+  EXPECT_EQ(first.back().end_pos, second.back().end_pos);
+
+  auto stats = instance.stats();
+  EXPECT_EQ(stats.degraded_chunks, 2u);
+  EXPECT_EQ(stats.cache_hits, 0u);  // Degraded results are not cached
+}
+
+// Sentences exercising the join generators that Split mode skips
+const char* const kGranularityInputs[] = {
+    "東京都に住んでいる",
+    "プールに飛び込む",
+    "お水をご確認ください",
+    "Web開発とAPIリクエストの未経験者",
+    "毅然とした態度で食べ物の読み方を説明した",
+    "やりなおしたいけどシンプルすぎる",
+    "人工知能研究所で3月に本買った",
+    "詳細は https://example.com/page を見てください。2024年1月15日まで",
+    "っ",
+};
+
+std::string joinSurfaces(const std::vector<core::Morpheme>& morphemes) {
+  std::string joined;
+  for (const auto& mor : morphemes) {
+    joined += mor.surface;
+    joined += '/';
+    joined += core::posToString(mor.pos);
+    joined += '/';
+    joined += mor.lemma;
+    joined += '@';
+    joined += std::to_string(mor.start_pos);
+    joined += ' ';
+  }
+  return joined;
+}
+
+void expectMultiGranularMatches(SuzumeOptions opts, core::AnalysisMode coarse_mode) {
+  Suzume multi(opts);
+  opts.mode = coarse_mode;
+  Suzume coarse(opts);
+  opts.mode = core::AnalysisMode::Split;
+  Suzume fine(opts);
+
+  for (const char* input : kGranularityInputs) {
+    auto result = multi.analyzeMultiGranular(input);
+    EXPECT_EQ(joinSurfaces(result.coarse), joinSurfaces(coarse.analyze(input))) << input;
+    EXPECT_EQ(joinSurfaces(result.fine), joinSurfaces(fine.analyze(input))) << input;
+  }
+}
+
+TEST_F(SuzumeApiTest, MultiGranularMatchesSeparateModes) {
+  SuzumeOptions opts = makeTestOptions();
+  expectMultiGranularMatches(opts, core::AnalysisMode::Normal);
+
+  opts.mode = core::AnalysisMode::Search;
+  expectMultiGranularMatches(opts, core::AnalysisMode::Search);
+
+  // Split-mode instances use Normal granularity for the coarse stream
+  opts.mode = core::AnalysisMode::Split;
+  expectMultiGranularMatches(opts, core::AnalysisMode::Normal);
+}
+
+TEST_F(SuzumeApiTest, MultiGranularBuildsOneLatticePerChunk) {
+  Suzume instance(makeTestOptions());
+  auto result = instance.analyzeMultiGranular("東京都に住んでいる");
+  EXPECT_FALSE(result.coarse.empty());
+  EXPECT_FALSE(result.fine.empty());
+  EXPECT_EQ(result.coarse.back().end_pos, result.fine.back().end_pos);
+
+  auto stats = instance.stats();
+  EXPECT_EQ(stats.analyze_calls, 1u);
+  EXPECT_EQ(stats.chunks, 1u);
+  EXPECT_EQ(stats.stage(core::AnalysisStage::Viterbi).calls, 1u);
+}
+
+TEST_F(SuzumeApiTest, MultiGranularUsesSentenceCache) {
+  SuzumeOptions opts = makeTestOptions();
+  opts.sentence_cache_capacity = 16;
+  expectMultiGranularMatches(opts, core::AnalysisMode::Normal);
+
+  Suzume instance(opts);
+  auto first = instance.analyzeMultiGranular("お水を飲む。");
+  auto second = instance.analyzeMultiGranular("お水を飲む。");
+  auto stats = instance.stats();
+  EXPECT_EQ(stats.chunks, 1u);
+  EXPECT_EQ(stats.cache_hits, 2u);  // Coarse and fine entries for the repeated text
+  EXPECT_EQ(joinSurfaces(first.fine), joinSurfaces(second.fine));
+
+  // A later single-mode analysis reuses the coarse entry
+  instance.resetStats();
+  instance.analyze("お水を飲む。");
+  EXPECT_EQ(instance.stats().cache_hits, 1u);
+}
+
+TEST_F(SuzumeApiTest, NBestStartsWithAnalyzeResult) {
+  Suzume instance(makeTestOptions());
+  for (const char* input : kGranularityInputs) {
+    auto paths = instance.analyzeNBest(input, 4);
+    ASSERT_FALSE(paths.empty()) << input;
+    EXPECT_LE(paths.size(), 4u);
+    EXPECT_EQ(joinSurfaces(paths[0].morphemes), joinSurfaces(instance.analyze(input))) << input;
+    for (size_t idx = 2; idx < paths.size(); ++idx) {
+      EXPECT_LE(paths[idx - 1].cost, paths[idx].cost) << input;
+    }
+  }
+}
+
+TEST_F(SuzumeApiTest, NBestReturnsDistinctAlternatives) {
+  Suzume instance(makeTestOptions());
+  auto paths = instance.analyzeNBest("東京都に住んでいる", 5);
+  ASSERT_GT(paths.size(), 1u);
+  for (size_t lhs = 0; lhs < paths.size(); ++lhs) {
+    EXPECT_EQ(paths[lhs].morphemes.back().end_pos, paths[0].morphemes.back().end_pos);
+    for (size_t rhs = lhs + 1; rhs < paths.size(); ++rhs) {
+      bool same = paths[lhs].morphemes.size() == paths[rhs].morphemes.size();
+      for (size_t idx = 0; same && idx < paths[lhs].morphemes.size(); ++idx) {
+        const auto& left = paths[lhs].morphemes[idx];
+        const auto& right = paths[rhs].morphemes[idx];
+        same = left.surface == right.surface && left.pos == right.pos && left.lemma == right.lemma;
+      }
+      EXPECT_FALSE(same) << lhs << " vs " << rhs;
+    }
+  }
+
+  EXPECT_TRUE(instance.analyzeNBest("東京都に住んでいる", 0).empty());
+  EXPECT_TRUE(instance.analyzeNBest("", 5).empty());
+}
+
+TEST_F(SuzumeApiTest, NBestKeepsPretokensInEveryPath) {
+  Suzume instance(makeTestOptions());
+  auto paths = instance.analyzeNBest("詳細はhttps://example.com/を見てください", 3);
+  ASSERT_FALSE(paths.empty());
+  for (const auto& path : paths) {
+    bool has_url = std::any_of(path.morphemes.begin(), path.morphemes.end(),
+                               [](const core::Morpheme& mor) { return mor.surface == "https://example.com/"; });
+    EXPECT_TRUE(has_url) << joinSurfaces(path.morphemes);
+  }
+}
+
+TEST_F(SuzumeApiTest, TermFrequenciesMatchTags) {
+  Suzume instance(makeTestOptions());
+  const std::string text = "東京で買った本を東京の友達に送った";
+
+  postprocess::TermFrequencies table;
+  instance.termFrequencies(text, table);
+  auto tags = instance.generateTags(text);
+  ASSERT_EQ(table.counts().size(), tags.size());
+  for (size_t idx = 0; idx < tags.size(); ++idx) {
+    EXPECT_EQ(table.term(table.counts()[idx].id), tags[idx].tag);
+  }
+  uint32_t tokyo = 0;
+  ASSERT_TRUE(table.find("東京", tokyo));
+  EXPECT_EQ(table.countOf(tokyo), 2u);
+
+  // Reuse for another document: counts reset, IDs stay
+  instance.termFrequencies("東京", table);
+  ASSERT_EQ(table.counts().size(), 1u);
+  EXPECT_EQ(table.counts()[0].id, tokyo);
+  EXPECT_EQ(table.counts()[0].count, 1u);
+}
+
+TEST_F(SuzumeApiTest, TermFrequenciesReuseBufferAcrossDocuments) {
+  Suzume instance(makeTestOptions());
+  // Long and short documents alternate so the reused buffer both grows and shrinks;
+  // the numerals and prolonged marks exercise the merging postprocess passes
+  const std::vector<std::string> texts = {"東京で買った本を東京の友達に送った", "猫", "3億5000万円の予算で3時間会議した",
+                                          "すごーーい食べものだ", "東京"};
+  postprocess::TermFrequencies table;
+  for (int round = 0; round < 2; ++round) {
+    for (const auto& text : texts) {
+      instance.termFrequencies(text, table);
+      auto tags = instance.generateTags(text);
+      ASSERT_EQ(table.counts().size(), tags.size()) << text;
+      for (size_t idx = 0; idx < tags.size(); ++idx) {
+        EXPECT_EQ(table.term(table.counts()[idx].id), tags[idx].tag) << text;
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace suzume
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstring>
+#include <string>
 
 #include "suzume_c.h"
 
@@ -110,6 +111,7 @@ TEST(SuzumeCApiTest, LayoutFunctionsMatchNativeStructs) {
   EXPECT_EQ(suzume_sizeof_tags(), sizeof(suzume_tags_t));
   EXPECT_EQ(suzume_sizeof_tag_options(), sizeof(suzume_tag_options_t));
   EXPECT_EQ(suzume_sizeof_extended_options(), sizeof(suzume_extended_options_t));
+  EXPECT_EQ(suzume_sizeof_stats(), sizeof(suzume_stats_t));
 
   EXPECT_EQ(suzume_offsetof_result(0), offsetof(suzume_result_t, morphemes));
   EXPECT_EQ(suzume_offsetof_result(1), offsetof(suzume_result_t, count));
@@ -119,8 +121,132 @@ TEST(SuzumeCApiTest, LayoutFunctionsMatchNativeStructs) {
   EXPECT_EQ(suzume_offsetof_extended_options(0), offsetof(suzume_extended_options_t, size));
   EXPECT_EQ(suzume_offsetof_extended_options(4), offsetof(suzume_extended_options_t, mode));
   EXPECT_EQ(suzume_offsetof_extended_options(6), offsetof(suzume_extended_options_t, merge_compounds));
+  EXPECT_EQ(suzume_offsetof_extended_options(9), offsetof(suzume_extended_options_t, deadline_us));
+  EXPECT_EQ(suzume_offsetof_extended_options(10), offsetof(suzume_extended_options_t, inflection_cache_size));
+  EXPECT_EQ(suzume_sizeof_memory_usage(), sizeof(suzume_memory_usage_t));
   EXPECT_EQ(suzume_offsetof_result(99), static_cast<size_t>(-1));
   EXPECT_EQ(suzume_offsetof_extended_options(99), static_cast<size_t>(-1));
 }
 
+TEST(SuzumeCApiTest, GetStatsReportsCountersAndResets) {
+  suzume_t handle = suzume_create();
+  ASSERT_NE(handle, nullptr);
+
+  suzume_result_t* result = suzume_analyze(handle, "東京に行く");
+  ASSERT_NE(result, nullptr);
+  suzume_result_free(result);
+
+  suzume_stats_t stats{};
+  stats.size = sizeof(stats);
+  ASSERT_EQ(suzume_get_stats(handle, &stats), 1);
+  EXPECT_EQ(stats.analyze_calls, 1u);
+  EXPECT_GT(stats.lattice_edges, 0u);
+  EXPECT_EQ(stats.stage_calls[4], 1u);
+  EXPECT_STREQ(suzume_stats_stage_name(4), "postprocess");
+  EXPECT_STREQ(suzume_stats_generator_name(0), "dictionary");
+  EXPECT_EQ(suzume_stats_stage_name(SUZUME_STATS_STAGE_COUNT), nullptr);
+  EXPECT_EQ(suzume_stats_generator_name(SUZUME_STATS_GENERATOR_COUNT), nullptr);
+
+  suzume_reset_stats(handle);
+  ASSERT_EQ(suzume_get_stats(handle, &stats), 1);
+  EXPECT_EQ(stats.analyze_calls, 0u);
+
+  suzume_destroy(handle);
+}
+
+TEST(SuzumeCApiTest, DeadlineIsReportedAsDegraded) {
+  suzume_extended_options_t options{};
+  suzume_init_extended_options(&options);
+  options.deadline_us = 1;
+  suzume_t handle = suzume_create_with_extended_options(&options);
+  ASSERT_NE(handle, nullptr);
+
+  std::string text;
+  for (int i = 0; i < 200; ++i) {
+    text += "あいうえおかきくけこ";
+  }
+  suzume_result_t* result = suzume_analyze(handle, text.c_str());
+  ASSERT_NE(result, nullptr);
+  EXPECT_GT(result->count, 0u);
+  suzume_result_free(result);
+
+  suzume_stats_t stats{};
+  stats.size = sizeof(stats);
+  ASSERT_EQ(suzume_get_stats(handle, &stats), 1);
+  EXPECT_GT(stats.degraded_chunks, 0u);
+
+  suzume_destroy(handle);
+}
+
+TEST(SuzumeCApiTest, GetMemoryUsageReportsComponents) {
+  suzume_t handle = suzume_create();
+  ASSERT_NE(handle, nullptr);
+  suzume_result_free(suzume_analyze(handle, "東京に行きました"));
+
+  suzume_memory_usage_t usage{};
+  usage.size = sizeof(usage);
+  ASSERT_EQ(suzume_get_memory_usage(handle, &usage), 1);
+  EXPECT_GT(usage.dictionary_entries, 0u);
+  EXPECT_GT(usage.inflection_cache, 0u);
+  EXPECT_EQ(usage.total, usage.dictionary_entries + usage.tries + usage.string_pools + usage.inflection_cache +
+                             usage.sentence_cache + usage.scratch);
+
+  usage.size = 0;
+  EXPECT_EQ(suzume_get_memory_usage(handle, &usage), 0);
+  EXPECT_EQ(suzume_get_memory_usage(nullptr, &usage), 0);
+
+  suzume_destroy(handle);
+}
+
+TEST(SuzumeCApiTest, GetStatsHonorsCallerSize) {
+  suzume_t handle = suzume_create();
+  ASSERT_NE(handle, nullptr);
+  suzume_result_free(suzume_analyze(handle, "東京"));
+
+  // A caller built against an older, shorter struct
+  suzume_stats_t stats{};
+  std::memset(&stats, 0xAB, sizeof(stats));
+  stats.size = static_cast<uint32_t>(offsetof(suzume_stats_t, input_bytes));
+  ASSERT_EQ(suzume_get_stats(handle, &stats), 1);
+  EXPECT_EQ(stats.analyze_calls, 1u);
+  EXPECT_EQ(stats.input_bytes, 0xABABABABABABABABULL);
+
+  stats.size = 0;
+  EXPECT_EQ(suzume_get_stats(handle, &stats), 0);
+  EXPECT_EQ(suzume_get_stats(nullptr, &stats), 0);
+  suzume_reset_stats(nullptr);
+
+  suzume_destroy(handle);
+}
+
+TEST(SuzumeCApiTest, AnalyzeSerialized) {
+  suzume_t handle = suzume_create();
+  ASSERT_NE(handle, nullptr);
+
+  size_t length = 0;
+  char* tsv = suzume_analyze_serialized(handle, "東京", SUZUME_FORMAT_TSV, &length);
+  ASSERT_NE(tsv, nullptr);
+  EXPECT_EQ(std::strlen(tsv), length);
+  EXPECT_EQ(std::string(tsv, length), "東京\tNOUN\t東京\t0\t2\n");
+  suzume_free(tsv);
+
+  char* json = suzume_analyze_serialized(handle, "東京", SUZUME_FORMAT_JSON, nullptr);
+  ASSERT_NE(json, nullptr);
+  EXPECT_STREQ(json, R"([{"surface":"東京","pos":"NOUN","lemma":"東京","start":0,"end":2}])");
+  suzume_free(json);
+
+  char* binary = suzume_analyze_serialized(handle, "東京", SUZUME_FORMAT_BINARY, &length);
+  ASSERT_NE(binary, nullptr);
+  EXPECT_GT(length, 2u);
+  EXPECT_EQ(binary[0], 1);  // Format version
+  EXPECT_EQ(binary[1], 1);  // Morpheme count
+  suzume_free(binary);
+
+  EXPECT_EQ(suzume_analyze_serialized(handle, "東京", 99, &length), nullptr);
+  EXPECT_NE(std::string(suzume_last_error()).find("unknown format"), std::string::npos);
+  EXPECT_EQ(suzume_analyze_serialized(nullptr, "東京", SUZUME_FORMAT_TSV, &length), nullptr);
+
+  suzume_destroy(handle);
+}
+
 }  // namespace
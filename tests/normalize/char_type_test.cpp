@@ -588,6 +588,41 @@ TEST(CharTypeTest, IsCounterKanjiFalse) {
   EXPECT_FALSE(isCounterKanji(U'A'));
 }
 
+// ============================================================================
+// Lookup table tests
+// ============================================================================
+
+TEST(CharTypeTest, ClassifyRangeBoundaries) {
+  // Earlier ranges win where they overlap later ones
+  EXPECT_EQ(classifyChar(0x3005), CharType::Kanji);  // 々 inside CJK Symbols
+  EXPECT_EQ(classifyChar(0x3004), CharType::Symbol);
+  EXPECT_EQ(classifyChar(0x303F), CharType::Symbol);
+  EXPECT_EQ(classifyChar(0x303F + 1), CharType::Hiragana);
+  EXPECT_EQ(classifyChar(0xFF65), CharType::Unknown);
+  EXPECT_EQ(classifyChar(0xFF66), CharType::Katakana);
+  EXPECT_EQ(classifyChar(0xFF9F), CharType::Katakana);
+  EXPECT_EQ(classifyChar(0x4DC0), CharType::Unknown);
+  EXPECT_EQ(classifyChar(0x1F), CharType::Unknown);
+  EXPECT_EQ(classifyChar(0xFFFF), CharType::Unknown);
+
+  // Supplementary planes
+  EXPECT_EQ(classifyChar(0x10000), CharType::Unknown);
+  EXPECT_EQ(classifyChar(0x20000), CharType::Kanji);
+  EXPECT_EQ(classifyChar(0x1F600), CharType::Emoji);
+  EXPECT_EQ(classifyChar(0xE0020), CharType::Emoji);
+  EXPECT_EQ(classifyChar(0x10FFFF), CharType::Unknown);
+}
+
+TEST(CharTypeTest, CharTypeBitsAreDistinct) {
+  uint32_t seen = 0;
+  for (uint8_t idx = 0; idx <= static_cast<uint8_t>(CharType::Unknown); ++idx) {
+    uint8_t bit = charTypeBit(static_cast<CharType>(idx));
+    EXPECT_EQ(seen & bit, 0u);
+    seen |= bit;
+  }
+  EXPECT_EQ(seen, 0xFFu);
+}
+
 }  // namespace
 }  // namespace normalize
 }  // namespace suzume
@@ -0,0 +1,86 @@
+#include "postprocess/lemmatizer.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "dictionary/binary_dict.h"
+
+namespace suzume {
+namespace postprocess {
+namespace {
+
+core::Morpheme makeVerb(const std::string& surface, core::LemmaSource source) {
+  core::Morpheme mor;
+  mor.surface = surface;
+  mor.lemma = surface;
+  mor.pos = core::PartOfSpeech::Verb;
+  mor.lemma_source = source;
+  return mor;
+}
+
+TEST(LemmatizerTest, DefaultedLemmaIsDerived) {
+  Lemmatizer lemmatizer;
+  std::vector<core::Morpheme> morphemes = {makeVerb("食べた", core::LemmaSource::Unknown)};
+  lemmatizer.lemmatizeAll(morphemes);
+  EXPECT_EQ(morphemes[0].lemma, "食べる");
+}
+
+TEST(LemmatizerTest, LatticeLemmaIsKept) {
+  // A lemma verified during candidate generation is not re-derived, even
+  // when it equals the surface
+  Lemmatizer lemmatizer;
+  std::vector<core::Morpheme> morphemes = {makeVerb("食べた", core::LemmaSource::Candidate),
+                                           makeVerb("食べた", core::LemmaSource::Dictionary)};
+  lemmatizer.lemmatizeAll(morphemes);
+  EXPECT_EQ(morphemes[0].lemma, "食べた");
+  EXPECT_EQ(morphemes[1].lemma, "食べた");
+}
+
+TEST(LemmatizerTest, SharedInflectionGivesSameLemmas) {
+  grammar::Inflection inflection;
+  Lemmatizer shared(nullptr, &inflection);
+  Lemmatizer owned;
+  for (const char* surface : {"書いて", "読みました", "泳いだ", "走らない", "食べさせる"}) {
+    core::Morpheme mor = makeVerb(surface, core::LemmaSource::Unknown);
+    EXPECT_EQ(shared.lemmatize(mor), owned.lemmatize(mor)) << surface;
+  }
+}
+
+TEST(LemmatizerTest, LongerAdjectiveEndingWins) {
+  // くなかった must take precedence over the shorter かった ending
+  Lemmatizer lemmatizer;
+  core::Morpheme adj;
+  adj.surface = "高くなかった";
+  adj.lemma = adj.surface;
+  adj.pos = core::PartOfSpeech::Adjective;
+  EXPECT_EQ(lemmatizer.lemmatize(adj), "高い");
+}
+
+TEST(LemmatizerTest, ConjugationIndexResolvesLemma) {
+  // 来た is ambiguous for inflection analysis (来る / 来す ...); the index settles it
+  dictionary::BinaryDictWriter writer;
+  dictionary::DictionaryEntry entry;
+  entry.surface = "来";
+  entry.lemma = "来る";
+  entry.pos = core::PartOfSpeech::Verb;
+  writer.addEntry(entry);
+  writer.addConjugatedSurface("来た", {"来る", core::PartOfSpeech::Verb, core::ExtendedPOS::VerbRenyokei,
+                                       dictionary::ConjugationType::Kuru});
+  auto data = writer.build();
+  ASSERT_TRUE(data.hasValue());
+  dictionary::DictionaryManager manager;
+  ASSERT_TRUE(manager.loadUserBinaryDictionaryFromMemory(data.value().data(), data.value().size()));
+
+  Lemmatizer lemmatizer(&manager);
+  EXPECT_EQ(lemmatizer.lemmatize(makeVerb("来た", core::LemmaSource::Unknown)), "来る");
+
+  // POS and conjugation type hints must agree with the index
+  core::Morpheme adj = makeVerb("来た", core::LemmaSource::Unknown);
+  adj.pos = core::PartOfSpeech::Adjective;
+  EXPECT_NE(lemmatizer.lemmatize(adj), "来る");
+}
+
+}  // namespace
+}  // namespace postprocess
+}  // namespace suzume
@@ -501,6 +501,37 @@ TEST(TagGeneratorTest, PosFilterAndExcludeBasicCombined) {
   EXPECT_EQ(tags[1].tag, "食べる");
 }
 
+TEST(TagGeneratorTest, ForEachTermKeepsRepeatsAndOffsets) {
+  TagGeneratorOptions options;
+  options.max_tags = 1;  // Only limits generate()
+  TagGenerator generator(options);
+
+  std::vector<core::Morpheme> morphemes;
+  morphemes.push_back(makeMorpheme("東京", core::PartOfSpeech::Noun));
+  morphemes.push_back(makeMorpheme("と", core::PartOfSpeech::Particle));
+  morphemes.push_back(makeMorpheme("東京", core::PartOfSpeech::Noun));
+  for (size_t idx = 0, pos = 0; idx < morphemes.size(); ++idx) {
+    morphemes[idx].start = pos;
+    pos += morphemes[idx].surface == "と" ? 1 : 2;
+    morphemes[idx].end = pos;
+  }
+
+  struct Collector : TermSink {
+    std::vector<TermView> terms;
+    void onTerm(const TermView& term) override { terms.push_back(term); }
+  } collector;
+  generator.forEachTerm(morphemes, collector);
+
+  ASSERT_EQ(collector.terms.size(), 2u);
+  EXPECT_EQ(collector.terms[0].term, "東京");
+  EXPECT_EQ(collector.terms[0].start, 0u);
+  EXPECT_EQ(collector.terms[1].term, "東京");
+  EXPECT_EQ(collector.terms[1].start, 3u);
+  EXPECT_EQ(collector.terms[1].end, 5u);
+  EXPECT_EQ(collector.terms[1].pos, core::PartOfSpeech::Noun);
+  EXPECT_EQ(generator.generate(morphemes).size(), 1u);
+}
+
 }  // namespace
 }  // namespace postprocess
 }  // namespace suzume
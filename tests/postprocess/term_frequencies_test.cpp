@@ -0,0 +1,63 @@
+#include "postprocess/term_frequencies.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace suzume {
+namespace postprocess {
+namespace {
+
+TEST(TermFrequenciesTest, CountsInFirstOccurrenceOrder) {
+  TermFrequencies table;
+  uint32_t tokyo = table.add("東京", core::PartOfSpeech::Noun);
+  uint32_t iku = table.add("行く", core::PartOfSpeech::Verb);
+  EXPECT_EQ(table.add("東京", core::PartOfSpeech::Noun), tokyo);
+  EXPECT_NE(tokyo, iku);
+
+  ASSERT_EQ(table.counts().size(), 2u);
+  EXPECT_EQ(table.counts()[0].id, tokyo);
+  EXPECT_EQ(table.counts()[0].count, 2u);
+  EXPECT_EQ(table.counts()[1].id, iku);
+  EXPECT_EQ(table.counts()[1].count, 1u);
+  EXPECT_EQ(table.counts()[1].pos, core::PartOfSpeech::Verb);
+  EXPECT_EQ(table.term(tokyo), "東京");
+  EXPECT_EQ(table.countOf(tokyo), 2u);
+}
+
+TEST(TermFrequenciesTest, ClearCountsKeepsInternedIds) {
+  TermFrequencies table;
+  uint32_t tokyo = table.add("東京", core::PartOfSpeech::Noun);
+  table.add("大阪", core::PartOfSpeech::Noun);
+  table.clearCounts();
+
+  EXPECT_TRUE(table.counts().empty());
+  EXPECT_EQ(table.countOf(tokyo), 0u);
+  EXPECT_EQ(table.termCount(), 2u);
+
+  uint32_t found = 0;
+  ASSERT_TRUE(table.find("東京", found));
+  EXPECT_EQ(found, tokyo);
+  EXPECT_FALSE(table.find("京都", found));
+  EXPECT_EQ(table.add("東京", core::PartOfSpeech::Noun), tokyo);
+  EXPECT_EQ(table.countOf(tokyo), 1u);
+}
+
+TEST(TermFrequenciesTest, GrowsPastInitialCapacity) {
+  TermFrequencies table;
+  for (int idx = 0; idx < 5000; ++idx) {
+    EXPECT_EQ(table.add("term" + std::to_string(idx), core::PartOfSpeech::Noun), static_cast<uint32_t>(idx));
+  }
+  EXPECT_EQ(table.termCount(), 5000u);
+  for (int idx = 0; idx < 5000; idx += 499) {
+    uint32_t id = 0;
+    ASSERT_TRUE(table.find("term" + std::to_string(idx), id));
+    EXPECT_EQ(table.term(id), "term" + std::to_string(idx));
+  }
+  EXPECT_EQ(table.add("", core::PartOfSpeech::Noun), 5000u);
+  EXPECT_EQ(table.term(5000), "");
+}
+
+}  // namespace
+}  // namespace postprocess
+}  // namespace suzume
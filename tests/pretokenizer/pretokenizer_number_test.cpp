@@ -399,5 +399,25 @@ TEST_F(PreTokenizerNumberTest, NoMatch_PlainNumber) {
   EXPECT_FALSE(result.spans.empty());
 }
 
+TEST_F(PreTokenizerNumberTest, MatchAddress_FoldsFullwidthDigits) {
+  auto result = pretokenizer_.process("１-２３-4番地");
+  ASSERT_GE(result.tokens.size(), 1u);
+  EXPECT_EQ(result.tokens[0].type, PreTokenType::Number);
+  EXPECT_EQ(result.tokens[0].surface, "1-23-4");
+  EXPECT_EQ(result.tokens[0].end, std::string("１-２３-4").size());
+}
+
+TEST_F(PreTokenizerNumberTest, MatchTime_RejectsOutOfRangeValues) {
+  auto result = pretokenizer_.process("25時");
+  for (const auto& token : result.tokens) {
+    EXPECT_NE(token.type, PreTokenType::Time);
+  }
+
+  result = pretokenizer_.process("１２時６０分");
+  ASSERT_EQ(result.tokens.size(), 1u);
+  EXPECT_EQ(result.tokens[0].type, PreTokenType::Time);
+  EXPECT_EQ(result.tokens[0].surface, "１２時");
+}
+
 }  // namespace
 }  // namespace suzume::pretokenizer
@@ -483,5 +483,52 @@ TEST_F(PreTokenizerTextTest, NoMatch_PlainNumber) {
   EXPECT_FALSE(result.spans.empty());
 }
 
+// ===== Skip-scan Tests =====
+
+TEST_F(PreTokenizerTextTest, SkipScan_BoundaryAtEveryOffset) {
+  // Kana/kanji runs are skipped in blocks; a boundary must be found at any alignment
+  const std::string filler = "日本語のテキストミーティング";
+  for (size_t chars = 0; chars <= 14; ++chars) {
+    std::string prefix;
+    size_t byte_pos = 0;
+    for (size_t idx = 0; idx < chars; ++idx) {
+      size_t len = (static_cast<unsigned char>(filler[byte_pos]) >= 0xE0) ? 3 : 1;
+      prefix += filler.substr(byte_pos, len);
+      byte_pos += len;
+    }
+    std::string text = prefix + "。" + filler + filler + "・" + filler;
+    auto result = pretokenizer_.process(text);
+
+    ASSERT_EQ(result.tokens.size(), 2u) << "prefix chars: " << chars;
+    EXPECT_EQ(result.tokens[0].surface, "。");
+    EXPECT_EQ(result.tokens[0].start, prefix.size());
+    EXPECT_EQ(result.tokens[1].surface, "・");
+    EXPECT_EQ(result.spans.back().end, text.size());
+  }
+}
+
+TEST_F(PreTokenizerTextTest, SkipScan_NoTriggersYieldsSingleSpan) {
+  // ミ (E3 83 9F) and ー (E3 83 BC) share lead bytes with ・ but are not boundaries
+  std::string text;
+  for (int idx = 0; idx < 20; ++idx) {
+    text += "ミーティングの資料を確認する";
+  }
+  auto result = pretokenizer_.process(text);
+  EXPECT_TRUE(result.tokens.empty());
+  ASSERT_EQ(result.spans.size(), 1u);
+  EXPECT_EQ(result.spans[0].start, 0u);
+  EXPECT_EQ(result.spans[0].end, text.size());
+}
+
+TEST_F(PreTokenizerTextTest, SkipScan_FullwidthTriggersAfterLongRun) {
+  std::string text = "今日はとても良い天気でしたので散歩に行きました２０２４年１月＃タグ";
+  auto result = pretokenizer_.process(text);
+  ASSERT_EQ(result.tokens.size(), 2u);
+  EXPECT_EQ(result.tokens[0].type, PreTokenType::Date);
+  EXPECT_EQ(result.tokens[0].surface, "２０２４年１月");
+  EXPECT_EQ(result.tokens[1].type, PreTokenType::Hashtag);
+  EXPECT_EQ(result.tokens[1].surface, "＃タグ");
+}
+
 }  // namespace
 }  // namespace suzume::pretokenizer
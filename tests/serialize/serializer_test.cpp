@@ -0,0 +1,190 @@
+#include "serialize/serializer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace suzume {
+namespace serialize {
+namespace {
+
+core::Morpheme makeMorpheme(const std::string& surface, core::PartOfSpeech pos, const std::string& lemma,
+                            size_t start, size_t end) {
+  core::Morpheme mor;
+  mor.surface = surface;
+  mor.pos = pos;
+  mor.lemma = lemma;
+  mor.start = start;
+  mor.end = end;
+  mor.syncPositions();
+  return mor;
+}
+
+std::vector<core::Morpheme> sampleMorphemes() {
+  return {makeMorpheme("東京", core::PartOfSpeech::Noun, "東京", 0, 2),
+          makeMorpheme("に", core::PartOfSpeech::Particle, "に", 2, 3)};
+}
+
+std::string escape(std::string_view value) {
+  OutputBuffer out;
+  appendJsonEscaped(out, value);
+  return out.release();
+}
+
+TEST(SerializerTest, JsonEscapeSpecialBytes) {
+  EXPECT_EQ(escape("a\"b\\c"), "a\\\"b\\\\c");
+  EXPECT_EQ(escape("line\nnext\tend\r"), "line\\nnext\\tend\\r");
+  EXPECT_EQ(escape(std::string("\x01\x1f", 2)), "\\u0001\\u001f");
+  EXPECT_EQ(escape(std::string("\0", 1)), "\\u0000");
+  EXPECT_EQ(escape("日本語"), "日本語");
+  EXPECT_EQ(escape("\x7f"), "\x7f");
+  EXPECT_EQ(escape(""), "");
+}
+
+TEST(SerializerTest, JsonEscapeAcrossBlockBoundaries) {
+  // Special bytes at every offset around the 16-byte scan blocks
+  for (size_t offset = 0; offset < 40; ++offset) {
+    std::string input(offset, 'x');
+    input += '"';
+    input += std::string(20, 'y');
+    std::string expected(offset, 'x');
+    expected += "\\\"";
+    expected += std::string(20, 'y');
+    EXPECT_EQ(escape(input), expected) << "offset " << offset;
+  }
+
+  std::string utf8_run;
+  for (int idx = 0; idx < 12; ++idx) {
+    utf8_run += "東";
+  }
+  EXPECT_EQ(escape(utf8_run + "\n" + utf8_run), utf8_run + "\\n" + utf8_run);
+}
+
+TEST(SerializerTest, MorphemeLinesAndTsv) {
+  OutputBuffer out;
+  writeMorphemeLines(out, sampleMorphemes());
+  EXPECT_EQ(out.view(), "東京\tNOUN\t東京\nに\tPARTICLE\tに\n");
+
+  out.clear();
+  writeTsv(out, sampleMorphemes());
+  EXPECT_EQ(out.view(), "東京\tNOUN\t東京\t0\t2\nに\tPARTICLE\tに\t2\t3\n");
+}
+
+TEST(SerializerTest, JsonArrayAndDocument) {
+  auto morphemes = sampleMorphemes();
+  morphemes[0].surface = "a\"b";
+
+  OutputBuffer out;
+  writeJsonArray(out, morphemes);
+  EXPECT_EQ(out.view(),
+            R"([{"surface":"a\"b","pos":"NOUN","lemma":"東京","start":0,"end":2},)"
+            R"({"surface":"に","pos":"PARTICLE","lemma":"に","start":2,"end":3}])");
+
+  out.clear();
+  writeJsonArray(out, {});
+  EXPECT_EQ(out.view(), "[]");
+
+  out.clear();
+  writeJsonDocument(out, "東京に", sampleMorphemes());
+  EXPECT_EQ(out.view(),
+            "{\n  \"input\": \"東京に\",\n  \"morphemes\": [\n"
+            "    {\"surface\": \"東京\", \"pos\": \"NOUN\", \"lemma\": \"東京\"},\n"
+            "    {\"surface\": \"に\", \"pos\": \"PARTICLE\", \"lemma\": \"に\"}\n"
+            "  ]\n}\n");
+}
+
+TEST(SerializerTest, ChasenEndsWithEos) {
+  OutputBuffer out;
+  writeChasen(out, sampleMorphemes());
+  EXPECT_EQ(out.view(), "東京\t*\t東京\t名詞\t*\t*\nに\t*\tに\t助詞\t*\t*\nEOS\n");
+
+  out.clear();
+  writeChasen(out, {});
+  EXPECT_EQ(out.view(), "EOS\n");
+}
+
+TEST(SerializerTest, BinaryRoundTrip) {
+  auto morphemes = sampleMorphemes();
+  morphemes.push_back(makeMorpheme("行く", core::PartOfSpeech::Verb, "行く", 3, 5));
+  morphemes[0].features.is_dictionary = true;
+  morphemes[0].syncPositions();
+  morphemes[1].is_unknown = true;
+  morphemes[2].conj_type = dictionary::ConjugationType::GodanKa;
+  morphemes[2].conj_form = grammar::ConjForm::Renyokei;
+  morphemes[2].extended_pos = core::ExtendedPOS::VerbShuushikei;
+
+  OutputBuffer out;
+  writeBinary(out, morphemes);
+  out.append("trailing");
+
+  std::vector<core::Morpheme> decoded;
+  auto consumed = readBinary(out.view(), decoded);
+  ASSERT_TRUE(consumed.hasValue()) << consumed.error().message;
+  EXPECT_EQ(consumed.value(), out.size() - 8);
+  ASSERT_EQ(decoded.size(), morphemes.size());
+  for (size_t idx = 0; idx < morphemes.size(); ++idx) {
+    EXPECT_EQ(decoded[idx].surface, morphemes[idx].surface);
+    EXPECT_EQ(decoded[idx].lemma, morphemes[idx].lemma);
+    EXPECT_EQ(decoded[idx].pos, morphemes[idx].pos);
+    EXPECT_EQ(decoded[idx].extended_pos, morphemes[idx].extended_pos);
+    EXPECT_EQ(decoded[idx].conj_type, morphemes[idx].conj_type);
+    EXPECT_EQ(decoded[idx].conj_form, morphemes[idx].conj_form);
+    EXPECT_EQ(decoded[idx].start_pos, morphemes[idx].start);
+    EXPECT_EQ(decoded[idx].end_pos, morphemes[idx].end);
+    EXPECT_EQ(decoded[idx].is_unknown, morphemes[idx].is_unknown);
+    EXPECT_EQ(decoded[idx].is_from_dictionary, morphemes[idx].features.is_dictionary);
+  }
+}
+
+TEST(SerializerTest, BinaryRejectsMalformedInput) {
+  OutputBuffer out;
+  writeBinary(out, sampleMorphemes());
+  std::string encoded = out.release();
+
+  std::vector<core::Morpheme> decoded;
+  EXPECT_FALSE(readBinary("", decoded).hasValue());
+  EXPECT_FALSE(readBinary(std::string("\x02\x00", 2), decoded).hasValue());
+  for (size_t len = 1; len < encoded.size(); ++len) {
+    EXPECT_FALSE(readBinary(std::string_view(encoded).substr(0, len), decoded).hasValue()) << "length " << len;
+  }
+
+  // Huge count with no payload
+  EXPECT_FALSE(readBinary(std::string("\x01\xff\xff\xff\x0f", 5), decoded).hasValue());
+
+  // Out-of-range part of speech
+  std::string bad_pos = encoded;
+  bad_pos[4] = static_cast<char>(0xff);
+  EXPECT_FALSE(readBinary(bad_pos, decoded).hasValue());
+
+  // Out-of-range conjugation type and form
+  for (size_t offset : {6, 7}) {
+    std::string bad_conj = encoded;
+    bad_conj[offset] = static_cast<char>(0x7f);
+    EXPECT_FALSE(readBinary(bad_conj, decoded).hasValue()) << "offset " << offset;
+  }
+}
+
+TEST(SerializerTest, SerializeDispatchesByFormat) {
+  OutputBuffer direct;
+  writeTsv(direct, sampleMorphemes());
+  OutputBuffer dispatched;
+  serialize(dispatched, SerialFormat::Tsv, sampleMorphemes());
+  EXPECT_EQ(dispatched.view(), direct.view());
+}
+
+TEST(OutputBufferTest, IntegersAndVarints) {
+  OutputBuffer out;
+  out.appendUInt(0);
+  out.append(' ');
+  out.appendUInt(18446744073709551615ULL);
+  EXPECT_EQ(out.view(), "0 18446744073709551615");
+
+  out.clear();
+  out.appendVarint(300);
+  EXPECT_EQ(out.view(), std::string("\xac\x02", 2));
+}
+
+}  // namespace
+}  // namespace serialize
+}  // namespace suzume
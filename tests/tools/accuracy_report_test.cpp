@@ -0,0 +1,148 @@
+#include "accuracy_report.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace suzume::test {
+namespace {
+
+CaseResult makeCase(const std::string& file, bool passed, double latency_us, size_t chars, uint64_t edges) {
+  CaseResult result;
+  result.file = file;
+  result.passed = passed;
+  result.latency_us = latency_us;
+  result.chars = chars;
+  result.edges = edges;
+  return result;
+}
+
+const GroupMetrics* findGroup(const std::vector<GroupMetrics>& groups, const std::string& name) {
+  for (const auto& group : groups) {
+    if (group.name == name) {
+      return &group;
+    }
+  }
+  return nullptr;
+}
+
+TEST(AccuracyReportTest, CategoryIsFilePrefix) {
+  EXPECT_EQ(categoryOf("verb_ichidan.json"), "verb");
+  EXPECT_EQ(categoryOf("adverb.json"), "adverb");
+}
+
+TEST(AccuracyReportTest, PercentileUsesNearestRank) {
+  std::vector<double> values;
+  for (int idx = 100; idx >= 1; --idx) {
+    values.push_back(idx);
+  }
+  EXPECT_DOUBLE_EQ(percentile(values, 50.0), 50.0);
+  EXPECT_DOUBLE_EQ(percentile(values, 99.0), 99.0);
+  EXPECT_DOUBLE_EQ(percentile({7.0}, 99.0), 7.0);
+  EXPECT_DOUBLE_EQ(percentile({}, 50.0), 0.0);
+}
+
+TEST(AccuracyReportTest, AggregatesByFileAndCategory) {
+  std::vector<CaseResult> results = {makeCase("verb_a.json", true, 10.0, 4, 40),
+                                     makeCase("verb_b.json", false, 30.0, 6, 30),
+                                     makeCase("noun.json", true, 20.0, 10, 50)};
+  auto groups = aggregate(results, 40.0);
+  ASSERT_EQ(groups.front().name, "total");
+  EXPECT_EQ(groups.front().cases, 3U);
+  EXPECT_EQ(groups.front().passed, 2U);
+  EXPECT_DOUBLE_EQ(groups.front().relative_p50, 0.5);
+
+  const GroupMetrics* verb = findGroup(groups, "category:verb");
+  ASSERT_NE(verb, nullptr);
+  EXPECT_EQ(verb->cases, 2U);
+  EXPECT_EQ(verb->failed(), 1U);
+  EXPECT_DOUBLE_EQ(verb->edges_per_char, 7.0);
+  EXPECT_DOUBLE_EQ(verb->p50_us, 10.0);
+  EXPECT_DOUBLE_EQ(verb->relative_p50, 0.25);
+  EXPECT_NE(findGroup(groups, "file:verb_b.json"), nullptr);
+}
+
+TEST(AccuracyReportTest, BaselineRoundTrips) {
+  auto groups =
+      aggregate({makeCase("verb_a.json", true, 12.5, 4, 40), makeCase("noun.json", false, 20.0, 10, 55)}, 50.0);
+  auto parsed = parseBaseline(formatBaseline(groups));
+  ASSERT_EQ(parsed.size(), groups.size());
+  for (size_t idx = 0; idx < groups.size(); ++idx) {
+    EXPECT_EQ(parsed[idx].name, groups[idx].name);
+    EXPECT_EQ(parsed[idx].cases, groups[idx].cases);
+    EXPECT_EQ(parsed[idx].passed, groups[idx].passed);
+    EXPECT_NEAR(parsed[idx].p50_us, groups[idx].p50_us, 0.01);
+    EXPECT_NEAR(parsed[idx].relative_p99, groups[idx].relative_p99, 0.0001);
+    EXPECT_NEAR(parsed[idx].edges_per_char, groups[idx].edges_per_char, 0.0001);
+  }
+  EXPECT_THROW(parseBaseline("{\"version\": 1}"), std::runtime_error);
+
+  // Relative latency of version 1 (against the run's own total) is not comparable
+  auto old = parseBaseline(R"({"version": 1, "groups": [{"name": "total", "relative_p50": 1.0}]})");
+  ASSERT_EQ(old.size(), 1U);
+  EXPECT_DOUBLE_EQ(old[0].relative_p50, 0.0);
+  EXPECT_THROW(parseBaseline("{\"groups\": [{\"cases\": 1}]}"), std::runtime_error);
+}
+
+TEST(AccuracyReportTest, FasterGroupDoesNotMoveOthers) {
+  std::vector<CaseResult> before = {makeCase("verb.json", true, 10.0, 4, 40), makeCase("noun.json", true, 20.0, 4, 40),
+                                    makeCase("noun.json", true, 20.0, 4, 40)};
+  std::vector<CaseResult> after = before;
+  after[1].latency_us = 2.0;
+  after[2].latency_us = 2.0;
+  EXPECT_DOUBLE_EQ(findGroup(aggregate(before, 40.0), "file:verb.json")->relative_p50,
+                   findGroup(aggregate(after, 40.0), "file:verb.json")->relative_p50);
+}
+
+TEST(AccuracyReportTest, DetectsRegressions) {
+  GroupMetrics base;
+  base.name = "category:verb";
+  base.cases = 120;
+  base.passed = 120;
+  base.relative_p50 = 1.0;
+  base.relative_p99 = 1.0;
+  base.edges_per_char = 10.0;
+
+  // New passing cases and small drift are not regressions
+  GroupMetrics current = base;
+  current.cases = 125;
+  current.passed = 125;
+  current.relative_p50 = 1.2;
+  current.edges_per_char = 10.4;
+  Tolerances tolerances;
+  EXPECT_TRUE(compareToBaseline({current}, {base}, tolerances).empty());
+
+  current.passed = 124;
+  current.relative_p99 = 1.5;
+  current.edges_per_char = 11.0;
+  auto regressions = compareToBaseline({current}, {base}, tolerances);
+  ASSERT_EQ(regressions.size(), 3U);
+  EXPECT_EQ(regressions[0].metric, "failed");
+  EXPECT_EQ(regressions[1].metric, "edges_per_char");
+  EXPECT_EQ(regressions[2].metric, "relative_p99");
+  EXPECT_FALSE(regressions[0].warning);
+  EXPECT_FALSE(regressions[1].warning);
+
+  // Latency only warns unless gated
+  EXPECT_TRUE(regressions[2].warning);
+  tolerances.gate_latency = true;
+  EXPECT_FALSE(compareToBaseline({current}, {base}, tolerances)[2].warning);
+
+  // p99 of mid-sized groups and all latency of small groups is not compared
+  current.cases = 50;
+  current.passed = 50;
+  base.cases = 50;
+  base.passed = 50;
+  current.relative_p50 = base.relative_p50;
+  current.edges_per_char = base.edges_per_char;
+  EXPECT_TRUE(compareToBaseline({current}, {base}, tolerances).empty());
+  current.relative_p50 = 2.0;
+  current.cases = 10;
+  current.passed = 10;
+  base.cases = 10;
+  base.passed = 10;
+  EXPECT_TRUE(compareToBaseline({current}, {base}, tolerances).empty());
+}
+
+}  // namespace
+}  // namespace suzume::test
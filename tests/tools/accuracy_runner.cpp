@@ -0,0 +1,328 @@
+// Data-driven accuracy runner with per-case latency reporting.
+//
+// Runs every case in tests/data/tokenization (or the given files/directories)
+// across worker threads, one Suzume instance per thread, and reports accuracy,
+// p50/p99 latency and lattice edges per character per file and per category.
+// With --baseline, exits non-zero when a group loses accuracy or generates
+// more edges than a stored report; latency growth is reported as a warning
+// (a failure with --gate-latency). --write-baseline stores the current report.
+//
+// Run from the project root:
+//   build/bin/suzume_accuracy --jobs 4 --baseline tests/data/accuracy_baseline.json
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "accuracy_report.h"
+#include "json_loader.h"
+#include "normalize/utf8.h"
+#include "suzume.h"
+#include "test_case.h"
+
+namespace fs = std::filesystem;
+
+namespace suzume::test {
+namespace {
+
+struct RunnerOptions {
+  size_t jobs{0};    // 0 = hardware concurrency
+  size_t repeat{5};  // Passes over all cases; the fastest time per case is reported
+  std::string baseline;
+  std::string write_baseline;
+  Tolerances tolerances;
+  bool verbose{false};
+  std::vector<std::string> paths;
+};
+
+struct LoadedCase {
+  std::string file;
+  TestCase test_case;
+};
+
+void printUsage() {
+  std::cerr << "Usage: suzume_accuracy [options] [file.json|dir ...]\n"
+               "  -j, --jobs N               Worker threads (default: hardware concurrency)\n"
+               "  --repeat N                 Passes over all cases, fastest time is kept (default: 5)\n"
+               "  --baseline PATH            Compare against a stored report; exit 1 on regression\n"
+               "  --write-baseline PATH      Store the current report\n"
+               "  --latency-tolerance F      Allowed relative p50/p99 growth (default: 0.25)\n"
+               "  --edges-tolerance F        Allowed edges-per-char growth (default: 0.05)\n"
+               "  --gate-latency             Fail on latency growth instead of warning\n"
+               "  -v, --verbose              List failing cases\n"
+               "Paths default to tests/data/tokenization.\n";
+}
+
+bool parseArgs(int argc, char** argv, RunnerOptions& options) {
+  for (int idx = 1; idx < argc; ++idx) {
+    std::string arg = argv[idx];
+    bool has_value = idx + 1 < argc;
+    if ((arg == "-j" || arg == "--jobs") && has_value) {
+      options.jobs = std::strtoul(argv[++idx], nullptr, 10);
+    } else if (arg == "--repeat" && has_value) {
+      options.repeat = std::max<size_t>(1, std::strtoul(argv[++idx], nullptr, 10));
+    } else if (arg == "--baseline" && has_value) {
+      options.baseline = argv[++idx];
+    } else if (arg == "--write-baseline" && has_value) {
+      options.write_baseline = argv[++idx];
+    } else if (arg == "--latency-tolerance" && has_value) {
+      options.tolerances.latency = std::strtod(argv[++idx], nullptr);
+    } else if (arg == "--edges-tolerance" && has_value) {
+      options.tolerances.edges = std::strtod(argv[++idx], nullptr);
+    } else if (arg == "--gate-latency") {
+      options.tolerances.gate_latency = true;
+    } else if (arg == "-v" || arg == "--verbose") {
+      options.verbose = true;
+    } else if (arg == "-h" || arg == "--help" || arg.rfind('-', 0) == 0) {
+      return false;
+    } else {
+      options.paths.push_back(arg);
+    }
+  }
+  if (options.paths.empty()) {
+    options.paths.emplace_back("tests/data/tokenization");
+  }
+  if (options.jobs == 0) {
+    options.jobs = std::max(1U, std::thread::hardware_concurrency());
+  }
+  return true;
+}
+
+std::vector<LoadedCase> loadCases(const std::vector<std::string>& paths) {
+  std::vector<fs::path> files;
+  for (const auto& path : paths) {
+    if (fs::is_directory(path)) {
+      for (const auto& entry : fs::directory_iterator(path)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".json") {
+          files.push_back(entry.path());
+        }
+      }
+    } else {
+      files.emplace_back(path);
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  std::vector<LoadedCase> cases;
+  for (const auto& file : files) {
+    try {
+      auto suite = JsonLoader::loadFromFile(file.string());
+      for (auto& test_case : suite.cases) {
+        cases.push_back({file.filename().string(), std::move(test_case)});
+      }
+    } catch (const std::exception& e) {
+      std::cerr << "Warning: Failed to load " << file << ": " << e.what() << "\n";
+    }
+  }
+  return cases;
+}
+
+// Fixed CPU and allocation work that does not touch the analyzer, timed to
+// express latency in machine-independent units. Its result is returned so
+// the work cannot be optimized away.
+size_t referenceWorkload() {
+  std::vector<std::string> keys;
+  keys.reserve(20000);
+  uint32_t state = 12345;
+  for (size_t idx = 0; idx < 20000; ++idx) {
+    state = state * 1103515245U + 12345U;
+    keys.push_back("key" + std::to_string(state % 100000));
+  }
+  std::sort(keys.begin(), keys.end());
+  std::unordered_map<std::string, size_t> counts;
+  for (const auto& key : keys) {
+    ++counts[key];
+  }
+  return counts.size();
+}
+
+// Same checks as the universal tokenization test
+bool matches(const std::vector<core::Morpheme>& result, const std::vector<ExpectedMorpheme>& expected) {
+  if (result.size() != expected.size()) {
+    return false;
+  }
+  for (size_t idx = 0; idx < expected.size(); ++idx) {
+    if (result[idx].surface != expected[idx].surface) {
+      return false;
+    }
+    if (!expected[idx].pos.empty() && result[idx].pos != expected[idx].posEnum()) {
+      return false;
+    }
+    if (!expected[idx].lemma.empty() && result[idx].lemma != expected[idx].lemma) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Each pass hands cases out through a shared index so slow files do not pin
+// one thread. Repeats are whole passes rather than back-to-back calls, so a
+// burst of machine noise cannot hit every sample of the same case.
+std::vector<CaseResult> runCases(const std::vector<LoadedCase>& cases, const RunnerOptions& options,
+                                 double& reference_us) {
+  std::vector<CaseResult> results(cases.size());
+  for (size_t idx = 0; idx < cases.size(); ++idx) {
+    results[idx].file = cases[idx].file;
+    results[idx].id = cases[idx].test_case.id;
+    results[idx].chars = normalize::utf8Length(cases[idx].test_case.input);
+  }
+
+  SuzumeOptions suzume_options;
+  suzume_options.skip_user_dictionary = true;
+  std::vector<std::unique_ptr<Suzume>> analyzers;
+  for (size_t idx = 0; idx < options.jobs; ++idx) {
+    analyzers.push_back(std::make_unique<Suzume>(suzume_options));
+    analyzers.back()->analyze(cases.front().test_case.input);  // Warm up dictionaries and caches
+  }
+
+  // The reference workload is timed once per pass, under the same load as
+  // the cases, and the fastest time is kept like theirs
+  reference_us = 0.0;
+  size_t reference_checksum = 0;
+  for (size_t pass = 0; pass < options.repeat; ++pass) {
+    auto reference_start = std::chrono::steady_clock::now();
+    reference_checksum += referenceWorkload();
+    std::chrono::duration<double, std::micro> reference_elapsed = std::chrono::steady_clock::now() - reference_start;
+    reference_us = pass == 0 ? reference_elapsed.count() : std::min(reference_us, reference_elapsed.count());
+
+    std::atomic<size_t> next{0};
+    auto worker = [&](Suzume& analyzer) {
+      for (size_t idx = next.fetch_add(1); idx < cases.size(); idx = next.fetch_add(1)) {
+        const TestCase& test_case = cases[idx].test_case;
+        CaseResult& result = results[idx];
+
+        uint64_t edges_before = analyzer.stats().lattice_edges;
+        auto start = std::chrono::steady_clock::now();
+        auto morphemes = analyzer.analyze(test_case.input);
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (pass == 0) {
+          result.edges = analyzer.stats().lattice_edges - edges_before;
+          result.passed = matches(morphemes, test_case.getTestExpected());
+          result.latency_us = elapsed.count();
+        } else {
+          result.latency_us = std::min(result.latency_us, elapsed.count());
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t idx = 1; idx < options.jobs; ++idx) {
+      threads.emplace_back(worker, std::ref(*analyzers[idx]));
+    }
+    worker(*analyzers[0]);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  if (reference_checksum == 0) {
+    reference_us = 0.0;
+  }
+  return results;
+}
+
+void printReport(const std::vector<GroupMetrics>& groups) {
+  std::printf("%-48s %6s %8s %10s %10s %10s\n", "group", "cases", "acc%", "p50(us)", "p99(us)", "edges/ch");
+  for (const GroupMetrics& group : groups) {
+    std::printf("%-48s %6zu %8.2f %10.1f %10.1f %10.2f\n", group.name.c_str(), group.cases, group.accuracy() * 100.0,
+                group.p50_us, group.p99_us, group.edges_per_char);
+  }
+}
+
+bool readFile(const std::string& path, std::string& out) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  out = buffer.str();
+  return true;
+}
+
+int run(int argc, char** argv) {
+  RunnerOptions options;
+  if (!parseArgs(argc, argv, options)) {
+    printUsage();
+    return 2;
+  }
+
+  auto cases = loadCases(options.paths);
+  if (cases.empty()) {
+    std::cerr << "No test cases found (run from the project root)\n";
+    return 2;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  double reference_us = 0.0;
+  auto results = runCases(cases, options, reference_us);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  auto groups = aggregate(results, reference_us);
+  printReport(groups);
+  std::printf("\n%zu cases, %zu threads, %.2fs, reference workload %.1f us\n", cases.size(), options.jobs,
+              elapsed.count(), reference_us);
+
+  if (options.verbose) {
+    for (const CaseResult& result : results) {
+      if (!result.passed) {
+        std::printf("FAIL %s/%s\n", result.file.c_str(), result.id.c_str());
+      }
+    }
+  }
+
+  if (!options.write_baseline.empty()) {
+    std::ofstream out(options.write_baseline);
+    out << formatBaseline(groups);
+    if (!out) {
+      std::cerr << "Cannot write baseline: " << options.write_baseline << "\n";
+      return 2;
+    }
+    std::printf("Baseline written to %s\n", options.write_baseline.c_str());
+  }
+
+  if (options.baseline.empty()) {
+    return groups.front().failed() == 0 ? 0 : 1;
+  }
+
+  std::string json;
+  if (!readFile(options.baseline, json)) {
+    std::cerr << "Cannot open baseline: " << options.baseline << "\n";
+    return 2;
+  }
+  std::vector<GroupMetrics> baseline;
+  try {
+    baseline = parseBaseline(json);
+  } catch (const std::exception& e) {
+    std::cerr << "Invalid baseline " << options.baseline << ": " << e.what() << "\n";
+    return 2;
+  }
+
+  auto regressions = compareToBaseline(groups, baseline, options.tolerances);
+  size_t failures = 0;
+  for (const Regression& regression : regressions) {
+    std::printf("%s %s %s: %.4f -> %.4f\n", regression.warning ? "WARNING" : "REGRESSION", regression.group.c_str(),
+                regression.metric.c_str(), regression.baseline, regression.current);
+    failures += regression.warning ? 0 : 1;
+  }
+  std::printf("%zu regression(s), %zu latency warning(s) against %s\n", failures, regressions.size() - failures,
+              options.baseline.c_str());
+  return failures == 0 ? 0 : 1;
+}
+
+}  // namespace
+}  // namespace suzume::test
+
+int main(int argc, char** argv) { return suzume::test::run(argc, argv); }
@@ -0,0 +1,24 @@
+# Runs `suzume-cli test startup --budget-us=BUDGET_US` in up to ATTEMPTS fresh
+# processes and passes as soon as one is within budget, so a single run
+# slowed down by other load on the machine does not fail the test.
+#
+# cmake -DSUZUME_CLI=<path> -DBUDGET_US=<us> [-DATTEMPTS=3] -P startup_budget.cmake
+
+if(NOT DEFINED ATTEMPTS)
+  set(ATTEMPTS 3)
+endif()
+
+foreach(attempt RANGE 1 ${ATTEMPTS})
+  execute_process(
+    COMMAND ${SUZUME_CLI} test startup --budget-us=${BUDGET_US}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE error
+  )
+  message(STATUS "Attempt ${attempt}:\n${output}${error}")
+  if(result EQUAL 0)
+    return()
+  endif()
+endforeach()
+
+message(FATAL_ERROR "Startup exceeded ${BUDGET_US} us in all ${ATTEMPTS} attempts")